@@ -15,6 +15,16 @@
 #ifndef __GPIO_CONFIG_H__
 #define __GPIO_CONFIG_H__
 
+/**
+ * @brief Core cycles the parallel bus functions hold WR low, as NOP instructions between the store that pulls WR
+ * low and the store that releases it.
+ *
+ * The two stores alone keep WR low about 2 core cycles, 28 ns at 72 MHz: under the 30 ns minimum WR low time of the
+ * ILI9481 (tWRL). With 2 NOPs WR stays low at least 3 core cycles, 42 ns at 72 MHz, a 12 ns margin. These figures
+ * come from the instruction and APB2 bridge timings: check WR on a logic analyser after changing the core clock, the
+ * compiler or its options. 0 removes the hold, e.g. with the core at 36 MHz or less.
+ */
+#define GPIO_WR_HOLD_NOPS			2
 
 
 
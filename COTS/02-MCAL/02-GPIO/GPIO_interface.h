@@ -145,4 +145,106 @@ void GPIO_SetPinValue(u8 Copy_PORT,u8 Copy_PIN, u8 Copy_Value);
  */
 u8  GPIO_GetPinValue(u8 Copy_PORT, u8 Copy_PIN);
 
+/**
+ * @brief Sets and clears several pins of a port in one store.
+ *
+ * The masks are written to the bit set/reset register: the pins of Copy_SetMask go high and those of Copy_ResetMask
+ * go low at the same time, the other pins keep their level. Nothing is read back, so the write cannot be corrupted
+ * by an interrupt changing other pins of the port, and it takes a few cycles whatever the number of pins.
+ *
+ * @param[in] Copy_PORT The port: GPIO_PORTA, GPIO_PORTB or GPIO_PORTC.
+ * @param[in] Copy_SetMask The pins to drive high, bit n for pin n.
+ * @param[in] Copy_ResetMask The pins to drive low, bit n for pin n. A pin in both masks goes high.
+ *
+ * @retval None
+ *
+ * @note The pins must already be configured as outputs. Nothing is written for an unknown port.
+ *
+ * @par Example:
+ *      To drive pins 0 and 2 of port A high and pin 1 low, the following code can be used:
+ *      @code
+ *      GPIO_SetPortBits(GPIO_PORTA, 0x0005, 0x0002);
+ *      @endcode
+ */
+void GPIO_SetPortBits(u8 Copy_PORT, u16 Copy_SetMask, u16 Copy_ResetMask);
+
+/**
+ * @brief Writes 16-bit words to a parallel bus, strobing a write pin for each word.
+ *
+ * This function drives an 8080-style parallel bus: the 16 pins of the data port carry one word, and the strobe pin
+ * (WR, active low) is pulsed low then high for every word, the peripheral latching the data on the rising edge. The
+ * word is written to the output data register of the data port in one store and the strobe is driven through the
+ * bit reset and bit set/reset registers, so no read-modify-write happens inside the loop.
+ *
+ * @param[in] Copy_DataPORT The port whose 16 pins are the data bus: GPIO_PORTA, GPIO_PORTB or GPIO_PORTC. The whole port is written, so it must be dedicated to the bus.
+ * @param[in] Copy_StrobePORT The port of the strobe pin, different from the data port.
+ * @param[in] Copy_StrobePIN The strobe pin: GPIO_PIN0 to GPIO_PIN15. It must be high before the call and is left high.
+ * @param[in] Copy_Words Pointer to the words to write, D0 in bit 0.
+ * @param[in] Copy_Count The number of words.
+ *
+ * @retval None
+ *
+ * @note The pins must already be configured as push-pull outputs. Nothing is written for an unknown port or pin.
+ *
+ * @note WR is held low GPIO_WR_HOLD_NOPS core cycles between its two stores (GPIO_config.h), for the minimum WR low
+ * time of the peripheral (30 ns for the ILI9481); the config gives the margin.
+ *
+ * @note The bus runs as fast as the loop, about 10 core cycles per word (140 ns at 72 MHz) and 8 for
+ * @ref GPIO_WriteParallelRepeated16 (110 ns); check it against the write cycle time of the peripheral (100 ns for the
+ * ILI9481) when the core clock is raised or the loop changed. Against 16 SPI clocks per word (890 ns at 18 MHz,
+ * 440 ns at 36 MHz) that makes pixel streams about 3 to 6 times faster and fills 4 to 8 times, not 16 times: the loop,
+ * not the strobe, sets the pace.
+ *
+ * @par Example:
+ *      To send a row of RGB565 pixels on port B with WR on pin 8 of port A, the following code can be used:
+ *      @code
+ *      GPIO_WriteParallel16(GPIO_PORTB, GPIO_PORTA, GPIO_PIN8, RowPixels, 480);
+ *      @endcode
+ */
+void GPIO_WriteParallel16(u8 Copy_DataPORT, u8 Copy_StrobePORT, u8 Copy_StrobePIN, const u16 *Copy_Words, u32 Copy_Count);
+
+/**
+ * @brief Writes the same 16-bit word to a parallel bus a number of times.
+ *
+ * This is the fill counterpart of @ref GPIO_WriteParallel16: the word is written to the data port once, then only the
+ * strobe pin is pulsed, once per word.
+ *
+ * @param[in] Copy_DataPORT The port whose 16 pins are the data bus: GPIO_PORTA, GPIO_PORTB or GPIO_PORTC.
+ * @param[in] Copy_StrobePORT The port of the strobe pin, different from the data port.
+ * @param[in] Copy_StrobePIN The strobe pin: GPIO_PIN0 to GPIO_PIN15.
+ * @param[in] Copy_Word The word to write.
+ * @param[in] Copy_Count The number of times the word is written.
+ *
+ * @retval None
+ *
+ * @par Example:
+ *      To send 480 * 320 black pixels, the following code can be used:
+ *      @code
+ *      GPIO_WriteParallelRepeated16(GPIO_PORTB, GPIO_PORTA, GPIO_PIN8, 0x0000, 480UL * 320UL);
+ *      @endcode
+ */
+void GPIO_WriteParallelRepeated16(u8 Copy_DataPORT, u8 Copy_StrobePORT, u8 Copy_StrobePIN, u16 Copy_Word, u32 Copy_Count);
+
+/**
+ * @brief Writes bytes to a parallel bus, one bus cycle per byte.
+ *
+ * Same as @ref GPIO_WriteParallel16 with each byte on D0-D7 and the upper pins of the data port low, e.g. for the
+ * command and parameter bytes of a display controller on a 16-bit bus.
+ *
+ * @param[in] Copy_DataPORT The port whose pins are the data bus: GPIO_PORTA, GPIO_PORTB or GPIO_PORTC.
+ * @param[in] Copy_StrobePORT The port of the strobe pin, different from the data port.
+ * @param[in] Copy_StrobePIN The strobe pin: GPIO_PIN0 to GPIO_PIN15.
+ * @param[in] Copy_Bytes Pointer to the bytes to write.
+ * @param[in] Copy_Count The number of bytes.
+ *
+ * @retval None
+ *
+ * @par Example:
+ *      To send the four parameter bytes of a column address command, the following code can be used:
+ *      @code
+ *      GPIO_WriteParallel8(GPIO_PORTB, GPIO_PORTA, GPIO_PIN8, Columns, 4);
+ *      @endcode
+ */
+void GPIO_WriteParallel8(u8 Copy_DataPORT, u8 Copy_StrobePORT, u8 Copy_StrobePIN, const u8 *Copy_Bytes, u32 Copy_Count);
+
 #endif /**< __GPIO_INTERFACE_H__ */
@@ -46,6 +46,39 @@
 #define GPIOC_BRR_R			*((volatile u32 *)(GPIOC_BASE_ADDRESS + 0x14))   	/**< PORT C BIT RESET REGISTER */
 #define GPIOC_LCK_R	    	*((volatile u32 *)(GPIOC_BASE_ADDRESS + 0x18))  	/**< PORT C CONFIGURATION LOCK REGISTER */
 
+/**
+ * @brief GPIO Register Map.
+ *
+ * The same registers as the macros above, as one struct per port, for the parallel bus functions which keep
+ * the registers of their two ports in pointers for the whole transfer.
+ */
+typedef struct
+{
+	volatile u32 CRL;		/**< Configuration Register Low. */
+	volatile u32 CRH;		/**< Configuration Register High. */
+	volatile u32 IDR;		/**< Input Data Register. */
+	volatile u32 ODR;		/**< Output Data Register. */
+	volatile u32 BSRR;		/**< Bit Set/Reset Register. */
+	volatile u32 BRR;		/**< Bit Reset Register. */
+	volatile u32 LCKR;		/**< Configuration Lock Register. */
+} GPIO_RegDef_t;
+
+/**
+ * @brief Get the register map of a port.
+ *
+ * @param[in] Copy_PORT The port: GPIO_PORTA, GPIO_PORTB or GPIO_PORTC.
+ *
+ * @return The register map of the port, or NULL for an unknown port.
+ */
+static GPIO_RegDef_t *GPIO_GetRegisters(u8 Copy_PORT);
+
+/**
+ * @brief Hold WR low for GPIO_WR_HOLD_NOPS core cycles (GPIO_config.h).
+ */
+#define GPIO_WR_HOLD()				__asm volatile (".rept " GPIO_Str(GPIO_WR_HOLD_NOPS) "\n\tnop\n\t.endr")
+#define GPIO_Str(NUM)				GPIO_Str_Help(NUM)
+#define GPIO_Str_Help(NUM)			#NUM
+
 
 
 #endif /**< __GPIO_PRIVATE_H__ */
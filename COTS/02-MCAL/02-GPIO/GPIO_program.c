@@ -160,3 +160,99 @@ u8  MGPIO_u8GetPinValue(u8 Copy_PORT, u8 Copy_PIN)
 	}
 	return Local_u8ReturnPinValue;
 }
+
+void GPIO_SetPortBits(u8 Copy_PORT, u16 Copy_SetMask, u16 Copy_ResetMask)
+{
+	GPIO_RegDef_t *Local_Registers = GPIO_GetRegisters(Copy_PORT);
+
+	if(Local_Registers != NULL)
+	{
+		/**< Upper half resets, lower half sets; set wins when a pin is in both */
+		Local_Registers->BSRR = ((u32)Copy_ResetMask << 16) | Copy_SetMask;
+	}
+	else
+	{
+		/**< RETURN ERROR STATUS */
+	}
+}
+
+void GPIO_WriteParallel16(u8 Copy_DataPORT, u8 Copy_StrobePORT, u8 Copy_StrobePIN, const u16 *Copy_Words, u32 Copy_Count)
+{
+	GPIO_RegDef_t *Local_Data = GPIO_GetRegisters(Copy_DataPORT);
+	GPIO_RegDef_t *Local_Strobe = GPIO_GetRegisters(Copy_StrobePORT);
+	u32 Local_StrobeMask = 1UL << Copy_StrobePIN;
+
+	if((Local_Data != NULL) && (Local_Strobe != NULL) && (Copy_StrobePIN < 16))
+	{
+		while(Copy_Count-- > 0)
+		{
+			/**< Put the word on the bus, then pulse WR: the peripheral latches on the rising edge */
+			Local_Data->ODR = *Copy_Words++;
+			Local_Strobe->BRR = Local_StrobeMask;
+			GPIO_WR_HOLD();
+			Local_Strobe->BSRR = Local_StrobeMask;
+		}
+	}
+	else
+	{
+		/**< RETURN ERROR STATUS */
+	}
+}
+
+void GPIO_WriteParallelRepeated16(u8 Copy_DataPORT, u8 Copy_StrobePORT, u8 Copy_StrobePIN, u16 Copy_Word, u32 Copy_Count)
+{
+	GPIO_RegDef_t *Local_Data = GPIO_GetRegisters(Copy_DataPORT);
+	GPIO_RegDef_t *Local_Strobe = GPIO_GetRegisters(Copy_StrobePORT);
+	u32 Local_StrobeMask = 1UL << Copy_StrobePIN;
+
+	if((Local_Data != NULL) && (Local_Strobe != NULL) && (Copy_StrobePIN < 16))
+	{
+		/**< The bus keeps the word, only WR toggles. The loop is not unrolled: its overhead keeps the
+		 *   bus cycle above the write cycle time of the display controllers at 72 MHz */
+		Local_Data->ODR = Copy_Word;
+		while(Copy_Count-- > 0)
+		{
+			Local_Strobe->BRR = Local_StrobeMask;
+			GPIO_WR_HOLD();
+			Local_Strobe->BSRR = Local_StrobeMask;
+		}
+	}
+	else
+	{
+		/**< RETURN ERROR STATUS */
+	}
+}
+
+void GPIO_WriteParallel8(u8 Copy_DataPORT, u8 Copy_StrobePORT, u8 Copy_StrobePIN, const u8 *Copy_Bytes, u32 Copy_Count)
+{
+	GPIO_RegDef_t *Local_Data = GPIO_GetRegisters(Copy_DataPORT);
+	GPIO_RegDef_t *Local_Strobe = GPIO_GetRegisters(Copy_StrobePORT);
+	u32 Local_StrobeMask = 1UL << Copy_StrobePIN;
+
+	if((Local_Data != NULL) && (Local_Strobe != NULL) && (Copy_StrobePIN < 16))
+	{
+		while(Copy_Count-- > 0)
+		{
+			Local_Data->ODR = *Copy_Bytes++;
+			Local_Strobe->BRR = Local_StrobeMask;
+			GPIO_WR_HOLD();
+			Local_Strobe->BSRR = Local_StrobeMask;
+		}
+	}
+	else
+	{
+		/**< RETURN ERROR STATUS */
+	}
+}
+
+static GPIO_RegDef_t *GPIO_GetRegisters(u8 Copy_PORT)
+{
+	GPIO_RegDef_t *Local_Registers = NULL;
+	switch(Copy_PORT)
+	{
+		case GPIO_PORTA: Local_Registers = (GPIO_RegDef_t *)GPIOA_BASE_ADDRESS; break;
+		case GPIO_PORTB: Local_Registers = (GPIO_RegDef_t *)GPIOB_BASE_ADDRESS; break;
+		case GPIO_PORTC: Local_Registers = (GPIO_RegDef_t *)GPIOC_BASE_ADDRESS; break;
+	}
+	return Local_Registers;
+}
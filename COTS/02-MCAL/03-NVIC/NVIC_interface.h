@@ -124,10 +124,10 @@ typedef u8 IRQn_Type;
 #define NVIC_EXTI15_10_IRQn          40  /**< EXTI15_10 EXTI Line[15:10] interrupts */
 #define NVIC_RTCAlarm_IRQn           41  /**< RTCAlarm RTC alarm through EXTI line interrupt */
 #define NVIC_OTG_FS_WKUP_IRQn        42  /**< OTG_FS_WKUP USB On-The-Go FS Wakeup through EXTI line interrupt */
-#define NVIC_Reserved_IRQn           43  /**< Reserved interrupt */
-#define NVIC_Reserved_IRQn           44  /**< Reserved interrupt */
-#define NVIC_Reserved_IRQn           45  /**< Reserved interrupt */
-#define NVIC_Reserved_IRQn           46  /**< Reserved interrupt */
+#define NVIC_Reserved43_IRQn         43  /**< Reserved interrupt */
+#define NVIC_Reserved44_IRQn         44  /**< Reserved interrupt */
+#define NVIC_Reserved45_IRQn         45  /**< Reserved interrupt */
+#define NVIC_Reserved46_IRQn         46  /**< Reserved interrupt */
 #define NVIC_TIM5_IRQn               47  /**< TIM5 TIM5 global interrupt */
 #define NVIC_SPI3_IRQn               48  /**< SPI3 SPI3 global interrupt */
 #define NVIC_UART4_IRQn              49  /**< UART4 UART4 global interrupt */
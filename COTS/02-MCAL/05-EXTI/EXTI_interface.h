@@ -183,8 +183,6 @@ u8 EXTI_DisableEXTI(u8 Copy_u8Line);
  * @retval Local_u8ErrorStatus: The error status of the function. This parameter returns:
  *                          - 0 if no error occurred.
  *                          - 1 if an invalid EXTI line was provided.
- * 
- * @note This function is currently under development and cannot be used yet. Additional modifications are needed before this function can be used.
  */ 
 u8 EXTI_SwTrigger(u8 Copy_u8Line);
 
@@ -49,6 +49,13 @@ typedef struct EXTI_t{
  */
 #define EXTI 		((EXTI_t *)EXTI_BASE_ADDRESS)
 
+/**
+ * @brief Clears the pending flags of the enabled lines of one interrupt vector and calls the callback.
+ *
+ * @param[in] Copy_LinesMask: The lines sharing the vector, one bit per line.
+ */
+static void EXTI_HandleLines(u32 Copy_LinesMask);
+
 
 
 
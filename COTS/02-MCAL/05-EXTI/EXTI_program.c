@@ -46,24 +46,31 @@ u8 EXTI_SetSignalLatch(u8 Copy_Line, u8 Copy_Mode)
 {
 	u8 Local_u8ErrorStatus = 0;
 
-	switch (Copy_Mode)
+	if(Copy_Line < 20)
 	{
-		case EXTI_RISING		: 
-			SET_BIT(EXTI -> RTSR, EXTI_LINE);
-		break;
-
-		case EXTI_FALLING	: 
-			SET_BIT(EXTI -> FTSR, EXTI_LINE);	
-		break;
-
-		case EXTI_ON_CHANGE	: 
-			SET_BIT(EXTI -> RTSR, EXTI_LINE);
-			SET_BIT(EXTI -> FTSR, EXTI_LINE);			
-		break;
-
-		default:
-			Local_u8ErrorStatus = 1;
-		break;
+		switch (Copy_Mode)
+		{
+			case EXTI_RISING		: 
+				SET_BIT(EXTI -> RTSR, Copy_Line);
+			break;
+
+			case EXTI_FALLING	: 
+				SET_BIT(EXTI -> FTSR, Copy_Line);	
+			break;
+
+			case EXTI_ON_CHANGE	: 
+				SET_BIT(EXTI -> RTSR, Copy_Line);
+				SET_BIT(EXTI -> FTSR, Copy_Line);			
+			break;
+
+			default:
+				Local_u8ErrorStatus = 1;
+			break;
+		}
+	}
+	else
+	{
+		Local_u8ErrorStatus = 1;
 	}
 
 	return Local_u8ErrorStatus;
@@ -108,7 +115,7 @@ u8 EXTI_SwTrigger(u8 Copy_Line)
 
 	if(Copy_Line < 20)
 	{
-		CLR_BIT(EXTI->SWIER, Copy_Line);
+		SET_BIT(EXTI->SWIER, Copy_Line);
 	}
 	else
 	{
@@ -133,4 +140,52 @@ u8 EXTI_SetCallBack(void (*Copy_Callback)(void))
 	}
 
 	return Local_u8ErrorStatus;
-}
\ No newline at end of file
+}
+
+static void EXTI_HandleLines(u32 Copy_LinesMask)
+{
+	u32 Local_u32Pending = EXTI->PR & EXTI->IMR & Copy_LinesMask;
+
+	/**< Clear the pending flags by writing 1 */
+	EXTI->PR = Local_u32Pending;
+
+	if((Local_u32Pending != 0) && (EXTI_CallBack != NULL))
+	{
+		EXTI_CallBack();
+	}
+}
+
+void EXTI0_IRQHandler(void)
+{
+	EXTI_HandleLines(0x00000001);
+}
+
+void EXTI1_IRQHandler(void)
+{
+	EXTI_HandleLines(0x00000002);
+}
+
+void EXTI2_IRQHandler(void)
+{
+	EXTI_HandleLines(0x00000004);
+}
+
+void EXTI3_IRQHandler(void)
+{
+	EXTI_HandleLines(0x00000008);
+}
+
+void EXTI4_IRQHandler(void)
+{
+	EXTI_HandleLines(0x00000010);
+}
+
+void EXTI9_5_IRQHandler(void)
+{
+	EXTI_HandleLines(0x000003E0);
+}
+
+void EXTI15_10_IRQHandler(void)
+{
+	EXTI_HandleLines(0x0000FC00);
+}
@@ -43,6 +43,15 @@
  */
 #define STK_CTRL_CLKSOURCE     STK_CTRL_CLKSOURCE_8
 
+/**
+ * @brief Specifies the processor (AHB) clock frequency in Hz, as set up by RCC.
+ *
+ * The SysTick clock is this frequency, or an eighth of it with STK_CTRL_CLKSOURCE_8, and every
+ * interval in microseconds is converted with it: change it with the system clock, e.g. to
+ * 72000000 with the PLL at 72 MHz. The SysTick clock must be a whole number of MHz.
+ */
+#define STK_AHB_FREQUENCY      8000000UL
+
 /**
  * @brief Specifies whether the SysTick timer exception request is enabled.
  *
@@ -149,5 +149,18 @@ void STK_SetIntervalSingle(u32 Copy_Microseconds, void (*Copy_Callback)(void));
  */
 void STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void));
 
+/**
+ * @brief Changes the period of the running periodic interval, from the next period on.
+ *
+ * The new reload value is taken by the timer when the current period ends, so the period that
+ * follows the current one lasts exactly the specified time; the counter is not disturbed. Called from
+ * the callback, it gives every period its own length (e.g. binary code modulation).
+ *
+ * @param[in] Copy_Microseconds The length of the next period in microseconds, at least one SysTick count. In SysTick counts (STK_COUNTS_PER_US per microsecond) it should be less than or equal to 16777216 (0x01000000).
+ *
+ * @return None.
+ */
+void STK_SetNextInterval(u32 Copy_Microseconds);
+
 #endif /**<  __STK_INTERFACE_H__ */
 
@@ -72,7 +72,7 @@ typedef struct STK_RegDef_t{
 /**
  * @brief Sets the system clock frequency for the SysTick peripheral.
  *
- * This function sets the system clock frequency for the SysTick peripheral. It does not allow changes to the values defined by the STK_CTRL_CLKSOURCE constant.
+ * This function sets the system clock frequency for the SysTick peripheral from STK_AHB_FREQUENCY and STK_CTRL_CLKSOURCE (STK_config.h).
  *
  * @note
  * The available options for STK_CTRL_CLKSOURCE are:
@@ -82,13 +82,25 @@ typedef struct STK_RegDef_t{
  * @retval None
  */
 #if STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_1
-    #define STK_AHB_CLK       8000000   /**< Processor clock (AHB clock) divided by 1 */
+    #define STK_AHB_CLK       (STK_AHB_FREQUENCY)       /**< Processor clock (AHB clock) divided by 1 */
 #elif STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_8
-    #define STK_AHB_CLK       1000000   /**< Processor clock (AHB clock) divided by 8 */
+    #define STK_AHB_CLK       (STK_AHB_FREQUENCY / 8)   /**< Processor clock (AHB clock) divided by 8 */
 #else
     #error "You chose a wrong clock source for the SysTick"
 #endif
 
+/**
+ * @brief SysTick counts per microsecond.
+ *
+ * Intervals are converted as Microseconds * STK_COUNTS_PER_US: multiplying by STK_AHB_CLK first would overflow u32
+ * above 4294 us at 1 MHz, and a 64-bit division is too slow for @ref STK_SetNextInterval in an interrupt.
+ */
+#define STK_COUNTS_PER_US     (STK_AHB_CLK / 1000000UL)
+
+#if (STK_AHB_CLK % 1000000UL) != 0
+    #error "The SysTick clock must be a whole number of MHz: check STK_AHB_FREQUENCY and STK_CTRL_CLKSOURCE"
+#endif
+
 
 #endif /**< __STK_PRIVATE_H__ */
 
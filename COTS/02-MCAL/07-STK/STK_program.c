@@ -90,7 +90,7 @@ u32 STK_GetElapsedCounts(void)
 void STK_SetBusyWait(u32 Copy_Microseconds)
 {
     /**< Calculate the number of ticks required to wait for the specified number of microseconds */
-    u32 Local_u32Ticks = (Copy_Microseconds * STK_AHB_CLK) / 1000000;
+    u32 Local_u32Ticks = Copy_Microseconds * STK_COUNTS_PER_US;
 
     /**< Wait for the specified number of ticks using the SysTick timer */
     STK->LOAD = Local_u32Ticks;
@@ -119,7 +119,7 @@ void STK_SetIntervalSingle(u32 Copy_u32Microseconds, void (*Copy_pfCallback)(voi
         STK_Callback = Copy_pfCallback;
     
         /* Calculate the number of ticks required to wait for the specified number of microseconds */
-        u32 Local_u32Ticks = (Copy_u32Microseconds * STK_AHB_CLK) / 1000000;
+        u32 Local_u32Ticks = Copy_u32Microseconds * STK_COUNTS_PER_US;
     
         /* Set the reload value for the SysTick timer */
         STK->LOAD = Local_u32Ticks;
@@ -146,7 +146,7 @@ void STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void))
         STK_Callback = Copy_Callback;
 
         /* Calculate the number of ticks required to wait for the specified number of microseconds */
-        u32 Local_u32Ticks = (Copy_Microseconds * STK_AHB_CLK) / 1000000;
+        u32 Local_u32Ticks = Copy_Microseconds * STK_COUNTS_PER_US;
 
         /**< Set the reload value for the SysTick timer */
         STK->LOAD = Local_u32Ticks;
@@ -164,6 +164,12 @@ void STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void))
     }
 }
 
+void STK_SetNextInterval(u32 Copy_Microseconds)
+{
+    /**< Only the reload value: the counter reloads it at the end of the current period, and counts LOAD + 1 ticks */
+    STK->LOAD = (Copy_Microseconds * STK_COUNTS_PER_US) - 1;
+}
+
 void SysTick_Handler(void)
 {
     /**< Call the callback function */
@@ -293,6 +293,74 @@ void SPI_voidInit(SPI_t Copy_SelectedSPI, const SPI_config_t *Copy_SPIConfig);
  */
 void SPI_voidTransfer(SPI_t Copy_SPI, u8 *Copy_TxData, u8 *Copy_RxData, u16 Copy_Size);
 
+/**
+ * @brief Transmit a block of bytes without reading back the received data.
+ *
+ * Unlike @ref SPI_voidTransfer, this function does not touch the slave select pin and does not
+ * wait for RXNE after every byte: it only waits for TXE, so the next byte is queued while the
+ * previous one is still being shifted out. The caller owns the chip select of the slave and can
+ * therefore chain several calls inside one bus transaction.
+ *
+ * @param[in] Copy_SPI The SPI peripheral to transmit on.
+ * @param[in] Copy_TxData Pointer to the bytes to transmit.
+ * @param[in] Copy_Size The number of bytes to transmit.
+ *
+ * @return None.
+ *
+ * @note The function returns after the last byte has left the shift register (BSY cleared).
+ *
+ * @note Example Usage:
+ * @code
+ * /// Send the four parameter bytes of a command while CS is held low by the caller
+ * u8 Local_Args[4] = {0x00, 0x00, 0x00, 0x7F};
+ * SPI_voidTransmit(SPI_1, Local_Args, 4);
+ * @endcode
+ */
+void SPI_voidTransmit(SPI_t Copy_SPI, const u8 *Copy_TxData, u32 Copy_Size);
+
+/**
+ * @brief Transmit a block of 16-bit words, most significant byte first.
+ *
+ * The peripheral is switched to 16-bit data frames for the duration of the call, so every write to
+ * the data register sends a whole word and the byte order on the wire does not depend on the
+ * endianness of the buffer in memory. The previous 8-bit frame format is restored before returning.
+ *
+ * @param[in] Copy_SPI The SPI peripheral to transmit on.
+ * @param[in] Copy_TxData Pointer to the words to transmit.
+ * @param[in] Copy_Size The number of words to transmit.
+ *
+ * @return None.
+ *
+ * @note Like @ref SPI_voidTransmit, the slave select pin is left to the caller.
+ *
+ * @note Example Usage:
+ * @code
+ * /// Stream a row of RGB565 pixels
+ * SPI_voidTransmit16(SPI_1, Local_RowPixels, 128);
+ * @endcode
+ */
+void SPI_voidTransmit16(SPI_t Copy_SPI, const u16 *Copy_TxData, u32 Copy_Size);
+
+/**
+ * @brief Transmit the same 16-bit word a number of times, most significant byte first.
+ *
+ * This is the fill counterpart of @ref SPI_voidTransmit16: no source buffer is read, the same value
+ * is written to the data register every time the transmit buffer becomes empty.
+ *
+ * @param[in] Copy_SPI The SPI peripheral to transmit on.
+ * @param[in] Copy_Data The word to transmit.
+ * @param[in] Copy_Count The number of times the word is transmitted.
+ *
+ * @return None.
+ *
+ * @note Example Usage:
+ * @code
+ * /// Send 128 * 160 black pixels
+ * SPI_voidTransmitRepeated16(SPI_1, 0x0000, 128UL * 160UL);
+ * @endcode
+ */
+void SPI_voidTransmitRepeated16(SPI_t Copy_SPI, u16 Copy_Data, u32 Copy_Count);
+
 /**
  * @} SPI_Functions
  */
@@ -72,6 +72,11 @@
  */
 #define SPI_SR_TXE                  1
 
+/**
+ * @brief SPI_SR_OVR bit position.
+ */
+#define SPI_SR_OVR                  6
+
 /**
  * @brief SPI_SR_BSY bit position.
  */
@@ -253,6 +258,33 @@ static u8 SPI_ReceiveByte(SPI_RegDef_t *Copy_SPI);
  */
 static void SPI_WaitForTransmissionComplete(SPI_RegDef_t *Copy_SPI);
 
+/**
+ * @brief Switch the SPI peripheral between 8-bit and 16-bit data frames.
+ *
+ * The DFF bit may only be written while the peripheral is disabled, so this function waits for
+ * the bus to go idle, clears SPE, updates DFF and re-enables the peripheral. Nothing is done when
+ * the requested frame format is already selected.
+ *
+ * @param[in] Copy_SPI Pointer to the SPI peripheral structure.
+ * @param[in] Copy_DataFrame SPI_DATA_FRAME_8BIT or SPI_DATA_FRAME_16BIT.
+ *
+ * @return None.
+ */
+static void SPI_SetDataFrame(SPI_RegDef_t *Copy_SPI, SPI_DataFrame_t Copy_DataFrame);
+
+/**
+ * @brief Finish a transmit-only transfer.
+ *
+ * Waits for the last frame to leave the shift register, then discards the data that was clocked
+ * in while transmitting and clears the resulting overrun flag (read DR, then read SR), so that the
+ * next full-duplex @ref SPI_voidTransfer starts with an empty receive buffer.
+ *
+ * @param[in] Copy_SPI Pointer to the SPI peripheral structure.
+ *
+ * @return None.
+ */
+static void SPI_EndTransmit(SPI_RegDef_t *Copy_SPI);
+
 /**
  * @brief Initializes the SPI peripheral with default settings.
  * 
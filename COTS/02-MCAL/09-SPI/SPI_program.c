@@ -151,6 +151,62 @@ void SPI_voidTransfer(SPI_t Copy_SPI, u8 *Copy_TxData, u8 *Copy_RxData, u16 Copy
 
 }
 
+void SPI_voidTransmit(SPI_t Copy_SPI, const u8 *Copy_TxData, u32 Copy_Size)
+{
+  /**< Iterator to loop on the data */
+  u32 Local_Iterator;
+
+  /**< Queue every byte as soon as the transmit buffer is empty */
+  for (Local_Iterator = 0; Local_Iterator < Copy_Size; Local_Iterator++)
+  {
+    SPI_SendByte(Copy_SPI, Copy_TxData[Local_Iterator]);
+  }
+
+  /**< Wait for the last byte and drop the data received meanwhile */
+  SPI_EndTransmit(Copy_SPI);
+}
+
+void SPI_voidTransmit16(SPI_t Copy_SPI, const u16 *Copy_TxData, u32 Copy_Size)
+{
+  /**< Iterator to loop on the data */
+  u32 Local_Iterator;
+
+  /**< One write to DR sends a whole word, MSB first */
+  SPI_SetDataFrame(Copy_SPI, SPI_DATA_FRAME_16BIT);
+
+  for (Local_Iterator = 0; Local_Iterator < Copy_Size; Local_Iterator++)
+  {
+    /* Wait for the transmit buffer to be empty */
+    while (!GET_BIT(Copy_SPI->SR, SPI_SR_TXE));
+
+    /* Send the data */
+    Copy_SPI->DR = Copy_TxData[Local_Iterator];
+  }
+
+  /**< Wait for the last word, then go back to byte frames */
+  SPI_EndTransmit(Copy_SPI);
+  SPI_SetDataFrame(Copy_SPI, SPI_DATA_FRAME_8BIT);
+}
+
+void SPI_voidTransmitRepeated16(SPI_t Copy_SPI, u16 Copy_Data, u32 Copy_Count)
+{
+  /**< One write to DR sends a whole word, MSB first */
+  SPI_SetDataFrame(Copy_SPI, SPI_DATA_FRAME_16BIT);
+
+  while (Copy_Count--)
+  {
+    /* Wait for the transmit buffer to be empty */
+    while (!GET_BIT(Copy_SPI->SR, SPI_SR_TXE));
+
+    /* Send the data */
+    Copy_SPI->DR = Copy_Data;
+  }
+
+  /**< Wait for the last word, then go back to byte frames */
+  SPI_EndTransmit(Copy_SPI);
+  SPI_SetDataFrame(Copy_SPI, SPI_DATA_FRAME_8BIT);
+}
+
 /**
  * @} SPI_Functions
  */
@@ -184,6 +240,45 @@ static void SPI_WaitForTransmissionComplete(SPI_RegDef_t *Copy_SPI)
   while (GET_BIT(Copy_SPI->SR, SPI_SR_BSY));
 }
 
+static void SPI_SetDataFrame(SPI_RegDef_t *Copy_SPI, SPI_DataFrame_t Copy_DataFrame)
+{
+  /**< Nothing to do if the frame format is already the requested one */
+  if (GET_BIT(Copy_SPI->CR1, SPI_CR1_DFF) == (u32)Copy_DataFrame)
+  {
+    return;
+  }
+
+  /**< DFF must only be changed while the peripheral is disabled */
+  SPI_WaitForTransmissionComplete(Copy_SPI);
+  CLR_BIT(Copy_SPI->CR1, SPI_CR1_SPE);
+
+  if (Copy_DataFrame == SPI_DATA_FRAME_16BIT)
+  {
+    SET_BIT(Copy_SPI->CR1, SPI_CR1_DFF);
+  }
+  else
+  {
+    CLR_BIT(Copy_SPI->CR1, SPI_CR1_DFF);
+  }
+
+  SET_BIT(Copy_SPI->CR1, SPI_CR1_SPE);
+}
+
+static void SPI_EndTransmit(SPI_RegDef_t *Copy_SPI)
+{
+  /**< Temp variable to drain the receive side */
+  volatile u32 Local_Dummy;
+
+  /**< Wait until the last frame left the shift register */
+  while (!GET_BIT(Copy_SPI->SR, SPI_SR_TXE));
+  SPI_WaitForTransmissionComplete(Copy_SPI);
+
+  /**< Clear RXNE and OVR: read DR then SR */
+  Local_Dummy = Copy_SPI->DR;
+  Local_Dummy = Copy_SPI->SR;
+  (void)Local_Dummy;
+}
+
 static void SPI_DefaultInitiation(void)
 { 
   /**< Set the data frame format to be 8-bit data frame */
@@ -32,6 +32,40 @@
  */
 #define LEDMTRX_NUM_COLS 8
 
+/**
+ * @brief Refresh rate of the whole matrix in Hz.
+ *
+ * The refresh interrupt lights one column per tick, so it runs LEDMTRX_NUM_COLS times faster
+ * than this rate: 100 Hz on 8 columns is one tick every 1250 us. Below about 60 Hz the matrix
+ * flickers. The bit planes last whole microseconds, so the real rate is a little off: 98 Hz
+ * for 100 Hz at 8 bits (LEDMTRX_REFRESH_PERIOD_US in LEDMRX_private.h). The build fails when it
+ * is more than 5% off.
+ */
+#define LEDMTRX_REFRESH_RATE_HZ 100
+
+/**
+ * @brief Default animation frame rate in Hz, e.g. the marquee scrolling speed in columns per second.
+ *
+ * Animation frames are counted in refresh cycles, independently of the refresh rate, and
+ * start on a refresh cycle boundary. The rate can be changed at run time with
+ * LEDMTRX_SetAnimationRate; it is limited to LEDMTRX_REFRESH_RATE_HZ.
+ */
+#define LEDMTRX_ANIMATION_RATE_HZ 10
+
+/**
+ * @brief Brightness resolution of each LED in bits, 1 (on/off) to 8.
+ *
+ * With more than 1 bit the matrix is driven by binary code modulation: each column is shown
+ * once per bit of the brightness, the bit plane of weight 2^n for 2^n time units, so one
+ * refresh tick per bit plane instead of one per level. The shortest plane lasts
+ * 1 / (LEDMTRX_REFRESH_RATE_HZ * LEDMTRX_NUM_COLS * (2^LEDMTRX_GRAY_BITS - 1)) seconds, rounded
+ * to the nearest microsecond, and must be longer than the refresh tick itself: 5 us at 100 Hz
+ * and 8 bits, which needs a 72 MHz core. The build checks it against STK_AHB_FREQUENCY in
+ * STK_config.h, which must match the core clock anyway so that SysTick counts microseconds
+ * right; at 8 MHz it fails above 6 bits at 100 Hz.
+ */
+#define LEDMTRX_GRAY_BITS 4
+
 
 
 /**
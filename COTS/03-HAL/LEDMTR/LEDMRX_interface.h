@@ -3,31 +3,77 @@
  * @brief This file contains the interface functions for controlling an LED matrix.
  * 
  * The LED matrix can be controlled using the functions provided in this file.
+ *
+ * The matrix is refreshed in the background: a periodic interrupt lights one column per tick
+ * from a frame buffer of one byte per column (bit n for row n), so the CPU is only busy for
+ * the few microseconds of each tick.
+ *
+ * The frame buffer is doubled. The refresh shows the front buffer while the drawing functions
+ * write the back buffer and return at once; @ref LEDMTRX_SwapBuffers shows the back buffer
+ * from the next refresh cycle on, so a frame is never shown half drawn. The buffers are
+ * swapped before column 0 is lit and the new back buffer then starts as a copy of the
+ * frame shown, ready for the next changes.
+ *
+ * The marquee scrolls text through the matrix from the interrupt alone: each animation frame
+ * advances an offset in the text and renders the 8 visible columns from a 5x7 column font
+ * (ASCII 32 to 126, 5 bytes per character in flash).
+ *
+ * Each LED has LEDMTRX_GRAY_BITS bits of brightness, shown by binary code modulation: the
+ * frame buffers hold one bit plane per brightness bit, and each column is lit once per bit
+ * plane for a time proportional to the weight of the plane, set by reprogramming the SysTick
+ * period from the refresh tick. The on/off functions use full brightness.
  * 
  * @author Mahmoud Abdelraouf Mahmoud
  * @date 23 Jul 2023
  * @version V01
+ *
+ * @note Example Usage:
+ * @code
+ * static const u8 Smiley[LEDMTRX_NUM_COLS] = {0x3C, 0x42, 0xA5, 0x81, 0xA5, 0x99, 0x42, 0x3C};
+ *
+ * STK_Init();
+ * LEDMTRX_Init();
+ * LEDMTRX_StartRefresh();
+ * LEDMTRX_Display(Smiley);
+ *
+ * /// add a dot once the smiley is shown
+ * while (LEDMTRX_IsSwapPending());
+ * LEDMTRX_TurnOn(0, 0);
+ * LEDMTRX_SwapBuffers();
+ *
+ * /// then scroll a text at 12 columns per second
+ * LEDMTRX_SetAnimationRate(12);
+ * LEDMTRX_StartMarquee("HELLO STM32");
+ * @endcode
  */
 #ifndef __LEDMATRIX_INTERFACE_H__
 #define __LEDMATRIX_INTERFACE_H__
+
+/**
+ * @brief Full brightness level, with LEDMTRX_GRAY_BITS bits of brightness.
+ */
+#define LEDMTRX_MAX_LEVEL           ((1U << LEDMTRX_GRAY_BITS) - 1)
+
 /**
  * @brief Turn on an LED at a specific row and column in the LED matrix.
  * 
- * This function turns on the LED at the specified row and column in the LED matrix.
+ * This function turns on the LED at the specified row and column in the back buffer, with
+ * the same restrictions as @ref LEDMTRX_SetLedBrightness.
  * 
- * @param Copy_u8Row The row number of the LED to turn on (0-indexed).
- * @param Copy_u8Col The column number of the LED to turn on (0-indexed).
+ * @param Copy_Row The row number of the LED to turn on (0-indexed).
+ * @param Copy_Col The column number of the LED to turn on (0-indexed).
  * @return None.
  */
-void HLEDMTRX_voidTurnOn(u8 Copy_u8Row, u8 Copy_u8Col);
+void LEDMTRX_TurnOn(u8 Copy_Row, u8 Copy_Col);
 
 /**
  * @brief Turn off an LED at a specific row and column in the LED matrix.
  * 
- * This function turns off the LED at the specified row and column in the LED matrix.
+ * This function turns off the LED at the specified row and column in the back buffer, with
+ * the same restrictions as @ref LEDMTRX_SetLedBrightness.
  * 
- * @param Copy_u8Row The row number of the LED to turn off (0-indexed).
- * @param Copy_u8Col The column number of the LED to turn off (0-indexed).
+ * @param Copy_Row The row number of the LED to turn off (0-indexed).
+ * @param Copy_Col The column number of the LED to turn off (0-indexed).
  * @return None.
  */
 void LEDMTRX_TurnOff(u8 Copy_Row, u8 Copy_Col);
@@ -35,7 +81,7 @@ void LEDMTRX_TurnOff(u8 Copy_Row, u8 Copy_Col);
 /**
  * @brief Clear all LEDs in the LED matrix.
  * 
- * This function turns off all LEDs in the LED matrix.
+ * This function turns off all LEDs in the back buffer.
  * 
  * @return None.
  */
@@ -44,7 +90,8 @@ void LEDMTRX_Clear(void);
 /**
  * @brief Initialize the LED matrix.
  * 
- * This function initializes the LED matrix with the default settings.
+ * This function configures the row and column pins as outputs, turns every column off and
+ * clears both frame buffers. The refresh is started separately with @ref LEDMTRX_StartRefresh.
  * 
  * @return None.
  */
@@ -53,47 +100,168 @@ void LEDMTRX_Init(void);
 /**
  * @brief Displays data on the LED Matrix.
  *
- * This function displays data on the LED Matrix by enabling one column at a time and setting
- * the values for the rows. It uses an array of 8 bytes to represent the data for each column.
- * The function shifts the data to the left after displaying all columns, creating a scrolling
- * effect.
+ * This function copies the data into the back buffer and swaps the buffers at the next
+ * refresh cycle, replacing a swap still pending. It returns at once. Unlike earlier versions
+ * it neither waits nor shifts the data: see @ref LEDMTRX_ShiftLeft and
+ * @ref LEDMTRX_StartMarquee to scroll.
  *
- * @param Copy_pau8Data Pointer to an array of 8 bytes representing the data for each column.
+ * @param Copy_Data Pointer to an array of LEDMTRX_NUM_COLS bytes, one per column, bit n for row n.
  *
  * @return void
  */
-void LEDMTRX_Display(u8 *Copy_pau8Data);
+void LEDMTRX_Display(const u8 *Copy_Data);
 
 /**
  * @brief Set the state of an LED at a specific row and column in the LED matrix.
  * 
- * This function sets the state of the LED at the specified row and column in the LED matrix.
+ * This function sets the state of the LED at the specified row and column in the back buffer.
+ * It writes the LED with @ref LEDMTRX_SetLedBrightness and must not be called while
+ * @ref LEDMTRX_IsSwapPending returns 1 or while the marquee runs, for the same reasons.
  * 
- * @param row The row number of the LED (0-indexed).
- * @param col The column number of the LED (0-indexed).
- * @param state The state to set the LED to (0 for off, 1 for on).
+ * @param Copy_Row The row number of the LED (0-indexed).
+ * @param Copy_Col The column number of the LED (0-indexed).
+ * @param Copy_State The state to set the LED to (0 for off, 1 for on).
+ * @return None.
+ */
+void LEDMTRX_SetLedState(u8 Copy_Row, u8 Copy_Col, u8 Copy_State);
+
+/**
+ * @brief Set the brightness of an LED in the back buffer.
+ *
+ * Call this function only while @ref LEDMTRX_IsSwapPending returns 0. While a swap is
+ * pending the refresh interrupt may swap the buffers during the call and then copy the new
+ * front buffer over the back buffer: the change is lost, or half of it lands in the frame
+ * shown. Do not call it while the marquee runs either: every animation frame overwrites the
+ * back buffer and requests a swap.
+ *
+ * @param Copy_Row The row number of the LED (0-indexed).
+ * @param Copy_Col The column number of the LED (0-indexed).
+ * @param Copy_Level The brightness, 0 (off) to @ref LEDMTRX_MAX_LEVEL; higher values are limited to it.
  * @return None.
  */
-void LEDMTRX_SetLedState(u8 row, u8 col, u8 state);
+void LEDMTRX_SetLedBrightness(u8 Copy_Row, u8 Copy_Col, u8 Copy_Level);
 
 /**
- * @brief Shift the LED matrix display to the left by one column.
+ * @brief Display a picture with a brightness per LED.
+ *
+ * Like @ref LEDMTRX_Display: the picture is written into the back buffer, split into bit
+ * planes, and swapped in at the next refresh cycle.
+ *
+ * @param Copy_Levels Pointer to LEDMTRX_NUM_ROWS * LEDMTRX_NUM_COLS brightness levels, row by
+ *                    row, 0 to @ref LEDMTRX_MAX_LEVEL (higher values are limited to it).
+ * @return None.
+ */
+void LEDMTRX_DisplayGray(const u8 *Copy_Levels);
+
+/**
+ * @brief Display data shifted to the left, wrapping around.
  * 
- * This function shifts the LED matrix display to the left by one column.
+ * This function shows column (n + Copy_Shift) % LEDMTRX_NUM_COLS of the data in column n,
+ * like @ref LEDMTRX_Display. The data is left unchanged: to scroll a picture, call the
+ * function with an increasing shift.
  * 
+ * @param Copy_Data Pointer to an array of LEDMTRX_NUM_COLS bytes, one per column, bit n for row n.
+ * @param Copy_Shift Number of columns to shift by.
  * @return None.
  */
-void LEDMTRX_ShiftLeft(u8 *Copy_pau8Data);
+void LEDMTRX_ShiftLeft(const u8 *Copy_Data, u8 Copy_Shift);
 
 /**
  * @brief Set the state of a specific row in the LED matrix.
  * 
- * This function sets the state of all LEDs in a specific row of the LED matrix.
+ * This function sets the state of all LEDs in a specific row of the back buffer, with the
+ * same restrictions as @ref LEDMTRX_SetLedBrightness.
  * 
- * @param row The row number to set the state for (0-indexed).
- * @param state The state to set the row to (0 for off, 1 for on).
+ * @param Copy_Row The row number to set the state for (0-indexed).
+ * @param Copy_State The state to set the row to (0 for off, 1 for on).
+ * @return None.
+ */
+void LEDMTRX_SetRowState(u8 Copy_Row, u8 Copy_State);
+
+/**
+ * @brief Show the back buffer from the next refresh cycle on.
+ *
+ * This function only requests the swap, which the refresh performs before lighting column 0.
+ * Until @ref LEDMTRX_IsSwapPending returns 0, changes to the back buffer may still show in
+ * the frame being swapped in.
+ *
+ * @return None.
+ */
+void LEDMTRX_SwapBuffers(void);
+
+/**
+ * @brief Check whether a swap requested by @ref LEDMTRX_SwapBuffers is still to be done.
+ *
+ * @return 1 while the swap is pending, 0 once the back buffer can be drawn again.
+ */
+u8 LEDMTRX_IsSwapPending(void);
+
+/**
+ * @brief Scroll a text from right to left through the matrix, in a loop.
+ *
+ * The text enters from the right edge, one column per animation frame, and scrolls out fully
+ * before it starts again. Characters are 5 columns wide with 1 blank column between them;
+ * characters outside ASCII 32 to 126 show as spaces. The frames are rendered into the back
+ * buffer and swapped in by the refresh interrupt, so the drawing functions must not be used
+ * while the marquee runs.
+ *
+ * @param Copy_Text The text, NUL-terminated. It is read while the marquee runs and must stay
+ *                  in place (a literal or a constant in flash).
+ * @return None.
+ */
+void LEDMTRX_StartMarquee(const char *Copy_Text);
+
+/**
+ * @brief Stop the marquee. The last frame stays shown.
+ *
+ * @return None.
+ */
+void LEDMTRX_StopMarquee(void);
+
+/**
+ * @brief Set the animation frame rate.
+ *
+ * @param Copy_RateHz Frames per second, 0 to pause, up to LEDMTRX_REFRESH_RATE_HZ (higher values are limited to it).
+ * @return None.
+ */
+void LEDMTRX_SetAnimationRate(u8 Copy_RateHz);
+
+/**
+ * @brief Start the background refresh of the LED matrix.
+ *
+ * This function makes the SysTick interrupt call @ref LEDMTRX_Refresh once per column and
+ * bit plane, each period lasting the weight of the plane lit, so that a refresh cycle lasts
+ * about 1 / LEDMTRX_REFRESH_RATE_HZ seconds. SysTick must have been initialized with
+ * STK_Init. It takes over the SysTick callback: when SysTick already paces something else
+ * (e.g. the OS scheduler), call @ref LEDMTRX_Refresh from that periodic code instead of this
+ * function, which only gives correct brightness levels with LEDMTRX_GRAY_BITS at 1.
+ *
+ * @return None.
+ */
+void LEDMTRX_StartRefresh(void);
+
+/**
+ * @brief Stop the background refresh and turn every column off.
+ *
+ * @return None.
+ */
+void LEDMTRX_StopRefresh(void);
+
+/**
+ * @brief Light the next column of the LED matrix from the frame buffer.
+ *
+ * This function is the refresh tick: it turns the lit column off, drives the rows with the
+ * front buffer byte of the next column and bit plane and turns that column on, with one bit
+ * set/reset store per port involved (a single store for the rows on PA0 to PA7). It takes
+ * about 130 core cycles with the interrupt entry (under 2 us at 72 MHz) and is called from the
+ * SysTick interrupt after @ref LEDMTRX_StartRefresh, or from any periodic interrupt or task
+ * running LEDMTRX_NUM_COLS * LEDMTRX_GRAY_BITS times the refresh rate. Once column 0 is lit
+ * it also finishes a swap and, on animation frames, renders the marquee (up to about 800
+ * more cycles at 8 bits), during the longest bit plane. Tools/LEDMTRX_Model measures the
+ * refresh for every depth on the host.
+ *
  * @return None.
  */
-void LEDMTRX_SetRowState(u8 row, u8 state);
+void LEDMTRX_Refresh(void);
 
 #endif /**< __LEDMATRIX_INTERFACE_H__ */
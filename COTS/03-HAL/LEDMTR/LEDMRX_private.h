@@ -13,10 +13,109 @@
 #ifndef __LEDMATRIX_PRIVATE_H__
 #define __LEDMATRIX_PRIVATE_H__
 
+/**
+ * @brief A row or column pin, from the pin pairs of LEDMRX_config.h.
+ */
+typedef struct
+{
+  u8 Port;    /**< GPIO_PORTA, GPIO_PORTB or GPIO_PORTC. */
+  u8 Pin;     /**< 0 to 15. */
+} LEDMTRX_Pin_t;
+
+/**
+ * @brief Number of GPIO ports the rows and columns can be on.
+ */
+#define LEDMTRX_PORT_COUNT          3
+
+/**
+ * @brief Time unit of binary code modulation in microseconds: the length of bit plane 0.
+ *
+ * 1 / (LEDMTRX_REFRESH_RATE_HZ * LEDMTRX_NUM_COLS * LEDMTRX_MAX_LEVEL) seconds rounded to the
+ * nearest microsecond. No casts, so that the checks of LEDMRX_program.c can use it in #if.
+ */
+#define LEDMTRX_PLANE_UNIT_US       ((1000000UL + (LEDMTRX_REFRESH_RATE_HZ * LEDMTRX_NUM_COLS * LEDMTRX_MAX_LEVEL) / 2) / \
+                                     (LEDMTRX_REFRESH_RATE_HZ * LEDMTRX_NUM_COLS * LEDMTRX_MAX_LEVEL))
+
+/**
+ * @brief Period of a whole refresh cycle in microseconds, from the rounded plane unit.
+ *
+ * The matrix really refreshes at 1000000 / LEDMTRX_REFRESH_PERIOD_US Hz: 100 Hz configured on
+ * 8 columns gives 100.4 Hz at 4 bits, 99.2 Hz at 6 bits and 98.0 Hz at 8 bits.
+ */
+#define LEDMTRX_REFRESH_PERIOD_US   (LEDMTRX_PLANE_UNIT_US * LEDMTRX_MAX_LEVEL * LEDMTRX_NUM_COLS)
+
+/**
+ * @brief Refresh rates further than this from LEDMTRX_REFRESH_RATE_HZ, in percent, are rejected.
+ */
+#define LEDMTRX_REFRESH_TOLERANCE   5
+
+/**
+ * @brief Estimated core cycles of a refresh tick, interrupt entry and exit included.
+ *
+ * tick_cycles of Tools/LEDMTRX_Model/ledmodel.py, which fails when its estimate grows past this
+ * value. The shortest bit plane must last longer than that at STK_AHB_FREQUENCY.
+ */
+#define LEDMTRX_TICK_CYCLES         130
+
+/**
+ * @brief LEDMTRX_RowShift when the rows are not consecutive pins of one port.
+ */
+#define LEDMTRX_ROWS_SCATTERED      0xFF
 
+/**
+ * @brief Characters of the marquee font, and their size in columns.
+ */
+#define LEDMTRX_FONT_FIRST_CHAR     ' '
+#define LEDMTRX_FONT_LAST_CHAR      '~'
+#define LEDMTRX_FONT_WIDTH          5
+#define LEDMTRX_FONT_ADVANCE        (LEDMTRX_FONT_WIDTH + 1)   /**< Glyph and blank column. */
+
+/**
+ * @brief Turn every column off, with one store per port holding columns.
+ */
 static void LEDMTRX_DisableAllCols(void);
 
-static void LEDMTRX_SetRowValues(u8 Copy_u8Value);
+/**
+ * @brief Drive the rows with a column of a bit plane.
+ *
+ * When the rows are consecutive pins of one port (PA0 to PA7 by default) this is one masked
+ * store; otherwise one store per port holding rows.
+ *
+ * @param Copy_Value Bit n for row n, 1 lit.
+ */
+static void LEDMTRX_SetRowValues(u8 Copy_Value);
+
+/**
+ * @brief Write an on/off column into every bit plane of a frame buffer.
+ *
+ * @param Copy_Buffer 0 or 1.
+ * @param Copy_Col The column (0-indexed).
+ * @param Copy_Value Bit n for row n, 1 lit at full brightness.
+ */
+static void LEDMTRX_SetColumn(u8 Copy_Buffer, u8 Copy_Col, u8 Copy_Value);
+
+/**
+ * @brief End the first tick of a refresh cycle, once column 0 is lit.
+ *
+ * Copies the new front buffer into the back buffer after a swap, then renders a marquee
+ * frame into the back buffer when one is due; that frame is swapped in at the next cycle.
+ *
+ * @param Copy_Swapped 1 when the tick swapped the buffers.
+ */
+static void LEDMTRX_UpdateFrames(u8 Copy_Swapped);
+
+/**
+ * @brief SysTick callback: refresh, then set the length of the next period to the weight of the next bit plane.
+ */
+static void LEDMTRX_SysTickRefresh(void);
+
+/**
+ * @brief Read one column of the marquee.
+ *
+ * @param Copy_Index Column of the marquee: LEDMTRX_NUM_COLS blank columns, then the text.
+ * @return The column, bit n for row n.
+ */
+static u8 LEDMTRX_GetMarqueeColumn(u16 Copy_Index);
 
 /*****************************< Concatenate function *****************************/
 #define Conc(NUM)			Conc_Help(NUM)
@@ -25,4 +124,3 @@ static void LEDMTRX_SetRowValues(u8 Copy_u8Value);
 
 #endif /**< __LEDMATRIX_PRIVATE_H__ */ 
 
-
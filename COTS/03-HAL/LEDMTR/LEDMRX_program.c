@@ -14,197 +14,578 @@
 /*********************< MCAL *********************/
 #include "GPIO_interface.h"
 #include "STK_interface.h"
+#include "STK_config.h"
 /*********************< HAL *********************/
 #include "LEDMRX_private.h"
 #include "LEDMRX_interface.h"
 #include "LEDMRX_config.h"
 
+/**< Row and column pins, in order */
+static const LEDMTRX_Pin_t LEDMTRX_RowPins[LEDMTRX_NUM_ROWS] =
+{
+  { LEDMTRX_ROW0_PIN }, { LEDMTRX_ROW1_PIN }, { LEDMTRX_ROW2_PIN }, { LEDMTRX_ROW3_PIN },
+  { LEDMTRX_ROW4_PIN }, { LEDMTRX_ROW5_PIN }, { LEDMTRX_ROW6_PIN }, { LEDMTRX_ROW7_PIN }
+};
+
+static const LEDMTRX_Pin_t LEDMTRX_ColPins[LEDMTRX_NUM_COLS] =
+{
+  { LEDMTRX_COL0_PIN }, { LEDMTRX_COL1_PIN }, { LEDMTRX_COL2_PIN }, { LEDMTRX_COL3_PIN },
+  { LEDMTRX_COL4_PIN }, { LEDMTRX_COL5_PIN }, { LEDMTRX_COL6_PIN }, { LEDMTRX_COL7_PIN }
+};
 
+/**< Row and column pins of each port, built by LEDMTRX_Init */
+static u16 LEDMTRX_RowMasks[LEDMTRX_PORT_COUNT];
+static u16 LEDMTRX_ColMasks[LEDMTRX_PORT_COUNT];
 
+/**< Port and pin of row 0 when the rows are consecutive pins of one port, for a single row store */
+static u8 LEDMTRX_RowPort = 0;
+static u8 LEDMTRX_RowShift = LEDMTRX_ROWS_SCATTERED;
 
-void LEDMTRX_TurnOn(u8 Copy_u8Row, u8 Copy_u8Col)
+/**< 5x7 marquee font, ASCII 32 to 126: one byte per column, bit n for row n */
+static const u8 LEDMTRX_Font[][LEDMTRX_FONT_WIDTH] =
 {
- 
+  { 0x00, 0x00, 0x00, 0x00, 0x00 }, /**< space */
+  { 0x00, 0x00, 0x5F, 0x00, 0x00 }, /**< ! */
+  { 0x00, 0x07, 0x00, 0x07, 0x00 }, /**< " */
+  { 0x14, 0x7F, 0x14, 0x7F, 0x14 }, /**< # */
+  { 0x24, 0x2A, 0x7F, 0x2A, 0x12 }, /**< $ */
+  { 0x23, 0x13, 0x08, 0x64, 0x62 }, /**< % */
+  { 0x36, 0x49, 0x55, 0x22, 0x50 }, /**< & */
+  { 0x00, 0x05, 0x03, 0x00, 0x00 }, /**< ' */
+  { 0x00, 0x1C, 0x22, 0x41, 0x00 }, /**< ( */
+  { 0x00, 0x41, 0x22, 0x1C, 0x00 }, /**< ) */
+  { 0x14, 0x08, 0x3E, 0x08, 0x14 }, /**< * */
+  { 0x08, 0x08, 0x3E, 0x08, 0x08 }, /**< + */
+  { 0x00, 0x50, 0x30, 0x00, 0x00 }, /**< , */
+  { 0x08, 0x08, 0x08, 0x08, 0x08 }, /**< - */
+  { 0x00, 0x60, 0x60, 0x00, 0x00 }, /**< . */
+  { 0x20, 0x10, 0x08, 0x04, 0x02 }, /**< / */
+  { 0x3E, 0x51, 0x49, 0x45, 0x3E }, /**< 0 */
+  { 0x00, 0x42, 0x7F, 0x40, 0x00 }, /**< 1 */
+  { 0x42, 0x61, 0x51, 0x49, 0x46 }, /**< 2 */
+  { 0x21, 0x41, 0x45, 0x4B, 0x31 }, /**< 3 */
+  { 0x18, 0x14, 0x12, 0x7F, 0x10 }, /**< 4 */
+  { 0x27, 0x45, 0x45, 0x45, 0x39 }, /**< 5 */
+  { 0x3C, 0x4A, 0x49, 0x49, 0x30 }, /**< 6 */
+  { 0x01, 0x71, 0x09, 0x05, 0x03 }, /**< 7 */
+  { 0x36, 0x49, 0x49, 0x49, 0x36 }, /**< 8 */
+  { 0x06, 0x49, 0x49, 0x29, 0x1E }, /**< 9 */
+  { 0x00, 0x36, 0x36, 0x00, 0x00 }, /**< : */
+  { 0x00, 0x56, 0x36, 0x00, 0x00 }, /**< ; */
+  { 0x08, 0x14, 0x22, 0x41, 0x00 }, /**< < */
+  { 0x14, 0x14, 0x14, 0x14, 0x14 }, /**< = */
+  { 0x00, 0x41, 0x22, 0x14, 0x08 }, /**< > */
+  { 0x02, 0x01, 0x51, 0x09, 0x06 }, /**< ? */
+  { 0x32, 0x49, 0x79, 0x41, 0x3E }, /**< @ */
+  { 0x7E, 0x11, 0x11, 0x11, 0x7E }, /**< A */
+  { 0x7F, 0x49, 0x49, 0x49, 0x36 }, /**< B */
+  { 0x3E, 0x41, 0x41, 0x41, 0x22 }, /**< C */
+  { 0x7F, 0x41, 0x41, 0x22, 0x1C }, /**< D */
+  { 0x7F, 0x49, 0x49, 0x49, 0x41 }, /**< E */
+  { 0x7F, 0x09, 0x09, 0x09, 0x01 }, /**< F */
+  { 0x3E, 0x41, 0x49, 0x49, 0x7A }, /**< G */
+  { 0x7F, 0x08, 0x08, 0x08, 0x7F }, /**< H */
+  { 0x00, 0x41, 0x7F, 0x41, 0x00 }, /**< I */
+  { 0x20, 0x40, 0x41, 0x3F, 0x01 }, /**< J */
+  { 0x7F, 0x08, 0x14, 0x22, 0x41 }, /**< K */
+  { 0x7F, 0x40, 0x40, 0x40, 0x40 }, /**< L */
+  { 0x7F, 0x02, 0x0C, 0x02, 0x7F }, /**< M */
+  { 0x7F, 0x04, 0x08, 0x10, 0x7F }, /**< N */
+  { 0x3E, 0x41, 0x41, 0x41, 0x3E }, /**< O */
+  { 0x7F, 0x09, 0x09, 0x09, 0x06 }, /**< P */
+  { 0x3E, 0x41, 0x51, 0x21, 0x5E }, /**< Q */
+  { 0x7F, 0x09, 0x19, 0x29, 0x46 }, /**< R */
+  { 0x46, 0x49, 0x49, 0x49, 0x31 }, /**< S */
+  { 0x01, 0x01, 0x7F, 0x01, 0x01 }, /**< T */
+  { 0x3F, 0x40, 0x40, 0x40, 0x3F }, /**< U */
+  { 0x1F, 0x20, 0x40, 0x20, 0x1F }, /**< V */
+  { 0x3F, 0x40, 0x38, 0x40, 0x3F }, /**< W */
+  { 0x63, 0x14, 0x08, 0x14, 0x63 }, /**< X */
+  { 0x07, 0x08, 0x70, 0x08, 0x07 }, /**< Y */
+  { 0x61, 0x51, 0x49, 0x45, 0x43 }, /**< Z */
+  { 0x00, 0x7F, 0x41, 0x41, 0x00 }, /**< [ */
+  { 0x02, 0x04, 0x08, 0x10, 0x20 }, /**< backslash */
+  { 0x00, 0x41, 0x41, 0x7F, 0x00 }, /**< ] */
+  { 0x04, 0x02, 0x01, 0x02, 0x04 }, /**< ^ */
+  { 0x40, 0x40, 0x40, 0x40, 0x40 }, /**< _ */
+  { 0x00, 0x01, 0x02, 0x04, 0x00 }, /**< ` */
+  { 0x20, 0x54, 0x54, 0x54, 0x78 }, /**< a */
+  { 0x7F, 0x48, 0x44, 0x44, 0x38 }, /**< b */
+  { 0x38, 0x44, 0x44, 0x44, 0x20 }, /**< c */
+  { 0x38, 0x44, 0x44, 0x48, 0x7F }, /**< d */
+  { 0x38, 0x54, 0x54, 0x54, 0x18 }, /**< e */
+  { 0x08, 0x7E, 0x09, 0x01, 0x02 }, /**< f */
+  { 0x0C, 0x52, 0x52, 0x52, 0x3E }, /**< g */
+  { 0x7F, 0x08, 0x04, 0x04, 0x78 }, /**< h */
+  { 0x00, 0x44, 0x7D, 0x40, 0x00 }, /**< i */
+  { 0x20, 0x40, 0x44, 0x3D, 0x00 }, /**< j */
+  { 0x7F, 0x10, 0x28, 0x44, 0x00 }, /**< k */
+  { 0x00, 0x41, 0x7F, 0x40, 0x00 }, /**< l */
+  { 0x7C, 0x04, 0x18, 0x04, 0x78 }, /**< m */
+  { 0x7C, 0x08, 0x04, 0x04, 0x78 }, /**< n */
+  { 0x38, 0x44, 0x44, 0x44, 0x38 }, /**< o */
+  { 0x7C, 0x14, 0x14, 0x14, 0x08 }, /**< p */
+  { 0x08, 0x14, 0x14, 0x18, 0x7C }, /**< q */
+  { 0x7C, 0x08, 0x04, 0x04, 0x08 }, /**< r */
+  { 0x48, 0x54, 0x54, 0x54, 0x20 }, /**< s */
+  { 0x04, 0x3F, 0x44, 0x40, 0x20 }, /**< t */
+  { 0x3C, 0x40, 0x40, 0x20, 0x7C }, /**< u */
+  { 0x1C, 0x20, 0x40, 0x20, 0x1C }, /**< v */
+  { 0x3C, 0x40, 0x30, 0x40, 0x3C }, /**< w */
+  { 0x44, 0x28, 0x10, 0x28, 0x44 }, /**< x */
+  { 0x0C, 0x50, 0x50, 0x50, 0x3C }, /**< y */
+  { 0x44, 0x64, 0x54, 0x4C, 0x44 }, /**< z */
+  { 0x00, 0x08, 0x36, 0x41, 0x00 }, /**< { */
+  { 0x00, 0x00, 0x7F, 0x00, 0x00 }, /**< | */
+  { 0x00, 0x41, 0x36, 0x08, 0x00 }, /**< } */
+  { 0x10, 0x08, 0x08, 0x10, 0x08 }  /**< ~ */
+};
+
+/**< Front and back frame buffers, one bit plane per brightness bit and one byte per column; the refresh interrupt reads the front one */
+static volatile u8 LEDMTRX_FrameBuffers[2][LEDMTRX_GRAY_BITS][LEDMTRX_NUM_COLS];
+static volatile u8 LEDMTRX_FrontBuffer = 0;
+static volatile u8 LEDMTRX_SwapPending = 0;
+
+/**< Column and bit plane lit by the next refresh tick */
+static u8 LEDMTRX_NextCol = 0;
+static u8 LEDMTRX_NextPlane = LEDMTRX_GRAY_BITS - 1;
+
+/**< Marquee: text (NULL when stopped), width in columns and first column of the next frame */
+static const char * volatile LEDMTRX_MarqueeText = NULL;
+static u16 LEDMTRX_MarqueeWidth = 0;
+static u16 LEDMTRX_MarqueeOffset = 0;
+
+/**< Animation frames per second, and frame phase counted in refresh cycles */
+static volatile u8 LEDMTRX_AnimationRate = LEDMTRX_ANIMATION_RATE_HZ;
+static u16 LEDMTRX_AnimationPhase = 0;
+
+#if (LEDMTRX_GRAY_BITS < 1) || (LEDMTRX_GRAY_BITS > 8)
+  #error "LEDMTRX_GRAY_BITS must be 1 to 8"
+#endif
+
+#if LEDMTRX_PLANE_UNIT_US < 1
+  #error "The shortest bit plane is under 1 us: lower LEDMTRX_REFRESH_RATE_HZ or LEDMTRX_GRAY_BITS"
+#endif
+
+/**< Whole microsecond planes must keep the refresh near LEDMTRX_REFRESH_RATE_HZ */
+#if ((LEDMTRX_REFRESH_PERIOD_US * LEDMTRX_REFRESH_RATE_HZ * 100UL) > (1000000UL * (100 + LEDMTRX_REFRESH_TOLERANCE))) || \
+    ((LEDMTRX_REFRESH_PERIOD_US * LEDMTRX_REFRESH_RATE_HZ * 100UL) < (1000000UL * (100 - LEDMTRX_REFRESH_TOLERANCE)))
+  #error "The refresh rate is off LEDMTRX_REFRESH_RATE_HZ by more than LEDMTRX_REFRESH_TOLERANCE percent: change LEDMTRX_REFRESH_RATE_HZ or LEDMTRX_GRAY_BITS"
+#endif
+
+/**< The refresh tick must end within the shortest bit plane at the core clock of STK_config.h */
+#if (LEDMTRX_PLANE_UNIT_US * (STK_AHB_FREQUENCY / 1000000UL)) <= LEDMTRX_TICK_CYCLES
+  #error "A refresh tick is longer than the shortest bit plane at STK_AHB_FREQUENCY: lower LEDMTRX_GRAY_BITS or LEDMTRX_REFRESH_RATE_HZ, or raise the core clock"
+#endif
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void LEDMTRX_TurnOn(u8 Copy_Row, u8 Copy_Col)
+{
+  LEDMTRX_SetLedState(Copy_Row, Copy_Col, 1);
 }
 
-void LEDMTRX_TurnOff(u8 Copy_u8Row, u8 Copy_u8Col)
+void LEDMTRX_TurnOff(u8 Copy_Row, u8 Copy_Col)
 {
-  
+  LEDMTRX_SetLedState(Copy_Row, Copy_Col, 0);
 }
 
 void LEDMTRX_Clear(void)
 {
-  
+  u8 Local_Col;
+
+  for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+  {
+    LEDMTRX_SetColumn(LEDMTRX_FrontBuffer ^ 1, Local_Col, 0);
+  }
 }
 
 void LEDMTRX_Init(void)
 {
-  /**< Set Rows as output push-pull with 2MHZ */
-  GPIO_SetPinMode(LEDMTRX_ROW0_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_ROW1_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_ROW2_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_ROW3_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_ROW4_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_ROW5_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_ROW6_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_ROW7_PIN, GPIO_OUTPUT_PP_2MHZ);
-
-  /**< Set columns as output push-pull with 2MHZ */
-  GPIO_SetPinMode(LEDMTRX_COL0_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_COL1_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_COL2_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_COL3_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_COL4_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_COL5_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_COL6_PIN, GPIO_OUTPUT_PP_2MHZ);
-  GPIO_SetPinMode(LEDMTRX_COL7_PIN, GPIO_OUTPUT_PP_2MHZ);
-}
-
-void LEDMTRX_Display(u8 *Copy_Data)
-{
-  /****************************< Column 0 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 0 Date */
-  LEDMTRX_SetRowValues(Copy_Data[0]);
-  /**< Enable Column 0 */
-  GPIO_SetPinValue(LEDMTRX_COL0_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 1 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[1]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL1_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 2 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 2 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[2]);
-  /**< Enable Column 2 */
-  GPIO_SetPinValue(LEDMTRX_COL2_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 3 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[3]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL3_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 4 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[4]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL4_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 5 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[5]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL5_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 6 ****************************/
-  /**< Disable All Columns */
-  LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[6]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL6_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5);
-  /****************************< Column 7 ****************************/
-  /**< Disable All Columns */
+  u8 Local_Index;
+
+  /**< Set rows and columns as output push-pull with 2MHZ, and collect the pins of each port */
+  for (Local_Index = 0; Local_Index < LEDMTRX_NUM_ROWS; Local_Index++)
+  {
+    GPIO_SetPinMode(LEDMTRX_RowPins[Local_Index].Port, LEDMTRX_RowPins[Local_Index].Pin, GPIO_OUTPUT_PP_2MHZ);
+    LEDMTRX_RowMasks[LEDMTRX_RowPins[Local_Index].Port] |= (u16)(1U << LEDMTRX_RowPins[Local_Index].Pin);
+  }
+  for (Local_Index = 0; Local_Index < LEDMTRX_NUM_COLS; Local_Index++)
+  {
+    GPIO_SetPinMode(LEDMTRX_ColPins[Local_Index].Port, LEDMTRX_ColPins[Local_Index].Pin, GPIO_OUTPUT_PP_2MHZ);
+    LEDMTRX_ColMasks[LEDMTRX_ColPins[Local_Index].Port] |= (u16)(1U << LEDMTRX_ColPins[Local_Index].Pin);
+  }
+
+  /**< Rows on consecutive pins of one port are written with a single shifted store */
+  LEDMTRX_RowPort = LEDMTRX_RowPins[0].Port;
+  LEDMTRX_RowShift = LEDMTRX_RowPins[0].Pin;
+  for (Local_Index = 1; Local_Index < LEDMTRX_NUM_ROWS; Local_Index++)
+  {
+    if ((LEDMTRX_RowPins[Local_Index].Port != LEDMTRX_RowPort) || (LEDMTRX_RowPins[Local_Index].Pin != LEDMTRX_RowShift + Local_Index))
+    {
+      LEDMTRX_RowShift = LEDMTRX_ROWS_SCATTERED;
+    }
+  }
+
+  /**< Nothing lit until the refresh starts */
   LEDMTRX_DisableAllCols();
-  /**< Display Column 1 Date */
-  HLEDMTRX_voidSetRowValues(Copy_Data[7]);
-  /**< Enable Column 1 */
-  GPIO_SetPinValue(LEDMTRX_COL7_PIN, GPIO_LOW);
-  /**< Delay for 2.5mse */
-  STK_SetDelay(2.5); 
-  /****************************< Shift left the data ****************************/
-  HLEDMTRX_voidShiftLeft(Copy_Data);
-  /****************************< Set Delay ****************************/
-  STK_SetDelay(500);
+  for (Local_Index = 0; Local_Index < LEDMTRX_NUM_COLS; Local_Index++)
+  {
+    LEDMTRX_SetColumn(0, Local_Index, 0);
+    LEDMTRX_SetColumn(1, Local_Index, 0);
+  }
+  LEDMTRX_FrontBuffer = 0;
+  LEDMTRX_SwapPending = 0;
+  LEDMTRX_NextCol = 0;
+  LEDMTRX_NextPlane = LEDMTRX_GRAY_BITS - 1;
 }
 
+void LEDMTRX_Display(const u8 *Copy_Data)
+{
+  LEDMTRX_ShiftLeft(Copy_Data, 0);
+}
 
-static void LEDMTRX_DisableAllCols(void)
+void LEDMTRX_SetLedState(u8 Copy_Row, u8 Copy_Col, u8 Copy_State)
 {
-  GPIO_SetPinValue(LEDMTRX_COL0_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL1_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL2_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL3_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL4_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL5_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL6_PIN, GPIO_HIGH);
-  GPIO_SetPinValue(LEDMTRX_COL7_PIN, GPIO_HIGH);
+  LEDMTRX_SetLedBrightness(Copy_Row, Copy_Col, Copy_State ? LEDMTRX_MAX_LEVEL : 0);
 }
 
+void LEDMTRX_SetLedBrightness(u8 Copy_Row, u8 Copy_Col, u8 Copy_Level)
+{
+  volatile u8 (*Local_Back)[LEDMTRX_NUM_COLS];
+  u8 Local_Plane;
 
-static void LEDMTRX_SetRowValues(u8 Copy_Value)
+  if ((Copy_Row < LEDMTRX_NUM_ROWS) && (Copy_Col < LEDMTRX_NUM_COLS))
+  {
+#if LEDMTRX_GRAY_BITS < 8
+    /**< At 8 bits every u8 is a level */
+    if (Copy_Level > LEDMTRX_MAX_LEVEL)
+    {
+      Copy_Level = LEDMTRX_MAX_LEVEL;
+    }
+#endif
+
+    /**< Bit n of the level goes to bit plane n */
+    Local_Back = LEDMTRX_FrameBuffers[LEDMTRX_FrontBuffer ^ 1];
+    for (Local_Plane = 0; Local_Plane < LEDMTRX_GRAY_BITS; Local_Plane++)
+    {
+      if (GET_BIT(Copy_Level, Local_Plane))
+      {
+        SET_BIT(Local_Back[Local_Plane][Copy_Col], Copy_Row);
+      }
+      else
+      {
+        CLR_BIT(Local_Back[Local_Plane][Copy_Col], Copy_Row);
+      }
+    }
+  }
+}
+
+void LEDMTRX_SetRowState(u8 Copy_Row, u8 Copy_State)
 {
-  u8 Local_BitValue = 0;
+  u8 Local_Col;
 
-  Local_BitValue = GET_BIT(Copy_Value,0);
-  GPIO_SetPinValue(LEDMTRX_ROW0_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,1);
-  GPIO_SetPinValue(LEDMTRX_ROW1_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,2);
-  GPIO_SetPinValue(LEDMTRX_ROW2_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,3);
-  GPIO_SetPinValue(LEDMTRX_ROW3_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,4);
-  GPIO_SetPinValue(LEDMTRX_ROW4_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,5);
-  GPIO_SetPinValue(LEDMTRX_ROW5_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,6);
-  GPIO_SetPinValue(LEDMTRX_ROW6_PIN, Local_BitValue);
-  Local_BitValue = GET_BIT(Copy_Value,7);
-  GPIO_SetPinValue(LEDMTRX_ROW7_PIN, Local_BitValue);
+  for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+  {
+    LEDMTRX_SetLedState(Copy_Row, Local_Col, Copy_State);
+  }
 }
 
+void LEDMTRX_ShiftLeft(const u8 *Copy_Data, u8 Copy_Shift)
+{
+  u8 Local_Col;
+  u8 Local_Source;
+
+  /**< Cancel a pending swap first, so a half-written back buffer is never swapped in */
+  LEDMTRX_SwapPending = 0;
+
+  Local_Source = Copy_Shift % LEDMTRX_NUM_COLS;
+  for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+  {
+    LEDMTRX_SetColumn(LEDMTRX_FrontBuffer ^ 1, Local_Col, Copy_Data[Local_Source]);
+    Local_Source++;
+    if (Local_Source == LEDMTRX_NUM_COLS)
+    {
+      Local_Source = 0;
+    }
+  }
 
-void LEDMTRX_ShiftLeft(u8 *Copy_Data)
+  LEDMTRX_SwapPending = 1;
+}
+
+void LEDMTRX_DisplayGray(const u8 *Copy_Levels)
 {
-  u8 Local_Temp= 0;
+  volatile u8 (*Local_Back)[LEDMTRX_NUM_COLS];
+  u8 Local_Planes[LEDMTRX_GRAY_BITS];
+  u8 Local_Level;
+  u8 Local_Plane;
+  u8 Local_Row;
+  u8 Local_Col;
 
-  /**< Save the fist element in of the Data in temp variable */
-  Local_Temp = Copy_Data[0];
+  /**< Cancel a pending swap first, so a half-written back buffer is never swapped in */
+  LEDMTRX_SwapPending = 0;
+  Local_Back = LEDMTRX_FrameBuffers[LEDMTRX_FrontBuffer ^ 1];
 
-  /**< Shift data left */ 
-  for (u8 Local_u8ColsIterator = 0; Local_u8ColsIterator < LEDMTRX_NUM_COLS; Local_u8ColsIterator++)
+  for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
   {
-    Copy_Data[Local_u8ColsIterator] = Copy_Data[Local_u8ColsIterator+1];
+    /**< Slice the levels of the column into its bit planes */
+    for (Local_Plane = 0; Local_Plane < LEDMTRX_GRAY_BITS; Local_Plane++)
+    {
+      Local_Planes[Local_Plane] = 0;
+    }
+    for (Local_Row = 0; Local_Row < LEDMTRX_NUM_ROWS; Local_Row++)
+    {
+      Local_Level = Copy_Levels[Local_Row * LEDMTRX_NUM_COLS + Local_Col];
+#if LEDMTRX_GRAY_BITS < 8
+      if (Local_Level > LEDMTRX_MAX_LEVEL)
+      {
+        Local_Level = LEDMTRX_MAX_LEVEL;
+      }
+#endif
+      for (Local_Plane = 0; Local_Plane < LEDMTRX_GRAY_BITS; Local_Plane++)
+      {
+        Local_Planes[Local_Plane] |= (u8)(((Local_Level >> Local_Plane) & 1U) << Local_Row);
+      }
+    }
+    for (Local_Plane = 0; Local_Plane < LEDMTRX_GRAY_BITS; Local_Plane++)
+    {
+      Local_Back[Local_Plane][Local_Col] = Local_Planes[Local_Plane];
+    }
   }
 
-  /**< Set the last column data by the fist one */
-  Copy_Data[LEDMTRX_NUM_COLS-1] = Local_Temp;
+  LEDMTRX_SwapPending = 1;
+}
+
+void LEDMTRX_SwapBuffers(void)
+{
+  LEDMTRX_SwapPending = 1;
+}
+
+u8 LEDMTRX_IsSwapPending(void)
+{
+  return LEDMTRX_SwapPending;
+}
+
+void LEDMTRX_StartMarquee(const char *Copy_Text)
+{
+  u16 Local_Length = 0;
 
+  /**< Stop the running marquee before its state changes */
+  LEDMTRX_MarqueeText = NULL;
+  if (Copy_Text != NULL)
+  {
+    while (Copy_Text[Local_Length] != '\0')
+    {
+      Local_Length++;
+    }
+    LEDMTRX_MarqueeWidth = LEDMTRX_NUM_COLS + Local_Length * LEDMTRX_FONT_ADVANCE;
+    LEDMTRX_MarqueeOffset = 0;
+    LEDMTRX_AnimationPhase = 0;
+    LEDMTRX_MarqueeText = Copy_Text;
+  }
 }
 
+void LEDMTRX_StopMarquee(void)
+{
+  LEDMTRX_MarqueeText = NULL;
+}
 
-void LEDMTRX_DisplayWithShift(u8 *Copy_Data, u16 Copy_DelayMs)
+void LEDMTRX_SetAnimationRate(u8 Copy_RateHz)
 {
-  for(u8 i = 0; i < LEDMTRX_NUM_COLS; i++)
+  if (Copy_RateHz > LEDMTRX_REFRESH_RATE_HZ)
   {
-    LEDMTRX_SetRowValues(Copy_Data[i]);
-    GPIO_SetPinValue(LEDMTRX_COL0_PIN + i, GPIO_LOW);
-    STK_SetDelay(Copy_DelayMs);
-    LEDMTRX_DisableAllCols();
-    LEDMTRX_ShiftLeft(Copy_Data);
+    Copy_RateHz = LEDMTRX_REFRESH_RATE_HZ;
   }
+  LEDMTRX_AnimationRate = Copy_RateHz;
 }
 
+void LEDMTRX_StartRefresh(void)
+{
+  LEDMTRX_NextCol = 0;
+  LEDMTRX_NextPlane = LEDMTRX_GRAY_BITS - 1;
+  /**< The first period is the wait before the first tick: it gets the length of the plane that tick lights */
+  STK_SetIntervalPeriodic(LEDMTRX_PLANE_UNIT_US << (LEDMTRX_GRAY_BITS - 1), LEDMTRX_SysTickRefresh);
+}
+
+void LEDMTRX_StopRefresh(void)
+{
+  STK_Stop();
+  LEDMTRX_DisableAllCols();
+}
+
+void LEDMTRX_Refresh(void)
+{
+  const LEDMTRX_Pin_t *Local_Col = &LEDMTRX_ColPins[LEDMTRX_NextCol];
+  u8 Local_CycleStart = (LEDMTRX_NextCol == 0) && (LEDMTRX_NextPlane == LEDMTRX_GRAY_BITS - 1);
+  u8 Local_Swapped = 0;
+
+  /**< Swap before column 0, so each refresh cycle shows one frame */
+  if (Local_CycleStart && LEDMTRX_SwapPending)
+  {
+    LEDMTRX_FrontBuffer ^= 1;
+    Local_Swapped = 1;
+  }
+
+  /**< Columns off before the rows change, so no LED of the previous column ghosts */
+  LEDMTRX_DisableAllCols();
+  LEDMTRX_SetRowValues(LEDMTRX_FrameBuffers[LEDMTRX_FrontBuffer][LEDMTRX_NextPlane][LEDMTRX_NextCol]);
+  /**< Column on: columns are active low */
+  GPIO_SetPortBits(Local_Col->Port, 0, (u16)(1U << Local_Col->Pin));
+
+  /**< Bit planes from the most significant down, then the next column */
+  if (LEDMTRX_NextPlane == 0)
+  {
+    LEDMTRX_NextPlane = LEDMTRX_GRAY_BITS - 1;
+    LEDMTRX_NextCol++;
+    if (LEDMTRX_NextCol == LEDMTRX_NUM_COLS)
+    {
+      LEDMTRX_NextCol = 0;
+    }
+  }
+  else
+  {
+    LEDMTRX_NextPlane--;
+  }
+
+  /**< The rest of the cycle bookkeeping runs with column 0 already lit, in its longest plane */
+  if (Local_CycleStart)
+  {
+    LEDMTRX_UpdateFrames(Local_Swapped);
+  }
+}
+
+static void LEDMTRX_SysTickRefresh(void)
+{
+  LEDMTRX_Refresh();
+
+  /**< SysTick is already counting this plane; the next period shows the plane lit next */
+  STK_SetNextInterval(LEDMTRX_PLANE_UNIT_US << LEDMTRX_NextPlane);
+}
+
+static void LEDMTRX_DisableAllCols(void)
+{
+  u8 Local_Port;
+
+  for (Local_Port = 0; Local_Port < LEDMTRX_PORT_COUNT; Local_Port++)
+  {
+    if (LEDMTRX_ColMasks[Local_Port] != 0)
+    {
+      GPIO_SetPortBits(Local_Port, LEDMTRX_ColMasks[Local_Port], 0);
+    }
+  }
+}
+
+static void LEDMTRX_SetRowValues(u8 Copy_Value)
+{
+  u16 Local_Set[LEDMTRX_PORT_COUNT] = {0, 0, 0};
+  u8 Local_Row;
+  u8 Local_Port;
+
+  if (LEDMTRX_RowShift != LEDMTRX_ROWS_SCATTERED)
+  {
+    /**< One masked store: lit rows set, the other rows reset */
+    GPIO_SetPortBits(LEDMTRX_RowPort, (u16)((u16)Copy_Value << LEDMTRX_RowShift), (u16)((u16)(~Copy_Value & ((1U << LEDMTRX_NUM_ROWS) - 1)) << LEDMTRX_RowShift));
+  }
+  else
+  {
+    /**< Lit rows of each port; the other row pins of the port go low */
+    for (Local_Row = 0; Local_Row < LEDMTRX_NUM_ROWS; Local_Row++)
+    {
+      if (GET_BIT(Copy_Value, Local_Row))
+      {
+        Local_Set[LEDMTRX_RowPins[Local_Row].Port] |= (u16)(1U << LEDMTRX_RowPins[Local_Row].Pin);
+      }
+    }
+
+    for (Local_Port = 0; Local_Port < LEDMTRX_PORT_COUNT; Local_Port++)
+    {
+      if (LEDMTRX_RowMasks[Local_Port] != 0)
+      {
+        GPIO_SetPortBits(Local_Port, Local_Set[Local_Port], LEDMTRX_RowMasks[Local_Port] & ~Local_Set[Local_Port]);
+      }
+    }
+  }
+}
+
+static void LEDMTRX_SetColumn(u8 Copy_Buffer, u8 Copy_Col, u8 Copy_Value)
+{
+  u8 Local_Plane;
+
+  for (Local_Plane = 0; Local_Plane < LEDMTRX_GRAY_BITS; Local_Plane++)
+  {
+    LEDMTRX_FrameBuffers[Copy_Buffer][Local_Plane][Copy_Col] = Copy_Value;
+  }
+}
+
+static void LEDMTRX_UpdateFrames(u8 Copy_Swapped)
+{
+  const char *Local_Text = LEDMTRX_MarqueeText;
+  volatile u8 (*Local_Front)[LEDMTRX_NUM_COLS];
+  volatile u8 (*Local_Back)[LEDMTRX_NUM_COLS];
+  u16 Local_Index;
+  u8 Local_Plane;
+  u8 Local_Col;
+
+  /**< Start the new back buffer from the frame shown */
+  if (Copy_Swapped)
+  {
+    Local_Front = LEDMTRX_FrameBuffers[LEDMTRX_FrontBuffer];
+    Local_Back = LEDMTRX_FrameBuffers[LEDMTRX_FrontBuffer ^ 1];
+    for (Local_Plane = 0; Local_Plane < LEDMTRX_GRAY_BITS; Local_Plane++)
+    {
+      for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+      {
+        Local_Back[Local_Plane][Local_Col] = Local_Front[Local_Plane][Local_Col];
+      }
+    }
+    LEDMTRX_SwapPending = 0;
+  }
+
+  /**< One animation frame every REFRESH_RATE / ANIMATION_RATE cycles on average */
+  if (Local_Text != NULL)
+  {
+    LEDMTRX_AnimationPhase += LEDMTRX_AnimationRate;
+    if (LEDMTRX_AnimationPhase >= LEDMTRX_REFRESH_RATE_HZ)
+    {
+      LEDMTRX_AnimationPhase -= LEDMTRX_REFRESH_RATE_HZ;
+
+      Local_Index = LEDMTRX_MarqueeOffset;
+      for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+      {
+        LEDMTRX_SetColumn(LEDMTRX_FrontBuffer ^ 1, Local_Col, LEDMTRX_GetMarqueeColumn(Local_Index));
+        Local_Index++;
+        if (Local_Index == LEDMTRX_MarqueeWidth)
+        {
+          Local_Index = 0;
+        }
+      }
+      LEDMTRX_SwapPending = 1;
+
+      LEDMTRX_MarqueeOffset++;
+      if (LEDMTRX_MarqueeOffset == LEDMTRX_MarqueeWidth)
+      {
+        LEDMTRX_MarqueeOffset = 0;
+      }
+    }
+  }
+}
+
+static u8 LEDMTRX_GetMarqueeColumn(u16 Copy_Index)
+{
+  u8 Local_Column = 0;
+  u8 Local_Character;
+  u8 Local_GlyphCol;
+
+  /**< The blank columns come first, so the text enters from the right edge */
+  if (Copy_Index >= LEDMTRX_NUM_COLS)
+  {
+    Copy_Index -= LEDMTRX_NUM_COLS;
+    Local_Character = (u8)LEDMTRX_MarqueeText[Copy_Index / LEDMTRX_FONT_ADVANCE];
+    Local_GlyphCol = Copy_Index % LEDMTRX_FONT_ADVANCE;
+    if ((Local_GlyphCol < LEDMTRX_FONT_WIDTH) && (Local_Character >= LEDMTRX_FONT_FIRST_CHAR) && (Local_Character <= LEDMTRX_FONT_LAST_CHAR))
+    {
+      Local_Column = LEDMTRX_Font[Local_Character - LEDMTRX_FONT_FIRST_CHAR][Local_GlyphCol];
+    }
+  }
+
+  return Local_Column;
+}
@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************************** 
+ * @file TFT_config.h
+ * @brief This file contains the configuration options for the TFT core module.
+ ********************************************************************************************
+ * @date 20 Jul 2023
+ * @version V02
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * @note The panel geometry and pixel format are part of each controller descriptor and are
+ * configured in the controller folders (e.g. TFT_ST7735S_config.h).
+ *
+ * @attention The configuration options in this file should be adjusted according to
+ * the specific TFT display used and the microcontroller's capabilities.
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_CONFIG_H__
+#define __TFT_CONFIG_H__
+
+
+
+/**
+ * @addtogroup TFT_Configuration_Options TFT Configuration Options
+ * @brief Configuration options for the TFT Displays module.
+ * @{
+ */
+
+/**
+ * @brief Defines the default background color for the TFT display.
+ *
+ * This option should be set to the default background color used when clearing the display.
+ * The color is represented in 16-bit RGB565 format.
+ * For example, BLACK can be represented as 0x0000 (RGB565 value).
+ *
+ * User options for this macro include:
+ * - COLOR_BLACK       0x0000   Black Color (RGB565)
+ * - COLOR_WHITE       0xFFFF   White Color (RGB565)
+ * - COLOR_RED         0xF800   Red Color (RGB565)
+ * - COLOR_GREEN       0x07E0   Green Color (RGB565)
+ * - COLOR_BLUE        0x001F   Blue Color (RGB565)
+ * - COLOR_CYAN        0x07FF   Cyan Color (RGB565)
+ * - COLOR_MAGENTA     0xF81F   Magenta Color (RGB565)
+ * - COLOR_YELLOW      0xFFE0   Yellow Color (RGB565)
+ * - COLOR_ORANGE      0xFD20   Orange Color (RGB565)
+ * - COLOR_PURPLE      0x8010   Purple Color (RGB565)
+ * - COLOR_PINK        0xF81F   Pink Color (RGB565)
+ * - COLOR_LIME        0x07E0   Lime Color (RGB565)
+ * - COLOR_TEAL        0x0410   Teal Color (RGB565)
+ * - COLOR_VIOLET      0x801F   Violet Color (RGB565)
+ * - COLOR_BROWN       0xA145   Brown Color (RGB565)
+ */
+#define TFT_DEFAULT_BACKGROUND_COLOR    COLOR_BLACK
+
+/**
+ * @brief Size in pixels of the stack buffer used to stream text.
+ *
+ * A character cell is converted to RGB565 into this buffer, which is sent every time it
+ * fills up, all inside the single pixel burst of the cell. Larger values mean fewer SPI
+ * calls per glyph at the cost of 2 bytes of stack per pixel.
+ */
+#define TFT_TEXT_BUFFER_PIXELS          64
+
+/**
+ * @brief Size in pixels of the stack buffer used to decode compressed images.
+ *
+ * Literals and short runs are expanded into this buffer, which is sent every time it
+ * fills up. It can be smaller than an image line.
+ */
+#define TFT_IMAGE_BUFFER_PIXELS         64
+
+/**
+ * @brief Shortest run of a compressed image sent with a single repeated-color transfer.
+ *
+ * Shorter runs are copied into the decode buffer, which is cheaper than flushing it and
+ * starting a new transfer.
+ */
+#define TFT_IMAGE_RUN_THRESHOLD         16
+
+/**
+ * @brief Size in pixels of the stack buffer used to gather the pixels of rotated blits.
+ *
+ * Unrotated rows are sent straight from the bitmap; rotated ones are read column-wise into
+ * this buffer first.
+ */
+#define TFT_BLIT_BUFFER_PIXELS          64
+
+/**
+ * @brief Size in bytes of the stack buffer used to pack pixels for 12 and 18-bit formats.
+ *
+ * RGB565 pixels are sent as they are; the other packings convert them into this buffer,
+ * which is sent every time it fills up. Keep it a multiple of 6 so a full buffer always
+ * holds whole pixel pairs.
+ */
+#define TFT_PACK_BUFFER_BYTES           96
+
+/**
+ * @brief Defines the communication interface used to communicate with the TFT display.
+ *
+ * This option should be set to the communication interface used to communicate with the TFT display.
+ * For example, if the display uses SPI for communication, set TFT_COMM_INTERFACE to `TFT_COMM_INTERFACE_SPI`.
+ * If the display uses I2C, set `TFT_COMM_INTERFACE` to TFT_COMM_INTERFACE_I2C.
+ */
+#define TFT_COMM_INTERFACE          TFT_COMM_INTERFACE_SPI
+
+/** @} TFT_Configuration_Options */
+
+#endif /**< __TFT_CONFIG_H__ */
@@ -0,0 +1,698 @@
+/**
+ ********************************************************************************************
+ * @file TFT_interface.h
+ * @brief This file contains the interface of the TFT core module.
+ * 
+ * The TFT core holds everything that is common to the TFT controllers: chip-select and
+ * data/command handling, address windows, pixel bursts and the drawing primitives. The
+ * controller specific parts (init sequence, address opcodes, geometry and pixel format) are
+ * described by a @ref TFT_Controller_t descriptor provided by each controller folder
+ * (TFT_ST7735S, TFT_HX8357B, TFT_ILI9481).
+ ********************************************************************************************
+ * @date 20 Jul 2023
+ * @version V02
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * @note Every function takes the display configuration and the SPI peripheral, so several
+ * panels with different controllers can be driven in the same firmware, each one on its
+ * own SPI bus and its own CS/DC/RES pins.
+ *
+ * @note Example Usage:
+ * @code
+ * /// Small ST7735S panel on SPI1 and a large HX8357B panel on SPI2
+ * const TFT_Config_t smallPanel = {
+ *     .TFT_CSPin  = { GPIO_PORTA, GPIO_PIN2 },
+ *     .TFT_DCPin  = { GPIO_PORTA, GPIO_PIN3 },
+ *     .TFT_SDAPin = { GPIO_PORTA, GPIO_PIN7 },
+ *     .TFT_RESPin = { GPIO_PORTA, GPIO_PIN1 },
+ *     .TFT_Controller = &TFT_ST7735S_Controller
+ * };
+ * const TFT_Config_t largePanel = {
+ *     .TFT_CSPin  = { GPIO_PORTB, GPIO_PIN12 },
+ *     .TFT_DCPin  = { GPIO_PORTB, GPIO_PIN10 },
+ *     .TFT_SDAPin = { GPIO_PORTB, GPIO_PIN15 },
+ *     .TFT_RESPin = { GPIO_PORTB, GPIO_PIN11 },
+ *     .TFT_Controller = &TFT_HX8357B_Controller
+ * };
+ *
+ * TFT_Init(&smallPanel, SPI_SelectSpiPeripheral(SPI1));
+ * TFT_Init(&largePanel, SPI_SelectSpiPeripheral(SPI2));
+ * @endcode
+ *
+ * @note A panel may also sit on a 16-bit 8080 parallel bus (see @ref TFT_Bus_t): the pixels
+ * then cost one WR strobe each instead of 16 SPI clocks. The GPIO loop sets the pace, so at
+ * 72 MHz pixels stream about 3 to 6 times and fills run 4 to 8 times faster than on SPI at 36
+ * and 18 MHz (see @ref GPIO_WriteParallel16). The SPI argument of the functions is ignored for
+ * such a panel.
+ *
+ * @see TFT_Configuration_Options for configuration options.
+ * @see TFT_Functions for available functions.
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_INTERFACE_H__
+#define __TFT_INTERFACE_H__
+
+
+/**
+ * @addtogroup TFT_Displays_Module
+ * @{
+ */
+
+/**
+ * @defgroup TFT_Configuration_Options TFT Configuration Options
+ * @brief Configuration options for the TFT Displays module.
+ * @{
+ */
+
+/**
+ * @brief Enumeration of common colors in 16-bit RGB565 format.
+ */
+typedef enum
+{
+    TFT_COLOR_BLACK         = 0x0000,   /**< Black color (0, 0, 0) */
+    TFT_COLOR_WHITE         = 0xFFFF,   /**< White color (255, 255, 255) */
+    TFT_COLOR_RED           = 0xF800,   /**< Red color (255, 0, 0) */
+    TFT_COLOR_GREEN         = 0x07E0,   /**< Green color (0, 255, 0) */
+    TFT_COLOR_BLUE          = 0x001F,   /**< Blue color (0, 0, 255) */
+    TFT_COLOR_YELLOW        = 0xFFE0,   /**< Yellow color (255, 255, 0) */
+    TFT_COLOR_MAGENTA       = 0xF81F,   /**< Magenta color (255, 0, 255) */
+    TFT_COLOR_CYAN          = 0x07FF,   /**< Cyan color (0, 255, 255) */
+    TFT_COLOR_GRAY          = 0x7BEF,   /**< Gray color (128, 128, 128) */
+    TFT_COLOR_ORANGE        = 0xFD20,   /**< Orange color (255, 165, 0) */
+    TFT_COLOR_PINK          = 0xFC18,   /**< Pink color (255, 192, 203) */
+    TFT_COLOR_PURPLE        = 0x8010,   /**< Purple color (128, 0, 128) */
+    TFT_COLOR_BROWN         = 0xA145,   /**< Brown color (165, 42, 42) */
+    TFT_COLOR_GOLD          = 0xFEA0,   /**< Gold color (255, 215, 0) */
+    TFT_COLOR_SILVER        = 0xC618    /**< Silver color (192, 192, 192) */
+} TFT_Color_t;
+
+/**
+ * @struct TFT_PinPairs
+ * @brief Structure to represent GPIO port and pin pairs for TFT signals.
+ *
+ * This structure defines pairs of GPIO port index and pin number that are used to represent TFT signals.
+ * It is designed to be used in configurations for interfacing with TFT modules.
+ */
+typedef struct {
+    u8 TFT_Port : 4; /**< GPIO port index for TFT signals (3 bits). */
+    u8 TFT_Pin  : 4; /**< Pin number for TFT signals (4 bits). */
+} TFT_PinPairs;
+
+/**
+ * @brief Flag ORed into the argument count of an init table entry when a delay byte follows
+ * the arguments.
+ */
+#define TFT_INIT_DELAY              0x80
+
+/**
+ * @brief Delay byte value that stands for 500 ms in an init table (longer than a byte can hold).
+ */
+#define TFT_INIT_DELAY_500MS        255
+
+/**
+ * @brief Controller descriptor, see @ref TFT_Controller.
+ */
+typedef struct TFT_Controller TFT_Controller_t;
+
+/**
+ * @brief Bus between the microcontroller and the panel.
+ */
+typedef enum {
+    TFT_BUS_SPI = 0,                /**< Serial bus: SPI MOSI/SCK, CS and DC (default). */
+    TFT_BUS_PARALLEL_8080           /**< 16-bit 8080 bus: D0-D15 on one port, CS, DC (RS) and WR; RD tied high. */
+} TFT_Bus_t;
+
+/**
+ * @struct TFT_Config_t
+ * @brief TFT LCD Configuration Structure
+ *
+ * This structure defines the configuration parameters for one TFT LCD panel.
+ * It specifies the GPIO port and pin pairs for the panel signals and the controller
+ * descriptor of the panel.
+ */
+typedef struct {
+    TFT_PinPairs TFT_CSPin;                 /**< Chip Select (CS) pin configuration. */
+    TFT_PinPairs TFT_DCPin;                 /**< Data/Command Control (DC) pin configuration. */
+    TFT_PinPairs TFT_SDAPin;                /**< Serial Data Input (SDA) pin configuration. */
+    TFT_PinPairs TFT_RESPin;                /**< LCM Reset (RES) pin configuration. */
+    const TFT_Controller_t *TFT_Controller; /**< Controller descriptor (e.g. &TFT_ST7735S_Controller). */
+    u8 TFT_Bus;                             /**< Bus of the panel, a @ref TFT_Bus_t (SPI when left 0). */
+    u8 TFT_DataPort;                        /**< Parallel bus only: GPIO port of D0-D15, all 16 pins dedicated to the bus. */
+    TFT_PinPairs TFT_WRPin;                 /**< Parallel bus only: write strobe (WR) pin, on another port, high when idle. */
+} TFT_Config_t;
+
+/**
+ * @brief Packing of the pixel stream sent after the memory write command.
+ *
+ * The drawing functions take RGB565 colors whatever the interface pixel format; the core
+ * converts them to the packing of the controller descriptor while streaming.
+ *
+ * @note The parallel bus always streams one RGB565 pixel per bus cycle: a panel on it must be
+ * configured for the 16-bit pixel format.
+ */
+typedef enum {
+    TFT_PIXEL_RGB565 = 0,           /**< 16 bits, 2 bytes per pixel. */
+    TFT_PIXEL_RGB444,               /**< 12 bits, 3 bytes per 2 pixels: R0G0 B0R1 G1B1. */
+    TFT_PIXEL_RGB666                /**< 18 bits, 3 bytes per pixel, each channel in the top 6 bits of a byte. */
+} TFT_PixelPacking_t;
+
+/**
+ * @struct TFT_Controller
+ * @brief TFT controller descriptor.
+ *
+ * Describes what differs between the supported controllers. One constant descriptor is
+ * provided by each controller folder and referenced from @ref TFT_Config_t.
+ */
+struct TFT_Controller {
+    u16 TFT_Width;                  /**< Panel width in pixels. */
+    u16 TFT_Height;                 /**< Panel height in pixels. */
+    u8  TFT_ColumnAddressCommand;   /**< Column address set opcode (CASET). */
+    u8  TFT_RowAddressCommand;      /**< Row/page address set opcode (RASET/PASET). */
+    u8  TFT_MemoryWriteCommand;     /**< Memory write opcode (RAMWR). */
+    u8  TFT_ScrollAreaCommand;      /**< Vertical scrolling definition opcode (VSCRDEF). */
+    u8  TFT_ScrollStartCommand;     /**< Vertical scrolling start address opcode (VSCRSADD). */
+    u16 TFT_FrameMemoryHeight;      /**< Rows of frame memory covered by the scrolling definition. */
+    u8  TFT_RowsMirrored;           /**< 1 when the init table sets MADCTL MY: screen row 0 is the last frame memory row. */
+    u8  TFT_TearOffCommand;         /**< Tearing effect line off opcode (TEOFF). */
+    u8  TFT_TearOnCommand;          /**< Tearing effect line on opcode (TEON). */
+    u8  TFT_TearScanlineCommand;    /**< Tear scanline opcode (STE), 0 when the controller has none. */
+    u8  TFT_PixelFormat;            /**< Interface pixel format parameter sent with COLMOD. */
+    u8  TFT_PixelPacking;           /**< Packing of that pixel format, see @ref TFT_PixelPacking_t. */
+    u8  TFT_ResetHoldDelay;         /**< Delay in ms with RES high before the reset pulse. */
+    u8  TFT_ResetPulseDelay;        /**< Width of the reset pulse in ms. */
+    u8  TFT_ResetReadyDelay;        /**< Delay in ms after the reset pulse before the first command. */
+    const u8 *TFT_InitTable;        /**< Init sequence, see @ref TFT_Init for the encoding. */
+    u16 TFT_InitTableSize;          /**< Size of the init sequence in bytes. */
+};
+
+/**
+ * @brief Glyph descriptor of a @ref TFT_Font_t.
+ *
+ * The glyph bitmap is the tight bounding box of the inked pixels, placed relative to the
+ * pen position (left edge of the character cell) and the top of the text line.
+ */
+typedef struct {
+    u16 TFT_BitmapOffset;           /**< Offset of the glyph bitmap in the font bitmap array, in bytes. */
+    u8  TFT_Width;                  /**< Bitmap width in pixels. */
+    u8  TFT_Height;                 /**< Bitmap height in pixels. */
+    u8  TFT_XAdvance;               /**< Width of the character cell, distance to the next pen position. */
+    s8  TFT_XOffset;                /**< Offset from the pen position to the bitmap left edge. */
+    s8  TFT_YOffset;                /**< Offset from the top of the line to the bitmap top edge. */
+} TFT_Glyph_t;
+
+/**
+ * @brief Font stored in flash.
+ *
+ * Glyph bitmaps are packed row after row without padding, TFT_BitsPerPixel bits per pixel,
+ * most significant bits first. A 1-bpp pixel is either background or ink; a 2-bpp pixel
+ * holds four coverage levels (0 background .. 3 ink) used for anti-aliasing.
+ *
+ * Fonts are generated from BDF files with Tools/bdf2font.py.
+ */
+typedef struct {
+    const u8 *TFT_Bitmap;           /**< Packed glyph bitmaps. */
+    const TFT_Glyph_t *TFT_Glyphs;  /**< Glyph descriptors, from TFT_FirstChar to TFT_LastChar. */
+    u8 TFT_FirstChar;               /**< First character code in the font. */
+    u8 TFT_LastChar;                /**< Last character code in the font. */
+    u8 TFT_LineHeight;              /**< Height of a text line in pixels. */
+    u8 TFT_BitsPerPixel;            /**< 1 or 2. */
+} TFT_Font_t;
+
+/**
+ * @brief Pixel encodings of a @ref TFT_Image_t.
+ */
+typedef enum {
+    TFT_IMAGE_RLE = 0,              /**< Run and literal packets, see @ref TFT_Image_t. */
+    TFT_IMAGE_RGB565,               /**< 2 bytes per pixel, high byte first. */
+    TFT_IMAGE_RGB444,               /**< 12 bits per pixel, two pixels in three bytes (R0G0 B0R1 G1B1). */
+    TFT_IMAGE_INDEXED               /**< TFT_IndexBits (1, 2, 4 or 8) bits per pixel, palette indices. */
+} TFT_ImageFormat_t;
+
+/**
+ * @brief Image stored in flash.
+ *
+ * The pixels are stored row by row in the encoding given by TFT_Format. Packed encodings
+ * (RGB444, INDEXED) do not pad the rows: pixel N of the image starts at bit N times the
+ * pixel size, most significant bits first.
+ *
+ * @ref TFT_IMAGE_RLE images are a sequence of packets; packets may span rows. Each
+ * packet starts with a header byte:
+ *
+ * - bit 7 set: run, the next pixel value is repeated (header & 0x7F) + 1 times;
+ * - bit 7 clear: literal, (header & 0x7F) + 1 pixel values follow.
+ *
+ * A pixel value is one palette index byte when TFT_Palette is set, otherwise an RGB565
+ * color, high byte first.
+ *
+ * Images are generated with Tools/assets.py (or Tools/imgencode.py for RLE only).
+ */
+typedef struct {
+    const u8 *TFT_Data;             /**< Pixel data in the encoding of TFT_Format. */
+    const u16 *TFT_Palette;         /**< RGB565 palette of up to 256 colors, NULL for direct colors. */
+    u16 TFT_Width;                  /**< Image width in pixels. */
+    u16 TFT_Height;                 /**< Image height in pixels. */
+    u8 TFT_Format;                  /**< A @ref TFT_ImageFormat_t. */
+    u8 TFT_IndexBits;               /**< Bits per palette index, @ref TFT_IMAGE_INDEXED only. */
+} TFT_Image_t;
+
+/**
+ * @brief Uncompressed RGB565 image in RAM or flash, the source of the blit functions.
+ *
+ * Sprite sheets are one bitmap; a sprite is a rectangle of it.
+ */
+typedef struct {
+    const u16 *TFT_Pixels;          /**< TFT_Width * TFT_Height pixels, row by row. */
+    u16 TFT_Width;                  /**< Bitmap width in pixels (the distance between two rows). */
+    u16 TFT_Height;                 /**< Bitmap height in pixels. */
+} TFT_Bitmap_t;
+
+/**
+ * @brief Clockwise rotations of a blit.
+ */
+typedef enum {
+    TFT_ROTATE_0 = 0,               /**< As stored. */
+    TFT_ROTATE_90,                  /**< Quarter turn clockwise: the left column becomes the top row. */
+    TFT_ROTATE_180,                 /**< Half turn. */
+    TFT_ROTATE_270                  /**< Quarter turn counterclockwise: the top row becomes the left column. */
+} TFT_Rotation_t;
+
+/** @} TFT_Configuration_Options */
+
+/**
+ * @defgroup TFT_Functions TFT Functions
+ * @brief Functions for controlling the TFT display.
+ * @{
+ */
+
+/**
+ * @brief Initialize the TFT display.
+ *
+ * Pulses the reset line with the delays of the controller descriptor, then sends the
+ * controller init table. The table is a list of entries stored in flash:
+ *
+ * @code
+ * command, argument count [| TFT_INIT_DELAY], arguments..., [delay in ms]
+ * @endcode
+ *
+ * Every command is sent with all its arguments in one chip-select cycle. The delay byte is
+ * only present when @ref TFT_INIT_DELAY is set (@ref TFT_INIT_DELAY_500MS stands for 500 ms).
+ *
+ * @param Copy_TftDisplay Pointer to the TFT configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication with the TFT.
+ *
+ * @note This function sends a series of commands to configure the TFT display.
+ */
+void TFT_Init(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral);
+
+/**
+ * @brief Clears the TFT screen by filling it with the default background color.
+ *
+ * This function clears the entire TFT screen by filling it with the default background color.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @retval None
+ */
+void TFT_ClearScreen(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral);
+
+/**
+ * @brief Draws a pixel at the specified coordinates with the given color.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the pixel.
+ * @param[in] Copy_YPosition The Y-coordinate of the pixel.
+ * @param[in] color The color of the pixel in 16-bit RGB565 format.
+ * @retval None
+ */
+void TFT_DrawPixel(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 color);
+
+/**
+ * @brief Draws a line between two points with the given color.
+ *
+ * This function draws a line between the specified starting point (x1, y1) and
+ * the ending point (x2, y2) with the specified color.
+ *
+ * The line is split into horizontal runs (mostly horizontal lines) or vertical runs
+ * (mostly vertical lines) with Bresenham's run-slice algorithm, and every run is sent as
+ * one address window and one color burst instead of one window per pixel.
+ *
+ * @param[in] x1 The X-coordinate of the starting point.
+ * @param[in] y1 The Y-coordinate of the starting point.
+ * @param[in] x2 The X-coordinate of the ending point.
+ * @param[in] y2 The Y-coordinate of the ending point.
+ * @param[in] color The color of the line in 16-bit RGB565 format.
+ * @retval None
+ */
+void TFT_DrawLine(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 x1, u16 y1, u16 x2, u16 y2, u16 color);
+
+/**
+ * @brief Fills a rectangle with the given color.
+ *
+ * The address window is set once to the rectangle and the color is streamed for all its
+ * pixels. Parts of the rectangle outside the screen are clipped.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The width of the rectangle in pixels.
+ * @param[in] Copy_Height The height of the rectangle in pixels.
+ * @param[in] Copy_Color The fill color in 16-bit RGB565 format.
+ * @retval None
+ */
+void TFT_FillRect(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color);
+
+/**
+ * @brief Draws a horizontal line (span) starting at (x, y) towards the right.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the leftmost pixel.
+ * @param[in] Copy_YPosition The Y-coordinate of the line.
+ * @param[in] Copy_Length The length of the line in pixels.
+ * @param[in] Copy_Color The line color in 16-bit RGB565 format.
+ * @retval None
+ */
+void TFT_DrawHLine(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length, u16 Copy_Color);
+
+/**
+ * @brief Draws a vertical line starting at (x, y) downwards.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the line.
+ * @param[in] Copy_YPosition The Y-coordinate of the topmost pixel.
+ * @param[in] Copy_Length The length of the line in pixels.
+ * @param[in] Copy_Color The line color in 16-bit RGB565 format.
+ * @retval None
+ */
+void TFT_DrawVLine(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length, u16 Copy_Color);
+
+/**
+ * @brief Displays a full-screen image on the TFT screen.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Image Pointer to width * height pixels in RGB565 format, row by row.
+ * @retval None
+ */
+void TFT_DisplayImage(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u16 *Copy_Image);
+
+/**
+ * @brief Draws an image stored in any @ref TFT_ImageFormat_t.
+ *
+ * The image is decoded while it is streamed: one address window is set, then the pixels
+ * are expanded straight into the pixel burst. Images already stored in the packing of the
+ * display (RGB565, or RGB444 when drawn unclipped on a 12-bit display) are sent as they are.
+ * Long RLE runs are sent as one repeated color. Everything else goes
+ * through a stack buffer of @ref TFT_IMAGE_BUFFER_PIXELS pixels. The image is clipped to
+ * the edges of the screen; an RLE image is still read from its first packet.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner of the image, may be negative.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner of the image, may be negative.
+ * @param[in] Copy_Image The compressed image.
+ * @retval None
+ */
+void TFT_DrawImage(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, const TFT_Image_t *Copy_Image);
+
+/**
+ * @brief Writes a block of pixels to a rectangular area of the TFT screen in one burst.
+ *
+ * The address window is set once, then CS and DC are asserted a single time and all the pixels
+ * are streamed back to back before CS is released. The transfer is therefore limited by the SPI
+ * clock instead of by the per-byte chip-select handling of the command path.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner of the area.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner of the area.
+ * @param[in] Copy_Width The width of the area in pixels.
+ * @param[in] Copy_Height The height of the area in pixels.
+ * @param[in] Copy_Pixels Pointer to Copy_Width * Copy_Height pixels in RGB565 format, row by row.
+ * @retval None
+ */
+void TFT_BurstWritePixels(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Pixels);
+
+/**
+ * @brief Fills a rectangular area of the TFT screen with one color in one burst.
+ *
+ * Same as @ref TFT_BurstWritePixels, but the same color is repeated for every pixel of the area,
+ * so no source buffer is needed.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner of the area.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner of the area.
+ * @param[in] Copy_Width The width of the area in pixels.
+ * @param[in] Copy_Height The height of the area in pixels.
+ * @param[in] Copy_Color The fill color in 16-bit RGB565 format.
+ * @retval None
+ */
+void TFT_BurstWriteColor(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color);
+
+/**
+ * @brief Writes a rectangular part of a larger image to the TFT screen in one burst.
+ *
+ * Same as @ref TFT_BurstWritePixels, but the source rows are Copy_Stride pixels apart, so a
+ * sub-rectangle of a bigger image (e.g. one region of a full-screen frame) can be sent without
+ * copying it first. The whole area is still one address window and one chip-select cycle.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner of the area.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner of the area.
+ * @param[in] Copy_Width The width of the area in pixels.
+ * @param[in] Copy_Height The height of the area in pixels.
+ * @param[in] Copy_Pixels Pointer to the first pixel of the area in the source image (RGB565).
+ * @param[in] Copy_Stride The width of the source image in pixels.
+ * @retval None
+ */
+void TFT_BurstWriteStride(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Pixels, u16 Copy_Stride);
+
+/**
+ * @brief Writes an area of 8-bit palette indices to the TFT screen in one burst.
+ *
+ * Same as @ref TFT_BurstWritePixels for a source holding one palette index per pixel, e.g.
+ * a frame buffer at half the RAM of an RGB565 one. The indices are expanded to colors on the
+ * fly while streaming.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner of the area.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner of the area.
+ * @param[in] Copy_Width The width of the area in pixels.
+ * @param[in] Copy_Height The height of the area in pixels.
+ * @param[in] Copy_Indices Pointer to the Copy_Width * Copy_Height indices, row after row.
+ * @param[in] Copy_Palette The RGB565 color of every index used.
+ * @retval None
+ */
+void TFT_BurstWriteIndexed(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u8 *Copy_Indices, const u16 *Copy_Palette);
+
+/**
+ * @brief Draws a rectangle of a bitmap at any position, optionally rotated.
+ *
+ * The source rectangle is clipped to the bitmap and the destination to the screen on all
+ * four edges, so a sprite may be partly or completely off screen. The visible part is one
+ * address window and one pixel burst. Rotations remap the source indices while streaming,
+ * so the controller orientation (MADCTL) is left untouched.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner of the drawn (rotated) rectangle, may be negative.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner of the drawn (rotated) rectangle, may be negative.
+ * @param[in] Copy_Source The bitmap.
+ * @param[in] Copy_SourceX The X-coordinate of the source rectangle in the bitmap.
+ * @param[in] Copy_SourceY The Y-coordinate of the source rectangle in the bitmap.
+ * @param[in] Copy_Width The width of the source rectangle in pixels.
+ * @param[in] Copy_Height The height of the source rectangle in pixels.
+ * @param[in] Copy_Rotation A @ref TFT_Rotation_t; 90 and 270 swap the drawn width and height.
+ * @retval None
+ */
+void TFT_Blit(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, const TFT_Bitmap_t *Copy_Source, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation);
+
+/**
+ * @brief Draws a rectangle of a bitmap with a transparent color.
+ *
+ * Same as @ref TFT_Blit, but pixels of Copy_KeyColor are not drawn. Every row is split into
+ * runs of opaque pixels and each run is sent as its own address window and pixel burst, so
+ * the cost follows the number of runs: keep the transparent areas of sprites contiguous.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner of the drawn (rotated) rectangle, may be negative.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner of the drawn (rotated) rectangle, may be negative.
+ * @param[in] Copy_Source The bitmap.
+ * @param[in] Copy_SourceX The X-coordinate of the source rectangle in the bitmap.
+ * @param[in] Copy_SourceY The Y-coordinate of the source rectangle in the bitmap.
+ * @param[in] Copy_Width The width of the source rectangle in pixels.
+ * @param[in] Copy_Height The height of the source rectangle in pixels.
+ * @param[in] Copy_Rotation A @ref TFT_Rotation_t.
+ * @param[in] Copy_KeyColor The transparent color (RGB565).
+ * @retval None
+ */
+void TFT_BlitKeyed(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, const TFT_Bitmap_t *Copy_Source, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation, u16 Copy_KeyColor);
+
+/**
+ * @brief Sends a single command byte to the TFT display controller.
+ *
+ * Used by the controller init sequences. CS is asserted, the command is sent with DC low,
+ * and CS is released.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Command The command byte to be sent.
+ * @retval None
+ */
+void TFT_SendCommand(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Command);
+
+/**
+ * @brief Defines the vertical scrolling area.
+ *
+ * The frame memory rows are split into a fixed top area, the scrolling area and a fixed
+ * bottom area taking the remaining rows up to TFT_FrameMemoryHeight. Rows are counted in
+ * the screen order: when the controller mirrors the rows (TFT_RowsMirrored), the areas are
+ * sent in the reverse order so the same screen rows scroll.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_TopFixedRows Number of rows of the fixed top area.
+ * @param[in] Copy_ScrollRows Number of rows of the scrolling area.
+ *
+ * @retval 0 The scrolling area was set.
+ * @retval 1 The two areas do not fit in the frame memory.
+ */
+u8 TFT_SetScrollArea(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_TopFixedRows, u16 Copy_ScrollRows);
+
+/**
+ * @brief Sets the row drawn at the top of the scrolling area.
+ *
+ * Scrolling the content by N rows costs this single command: the panel starts scanning
+ * the scrolling area N rows further and wraps around its end. The area is the one given
+ * to @ref TFT_SetScrollArea; it is needed to place the start when the rows are mirrored.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_TopFixedRows Number of rows of the fixed top area.
+ * @param[in] Copy_ScrollRows Number of rows of the scrolling area.
+ * @param[in] Copy_StartRow The row, as drawn with the other functions, from Copy_TopFixedRows
+ *                          to the end of the scrolling area.
+ * @retval None
+ */
+void TFT_SetScrollStart(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_TopFixedRows, u16 Copy_ScrollRows, u16 Copy_StartRow);
+
+/**
+ * @brief Turns the tearing effect (TE) output of the controller on or off.
+ *
+ * When on, the TE pin goes high at the start of every vertical blanking: a write started
+ * on that edge runs ahead of the panel scan instead of being overtaken by it.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Enable 1 to turn the TE output on (vertical blanking only), 0 to turn it off.
+ * @retval None
+ */
+void TFT_SetTearingEffect(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Enable);
+
+/**
+ * @brief Moves the TE pulse to the scan of a given row.
+ *
+ * A region is best rewritten just after the scan has left it: the write then has a whole
+ * refresh period before the scan comes back, e.g. a pulse on the row after the bottom of
+ * the region.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Row The panel row starting the pulse, 0 for the vertical blanking.
+ *
+ * @retval 0 The scanline was set.
+ * @retval 1 The controller has no tear scanline command or the row is off the frame memory.
+ */
+u8 TFT_SetTearScanline(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_Row);
+
+/**
+ * @brief Sends a single data byte to the TFT display controller.
+ *
+ * Used by the controller init sequences. CS is asserted, the byte is sent with DC high,
+ * and CS is released.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Data The data byte to be sent.
+ * @retval None
+ */
+void TFT_SendData(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Data);
+
+/**
+ * @brief Sends a command followed by its parameter bytes in a single chip-select cycle.
+ *
+ * CS is asserted once, the command byte is sent with DC low, then DC is raised and all the
+ * parameter bytes are streamed with @ref SPI_voidTransmit before CS is released.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Command The command byte.
+ * @param[in] Copy_Args Pointer to the parameter bytes (may be NULL when Copy_ArgsCount is 0).
+ * @param[in] Copy_ArgsCount The number of parameter bytes.
+ * @retval None
+ */
+void TFT_SendCommandWithArgs(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Command, const u8 *Copy_Args, u8 Copy_ArgsCount);
+
+/**
+ * @brief Draws text with an opaque background.
+ *
+ * Every character cell (TFT_XAdvance x TFT_LineHeight pixels) is drawn with one address
+ * window and one pixel burst: the background and the ink are both written, so nothing has
+ * to be read back from the display. 2-bpp fonts are blended between Copy_Background and
+ * Copy_Color. Ink outside the character cell is clipped, and so is everything outside the
+ * screen. A '\n' moves the pen back to Copy_XPosition on the next line; characters missing
+ * from the font are skipped.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the left edge of the text.
+ * @param[in] Copy_YPosition The Y-coordinate of the top of the first line.
+ * @param[in] Copy_Text The null-terminated text.
+ * @param[in] Copy_Font The font to draw with.
+ * @param[in] Copy_Color The text color in 16-bit RGB565 format.
+ * @param[in] Copy_Background The background color in 16-bit RGB565 format.
+ * @return The X-coordinate of the pen after the last character.
+ */
+u16 TFT_DrawText(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color, u16 Copy_Background);
+
+/**
+ * @brief Draws text over what is already on the screen.
+ *
+ * Only the ink is drawn, one run of pixels per window. Without the background the
+ * coverage levels of 2-bpp fonts cannot be blended, so pixels at level 2 or above are drawn
+ * in Copy_Color and the others are left untouched. Prefer @ref TFT_DrawText when the
+ * background is known.
+ *
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_XPosition The X-coordinate of the left edge of the text.
+ * @param[in] Copy_YPosition The Y-coordinate of the top of the first line.
+ * @param[in] Copy_Text The null-terminated text.
+ * @param[in] Copy_Font The font to draw with.
+ * @param[in] Copy_Color The text color in 16-bit RGB565 format.
+ * @return The X-coordinate of the pen after the last character.
+ */
+u16 TFT_DrawTextTransparent(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color);
+
+/**
+ * @brief Measures text.
+ *
+ * @param[in] Copy_Text The null-terminated text.
+ * @param[in] Copy_Font The font the text is drawn with.
+ * @return The width in pixels of the longest line of the text.
+ */
+u16 TFT_GetTextWidth(const char *Copy_Text, const TFT_Font_t *Copy_Font);
+
+/** @} TFT_Functions */
+
+/** @} TFT_Displays_Module */
+
+#endif /**< __TFT_INTERFACE_H__ */
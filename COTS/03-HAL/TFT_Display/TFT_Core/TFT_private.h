@@ -0,0 +1,355 @@
+/**
+ ********************************************************************************************
+ * @file TFT_private.h
+ * @brief This file contains private definitions and declarations for the TFT core module.
+ ********************************************************************************************
+ * @date 20 Jul 2023
+ * @version V02
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * @attention This file contains internal/private functions, constants, and structures for
+ * the TFT Displays module. Users of this module should not directly interact with these
+ * definitions as they are intended for internal use only.
+ ********************************************************************************************
+ */
+
+#ifndef __TFT_PRIVATE_H__
+#define __TFT_PRIVATE_H__
+
+/**
+ * @brief RGB565 Color Definitions
+ *
+ * This section defines common RGB565 color values for use in TFT displays.
+ */
+/**********************< Basic Colors **********************/ 
+#define COLOR_BLACK       0x0000   /**< Black Color (RGB565) */
+#define COLOR_WHITE       0xFFFF   /**< White Color (RGB565) */
+#define COLOR_RED         0xF800   /**< Red Color (RGB565) */
+#define COLOR_GREEN       0x07E0   /**< Green Color (RGB565) */
+#define COLOR_BLUE        0x001F   /**< Blue Color (RGB565) */
+
+/**********************< Combinations **********************/
+#define COLOR_CYAN        0x07FF   /**< Cyan Color (RGB565) */
+#define COLOR_MAGENTA     0xF81F   /**< Magenta Color (RGB565) */
+#define COLOR_YELLOW      0xFFE0   /**< Yellow Color (RGB565) */
+#define COLOR_ORANGE      0xFD20   /**< Orange Color (RGB565) */
+#define COLOR_PURPLE      0x8010   /**< Purple Color (RGB565) */
+#define COLOR_PINK        0xF81F   /**< Pink Color (RGB565) */
+#define COLOR_LIME        0x07E0   /**< Lime Color (RGB565) */
+#define COLOR_TEAL        0x0410   /**< Teal Color (RGB565) */
+#define COLOR_VIOLET      0x801F   /**< Violet Color (RGB565) */
+#define COLOR_BROWN       0xA145   /**< Brown Color (RGB565) */
+
+/**
+ * @addtogroup TFT_Private_Functions TFT Private Functions
+ * @brief Internal/private functions for the TFT Displays module.
+ * @{
+ */
+
+/**
+ * @brief Draw one horizontal run of a line and step to the next row.
+ *
+ * Used by @ref TFT_DrawLine for X-major lines. The run covers Copy_Length pixels starting at
+ * the current X position in the direction given by Copy_XAdvance; on return the position is moved
+ * past the run and one row down.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_X Pointer to the current X position, updated by the function.
+ * @param Copy_Y Pointer to the current Y position, updated by the function.
+ * @param Copy_XAdvance +1 for lines going right, -1 for lines going left.
+ * @param Copy_Length The number of pixels in the run (0 draws nothing).
+ * @param Copy_Color The line color in 16-bit RGB565 format.
+ */
+static void TFT_DrawHorizontalRun(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s32 *Copy_X, s32 *Copy_Y, s32 Copy_XAdvance, s32 Copy_Length, u16 Copy_Color);
+
+/**
+ * @brief Draw one vertical run of a line and step to the next column.
+ *
+ * Used by @ref TFT_DrawLine for Y-major lines. The run covers Copy_Length pixels downwards from
+ * the current position; on return the position is moved past the run and one column over.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_X Pointer to the current X position, updated by the function.
+ * @param Copy_Y Pointer to the current Y position, updated by the function.
+ * @param Copy_XAdvance +1 for lines going right, -1 for lines going left.
+ * @param Copy_Length The number of pixels in the run (0 draws nothing).
+ * @param Copy_Color The line color in 16-bit RGB565 format.
+ */
+static void TFT_DrawVerticalRun(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s32 *Copy_X, s32 *Copy_Y, s32 Copy_XAdvance, s32 Copy_Length, u16 Copy_Color);
+
+/**
+ * @brief Set the address window and open a memory write.
+ *
+ * Sends the column and row address commands of the controller with the full start/end
+ * coordinates, then its memory write command. The pixel data that follows fills the window
+ * row by row.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_XStart The first column of the window.
+ * @param Copy_YStart The first row of the window.
+ * @param Copy_XEnd The last column of the window (inclusive).
+ * @param Copy_YEnd The last row of the window (inclusive).
+ */
+static void TFT_SetAddressWindow(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XStart, u16 Copy_YStart, u16 Copy_XEnd, u16 Copy_YEnd);
+
+/**
+ * @brief Select the display and switch the DC line to data for a pixel burst.
+ *
+ * Also selects the display and its pixel packing for @ref TFT_SendPixels and
+ * @ref TFT_SendColor until the end of the burst; the parallel bus always streams RGB565.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ */
+static void TFT_BeginPixelBurst(const TFT_Config_t *Copy_TftDisplay);
+
+/**
+ * @brief Release the display at the end of a pixel burst.
+ *
+ * A pixel still waiting for its pair (odd pixel count in the 12-bit format) is sent
+ * first, padded to whole bytes.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ */
+static void TFT_EndPixelBurst(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral);
+
+/**
+ * @brief Send RGB565 pixels of the current burst in the packing of the display.
+ *
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_Pixels The pixels (RGB565).
+ * @param Copy_Count The number of pixels.
+ */
+static void TFT_SendPixels(const SPI_t Copy_SpiPeripheral, const u16 *Copy_Pixels, u32 Copy_Count);
+
+/**
+ * @brief Send one RGB565 color repeated in the current burst, in the packing of the display.
+ *
+ * The color is packed once into a buffer which is then sent as many times as needed.
+ *
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_Color The color (RGB565).
+ * @param Copy_Count The number of pixels.
+ */
+static void TFT_SendColor(const SPI_t Copy_SpiPeripheral, u16 Copy_Color, u32 Copy_Count);
+
+/**
+ * @brief Write bytes on the bus of the display, with the current CS and DC levels.
+ *
+ * One SPI byte, or one parallel bus cycle with the byte on D0-D7.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication (SPI bus only).
+ * @param Copy_Bytes The bytes.
+ * @param Copy_Count The number of bytes.
+ */
+static void TFT_WriteBytes(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u8 *Copy_Bytes, u32 Copy_Count);
+
+/**
+ * @brief Write 16-bit words on the bus of the display, high byte first on SPI.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication (SPI bus only).
+ * @param Copy_Words The words.
+ * @param Copy_Count The number of words.
+ */
+static void TFT_WriteWords(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u16 *Copy_Words, u32 Copy_Count);
+
+/**
+ * @brief Write the same 16-bit word a number of times on the bus of the display.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication (SPI bus only).
+ * @param Copy_Word The word.
+ * @param Copy_Count The number of times the word is written.
+ */
+static void TFT_WriteRepeated(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_Word, u32 Copy_Count);
+
+/**
+ * @brief Pack one RGB565 pixel in the packing of the current burst.
+ *
+ * In the 12-bit packing a pixel pair shares bytes: the first pixel of a pair is kept
+ * pending and both are written with the second one.
+ *
+ * @param Copy_Buffer Where to write the packed bytes (3 bytes at most).
+ * @param Copy_Color The pixel (RGB565).
+ * @return The number of bytes written.
+ */
+static u8 TFT_PackPixel(u8 *Copy_Buffer, u16 Copy_Color);
+
+/**
+ * @brief Send a controller init table.
+ *
+ * Walks the table entry by entry (see @ref TFT_Init for the encoding), sending each command
+ * with its arguments as one burst through @ref TFT_SendCommandWithArgs and waiting the
+ * requested delays.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_Table Pointer to the init table.
+ * @param Copy_TableSize Size of the init table in bytes.
+ */
+static void TFT_SendInitTable(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u8 *Copy_Table, u16 Copy_TableSize);
+
+/**
+ * @brief Draw one character cell with its background.
+ *
+ * Sets one address window covering the visible part of the cell and streams its pixels,
+ * through a @ref TFT_TEXT_BUFFER_PIXELS stack buffer, in one burst.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_XPosition The X-coordinate of the pen (left edge of the cell).
+ * @param Copy_YPosition The Y-coordinate of the top of the line.
+ * @param Copy_Font The font.
+ * @param Copy_Glyph The glyph to draw.
+ * @param Copy_Palette RGB565 color of each pixel value (2 entries for 1 bpp, 4 for 2 bpp).
+ */
+static void TFT_DrawGlyph(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, const TFT_Font_t *Copy_Font, const TFT_Glyph_t *Copy_Glyph, const u16 *Copy_Palette);
+
+/**
+ * @brief Draw the ink of one glyph as horizontal runs.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_XPosition The X-coordinate of the pen (left edge of the cell).
+ * @param Copy_YPosition The Y-coordinate of the top of the line.
+ * @param Copy_Font The font.
+ * @param Copy_Glyph The glyph to draw.
+ * @param Copy_Color The ink color in RGB565.
+ */
+static void TFT_DrawGlyphInk(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, const TFT_Font_t *Copy_Font, const TFT_Glyph_t *Copy_Glyph, u16 Copy_Color);
+
+/**
+ * @brief Read one pixel value of a glyph bitmap.
+ *
+ * @param Copy_Font The font.
+ * @param Copy_Glyph The glyph.
+ * @param Copy_Index Index of the pixel in the glyph bitmap (row * width + column).
+ * @return The pixel value, 0 .. (1 << TFT_BitsPerPixel) - 1.
+ */
+static u8 TFT_GetGlyphPixel(const TFT_Font_t *Copy_Font, const TFT_Glyph_t *Copy_Glyph, u16 Copy_Index);
+
+/**
+ * @brief Blend two RGB565 colors.
+ *
+ * @param Copy_Background The color at level 0.
+ * @param Copy_Color The color at level Copy_Levels.
+ * @param Copy_Level The blend level.
+ * @param Copy_Levels The number of the last level.
+ * @return The blended color in RGB565.
+ */
+static u16 TFT_BlendColor(u16 Copy_Background, u16 Copy_Color, u8 Copy_Level, u8 Copy_Levels);
+
+/**
+ * @brief Decode a @ref TFT_IMAGE_RLE image into the open pixel burst.
+ *
+ * Packets are read from the first one; the pixels outside the visible rectangle are dropped.
+ *
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_Image The image.
+ * @param Copy_Left First visible column of the image.
+ * @param Copy_Top First visible row of the image.
+ * @param Copy_Width Number of visible columns.
+ * @param Copy_Height Number of visible rows.
+ */
+static void TFT_DecodeRleImage(const SPI_t Copy_SpiPeripheral, const TFT_Image_t *Copy_Image, u16 Copy_Left, u16 Copy_Top, u16 Copy_Width, u16 Copy_Height);
+
+/**
+ * @brief Decode an RGB565, RGB444 or indexed image into the open pixel burst.
+ *
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_Image The image.
+ * @param Copy_Left First visible column of the image.
+ * @param Copy_Top First visible row of the image.
+ * @param Copy_Width Number of visible columns.
+ * @param Copy_Height Number of visible rows.
+ */
+static void TFT_DecodePackedImage(const SPI_t Copy_SpiPeripheral, const TFT_Image_t *Copy_Image, u16 Copy_Left, u16 Copy_Top, u16 Copy_Width, u16 Copy_Height);
+
+/**
+ * @brief Read one pixel of an RGB565, RGB444 or indexed image.
+ *
+ * @param Copy_Image The image.
+ * @param Copy_Index Index of the pixel in the image (row * width + column).
+ * @return The pixel color in RGB565.
+ */
+static u16 TFT_GetPackedPixel(const TFT_Image_t *Copy_Image, u32 Copy_Index);
+
+/**
+ * @brief Clip and draw a blit, see @ref TFT_Blit and @ref TFT_BlitKeyed.
+ *
+ * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_XPosition The X-coordinate of the drawn rectangle.
+ * @param Copy_YPosition The Y-coordinate of the drawn rectangle.
+ * @param Copy_Source The bitmap.
+ * @param Copy_SourceX The X-coordinate of the source rectangle.
+ * @param Copy_SourceY The Y-coordinate of the source rectangle.
+ * @param Copy_Width The width of the source rectangle.
+ * @param Copy_Height The height of the source rectangle.
+ * @param Copy_Rotation A @ref TFT_Rotation_t.
+ * @param Copy_UseKey 1 to skip the pixels of Copy_KeyColor, 0 to draw them all.
+ * @param Copy_KeyColor The transparent color.
+ */
+static void TFT_DrawBlit(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, const TFT_Bitmap_t *Copy_Source, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation, u8 Copy_UseKey, u16 Copy_KeyColor);
+
+/**
+ * @brief Locate one drawn row of a blit in the bitmap.
+ *
+ * @param Copy_Source The bitmap.
+ * @param Copy_SourceX The X-coordinate of the source rectangle.
+ * @param Copy_SourceY The Y-coordinate of the source rectangle.
+ * @param Copy_Width The width of the source rectangle.
+ * @param Copy_Height The height of the source rectangle.
+ * @param Copy_Rotation A @ref TFT_Rotation_t.
+ * @param Copy_Row The drawn row, 0 is the top of the drawn rectangle.
+ * @param Copy_Step Receives the distance in the bitmap between two neighbour pixels of the row.
+ * @return The index in the bitmap of the pixel drawn at the left end of the row. The index
+ *         is returned rather than a pointer: with a negative step, stepping a pointer past the
+ *         end of the row would form an address before the bitmap.
+ */
+static u32 TFT_GetBlitRow(const TFT_Bitmap_t *Copy_Source, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation, u16 Copy_Row, s32 *Copy_Step);
+
+/**
+ * @brief Send pixels read Copy_Step pixels apart into the open pixel burst.
+ *
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_Pixels The bitmap pixels.
+ * @param Copy_Index The index of the first pixel sent.
+ * @param Copy_Step The distance between two pixels, wrapping modulo 2^32 when negative;
+ *        1 sends the pixels straight from memory.
+ * @param Copy_Count The number of pixels.
+ */
+static void TFT_SendStridedPixels(const SPI_t Copy_SpiPeripheral, const u16 *Copy_Pixels, u32 Copy_Index, s32 Copy_Step, u16 Copy_Count);
+
+/**
+ * @brief Add a run of one color to a pixel burst.
+ *
+ * Runs of at least @ref TFT_IMAGE_RUN_THRESHOLD pixels flush the buffer and are sent with
+ * one repeated-color transfer; shorter runs are appended to the buffer, which is sent
+ * whenever it fills up.
+ *
+ * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * @param Copy_Buffer The decode buffer of @ref TFT_IMAGE_BUFFER_PIXELS pixels.
+ * @param Copy_Count Number of pixels waiting in the buffer, updated.
+ * @param Copy_Color The color of the run in RGB565.
+ * @param Copy_Length The length of the run in pixels.
+ */
+static void TFT_StreamRun(const SPI_t Copy_SpiPeripheral, u16 *Copy_Buffer, u16 *Copy_Count, u16 Copy_Color, u16 Copy_Length);
+
+/**
+ * @brief Read one pixel value of a compressed image and advance the stream.
+ *
+ * @param Copy_Image The compressed image.
+ * @param Copy_Data The packet stream position, advanced past the pixel value.
+ * @return The pixel color in RGB565.
+ */
+static u16 TFT_ReadImagePixel(const TFT_Image_t *Copy_Image, const u8 **Copy_Data);
+
+/** @} TFT_Private_Functions */
+
+#endif /**< __TFT_PRIVATE_H__ */
@@ -0,0 +1,1436 @@
+/**
+ ********************************************************************************************
+ * @file TFT_program.c
+ * @brief This file contains the implementation of the TFT core module functions.
+ * 
+ * This module provides functions for interfacing with TFT (Thin-Film Transistor) displays
+ * to control graphical user interfaces (GUIs), display images, and render text.
+ ********************************************************************************************
+ * @date 20 Jul 2023
+ * @version V02
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * @note Everything controller specific is read from the controller descriptor of the
+ * configuration (see @ref TFT_Controller_t).
+ *
+ * @see TFT_interface.h for the public interface and function descriptions.
+ ******************************************************************************************** 
+ */
+
+/**<========================================================================================*/
+/*******************************************< LIB *******************************************/
+/**<========================================================================================*/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+
+/**<=========================================================================================*/
+/*******************************************< MCAL *******************************************/
+/**<=========================================================================================*/
+#include "GPIO_interface.h"
+#include "SPI_interface.h"
+#include "STK_interface.h"
+
+/**<========================================================================================*/
+/*******************************************< HAL *******************************************/
+/**<========================================================================================*/
+#include "TFT_interface.h"
+#include "TFT_private.h"
+#include "TFT_config.h"
+
+/**< Display and pixel packing of the current pixel burst */
+static const TFT_Config_t *TFT_BurstDisplay;
+static u8 TFT_BurstPacking = TFT_PIXEL_RGB565;
+
+/**< First pixel of a pair not sent yet (12-bit packing) */
+static u16 TFT_PendingPixel;
+static u8 TFT_IsPixelPending;
+
+/**<=============================================================================================================*/
+/*******************************************< Functions Implementation *******************************************/
+/**<=============================================================================================================*/
+
+/**
+ * @addtogroup TFT_Public_Functions
+ * @{
+ */
+
+void TFT_Init(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral)
+{
+    const TFT_Controller_t *Local_Controller = Copy_TftDisplay->TFT_Controller;
+
+    /**< Set the Reset (RES) pin to high logic level to release reset signal */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_RESPin.TFT_Port, Copy_TftDisplay->TFT_RESPin.TFT_Pin, GPIO_HIGH);
+    
+    /**< Wait for a specified delay before proceeding */
+    STK_SetDelay(Local_Controller->TFT_ResetHoldDelay);
+    
+    /**< Set the Reset (RST) pin to low logic level to assert reset signal */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_RESPin.TFT_Port, Copy_TftDisplay->TFT_RESPin.TFT_Pin, GPIO_LOW);
+    
+    /**< Wait for a short delay */
+    STK_SetDelay(Local_Controller->TFT_ResetPulseDelay);
+    
+    /**< Set the Reset (RES) pin to high logic level to release reset signal */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_RESPin.TFT_Port, Copy_TftDisplay->TFT_RESPin.TFT_Pin, GPIO_HIGH);
+    
+    /**< Wait for a specified delay before proceeding */
+    STK_SetDelay(Local_Controller->TFT_ResetReadyDelay);
+    
+    /**< Send the controller specific init sequence */
+    TFT_SendInitTable(Copy_TftDisplay, Copy_SpiPeripheral, Local_Controller->TFT_InitTable, Local_Controller->TFT_InitTableSize);
+}
+
+void TFT_ClearScreen(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral)
+{
+    /**< Fill the whole screen with the default background color in one burst */
+    TFT_BurstWriteColor(Copy_TftDisplay, Copy_SpiPeripheral, 0, 0, Copy_TftDisplay->TFT_Controller->TFT_Width,
+                        Copy_TftDisplay->TFT_Controller->TFT_Height, TFT_DEFAULT_BACKGROUND_COLOR);
+}
+
+void TFT_DrawPixel(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 color) 
+{
+    /**< A pixel is a 1x1 window */
+    TFT_FillRect(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition, 1, 1, color);
+}
+
+void TFT_DrawLine(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 x1, u16 y1, u16 x2, u16 y2, u16 color)
+{
+    s32 Local_X;            /**< Start of the next run on the X axis */
+    s32 Local_Y;            /**< Start of the next run on the Y axis */
+    s32 Local_XAdvance;     /**< +1 when the line goes right, -1 when it goes left */
+    s32 Local_XDelta;       /**< Absolute difference in X coordinates */
+    s32 Local_YDelta;       /**< Difference in Y coordinates (lines are always drawn downwards) */
+    s32 Local_WholeStep;    /**< Minimum length of a run */
+    s32 Local_AdjUp;        /**< Error term increment per run */
+    s32 Local_AdjDown;      /**< Error term decrement when a run gets one extra pixel */
+    s32 Local_ErrorTerm;    /**< Decides when a run gets one extra pixel */
+    s32 Local_InitialRun;   /**< Length of the first run */
+    s32 Local_FinalRun;     /**< Length of the last run */
+    s32 Local_RunLength;    /**< Length of the current run */
+    s32 Local_Run;          /**< Run counter */
+
+    /**< Always draw from top to bottom */
+    if (y1 > y2)
+    {
+        u16 Local_Temp;
+        Local_Temp = y1; y1 = y2; y2 = Local_Temp;
+        Local_Temp = x1; x1 = x2; x2 = Local_Temp;
+    }
+
+    Local_X = x1;
+    Local_Y = y1;
+    Local_YDelta = (s32)y2 - y1;
+    Local_XDelta = (s32)x2 - x1;
+    Local_XAdvance = 1;
+    if (Local_XDelta < 0)
+    {
+        Local_XAdvance = -1;
+        Local_XDelta = -Local_XDelta;
+    }
+
+    /**< Axis-aligned lines are a single run */
+    if (Local_YDelta == 0)
+    {
+        TFT_DrawHLine(Copy_TftDisplay, Copy_SpiPeripheral, (x1 < x2) ? x1 : x2, y1, (u16)(Local_XDelta + 1), color);
+        return;
+    }
+    if (Local_XDelta == 0)
+    {
+        TFT_DrawVLine(Copy_TftDisplay, Copy_SpiPeripheral, x1, y1, (u16)(Local_YDelta + 1), color);
+        return;
+    }
+
+    if (Local_XDelta >= Local_YDelta)
+    {
+        /**< X-major line: one horizontal run per row */
+        Local_WholeStep = Local_XDelta / Local_YDelta;
+        Local_AdjUp = (Local_XDelta % Local_YDelta) * 2;
+        Local_AdjDown = Local_YDelta * 2;
+        Local_ErrorTerm = (Local_XDelta % Local_YDelta) - (Local_YDelta * 2);
+
+        /**< The first and last runs share one whole step so the line stays symmetric */
+        Local_InitialRun = (Local_WholeStep / 2) + 1;
+        Local_FinalRun = Local_InitialRun;
+        if ((Local_AdjUp == 0) && ((Local_WholeStep & 0x01) == 0))
+        {
+            Local_InitialRun--;
+        }
+        if ((Local_WholeStep & 0x01) != 0)
+        {
+            Local_ErrorTerm += Local_YDelta;
+        }
+
+        TFT_DrawHorizontalRun(Copy_TftDisplay, Copy_SpiPeripheral, &Local_X, &Local_Y, Local_XAdvance, Local_InitialRun, color);
+        for (Local_Run = 0; Local_Run < (Local_YDelta - 1); Local_Run++)
+        {
+            Local_RunLength = Local_WholeStep;
+            if ((Local_ErrorTerm += Local_AdjUp) > 0)
+            {
+                Local_RunLength++;
+                Local_ErrorTerm -= Local_AdjDown;
+            }
+            TFT_DrawHorizontalRun(Copy_TftDisplay, Copy_SpiPeripheral, &Local_X, &Local_Y, Local_XAdvance, Local_RunLength, color);
+        }
+        TFT_DrawHorizontalRun(Copy_TftDisplay, Copy_SpiPeripheral, &Local_X, &Local_Y, Local_XAdvance, Local_FinalRun, color);
+    }
+    else
+    {
+        /**< Y-major line: one vertical run per column */
+        Local_WholeStep = Local_YDelta / Local_XDelta;
+        Local_AdjUp = (Local_YDelta % Local_XDelta) * 2;
+        Local_AdjDown = Local_XDelta * 2;
+        Local_ErrorTerm = (Local_YDelta % Local_XDelta) - (Local_XDelta * 2);
+
+        /**< The first and last runs share one whole step so the line stays symmetric */
+        Local_InitialRun = (Local_WholeStep / 2) + 1;
+        Local_FinalRun = Local_InitialRun;
+        if ((Local_AdjUp == 0) && ((Local_WholeStep & 0x01) == 0))
+        {
+            Local_InitialRun--;
+        }
+        if ((Local_WholeStep & 0x01) != 0)
+        {
+            Local_ErrorTerm += Local_XDelta;
+        }
+
+        TFT_DrawVerticalRun(Copy_TftDisplay, Copy_SpiPeripheral, &Local_X, &Local_Y, Local_XAdvance, Local_InitialRun, color);
+        for (Local_Run = 0; Local_Run < (Local_XDelta - 1); Local_Run++)
+        {
+            Local_RunLength = Local_WholeStep;
+            if ((Local_ErrorTerm += Local_AdjUp) > 0)
+            {
+                Local_RunLength++;
+                Local_ErrorTerm -= Local_AdjDown;
+            }
+            TFT_DrawVerticalRun(Copy_TftDisplay, Copy_SpiPeripheral, &Local_X, &Local_Y, Local_XAdvance, Local_RunLength, color);
+        }
+        TFT_DrawVerticalRun(Copy_TftDisplay, Copy_SpiPeripheral, &Local_X, &Local_Y, Local_XAdvance, Local_FinalRun, color);
+    }
+}
+
+void TFT_FillRect(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color)
+{
+    u16 Local_Width = Copy_TftDisplay->TFT_Controller->TFT_Width;
+    u16 Local_Height = Copy_TftDisplay->TFT_Controller->TFT_Height;
+
+    /**< Nothing to draw outside the screen */
+    if ((Copy_XPosition >= Local_Width) || (Copy_YPosition >= Local_Height))
+    {
+        return;
+    }
+
+    /**< Clip the right and bottom edges */
+    if (((u32)Copy_XPosition + Copy_Width) > Local_Width)
+    {
+        Copy_Width = Local_Width - Copy_XPosition;
+    }
+    if (((u32)Copy_YPosition + Copy_Height) > Local_Height)
+    {
+        Copy_Height = Local_Height - Copy_YPosition;
+    }
+
+    /**< One window, one burst */
+    TFT_BurstWriteColor(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition, Copy_Width, Copy_Height, Copy_Color);
+}
+
+void TFT_DrawHLine(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length, u16 Copy_Color)
+{
+    TFT_FillRect(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition, Copy_Length, 1, Copy_Color);
+}
+
+void TFT_DrawVLine(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length, u16 Copy_Color)
+{
+    TFT_FillRect(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition, 1, Copy_Length, Copy_Color);
+}
+
+void TFT_DisplayImage(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u16 *Copy_Image)
+{
+    /**< Stream the whole image in one burst */
+    TFT_BurstWritePixels(Copy_TftDisplay, Copy_SpiPeripheral, 0, 0, Copy_TftDisplay->TFT_Controller->TFT_Width,
+                         Copy_TftDisplay->TFT_Controller->TFT_Height, Copy_Image);
+}
+
+void TFT_DrawImage(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, const TFT_Image_t *Copy_Image)
+{
+    s32 Local_Left;
+    s32 Local_Top;
+    s32 Local_Right;
+    s32 Local_Bottom;
+
+    if ((Copy_Image == NULL) || (Copy_Image->TFT_Data == NULL))
+    {
+        return;
+    }
+
+    /**< Visible part of the image, clipped to the screen */
+    Local_Left = (Copy_XPosition < 0) ? 0 : Copy_XPosition;
+    Local_Top = (Copy_YPosition < 0) ? 0 : Copy_YPosition;
+    Local_Right = (s32)Copy_XPosition + Copy_Image->TFT_Width;
+    Local_Bottom = (s32)Copy_YPosition + Copy_Image->TFT_Height;
+    if (Local_Right > Copy_TftDisplay->TFT_Controller->TFT_Width)
+    {
+        Local_Right = Copy_TftDisplay->TFT_Controller->TFT_Width;
+    }
+    if (Local_Bottom > Copy_TftDisplay->TFT_Controller->TFT_Height)
+    {
+        Local_Bottom = Copy_TftDisplay->TFT_Controller->TFT_Height;
+    }
+    if ((Local_Left >= Local_Right) || (Local_Top >= Local_Bottom))
+    {
+        return;
+    }
+
+    TFT_SetAddressWindow(Copy_TftDisplay, Copy_SpiPeripheral, (u16)Local_Left, (u16)Local_Top, (u16)(Local_Right - 1), (u16)(Local_Bottom - 1));
+
+    /**< Decode the pixels straight into one pixel burst */
+    TFT_BeginPixelBurst(Copy_TftDisplay);
+    if (Copy_Image->TFT_Format == TFT_IMAGE_RLE)
+    {
+        TFT_DecodeRleImage(Copy_SpiPeripheral, Copy_Image, (u16)(Local_Left - Copy_XPosition), (u16)(Local_Top - Copy_YPosition),
+                           (u16)(Local_Right - Local_Left), (u16)(Local_Bottom - Local_Top));
+    }
+    else
+    {
+        TFT_DecodePackedImage(Copy_SpiPeripheral, Copy_Image, (u16)(Local_Left - Copy_XPosition), (u16)(Local_Top - Copy_YPosition),
+                              (u16)(Local_Right - Local_Left), (u16)(Local_Bottom - Local_Top));
+    }
+    TFT_EndPixelBurst(Copy_TftDisplay, Copy_SpiPeripheral);
+}
+
+void TFT_BurstWritePixels(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Pixels)
+{
+    if ((Copy_Pixels == NULL) || (Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    /**< Set the address window once for the whole area */
+    TFT_SetAddressWindow(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition,
+                         Copy_XPosition + Copy_Width - 1, Copy_YPosition + Copy_Height - 1);
+
+    /**< Stream all the pixels inside one chip-select cycle */
+    TFT_BeginPixelBurst(Copy_TftDisplay);
+    TFT_SendPixels(Copy_SpiPeripheral, Copy_Pixels, (u32)Copy_Width * Copy_Height);
+    TFT_EndPixelBurst(Copy_TftDisplay, Copy_SpiPeripheral);
+}
+
+void TFT_BurstWriteColor(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color)
+{
+    if ((Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    /**< Set the address window once for the whole area */
+    TFT_SetAddressWindow(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition,
+                         Copy_XPosition + Copy_Width - 1, Copy_YPosition + Copy_Height - 1);
+
+    /**< Repeat the color inside one chip-select cycle */
+    TFT_BeginPixelBurst(Copy_TftDisplay);
+    TFT_SendColor(Copy_SpiPeripheral, Copy_Color, (u32)Copy_Width * Copy_Height);
+    TFT_EndPixelBurst(Copy_TftDisplay, Copy_SpiPeripheral);
+}
+
+void TFT_BurstWriteStride(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Pixels, u16 Copy_Stride)
+{
+    u16 Local_Row;
+
+    if ((Copy_Pixels == NULL) || (Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    /**< Set the address window once for the whole area */
+    TFT_SetAddressWindow(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition,
+                         Copy_XPosition + Copy_Width - 1, Copy_YPosition + Copy_Height - 1);
+
+    /**< Stream the area row by row inside one chip-select cycle */
+    TFT_BeginPixelBurst(Copy_TftDisplay);
+    for (Local_Row = 0; Local_Row < Copy_Height; Local_Row++)
+    {
+        TFT_SendPixels(Copy_SpiPeripheral, Copy_Pixels, Copy_Width);
+        Copy_Pixels += Copy_Stride;
+    }
+    TFT_EndPixelBurst(Copy_TftDisplay, Copy_SpiPeripheral);
+}
+
+void TFT_BurstWriteIndexed(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u8 *Copy_Indices, const u16 *Copy_Palette)
+{
+    u16 Local_Buffer[TFT_IMAGE_BUFFER_PIXELS];
+    u16 Local_Count = 0;
+    u32 Local_Remaining;
+
+    if ((Copy_Indices == NULL) || (Copy_Palette == NULL) || (Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    /**< Set the address window once for the whole area */
+    TFT_SetAddressWindow(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition,
+                         Copy_XPosition + Copy_Width - 1, Copy_YPosition + Copy_Height - 1);
+
+    /**< Expand the indices through the buffer inside one chip-select cycle */
+    TFT_BeginPixelBurst(Copy_TftDisplay);
+    for (Local_Remaining = (u32)Copy_Width * Copy_Height; Local_Remaining > 0; Local_Remaining--)
+    {
+        Local_Buffer[Local_Count++] = Copy_Palette[*Copy_Indices++];
+        if (Local_Count == TFT_IMAGE_BUFFER_PIXELS)
+        {
+            TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+            Local_Count = 0;
+        }
+    }
+    if (Local_Count > 0)
+    {
+        TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+    }
+    TFT_EndPixelBurst(Copy_TftDisplay, Copy_SpiPeripheral);
+}
+
+void TFT_Blit(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, const TFT_Bitmap_t *Copy_Source, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation)
+{
+    TFT_DrawBlit(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition, Copy_Source, Copy_SourceX, Copy_SourceY, Copy_Width, Copy_Height, Copy_Rotation, 0, 0);
+}
+
+void TFT_BlitKeyed(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, const TFT_Bitmap_t *Copy_Source, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation, u16 Copy_KeyColor)
+{
+    TFT_DrawBlit(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition, Copy_Source, Copy_SourceX, Copy_SourceY, Copy_Width, Copy_Height, Copy_Rotation, 1, Copy_KeyColor);
+}
+
+void TFT_SendCommand(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Command)
+{
+    /**<  Set CS (Chip Select) pin low to select the TFT display for communication */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin,GPIO_LOW); 
+
+    /**< Set DC (Data/Command Control) pin low to indicate command mode */ 
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_DCPin.TFT_Port, Copy_TftDisplay->TFT_DCPin.TFT_Pin,GPIO_LOW); 
+
+    /**< Send the command byte */ 
+    TFT_WriteBytes(Copy_TftDisplay, Copy_SpiPeripheral, &Copy_Command, 1); 
+
+    /**< Set CS pin high to release the TFT display */ 
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin, GPIO_HIGH); 
+}
+
+u8 TFT_SetScrollArea(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_TopFixedRows, u16 Copy_ScrollRows)
+{
+    u8 Local_u8ErrorStatus = 0;
+    const TFT_Controller_t *Local_Controller = Copy_TftDisplay->TFT_Controller;
+    u16 Local_BottomFixedRows;
+    u16 Local_Swap;
+    u8 Local_Args[6];
+
+    if (((u32)Copy_TopFixedRows + Copy_ScrollRows) > Local_Controller->TFT_FrameMemoryHeight)
+    {
+        Local_u8ErrorStatus = 1;
+    }
+    else
+    {
+        Local_BottomFixedRows = Local_Controller->TFT_FrameMemoryHeight - Copy_TopFixedRows - Copy_ScrollRows;
+
+        /**< Mirrored rows: the fixed rows at the top of the screen are at the end of the frame memory */
+        if (Local_Controller->TFT_RowsMirrored)
+        {
+            Local_Swap = Copy_TopFixedRows;
+            Copy_TopFixedRows = Local_BottomFixedRows;
+            Local_BottomFixedRows = Local_Swap;
+        }
+
+        /**< Top fixed, scrolling and bottom fixed heights, high byte first */
+        Local_Args[0] = (u8)(Copy_TopFixedRows >> 8);
+        Local_Args[1] = (u8)Copy_TopFixedRows;
+        Local_Args[2] = (u8)(Copy_ScrollRows >> 8);
+        Local_Args[3] = (u8)Copy_ScrollRows;
+        Local_Args[4] = (u8)(Local_BottomFixedRows >> 8);
+        Local_Args[5] = (u8)Local_BottomFixedRows;
+        TFT_SendCommandWithArgs(Copy_TftDisplay, Copy_SpiPeripheral, Local_Controller->TFT_ScrollAreaCommand, Local_Args, 6);
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+void TFT_SetScrollStart(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_TopFixedRows, u16 Copy_ScrollRows, u16 Copy_StartRow)
+{
+    const TFT_Controller_t *Local_Controller = Copy_TftDisplay->TFT_Controller;
+    u16 Local_MemoryRow = Copy_StartRow;
+    u8 Local_Args[2];
+
+    /**
+     * Mirrored rows: the panel scans the area upwards on the screen, from its bottom row, so
+     * the start address is the frame memory row of the screen row shown at the bottom.
+     */
+    if (Local_Controller->TFT_RowsMirrored)
+    {
+        Local_MemoryRow = (Copy_StartRow == Copy_TopFixedRows) ? (u16)(Local_Controller->TFT_FrameMemoryHeight - Copy_TopFixedRows - Copy_ScrollRows)
+                                                               : (u16)(Local_Controller->TFT_FrameMemoryHeight - Copy_StartRow);
+    }
+
+    Local_Args[0] = (u8)(Local_MemoryRow >> 8);
+    Local_Args[1] = (u8)Local_MemoryRow;
+    TFT_SendCommandWithArgs(Copy_TftDisplay, Copy_SpiPeripheral, Local_Controller->TFT_ScrollStartCommand, Local_Args, 2);
+}
+
+void TFT_SetTearingEffect(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Enable)
+{
+    /**< Mode 0: pulses on vertical blanking only */
+    u8 Local_Mode = 0x00;
+
+    if (Copy_Enable)
+    {
+        TFT_SendCommandWithArgs(Copy_TftDisplay, Copy_SpiPeripheral, Copy_TftDisplay->TFT_Controller->TFT_TearOnCommand, &Local_Mode, 1);
+    }
+    else
+    {
+        TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, Copy_TftDisplay->TFT_Controller->TFT_TearOffCommand);
+    }
+}
+
+u8 TFT_SetTearScanline(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_Row)
+{
+    u8 Local_u8ErrorStatus = 0;
+    const TFT_Controller_t *Local_Controller = Copy_TftDisplay->TFT_Controller;
+    u8 Local_Args[2] = { (u8)(Copy_Row >> 8), (u8)Copy_Row };
+
+    if ((Local_Controller->TFT_TearScanlineCommand == 0) || (Copy_Row >= Local_Controller->TFT_FrameMemoryHeight))
+    {
+        Local_u8ErrorStatus = 1;
+    }
+    else
+    {
+        TFT_SendCommandWithArgs(Copy_TftDisplay, Copy_SpiPeripheral, Local_Controller->TFT_TearScanlineCommand, Local_Args, 2);
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+void TFT_SendData(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Data)
+{
+    /**<  Set CS (Chip Select) pin low to select the TFT display for communication */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin, GPIO_LOW); 
+
+    /**< Set DC (Data/Command Control) pin low to indicate command mode */ 
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_DCPin.TFT_Port, Copy_TftDisplay->TFT_DCPin.TFT_Pin, GPIO_HIGH); 
+
+    /**< Send the data byte */ 
+    TFT_WriteBytes(Copy_TftDisplay, Copy_SpiPeripheral, &Copy_Data, 1); 
+
+    /**< Set CS pin high to release the TFT display */ 
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin,GPIO_HIGH); 
+}
+
+void TFT_SendCommandWithArgs(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Command, const u8 *Copy_Args, u8 Copy_ArgsCount)
+{
+    /**<  Set CS (Chip Select) pin low to select the TFT display for the whole command */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin, GPIO_LOW);
+
+    /**< Send the command byte with DC low */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_DCPin.TFT_Port, Copy_TftDisplay->TFT_DCPin.TFT_Pin, GPIO_LOW);
+    TFT_WriteBytes(Copy_TftDisplay, Copy_SpiPeripheral, &Copy_Command, 1);
+
+    /**< Send all the parameter bytes with DC high */
+    if (Copy_ArgsCount > 0)
+    {
+        GPIO_SetPinValue(Copy_TftDisplay->TFT_DCPin.TFT_Port, Copy_TftDisplay->TFT_DCPin.TFT_Pin, GPIO_HIGH);
+        TFT_WriteBytes(Copy_TftDisplay, Copy_SpiPeripheral, Copy_Args, Copy_ArgsCount);
+    }
+
+    /**< Set CS pin high to release the TFT display */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin, GPIO_HIGH);
+}
+
+u16 TFT_DrawText(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color, u16 Copy_Background)
+{
+    u16 Local_Palette[4];
+    u16 Local_X = Copy_XPosition;
+    const TFT_Glyph_t *Local_Glyph;
+    u8 Local_Character;
+    u8 Local_Levels;
+    u8 Local_Level;
+
+    if ((Copy_Text == NULL) || (Copy_Font == NULL) || (Copy_Font->TFT_BitsPerPixel < 1) || (Copy_Font->TFT_BitsPerPixel > 2))
+    {
+        return Copy_XPosition;
+    }
+
+    /**< Color of every pixel value, blended once for the whole text */
+    Local_Levels = (1 << Copy_Font->TFT_BitsPerPixel) - 1;
+    for (Local_Level = 0; Local_Level <= Local_Levels; Local_Level++)
+    {
+        Local_Palette[Local_Level] = TFT_BlendColor(Copy_Background, Copy_Color, Local_Level, Local_Levels);
+    }
+
+    while (*Copy_Text != '\0')
+    {
+        Local_Character = (u8)*Copy_Text++;
+
+        if (Local_Character == '\n')
+        {
+            /**< Back to the left edge of the text, one line down */
+            Local_X = Copy_XPosition;
+            Copy_YPosition += Copy_Font->TFT_LineHeight;
+        }
+        else if ((Local_Character >= Copy_Font->TFT_FirstChar) && (Local_Character <= Copy_Font->TFT_LastChar))
+        {
+            /**< One window and one burst per character cell */
+            Local_Glyph = &Copy_Font->TFT_Glyphs[Local_Character - Copy_Font->TFT_FirstChar];
+            TFT_DrawGlyph(Copy_TftDisplay, Copy_SpiPeripheral, Local_X, Copy_YPosition, Copy_Font, Local_Glyph, Local_Palette);
+            Local_X += Local_Glyph->TFT_XAdvance;
+        }
+    }
+
+    return Local_X;
+}
+
+u16 TFT_DrawTextTransparent(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color)
+{
+    u16 Local_X = Copy_XPosition;
+    const TFT_Glyph_t *Local_Glyph;
+    u8 Local_Character;
+
+    if ((Copy_Text == NULL) || (Copy_Font == NULL) || (Copy_Font->TFT_BitsPerPixel < 1) || (Copy_Font->TFT_BitsPerPixel > 2))
+    {
+        return Copy_XPosition;
+    }
+
+    while (*Copy_Text != '\0')
+    {
+        Local_Character = (u8)*Copy_Text++;
+
+        if (Local_Character == '\n')
+        {
+            /**< Back to the left edge of the text, one line down */
+            Local_X = Copy_XPosition;
+            Copy_YPosition += Copy_Font->TFT_LineHeight;
+        }
+        else if ((Local_Character >= Copy_Font->TFT_FirstChar) && (Local_Character <= Copy_Font->TFT_LastChar))
+        {
+            Local_Glyph = &Copy_Font->TFT_Glyphs[Local_Character - Copy_Font->TFT_FirstChar];
+            TFT_DrawGlyphInk(Copy_TftDisplay, Copy_SpiPeripheral, Local_X, Copy_YPosition, Copy_Font, Local_Glyph, Copy_Color);
+            Local_X += Local_Glyph->TFT_XAdvance;
+        }
+    }
+
+    return Local_X;
+}
+
+u16 TFT_GetTextWidth(const char *Copy_Text, const TFT_Font_t *Copy_Font)
+{
+    u16 Local_LineWidth = 0;
+    u16 Local_MaxWidth = 0;
+    u8 Local_Character;
+
+    if ((Copy_Text == NULL) || (Copy_Font == NULL))
+    {
+        return 0;
+    }
+
+    while (*Copy_Text != '\0')
+    {
+        Local_Character = (u8)*Copy_Text++;
+
+        if (Local_Character == '\n')
+        {
+            Local_LineWidth = 0;
+        }
+        else if ((Local_Character >= Copy_Font->TFT_FirstChar) && (Local_Character <= Copy_Font->TFT_LastChar))
+        {
+            Local_LineWidth += Copy_Font->TFT_Glyphs[Local_Character - Copy_Font->TFT_FirstChar].TFT_XAdvance;
+        }
+
+        if (Local_LineWidth > Local_MaxWidth)
+        {
+            Local_MaxWidth = Local_LineWidth;
+        }
+    }
+
+    return Local_MaxWidth;
+}
+
+/**
+ * @} TFT_Public_Functions
+ */
+
+/**
+ * @addtogroup TFT_Private_Functions
+ * @{
+ */
+
+static void TFT_DrawHorizontalRun(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s32 *Copy_X, s32 *Copy_Y, s32 Copy_XAdvance, s32 Copy_Length, u16 Copy_Color)
+{
+    if (Copy_Length > 0)
+    {
+        /**< The run starts at the current X and extends in the direction of the line */
+        if (Copy_XAdvance > 0)
+        {
+            TFT_DrawHLine(Copy_TftDisplay, Copy_SpiPeripheral, (u16)*Copy_X, (u16)*Copy_Y, (u16)Copy_Length, Copy_Color);
+        }
+        else
+        {
+            TFT_DrawHLine(Copy_TftDisplay, Copy_SpiPeripheral, (u16)(*Copy_X - Copy_Length + 1), (u16)*Copy_Y, (u16)Copy_Length, Copy_Color);
+        }
+        *Copy_X += Copy_XAdvance * Copy_Length;
+    }
+
+    /**< Next run is on the next row */
+    (*Copy_Y)++;
+}
+
+static void TFT_DrawVerticalRun(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s32 *Copy_X, s32 *Copy_Y, s32 Copy_XAdvance, s32 Copy_Length, u16 Copy_Color)
+{
+    if (Copy_Length > 0)
+    {
+        TFT_DrawVLine(Copy_TftDisplay, Copy_SpiPeripheral, (u16)*Copy_X, (u16)*Copy_Y, (u16)Copy_Length, Copy_Color);
+        *Copy_Y += Copy_Length;
+    }
+
+    /**< Next run is on the next column */
+    *Copy_X += Copy_XAdvance;
+}
+
+static void TFT_SetAddressWindow(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XStart, u16 Copy_YStart, u16 Copy_XEnd, u16 Copy_YEnd)
+{
+    const TFT_Controller_t *Local_Controller = Copy_TftDisplay->TFT_Controller;
+
+    /**< Start and end coordinates, high byte first */
+    u8 Local_Columns[4] = { (u8)(Copy_XStart >> 8), (u8)Copy_XStart, (u8)(Copy_XEnd >> 8), (u8)Copy_XEnd };
+    u8 Local_Rows[4]    = { (u8)(Copy_YStart >> 8), (u8)Copy_YStart, (u8)(Copy_YEnd >> 8), (u8)Copy_YEnd };
+
+    TFT_SendCommandWithArgs(Copy_TftDisplay, Copy_SpiPeripheral, Local_Controller->TFT_ColumnAddressCommand, Local_Columns, 4);  /**< Column window */
+    TFT_SendCommandWithArgs(Copy_TftDisplay, Copy_SpiPeripheral, Local_Controller->TFT_RowAddressCommand, Local_Rows, 4);        /**< Row window */
+    TFT_SendCommandWithArgs(Copy_TftDisplay, Copy_SpiPeripheral, Local_Controller->TFT_MemoryWriteCommand, NULL, 0);            /**< Open the memory write */
+}
+
+static void TFT_BeginPixelBurst(const TFT_Config_t *Copy_TftDisplay)
+{
+    /**< Select the display and stay in data mode for the whole burst */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin, GPIO_LOW);
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_DCPin.TFT_Port, Copy_TftDisplay->TFT_DCPin.TFT_Pin, GPIO_HIGH);
+
+    /**< Pixels are packed for the display until the end of the burst, one word per cycle on the parallel bus */
+    TFT_BurstDisplay = Copy_TftDisplay;
+    TFT_BurstPacking = Copy_TftDisplay->TFT_Controller->TFT_PixelPacking;
+    if (Copy_TftDisplay->TFT_Bus == TFT_BUS_PARALLEL_8080)
+    {
+        TFT_BurstPacking = TFT_PIXEL_RGB565;
+    }
+    TFT_IsPixelPending = 0;
+}
+
+static void TFT_EndPixelBurst(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral)
+{
+    u8 Local_Bytes[2];
+
+    /**< Send a lone last pixel in two bytes, the controller drops the padding bits */
+    if (TFT_IsPixelPending)
+    {
+        Local_Bytes[0] = (u8)(TFT_PendingPixel >> 4);
+        Local_Bytes[1] = (u8)(TFT_PendingPixel << 4);
+        TFT_WriteBytes(Copy_TftDisplay, Copy_SpiPeripheral, Local_Bytes, 2);
+        TFT_IsPixelPending = 0;
+    }
+
+    /**< Release the display */
+    GPIO_SetPinValue(Copy_TftDisplay->TFT_CSPin.TFT_Port, Copy_TftDisplay->TFT_CSPin.TFT_Pin, GPIO_HIGH);
+}
+
+static void TFT_SendPixels(const SPI_t Copy_SpiPeripheral, const u16 *Copy_Pixels, u32 Copy_Count)
+{
+    u8 Local_Buffer[TFT_PACK_BUFFER_BYTES];
+    u16 Local_Length = 0;
+
+    if (TFT_BurstPacking == TFT_PIXEL_RGB565)
+    {
+        /**< Native format of the colors, one word per pixel */
+        TFT_WriteWords(TFT_BurstDisplay, Copy_SpiPeripheral, Copy_Pixels, Copy_Count);
+        return;
+    }
+
+    while (Copy_Count-- > 0)
+    {
+        /**< Keep room for the longest packed pixel */
+        if ((Local_Length + 3) > TFT_PACK_BUFFER_BYTES)
+        {
+            TFT_WriteBytes(TFT_BurstDisplay, Copy_SpiPeripheral, Local_Buffer, Local_Length);
+            Local_Length = 0;
+        }
+        Local_Length += TFT_PackPixel(&Local_Buffer[Local_Length], *Copy_Pixels++);
+    }
+    if (Local_Length > 0)
+    {
+        TFT_WriteBytes(TFT_BurstDisplay, Copy_SpiPeripheral, Local_Buffer, Local_Length);
+    }
+}
+
+static void TFT_SendColor(const SPI_t Copy_SpiPeripheral, u16 Copy_Color, u32 Copy_Count)
+{
+    u8 Local_Buffer[TFT_PACK_BUFFER_BYTES];
+    u16 Local_Length = 0;
+    u16 Local_BufferPixels;
+    u16 Local_Pixel;
+
+    if (TFT_BurstPacking == TFT_PIXEL_RGB565)
+    {
+        TFT_WriteRepeated(TFT_BurstDisplay, Copy_SpiPeripheral, Copy_Color, Copy_Count);
+        return;
+    }
+
+    /**< Complete the pair left open by the previous pixels */
+    if (TFT_IsPixelPending && (Copy_Count > 0))
+    {
+        Local_Length = TFT_PackPixel(Local_Buffer, Copy_Color);
+        TFT_WriteBytes(TFT_BurstDisplay, Copy_SpiPeripheral, Local_Buffer, Local_Length);
+        Copy_Count--;
+    }
+
+    /**< Pixels in a full buffer, always whole pairs */
+    Local_BufferPixels = TFT_PACK_BUFFER_BYTES / 3;
+    if (TFT_BurstPacking == TFT_PIXEL_RGB444)
+    {
+        Local_BufferPixels *= 2;
+    }
+
+    /**< Pack a full buffer once and send it as many times as it fits */
+    if (Copy_Count >= Local_BufferPixels)
+    {
+        Local_Length = 0;
+        for (Local_Pixel = 0; Local_Pixel < Local_BufferPixels; Local_Pixel++)
+        {
+            Local_Length += TFT_PackPixel(&Local_Buffer[Local_Length], Copy_Color);
+        }
+        while (Copy_Count >= Local_BufferPixels)
+        {
+            TFT_WriteBytes(TFT_BurstDisplay, Copy_SpiPeripheral, Local_Buffer, Local_Length);
+            Copy_Count -= Local_BufferPixels;
+        }
+    }
+
+    /**< The rest, the last pixel may stay pending */
+    Local_Length = 0;
+    while (Copy_Count-- > 0)
+    {
+        Local_Length += TFT_PackPixel(&Local_Buffer[Local_Length], Copy_Color);
+    }
+    if (Local_Length > 0)
+    {
+        TFT_WriteBytes(TFT_BurstDisplay, Copy_SpiPeripheral, Local_Buffer, Local_Length);
+    }
+}
+
+static void TFT_WriteBytes(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u8 *Copy_Bytes, u32 Copy_Count)
+{
+    if (Copy_TftDisplay->TFT_Bus == TFT_BUS_PARALLEL_8080)
+    {
+        GPIO_WriteParallel8(Copy_TftDisplay->TFT_DataPort, Copy_TftDisplay->TFT_WRPin.TFT_Port, Copy_TftDisplay->TFT_WRPin.TFT_Pin, Copy_Bytes, Copy_Count);
+    }
+    else
+    {
+        SPI_voidTransmit(Copy_SpiPeripheral, Copy_Bytes, Copy_Count);
+    }
+}
+
+static void TFT_WriteWords(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u16 *Copy_Words, u32 Copy_Count)
+{
+    if (Copy_TftDisplay->TFT_Bus == TFT_BUS_PARALLEL_8080)
+    {
+        GPIO_WriteParallel16(Copy_TftDisplay->TFT_DataPort, Copy_TftDisplay->TFT_WRPin.TFT_Port, Copy_TftDisplay->TFT_WRPin.TFT_Pin, Copy_Words, Copy_Count);
+    }
+    else
+    {
+        SPI_voidTransmit16(Copy_SpiPeripheral, Copy_Words, Copy_Count);
+    }
+}
+
+static void TFT_WriteRepeated(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_Word, u32 Copy_Count)
+{
+    if (Copy_TftDisplay->TFT_Bus == TFT_BUS_PARALLEL_8080)
+    {
+        GPIO_WriteParallelRepeated16(Copy_TftDisplay->TFT_DataPort, Copy_TftDisplay->TFT_WRPin.TFT_Port, Copy_TftDisplay->TFT_WRPin.TFT_Pin, Copy_Word, Copy_Count);
+    }
+    else
+    {
+        SPI_voidTransmitRepeated16(Copy_SpiPeripheral, Copy_Word, Copy_Count);
+    }
+}
+
+static u8 TFT_PackPixel(u8 *Copy_Buffer, u16 Copy_Color)
+{
+    u8 Local_Red = (u8)(Copy_Color >> 11);
+    u8 Local_Green = (u8)((Copy_Color >> 5) & 0x3F);
+    u8 Local_Blue = (u8)(Copy_Color & 0x1F);
+    u16 Local_Pixel;
+    u8 Local_Length = 0;
+
+    if (TFT_BurstPacking == TFT_PIXEL_RGB666)
+    {
+        /**< Each channel in the top 6 bits of its byte, red and blue widened */
+        Copy_Buffer[0] = (u8)((Local_Red << 3) | (Local_Red >> 2));
+        Copy_Buffer[1] = (u8)(Local_Green << 2);
+        Copy_Buffer[2] = (u8)((Local_Blue << 3) | (Local_Blue >> 2));
+        return 3;
+    }
+
+    /**< RGB444: keep the top 4 bits of each channel */
+    Local_Pixel = (u16)(((Local_Red >> 1) << 8) | ((Local_Green >> 2) << 4) | (Local_Blue >> 1));
+
+    if (!TFT_IsPixelPending)
+    {
+        /**< First of a pair: wait for the second one */
+        TFT_PendingPixel = Local_Pixel;
+        TFT_IsPixelPending = 1;
+    }
+    else
+    {
+        /**< R0G0 B0R1 G1B1 */
+        Copy_Buffer[0] = (u8)(TFT_PendingPixel >> 4);
+        Copy_Buffer[1] = (u8)((TFT_PendingPixel << 4) | (Local_Pixel >> 8));
+        Copy_Buffer[2] = (u8)Local_Pixel;
+        TFT_IsPixelPending = 0;
+        Local_Length = 3;
+    }
+
+    return Local_Length;
+}
+
+static void TFT_SendInitTable(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u8 *Copy_Table, u16 Copy_TableSize)
+{
+    u16 Local_Index = 0;
+    u8 Local_Command;
+    u8 Local_ArgsCount;
+    u8 Local_Delay;
+
+    while (Local_Index < Copy_TableSize)
+    {
+        /**< Entry header: command and argument count with the delay flag */
+        Local_Command = Copy_Table[Local_Index++];
+        Local_ArgsCount = Copy_Table[Local_Index++];
+
+        /**< Command and all its arguments in one chip-select cycle */
+        TFT_SendCommandWithArgs(Copy_TftDisplay, Copy_SpiPeripheral, Local_Command, &Copy_Table[Local_Index], Local_ArgsCount & ~TFT_INIT_DELAY);
+        Local_Index += Local_ArgsCount & ~TFT_INIT_DELAY;
+
+        /**< Optional delay after the command */
+        if (Local_ArgsCount & TFT_INIT_DELAY)
+        {
+            Local_Delay = Copy_Table[Local_Index++];
+            STK_SetDelay((Local_Delay == TFT_INIT_DELAY_500MS) ? 500 : Local_Delay);
+        }
+    }
+}
+
+static void TFT_DrawGlyph(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, const TFT_Font_t *Copy_Font, const TFT_Glyph_t *Copy_Glyph, const u16 *Copy_Palette)
+{
+    u16 Local_Buffer[TFT_TEXT_BUFFER_PIXELS];
+    u16 Local_Count = 0;
+    u16 Local_Width = Copy_Glyph->TFT_XAdvance;
+    u16 Local_Height = Copy_Font->TFT_LineHeight;
+    u16 Local_Row;
+    u16 Local_Column;
+    s16 Local_BitmapX;
+    s16 Local_BitmapY;
+    u8 Local_Value;
+
+    /**< Nothing to draw outside the screen */
+    if ((Copy_XPosition >= Copy_TftDisplay->TFT_Controller->TFT_Width) || (Copy_YPosition >= Copy_TftDisplay->TFT_Controller->TFT_Height) ||
+        (Local_Width == 0) || (Local_Height == 0))
+    {
+        return;
+    }
+
+    /**< Clip the cell to the right and bottom edges */
+    if (((u32)Copy_XPosition + Local_Width) > Copy_TftDisplay->TFT_Controller->TFT_Width)
+    {
+        Local_Width = Copy_TftDisplay->TFT_Controller->TFT_Width - Copy_XPosition;
+    }
+    if (((u32)Copy_YPosition + Local_Height) > Copy_TftDisplay->TFT_Controller->TFT_Height)
+    {
+        Local_Height = Copy_TftDisplay->TFT_Controller->TFT_Height - Copy_YPosition;
+    }
+
+    TFT_SetAddressWindow(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition,
+                         Copy_XPosition + Local_Width - 1, Copy_YPosition + Local_Height - 1);
+
+    /**< Background and ink of the whole cell in one chip-select cycle */
+    TFT_BeginPixelBurst(Copy_TftDisplay);
+    for (Local_Row = 0; Local_Row < Local_Height; Local_Row++)
+    {
+        Local_BitmapY = (s16)Local_Row - Copy_Glyph->TFT_YOffset;
+
+        for (Local_Column = 0; Local_Column < Local_Width; Local_Column++)
+        {
+            Local_BitmapX = (s16)Local_Column - Copy_Glyph->TFT_XOffset;
+
+            /**< Pixels outside the glyph bitmap are background */
+            Local_Value = 0;
+            if ((Local_BitmapX >= 0) && (Local_BitmapX < Copy_Glyph->TFT_Width) &&
+                (Local_BitmapY >= 0) && (Local_BitmapY < Copy_Glyph->TFT_Height))
+            {
+                Local_Value = TFT_GetGlyphPixel(Copy_Font, Copy_Glyph, (u16)Local_BitmapY * Copy_Glyph->TFT_Width + (u16)Local_BitmapX);
+            }
+
+            Local_Buffer[Local_Count++] = Copy_Palette[Local_Value];
+            if (Local_Count == TFT_TEXT_BUFFER_PIXELS)
+            {
+                TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+                Local_Count = 0;
+            }
+        }
+    }
+    if (Local_Count > 0)
+    {
+        TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+    }
+    TFT_EndPixelBurst(Copy_TftDisplay, Copy_SpiPeripheral);
+}
+
+static void TFT_DrawGlyphInk(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, const TFT_Font_t *Copy_Font, const TFT_Glyph_t *Copy_Glyph, u16 Copy_Color)
+{
+    u8 Local_Threshold = 1 << (Copy_Font->TFT_BitsPerPixel - 1);
+    u16 Local_Row;
+    u16 Local_Column;
+    u16 Local_RunStart;
+    s32 Local_X;
+    s32 Local_Y;
+    s32 Local_Length;
+
+    for (Local_Row = 0; Local_Row < Copy_Glyph->TFT_Height; Local_Row++)
+    {
+        Local_Y = (s32)Copy_YPosition + Copy_Glyph->TFT_YOffset + Local_Row;
+        if (Local_Y < 0)
+        {
+            continue;
+        }
+
+        Local_Column = 0;
+        while (Local_Column < Copy_Glyph->TFT_Width)
+        {
+            /**< Skip the background, then find the end of the run of ink */
+            while ((Local_Column < Copy_Glyph->TFT_Width) &&
+                   (TFT_GetGlyphPixel(Copy_Font, Copy_Glyph, Local_Row * Copy_Glyph->TFT_Width + Local_Column) < Local_Threshold))
+            {
+                Local_Column++;
+            }
+            Local_RunStart = Local_Column;
+            while ((Local_Column < Copy_Glyph->TFT_Width) &&
+                   (TFT_GetGlyphPixel(Copy_Font, Copy_Glyph, Local_Row * Copy_Glyph->TFT_Width + Local_Column) >= Local_Threshold))
+            {
+                Local_Column++;
+            }
+
+            /**< Clip the left edge, the line primitive clips the others */
+            Local_X = (s32)Copy_XPosition + Copy_Glyph->TFT_XOffset + Local_RunStart;
+            Local_Length = Local_Column - Local_RunStart;
+            if (Local_X < 0)
+            {
+                Local_Length += Local_X;
+                Local_X = 0;
+            }
+            if (Local_Length > 0)
+            {
+                TFT_DrawHLine(Copy_TftDisplay, Copy_SpiPeripheral, (u16)Local_X, (u16)Local_Y, (u16)Local_Length, Copy_Color);
+            }
+        }
+    }
+}
+
+static u8 TFT_GetGlyphPixel(const TFT_Font_t *Copy_Font, const TFT_Glyph_t *Copy_Glyph, u16 Copy_Index)
+{
+    u32 Local_Bit = (u32)Copy_Index * Copy_Font->TFT_BitsPerPixel;
+    u8 Local_Byte = Copy_Font->TFT_Bitmap[Copy_Glyph->TFT_BitmapOffset + (Local_Bit >> 3)];
+
+    /**< Pixels are packed most significant bits first */
+    return (Local_Byte >> (8 - Copy_Font->TFT_BitsPerPixel - (Local_Bit & 0x07))) & ((1 << Copy_Font->TFT_BitsPerPixel) - 1);
+}
+
+static u16 TFT_BlendColor(u16 Copy_Background, u16 Copy_Color, u8 Copy_Level, u8 Copy_Levels)
+{
+    u16 Local_Red   = ((Copy_Background >> 11) & 0x1F) * (Copy_Levels - Copy_Level) + ((Copy_Color >> 11) & 0x1F) * Copy_Level;
+    u16 Local_Green = ((Copy_Background >> 5) & 0x3F) * (Copy_Levels - Copy_Level) + ((Copy_Color >> 5) & 0x3F) * Copy_Level;
+    u16 Local_Blue  = (Copy_Background & 0x1F) * (Copy_Levels - Copy_Level) + (Copy_Color & 0x1F) * Copy_Level;
+
+    /**< Weighted average of each channel, rounded */
+    Local_Red   = (Local_Red + Copy_Levels / 2) / Copy_Levels;
+    Local_Green = (Local_Green + Copy_Levels / 2) / Copy_Levels;
+    Local_Blue  = (Local_Blue + Copy_Levels / 2) / Copy_Levels;
+
+    return (u16)((Local_Red << 11) | (Local_Green << 5) | Local_Blue);
+}
+
+static void TFT_DecodeRleImage(const SPI_t Copy_SpiPeripheral, const TFT_Image_t *Copy_Image, u16 Copy_Left, u16 Copy_Top, u16 Copy_Width, u16 Copy_Height)
+{
+    u16 Local_Buffer[TFT_IMAGE_BUFFER_PIXELS];
+    u16 Local_Count = 0;
+    const u8 *Local_Data;
+    u32 Local_Right = (u32)Copy_Left + Copy_Width;
+    u32 Local_Bottom = (u32)Copy_Top + Copy_Height;
+    u32 Local_Start;
+    u32 Local_End;
+    u16 Local_Column = 0;
+    u16 Local_Row = 0;
+    u16 Local_Length;
+    u16 Local_Span;
+    u16 Local_Color;
+    u8 Local_Header;
+
+    Local_Data = Copy_Image->TFT_Data;
+    while (Local_Row < Local_Bottom)
+    {
+        Local_Header = *Local_Data++;
+        Local_Length = (Local_Header & 0x7F) + 1;
+
+        if (Local_Header & 0x80)
+        {
+            /**< Run: split it at the row ends and drop the clipped rows and columns */
+            Local_Color = TFT_ReadImagePixel(Copy_Image, &Local_Data);
+            while ((Local_Length > 0) && (Local_Row < Local_Bottom))
+            {
+                Local_Span = Copy_Image->TFT_Width - Local_Column;
+                if (Local_Span > Local_Length)
+                {
+                    Local_Span = Local_Length;
+                }
+                Local_Start = (Local_Column > Copy_Left) ? Local_Column : Copy_Left;
+                Local_End = (((u32)Local_Column + Local_Span) < Local_Right) ? ((u32)Local_Column + Local_Span) : Local_Right;
+                if ((Local_Row >= Copy_Top) && (Local_Start < Local_End))
+                {
+                    TFT_StreamRun(Copy_SpiPeripheral, Local_Buffer, &Local_Count, Local_Color, (u16)(Local_End - Local_Start));
+                }
+                Local_Length -= Local_Span;
+                Local_Column += Local_Span;
+                if (Local_Column == Copy_Image->TFT_Width)
+                {
+                    Local_Column = 0;
+                    Local_Row++;
+                }
+            }
+        }
+        else
+        {
+            /**< Literal: copy the visible pixels into the buffer */
+            while ((Local_Length > 0) && (Local_Row < Local_Bottom))
+            {
+                Local_Color = TFT_ReadImagePixel(Copy_Image, &Local_Data);
+                if ((Local_Row >= Copy_Top) && (Local_Column >= Copy_Left) && (Local_Column < Local_Right))
+                {
+                    Local_Buffer[Local_Count++] = Local_Color;
+                    if (Local_Count == TFT_IMAGE_BUFFER_PIXELS)
+                    {
+                        TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+                        Local_Count = 0;
+                    }
+                }
+                Local_Length--;
+                if (++Local_Column == Copy_Image->TFT_Width)
+                {
+                    Local_Column = 0;
+                    Local_Row++;
+                }
+            }
+        }
+    }
+    if (Local_Count > 0)
+    {
+        TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+    }
+}
+
+static void TFT_DecodePackedImage(const SPI_t Copy_SpiPeripheral, const TFT_Image_t *Copy_Image, u16 Copy_Left, u16 Copy_Top, u16 Copy_Width, u16 Copy_Height)
+{
+    u16 Local_Buffer[TFT_IMAGE_BUFFER_PIXELS];
+    u16 Local_Count = 0;
+    u32 Local_Index;
+    u16 Local_Row;
+    u16 Local_Column;
+
+    /**< First visible pixel */
+    Local_Index = (u32)Copy_Top * Copy_Image->TFT_Width;
+
+    if ((Copy_Image->TFT_Format == TFT_IMAGE_RGB444) && (TFT_BurstPacking == TFT_PIXEL_RGB444) && (Copy_Width == Copy_Image->TFT_Width) &&
+        ((Local_Index & 0x01) == 0))
+    {
+        /**< Same packing as the pixel stream, no clipped column and the first row starts a pixel pair: send the visible rows as they are */
+        TFT_WriteBytes(TFT_BurstDisplay, Copy_SpiPeripheral, &Copy_Image->TFT_Data[(Local_Index / 2) * 3], ((u32)Copy_Width * Copy_Height * 3 + 1) / 2);
+        return;
+    }
+
+    for (Local_Row = 0; Local_Row < Copy_Height; Local_Row++)
+    {
+        Local_Index = ((u32)Copy_Top + Local_Row) * Copy_Image->TFT_Width + Copy_Left;
+
+        if ((Copy_Image->TFT_Format == TFT_IMAGE_RGB565) && (TFT_BurstPacking == TFT_PIXEL_RGB565) && (TFT_BurstDisplay->TFT_Bus == TFT_BUS_SPI))
+        {
+            /**< Already in the order of the SPI pixel stream, send the visible bytes as they are */
+            SPI_voidTransmit(Copy_SpiPeripheral, &Copy_Image->TFT_Data[Local_Index * 2], (u32)Copy_Width * 2);
+            continue;
+        }
+
+        for (Local_Column = 0; Local_Column < Copy_Width; Local_Column++)
+        {
+            Local_Buffer[Local_Count++] = TFT_GetPackedPixel(Copy_Image, Local_Index + Local_Column);
+            if (Local_Count == TFT_IMAGE_BUFFER_PIXELS)
+            {
+                TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+                Local_Count = 0;
+            }
+        }
+    }
+    if (Local_Count > 0)
+    {
+        TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+    }
+}
+
+static u16 TFT_GetPackedPixel(const TFT_Image_t *Copy_Image, u32 Copy_Index)
+{
+    const u8 *Local_Data = Copy_Image->TFT_Data;
+    u32 Local_Bit;
+    u8 Local_Red;
+    u8 Local_Green;
+    u8 Local_Blue;
+
+    if (Copy_Image->TFT_Format == TFT_IMAGE_RGB565)
+    {
+        /**< High byte first */
+        Local_Data += Copy_Index * 2;
+        return (u16)(((u16)Local_Data[0] << 8) | Local_Data[1]);
+    }
+
+    if (Copy_Image->TFT_Format == TFT_IMAGE_RGB444)
+    {
+        /**< Two pixels in three bytes: RG BR GB */
+        Local_Data += (Copy_Index >> 1) * 3;
+        if ((Copy_Index & 0x01) == 0)
+        {
+            Local_Red = Local_Data[0] >> 4;
+            Local_Green = Local_Data[0] & 0x0F;
+            Local_Blue = Local_Data[1] >> 4;
+        }
+        else
+        {
+            Local_Red = Local_Data[1] & 0x0F;
+            Local_Green = Local_Data[2] >> 4;
+            Local_Blue = Local_Data[2] & 0x0F;
+        }
+
+        /**< Widen each channel by repeating its top bits */
+        return (u16)((((Local_Red << 1) | (Local_Red >> 3)) << 11) | (((Local_Green << 2) | (Local_Green >> 2)) << 5) | ((Local_Blue << 1) | (Local_Blue >> 3)));
+    }
+
+    /**< Palette index, most significant bits first */
+    Local_Bit = Copy_Index * Copy_Image->TFT_IndexBits;
+    return Copy_Image->TFT_Palette[(Local_Data[Local_Bit >> 3] >> (8 - Copy_Image->TFT_IndexBits - (Local_Bit & 0x07))) & ((1 << Copy_Image->TFT_IndexBits) - 1)];
+}
+
+static void TFT_DrawBlit(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, const TFT_Bitmap_t *Copy_Source, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation, u8 Copy_UseKey, u16 Copy_KeyColor)
+{
+    const u16 *Local_Pixels;
+    u32 Local_Index;
+    s32 Local_Step;
+    s32 Local_Left;
+    s32 Local_Top;
+    s32 Local_Right;
+    s32 Local_Bottom;
+    s32 Local_Y;
+    s32 Local_X;
+    s32 Local_RunStart;
+
+    if ((Copy_Source == NULL) || (Copy_Source->TFT_Pixels == NULL) || (Copy_Rotation > TFT_ROTATE_270) ||
+        (Copy_SourceX >= Copy_Source->TFT_Width) || (Copy_SourceY >= Copy_Source->TFT_Height))
+    {
+        return;
+    }
+    Local_Pixels = Copy_Source->TFT_Pixels;
+
+    /**< Keep the source rectangle inside the bitmap */
+    if (((u32)Copy_SourceX + Copy_Width) > Copy_Source->TFT_Width)
+    {
+        Copy_Width = Copy_Source->TFT_Width - Copy_SourceX;
+    }
+    if (((u32)Copy_SourceY + Copy_Height) > Copy_Source->TFT_Height)
+    {
+        Copy_Height = Copy_Source->TFT_Height - Copy_SourceY;
+    }
+
+    /**< Drawn rectangle, quarter turns swap its sides, clipped to the screen */
+    Local_Left = Copy_XPosition;
+    Local_Top = Copy_YPosition;
+    Local_Right = Local_Left + (((Copy_Rotation & 0x01) != 0) ? Copy_Height : Copy_Width);
+    Local_Bottom = Local_Top + (((Copy_Rotation & 0x01) != 0) ? Copy_Width : Copy_Height);
+    if (Local_Left < 0)
+    {
+        Local_Left = 0;
+    }
+    if (Local_Top < 0)
+    {
+        Local_Top = 0;
+    }
+    if (Local_Right > Copy_TftDisplay->TFT_Controller->TFT_Width)
+    {
+        Local_Right = Copy_TftDisplay->TFT_Controller->TFT_Width;
+    }
+    if (Local_Bottom > Copy_TftDisplay->TFT_Controller->TFT_Height)
+    {
+        Local_Bottom = Copy_TftDisplay->TFT_Controller->TFT_Height;
+    }
+    if ((Local_Left >= Local_Right) || (Local_Top >= Local_Bottom))
+    {
+        return;
+    }
+
+    if (!Copy_UseKey)
+    {
+        /**< The visible part in one window and one burst */
+        TFT_SetAddressWindow(Copy_TftDisplay, Copy_SpiPeripheral, (u16)Local_Left, (u16)Local_Top, (u16)(Local_Right - 1), (u16)(Local_Bottom - 1));
+        TFT_BeginPixelBurst(Copy_TftDisplay);
+        for (Local_Y = Local_Top; Local_Y < Local_Bottom; Local_Y++)
+        {
+            Local_Index = TFT_GetBlitRow(Copy_Source, Copy_SourceX, Copy_SourceY, Copy_Width, Copy_Height, Copy_Rotation, (u16)(Local_Y - Copy_YPosition), &Local_Step);
+            Local_Index += (u32)(Local_Left - Copy_XPosition) * (u32)Local_Step;
+            TFT_SendStridedPixels(Copy_SpiPeripheral, Local_Pixels, Local_Index, Local_Step, (u16)(Local_Right - Local_Left));
+        }
+        TFT_EndPixelBurst(Copy_TftDisplay, Copy_SpiPeripheral);
+        return;
+    }
+
+    for (Local_Y = Local_Top; Local_Y < Local_Bottom; Local_Y++)
+    {
+        Local_Index = TFT_GetBlitRow(Copy_Source, Copy_SourceX, Copy_SourceY, Copy_Width, Copy_Height, Copy_Rotation, (u16)(Local_Y - Copy_YPosition), &Local_Step);
+        Local_Index += (u32)(Local_Left - Copy_XPosition) * (u32)Local_Step;
+
+        /**< Local_Index is the pixel at Local_X; past the end of the row it is never read */
+        Local_X = Local_Left;
+        while (Local_X < Local_Right)
+        {
+            /**< Skip the transparent pixels, then find the end of the opaque run */
+            while ((Local_X < Local_Right) && (Local_Pixels[Local_Index] == Copy_KeyColor))
+            {
+                Local_X++;
+                Local_Index += (u32)Local_Step;
+            }
+            Local_RunStart = Local_X;
+            while ((Local_X < Local_Right) && (Local_Pixels[Local_Index + (u32)(Local_X - Local_RunStart) * (u32)Local_Step] != Copy_KeyColor))
+            {
+                Local_X++;
+            }
+
+            /**< One window and one burst per run */
+            if (Local_X > Local_RunStart)
+            {
+                TFT_SetAddressWindow(Copy_TftDisplay, Copy_SpiPeripheral, (u16)Local_RunStart, (u16)Local_Y, (u16)(Local_X - 1), (u16)Local_Y);
+                TFT_BeginPixelBurst(Copy_TftDisplay);
+                TFT_SendStridedPixels(Copy_SpiPeripheral, Local_Pixels, Local_Index, Local_Step, (u16)(Local_X - Local_RunStart));
+                TFT_EndPixelBurst(Copy_TftDisplay, Copy_SpiPeripheral);
+                Local_Index += (u32)(Local_X - Local_RunStart) * (u32)Local_Step;
+            }
+        }
+    }
+}
+
+static u32 TFT_GetBlitRow(const TFT_Bitmap_t *Copy_Source, u16 Copy_SourceX, u16 Copy_SourceY, u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation, u16 Copy_Row, s32 *Copy_Step)
+{
+    u32 Local_Stride = Copy_Source->TFT_Width;
+
+    switch (Copy_Rotation)
+    {
+        case TFT_ROTATE_90:
+            /**< Drawn row r is source column r, read from the bottom up */
+            *Copy_Step = -(s32)Local_Stride;
+            return (((u32)Copy_SourceY + Copy_Height - 1) * Local_Stride) + Copy_SourceX + Copy_Row;
+
+        case TFT_ROTATE_180:
+            /**< Drawn row r is source row (height - 1 - r), read from right to left */
+            *Copy_Step = -1;
+            return (((u32)Copy_SourceY + Copy_Height - 1 - Copy_Row) * Local_Stride) + Copy_SourceX + Copy_Width - 1;
+
+        case TFT_ROTATE_270:
+            /**< Drawn row r is source column (width - 1 - r), read from the top down */
+            *Copy_Step = (s32)Local_Stride;
+            return ((u32)Copy_SourceY * Local_Stride) + Copy_SourceX + Copy_Width - 1 - Copy_Row;
+
+        default:
+            *Copy_Step = 1;
+            return (((u32)Copy_SourceY + Copy_Row) * Local_Stride) + Copy_SourceX;
+    }
+}
+
+static void TFT_SendStridedPixels(const SPI_t Copy_SpiPeripheral, const u16 *Copy_Pixels, u32 Copy_Index, s32 Copy_Step, u16 Copy_Count)
+{
+    u16 Local_Buffer[TFT_BLIT_BUFFER_PIXELS];
+    u16 Local_Count = 0;
+
+    if (Copy_Step == 1)
+    {
+        /**< Contiguous in memory, no copy */
+        TFT_SendPixels(Copy_SpiPeripheral, &Copy_Pixels[Copy_Index], Copy_Count);
+        return;
+    }
+
+    /**< Walk the index, not a pointer: after the last pixel it may point outside the bitmap */
+    while (Copy_Count-- > 0)
+    {
+        Local_Buffer[Local_Count++] = Copy_Pixels[Copy_Index];
+        Copy_Index += (u32)Copy_Step;
+        if (Local_Count == TFT_BLIT_BUFFER_PIXELS)
+        {
+            TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+            Local_Count = 0;
+        }
+    }
+    if (Local_Count > 0)
+    {
+        TFT_SendPixels(Copy_SpiPeripheral, Local_Buffer, Local_Count);
+    }
+}
+
+static void TFT_StreamRun(const SPI_t Copy_SpiPeripheral, u16 *Copy_Buffer, u16 *Copy_Count, u16 Copy_Color, u16 Copy_Length)
+{
+    if (Copy_Length >= TFT_IMAGE_RUN_THRESHOLD)
+    {
+        /**< Keep the pixel order: send what is buffered, then the whole run at once */
+        if (*Copy_Count > 0)
+        {
+            TFT_SendPixels(Copy_SpiPeripheral, Copy_Buffer, *Copy_Count);
+            *Copy_Count = 0;
+        }
+        TFT_SendColor(Copy_SpiPeripheral, Copy_Color, Copy_Length);
+        return;
+    }
+
+    while (Copy_Length-- > 0)
+    {
+        Copy_Buffer[(*Copy_Count)++] = Copy_Color;
+        if (*Copy_Count == TFT_IMAGE_BUFFER_PIXELS)
+        {
+            TFT_SendPixels(Copy_SpiPeripheral, Copy_Buffer, *Copy_Count);
+            *Copy_Count = 0;
+        }
+    }
+}
+
+static u16 TFT_ReadImagePixel(const TFT_Image_t *Copy_Image, const u8 **Copy_Data)
+{
+    u16 Local_Color;
+
+    if (Copy_Image->TFT_Palette != NULL)
+    {
+        Local_Color = Copy_Image->TFT_Palette[**Copy_Data];
+        *Copy_Data += 1;
+    }
+    else
+    {
+        /**< High byte first */
+        Local_Color = ((u16)(*Copy_Data)[0] << 8) | (*Copy_Data)[1];
+        *Copy_Data += 2;
+    }
+
+    return Local_Color;
+}
+
+/**
+ * @} TFT_Private_Functions
+ */
+
+/**<====================================================================================================================*/
+/*******************************************< End of Functions Implementation *******************************************/
+/**<====================================================================================================================*/
+
+/** @} */ // End of TFT_program.c module.
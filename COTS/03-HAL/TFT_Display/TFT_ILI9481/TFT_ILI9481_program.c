@@ -1,273 +1,126 @@
 /**
- * @file TFT_Displays_program.c
- * @brief This file contains the implementation of the TFT Displays module functions.
+ ********************************************************************************************
+ * @file TFT_ILI9481_program.c
+ * @brief This file contains the ILI9481 controller descriptor and init sequence.
  * 
- * This module provides functions for interfacing with TFT (Thin-Film Transistor) displays
- * to control graphical user interfaces (GUIs), display images, and render text.
- *
+ * The drawing code is shared by all controllers and lives in the TFT core; this file only
+ * provides what is specific to the ILI9481.
+ ********************************************************************************************
  * @date 20 Jul 2023
- * @version V01
+ * @version V02
  * @author Mahmoud Abdelraouf Mahmoud
  *
  * @note Before using this module, make sure to configure the display controller
  * and the required GPIO pins for communication and control.
  *
- * @see TFT_Displays_interface.h for the public interface and function descriptions.
+ * @see TFT_interface.h for the public interface and function descriptions.
+ ******************************************************************************************** 
  */
 
-/**< LIB */
+/**<========================================================================================*/
+/*******************************************< LIB *******************************************/
+/**<========================================================================================*/
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
 
-/**< MCAL */
-#include "GPIO_interface.h"
+/**<=========================================================================================*/
+/*******************************************< MCAL *******************************************/
+/**<=========================================================================================*/
 #include "SPI_interface.h"
-#include "STK_interface.h"
 
-/**< HAL */
-#include "TFT_ILI9481_config.h"
+/**<========================================================================================*/
+/*******************************************< HAL *******************************************/
+/**<========================================================================================*/
+#include "TFT_interface.h"
 #include "TFT_ILI9481_interface.h"
 #include "TFT_ILI9481_private.h"
+#include "TFT_ILI9481_config.h"
 
+#if (TFT_DISPLAY_COLORS != _3BIT_PER_PIXEL) && (TFT_DISPLAY_COLORS != _16BIT_PER_PIXEL) && (TFT_DISPLAY_COLORS != _18BIT_PER_PIXEL)
+    #error "Wrong choice for TFT_DISPLAY_COLORS"
+#endif
 
+/**< Packing of the pixel stream for the chosen pixel format */
+#if (TFT_DISPLAY_COLORS == _3BIT_PER_PIXEL)
+    #error "The drawing functions do not support the 3-bit pixel format"
+#elif (TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL)
+    #define TFT_PIXEL_PACKING       TFT_PIXEL_RGB666
+#else
+    #define TFT_PIXEL_PACKING       TFT_PIXEL_RGB565
+#endif
 
-void TFT_Init(const TFT_Config_t *Copy_psTftDisplay, SPI_t Copy_psTheSpiTftUsed)
-{
-    /**< Set the Reset (RST) pin to high logic level to release reset signal */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RstPin, GPIO_HIGH);
-    
-    /**< Wait for a specified delay before proceeding */
-    STK_SetDelay(5);
-    
-    /**< Set the Reset (RST) pin to low logic level to assert reset signal */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RstPin, GPIO_LOW);
-    
-    /**< Wait for a short delay */
-    STK_SetDelay(15);
-    
-    /**< Set the Reset (RST) pin to high logic level to release reset signal */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RstPin, GPIO_HIGH);
-    
-    /**< Wait for a specified delay before proceeding */
-    STK_SetDelay(15);
-    
-    TFT_InitController(Copy_psTftDisplay, Copy_psTheSpiTftUsed);
-}
-
-/**
- * @brief Clears the display screen.
- *
- * This function clears the entire display screen and sets all pixels to the background color.
- *
- * @param None
- * @retval None
- */
-void TFT_ClearScreen(void)
-{
-    /**< Implement the TFT display screen clearing */
-    
-}
-
-/**
- * @brief Draws a pixel at the specified coordinates with the given color.
- *
- * This function draws a single pixel at the specified (x, y) coordinates with the specified color.
- *
- * @param[in] x The X-coordinate of the pixel.
- * @param[in] y The Y-coordinate of the pixel.
- * @param[in] color The color of the pixel in 16-bit RGB565 format.
- * @retval None
- */
-void TFT_DrawPixel(u16 x, u16 y, u16 color)
-{
-    /* Implement the TFT pixel drawing function */
-    
-}
-
-/**
- * @brief Draws a line between two points with the given color.
- *
- * This function draws a line between the specified starting point (x1, y1) and
- * the ending point (x2, y2) with the specified color.
- *
- * @param[in] x1 The X-coordinate of the starting point.
- * @param[in] y1 The Y-coordinate of the starting point.
- * @param[in] x2 The X-coordinate of the ending point.
- * @param[in] y2 The Y-coordinate of the ending point.
- * @param[in] color The color of the line in 16-bit RGB565 format.
- * @retval None
- */
-void TFT_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2, u16 color)
-{
-    /*<* Implement the TFT line drawing function */
-   
-}
+/**<=============================================================================================================*/
+/*******************************************< Init Sequence *******************************************/
+/**<=============================================================================================================*/
 
 /**
- * @brief Displays an image on the TFT screen.
- *
- * This function displays an image stored in memory at the specified (x, y) coordinates.
+ * @brief ILI9481 init sequence.
  *
- * @param[in] x The X-coordinate where the image will be displayed.
- * @param[in] y The Y-coordinate where the image will be displayed.
- * @param[in] image Pointer to the image data in RGB565 format.
- * @param[in] width The width of the image in pixels.
- * @param[in] height The height of the image in pixels.
- * @retval None
+ * Each entry is: command, argument count (ORed with @ref TFT_INIT_DELAY when a delay follows),
+ * the arguments, then the delay in ms when flagged.
  */
-void TFT_DisplayImage(u16 x, u16 y, const u16* image, u16 width, u16 height)
+static const u8 TFT_ILI9481_InitTable[] =
 {
-    /**< Implement the TFT image display function */
-    
-}
-
-/**
- * @brief Displays text on the TFT screen.
- *
- * This function displays text at the specified (x, y) coordinates with the given color.
- *
- * @param[in] x The X-coordinate where the text will be displayed.
- * @param[in] y The Y-coordinate where the text will be displayed.
- * @param[in] text Pointer to the text string to be displayed.
- * @param[in] font The font size and style to use for rendering the text.
- * @param[in] color The color of the text in 16-bit RGB565 format.
- * @retval None
- */
-//void TFT_voidDisplayText(u16 x, u16 y, const char* text, const Font_t* font, u16 color)
-//{
-//    /**< Implement the TFT text display function */
-//
-//}
-
-/**
- * @addtogroup TFT_Private_Functions
- * @{
- */
-
-static void TFT_SendCommand(const TFT_Config_t *Copy_psTftDisplay, const SPI_t Copy_psTheSpiTftUsed, u8 Copy_Command)
-{
-    /**< Temp variable to receive the data in */
-    u8 Local_u8ReceivedData = 0;
-
-    /**< Set RS (Register Select) pin low to indicate command mode */ 
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RsPin, GPIO_LOW); 
-
-    /**<  Set CS (Chip Select) pin low to select the TFT display for communication */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_CsPin, GPIO_LOW); 
-
-    /**< Perform SPI data transfer to send the command byte */ 
-    SPI_voidTransfer(Copy_psTheSpiTftUsed, &Copy_Command, &Local_u8ReceivedData, 1); 
-
-    /**< Set CS pin high to release the TFT display */ 
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_CsPin, GPIO_HIGH); 
-}
-
-static void TFT_SendData(const TFT_Config_t *Copy_psTftDisplay, const SPI_t Copy_psTheSpiTftUsed, u8 Copy_Data)
-{
-    /**< Temp variable to receive the data in */
-    u8 Local_u8ReceivedData = 0;
-
-    /**< Set RS (Register Select) pin high to indicate data mode */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_RsPin, GPIO_HIGH);
-
-    /**< Set CS (Chip Select) pin low to select the TFT display for communication */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_CsPin, GPIO_LOW);
-
-    /**< Perform SPI data transfer to send the data byte */
-    SPI_voidTransfer(Copy_psTheSpiTftUsed, &Copy_Data, &Local_u8ReceivedData, 1);
-
-    /**< Set CS pin high to release the TFT display */
-    GPIO_SetPinValue(Copy_psTftDisplay->TFT_Port, Copy_psTftDisplay->TFT_CsPin, GPIO_HIGH);
-}
-
-static void TFT_InitController(const TFT_Config_t *Copy_psTftDisplay, SPI_t Copy_psTheSpiTftUsed)
-{
-    /**< Configure ILI9481 display */ 
-
     /**< Send command to exit sleep mode */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x11);
-    STK_SetDelay(20);
+    0x11, TFT_INIT_DELAY | 0, 20,
 
     /**< Send command to configure power setting */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xD0);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x07);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x42);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x18);
+    0xD0, 3, 0x07, 0x42, 0x18,
 
     /**< Send command to configure address mode */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xD1);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x07);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x10);
+    0xD1, 3, 0x00, 0x07, 0x10,
 
     /**< Send command to configure display mode */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xD2);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x01);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x02);
+    0xD2, 2, 0x01, 0x02,
 
     /**< Send command to configure gamma setting */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xC0);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x10);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x3B);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x02);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x11);
+    0xC0, 5, 0x10, 0x3B, 0x00, 0x02, 0x11,
 
     /**< Send command to configure frame rate and inversion control */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xC5);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x03);
+    0xC5, 1, 0x03,
 
     /**< Send command to configure gamma settings */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xC8);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x32);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x36);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x45);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x06);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x16);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x37);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x75);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x77);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x54);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x0C);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
+    0xC8, 12, 0x00, 0x32, 0x36, 0x45, 0x06, 0x16, 0x37, 0x75, 0x77, 0x54, 0x0C, 0x00,
 
     /**< Send command to set scroll area */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x36);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x0A);
+    0x36, 1, 0x0A,
 
     /**< Send command to set pixel format */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x3A);
-    #if (TFT_DISPLAY_COLORS == _3BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _16BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL)
-        TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, TFT_DISPLAY_COLORS);
-    #else
-        TFT_SendCommand(Copy_psTftDisplay, 0x21);
-    #endif
+    0x3A, 1, TFT_DISPLAY_COLORS,
 
     /**< Send command to set column address */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x2A);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x01);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x3F);
+    0x2A, 4, 0x00, 0x00, 0x01, 0x3F,
 
     /**< Send command to set page address */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x2B);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x00);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x01);
-    TFT_SendData(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0xE0);
+    0x2B, TFT_INIT_DELAY | 4, 0x00, 0x00, 0x01, 0xE0, 120,
 
-    STK_SetDelay(120);
     /**< Send command to exit idle mode */
-    TFT_SendCommand(Copy_psTftDisplay, Copy_psTheSpiTftUsed, 0x29);
-
-    /**< End of ILI9481 display configuration */
-}
-
+    0x29, 0,
+};
 
-/**
- * @} TFT_Private_Functions
- */
+/**<=============================================================================================================*/
+/*******************************************< Controller Descriptor *******************************************/
+/**<=============================================================================================================*/
 
-/** @} */ // End of TFT_Displays_program.c module.
+const TFT_Controller_t TFT_ILI9481_Controller =
+{
+    .TFT_Width                  = TFT_DISPLAY_WIDTH,
+    .TFT_Height                 = TFT_DISPLAY_HEIGHT,
+    .TFT_ColumnAddressCommand   = TFT_SET_COLUMN_ADDRESS,
+    .TFT_RowAddressCommand      = TFT_SET_PAGE_ADDRESS,
+    .TFT_MemoryWriteCommand     = TFT_WRITE_MEMORY_START,
+    .TFT_ScrollAreaCommand      = TFT_SET_SCROLL_AREA,
+    .TFT_ScrollStartCommand     = TFT_SET_SCROLL_START,
+    .TFT_FrameMemoryHeight      = TFT_DISPLAY_HEIGHT,
+    .TFT_RowsMirrored           = 0,
+    .TFT_TearOffCommand         = TFT_SET_TEAR_OFF,
+    .TFT_TearOnCommand          = TFT_SET_TEAR_ON,
+    .TFT_TearScanlineCommand    = TFT_SET_TEAR_SCANLINE,
+    .TFT_PixelFormat            = TFT_DISPLAY_COLORS,
+    .TFT_PixelPacking           = TFT_PIXEL_PACKING,
+    .TFT_ResetHoldDelay         = 5,
+    .TFT_ResetPulseDelay        = 15,
+    .TFT_ResetReadyDelay        = 15,
+    .TFT_InitTable              = TFT_ILI9481_InitTable,
+    .TFT_InitTableSize          = sizeof(TFT_ILI9481_InitTable)
+};
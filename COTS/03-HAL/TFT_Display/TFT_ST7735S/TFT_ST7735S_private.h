@@ -26,30 +26,6 @@
  * @{
  */
 
-/**
- * @brief RGB565 Color Definitions
- *
- * This section defines common RGB565 color values for use in TFT displays.
- */
-/**********************< Basic Colors **********************/ 
-#define COLOR_BLACK       0x0000   /**< Black Color (RGB565) */
-#define COLOR_WHITE       0xFFFF   /**< White Color (RGB565) */
-#define COLOR_RED         0xF800   /**< Red Color (RGB565) */
-#define COLOR_GREEN       0x07E0   /**< Green Color (RGB565) */
-#define COLOR_BLUE        0x001F   /**< Blue Color (RGB565) */
-
-/**********************< Combinations **********************/
-#define COLOR_CYAN        0x07FF   /**< Cyan Color (RGB565) */
-#define COLOR_MAGENTA     0xF81F   /**< Magenta Color (RGB565) */
-#define COLOR_YELLOW      0xFFE0   /**< Yellow Color (RGB565) */
-#define COLOR_ORANGE      0xFD20   /**< Orange Color (RGB565) */
-#define COLOR_PURPLE      0x8010   /**< Purple Color (RGB565) */
-#define COLOR_PINK        0xF81F   /**< Pink Color (RGB565) */
-#define COLOR_LIME        0x07E0   /**< Lime Color (RGB565) */
-#define COLOR_TEAL        0x0410   /**< Teal Color (RGB565) */
-#define COLOR_VIOLET      0x801F   /**< Violet Color (RGB565) */
-#define COLOR_BROWN       0xA145   /**< Brown Color (RGB565) */
-
 /**
  * @brief 3-bit per pixel RGB color format (RGB111).
  *
@@ -58,6 +34,14 @@
  */
 #define _3BIT_PER_PIXEL           0x01      /**< RGB111 */
 
+/**
+ * @brief 12-bit per pixel RGB color format (RGB444).
+ *
+ * This format represents each pixel using 12 bits, with 4 bits for red, green, and blue components,
+ * allowing a total of 4,096 different colors. Two pixels are sent in three bytes.
+ */
+#define _12BIT_PER_PIXEL          0x03      /**< RGB444 */
+
 /**
  * @brief 16-bit per pixel RGB color format (RGB565).
  *
@@ -202,264 +186,4 @@
 
 /** @} TFT_Command_and_Some_Macros_Private */
 
-/**
- * @addtogroup TFT_Private_Functions TFT Private Functions
- * @brief Internal/private functions for the TFT Displays module.
- * @{
- */
-
-/**
- * @brief Internal function to send commands to the TFT display controller.
- *
- * This function is used internally to send commands to the TFT display controller
- * using the specified communication interface.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral to be used for communication.
- * @param Copy_Command The command byte to be sent.
- *
- * @note Make sure to properly configure the TFT display and SPI functions before calling this function.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Send a command (e.g., 0xA1) to the TFT display
- * TFT_SendCommand(&tftConfig, spiPeripheral, 0xA1);
- * @endcode
- */
-static void TFT_SendCommand(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Command);
-
-/**
- * @brief Send data to the TFT display using SPI communication.
- *
- * This function sends a single data byte to the TFT display using the specified SPI peripheral.
- * It sets the RS (Register Select) pin to high to indicate data mode, selects the TFT display by
- * setting the CS (Chip Select) pin low, performs an SPI data transfer to send the data byte, and
- * then releases the display by setting the CS pin high again.
- *
- * @param[in] Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param[in] Copy_psSpiPeripheral The SPI peripheral to be used for communication.
- * @param[in] Copy_Data The data byte to be sent to the TFT display.
- *
- * @return None.
- *
- * @note Make sure to properly configure the TFT display and GPIO functions before calling this function.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Send data (e.g., 0x55) to the TFT display
- * TFT_SendData(spiPeripheral, &tftConfig, 0x55);
- * @endcode
- */
-static void TFT_SendData(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u8 Copy_Data);
-
-/**
- * @brief Draw a pixel on the TFT display.
- *
- * This function is used to draw a pixel on the TFT display at the specified
- * coordinates using the specified color. It encapsulates the process of setting
- * the X and Y addresses, sending the RAM write command, and sending the color data
- * to the display.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral used for communication.
- * @param Copy_XPosition The x-coordinate of the pixel.
- * @param Copy_YPosition The y-coordinate of the pixel.
- * @param color The color of the pixel in 16-bit RGB565 format.
- *
- * @note Make sure to properly configure the TFT display, SPI, and GPIO functions
- *       before calling this function.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Draw a red pixel at (100, 50)
- * TFT_DrawPixel(&tftConfig, spiPeripheral, 100, 50, TFT_COLOR_RED);
- * @endcode
- */
-static void TFT_DrawPixel(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u16 color);
-
-/**
- * @brief Set the X address on the TFT display controller.
- *
- * This function sends the necessary commands to the TFT display controller
- * to set the X address for drawing pixels. The provided X coordinate specifies
- * the horizontal position where the next pixel will be drawn.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral used for communication.
- * @param Copy_XPosition The X coordinate to set for drawing.
- *
- * @note This function should be called before drawing any pixel to set the desired
- *       horizontal position on the TFT display.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Set the X address to 100
- * TFT_SetXAddress(&tftConfig, spiPeripheral, 100);
- * @endcode
- */
-static void TFT_SetXAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition);
-
-/**
- * @brief Set the Y address on the TFT display controller.
- *
- * This function sends the necessary commands to the TFT display controller
- * to set the Y address for drawing pixels. The provided Y coordinate specifies
- * the vertical position where the next pixel will be drawn.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral used for communication.
- * @param Copy_YPosition The Y coordinate to set for drawing.
- *
- * @note This function should be called before drawing any pixel to set the desired
- *       vertical position on the TFT display.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Set the Y address to 50
- * TFT_SetYAddress(&tftConfig, spiPeripheral, 50);
- * @endcode
- */
-static void TFT_SetYAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_YPosition);
-
-/**
- * @brief Set the X and Y addresses on the TFT display controller.
- *
- * This function sends the necessary commands to the TFT display controller
- * to set both the X and Y addresses for drawing pixels. The provided X and Y
- * coordinates specify the horizontal and vertical positions where the next pixel
- * will be drawn.
- *
- * @param Copy_psTftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_psSpiPeripheral The SPI peripheral used for communication.
- * @param Copy_XPosition The X coordinate to set for drawing.
- * @param Copy_YPosition The Y coordinate to set for drawing.
- *
- * @note This function should be called before drawing any pixel to set the desired
- *       position on the TFT display.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Set the X and Y addresses to 100 and 50 respectively
- * TFT_SetXYAddress(&tftConfig, spiPeripheral, 100, 50);
- * @endcode
- */
-static void TFT_SetXYAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition);
-
-/**
- * @brief Internal function to initialize the TFT display controller.
- *
- * This function is used internally to initialize the TFT display controller
- * based on the configuration settings provided in the TFT_Config_t structure.
- * It configures the display controller's parameters and settings to ensure proper
- * communication and display behavior.
- *
- * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_SpiPeripheral The SPI peripheral used for communication.
- *
- * @note This function should be called during the initialization process of the TFT display module.
- *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Initialize the TFT display controller
- * TFT_InitController(&tftConfig, spiPeripheral);
- * @endcode
- */
-static void TFT_InitController(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral);
-
-/**
- * @brief Internal function to draw a character on the TFT display.
- *
- * This function is used internally to draw a character on the TFT display at the specified
- * coordinates using the specified font and color.
- *
- * @param x The x-coordinate of the character.
- * @param y The y-coordinate of the character.
- * @param character The character to be drawn.
- * @param font Pointer to the font data structure.
- * @param textColor The color of the character in 16-bit RGB565 format.
- * @param backgroundColor The background color of the character in 16-bit RGB565 format.
- */
-//static void TFT_DrawCharacter(u16 x, u16 y, char character, const Font_t *font, u16 textColor, u16 backgroundColor);
-
-/* Add more internal functions and private declarations as needed */
-
-/** @} TFT_Private_Functions */
-
 #endif /**< __TFT_ST7735S_DISPLAYS_PRIVATE_H__ */
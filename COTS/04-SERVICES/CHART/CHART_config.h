@@ -0,0 +1,19 @@
+/**
+ * @file CHART_config.h
+ * @brief This file contains the configuration options for the strip chart.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __CHART_CONFIG_H__
+#define __CHART_CONFIG_H__
+
+/**
+ * @brief Number of blank columns kept ahead of the newest column of a sweep chart, so the
+ * sweep position stays visible; 0 overwrites the oldest trace in place.
+ */
+#define CHART_SWEEP_GAP             4
+
+#endif /**< __CHART_CONFIG_H__ */
@@ -0,0 +1,118 @@
+/**
+ * @file CHART_interface.h
+ * @brief This file contains the public interface of the strip chart.
+ *
+ * The strip chart plots a stream of samples, oscilloscope style. Samples are reduced to one
+ * line of pixels (a column of the plot) per CHART_Decimation samples: the line shows the
+ * minimum and the maximum of its samples, joined to the last sample of the previous line,
+ * so peaks survive any decimation. Appending a line never redraws the plot: the chart
+ * remembers the trace span of every line, and only the pixels entering or leaving the
+ * trace are sent, usually a few pixels per line.
+ *
+ * Two modes are available:
+ * - sweep: time runs left to right across the plot and wraps, a blank gap of
+ *   @ref CHART_SWEEP_GAP columns moving ahead of the newest column;
+ * - scroll: time runs top to bottom like the paper of a chart recorder, values left to
+ *   right. The plot is the hardware scrolling area of the controller: once it is full, the
+ *   oldest row is reused for the newest one and one scroll start command moves it to the
+ *   bottom.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Include SPI_interface.h and TFT_interface.h before this file.
+ *
+ * @note In scroll mode the whole rows of the plot scroll, whatever its X range: keep the
+ * rest of these rows blank.
+ *
+ * @note Example Usage:
+ * @code
+ * static u16 spans[2 * 320];
+ * static CHART_t chart;
+ *
+ * CHART_Init(&chart, &tftConfig, spi, CHART_SWEEP, 0, 40, 320, 200, 0, 4095, 8, 0x07E0, 0x0000, spans);
+ *
+ * /// ADC end of conversion interrupt
+ * CHART_AddSample(&chart, ADC_Read());     /// one column every 8 samples
+ * @endcode
+ */
+
+#ifndef __CHART_INTERFACE_H__
+#define __CHART_INTERFACE_H__
+
+/**
+ * @brief Plot modes.
+ */
+typedef enum {
+    CHART_SWEEP,                    /**< Time left to right, wrapping at the right edge. */
+    CHART_SCROLL                    /**< Time top to bottom, the plot scrolling upwards. */
+} CHART_Mode_t;
+
+/**
+ * @brief State of one strip chart.
+ */
+typedef struct {
+    const TFT_Config_t *TftDisplay; /**< The display. */
+    SPI_t SpiPeripheral;            /**< The SPI peripheral of the display. */
+    u8 Mode;                        /**< A @ref CHART_Mode_t. */
+    u8 IsFull;                      /**< 1 once every line of the plot holds a trace. */
+    u16 X;                          /**< X-coordinate of the top-left corner of the plot. */
+    u16 Y;                          /**< Y-coordinate of the top-left corner of the plot. */
+    u16 Lines;                      /**< Number of lines: the width in sweep mode, the height in scroll mode. */
+    u16 Range;                      /**< Pixels across a line: the height in sweep mode, the width in scroll mode. */
+    u16 Foreground;                 /**< Trace color (RGB565). */
+    u16 Background;                 /**< Plot color (RGB565). */
+    s32 Min;                        /**< Value at the bottom (sweep) or left edge (scroll). */
+    s32 Max;                        /**< Value at the top (sweep) or right edge (scroll). */
+    u16 Decimation;                 /**< Samples per line. */
+    u16 Count;                      /**< Samples of the line being collected. */
+    s32 Low;                        /**< Smallest sample of the line being collected. */
+    s32 High;                       /**< Largest sample of the line being collected. */
+    s32 Last;                       /**< Last sample. */
+    u16 Previous;                   /**< Position of the last sample of the previous line, or CHART_NONE. */
+    u16 Line;                       /**< Line receiving the next samples. */
+    u16 *Spans;                     /**< Trace span of every line: first and last position, first > last when blank. */
+} CHART_t;
+
+/**
+ * @brief Initializes a strip chart and clears its plot.
+ *
+ * @param[out] Copy_Chart         The chart.
+ * @param[in]  Copy_TftDisplay    The display, already initialized with @ref TFT_Init.
+ * @param[in]  Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in]  Copy_Mode          A @ref CHART_Mode_t.
+ * @param[in]  Copy_XPosition     The X-coordinate of the top-left corner of the plot.
+ * @param[in]  Copy_YPosition     The Y-coordinate of the top-left corner of the plot; in
+ *                                scroll mode, the first row of the scrolling area.
+ * @param[in]  Copy_Width         The width of the plot in pixels.
+ * @param[in]  Copy_Height        The height of the plot in pixels.
+ * @param[in]  Copy_Min           The value at the bottom (sweep) or left edge (scroll).
+ * @param[in]  Copy_Max           The value at the top (sweep) or right edge (scroll).
+ * @param[in]  Copy_Decimation    The number of samples per line, at least 1.
+ * @param[in]  Copy_Foreground    The trace color (RGB565).
+ * @param[in]  Copy_Background    The plot color (RGB565).
+ * @param[in]  Copy_Spans         Storage for 2 * Copy_Width (sweep) or 2 * Copy_Height
+ *                                (scroll) positions.
+ *
+ * @retval     0                  The chart was initialized.
+ * @retval     1                  A pointer is NULL, the plot or the value range is empty,
+ *                                Copy_Decimation is 0 or the scrolling area does not fit in
+ *                                the frame memory.
+ */
+u8 CHART_Init(CHART_t *Copy_Chart, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, u8 Copy_Mode, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height,
+              s32 Copy_Min, s32 Copy_Max, u16 Copy_Decimation, u16 Copy_Foreground, u16 Copy_Background, u16 *Copy_Spans);
+
+/**
+ * @brief Appends one sample.
+ *
+ * Most samples only update the minimum and the maximum of the current line; every
+ * CHART_Decimation samples the line is drawn. Values outside the range are drawn at its
+ * edge.
+ *
+ * @param[in,out] Copy_Chart The chart.
+ * @param[in]     Copy_Value The sample.
+ */
+void CHART_AddSample(CHART_t *Copy_Chart, s32 Copy_Value);
+
+#endif /**< __CHART_INTERFACE_H__ */
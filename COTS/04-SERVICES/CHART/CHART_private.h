@@ -0,0 +1,63 @@
+/**
+ * @file CHART_private.h
+ * @brief This file contains the private interface of the strip chart.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __CHART_PRIVATE_H__
+#define __CHART_PRIVATE_H__
+
+/**
+ * @brief No previous line to join.
+ */
+#define CHART_NONE                  0xFFFF
+
+/**
+ * @brief Span of a blank line: the first position is past the last one.
+ */
+#define CHART_BLANK_FIRST           1
+#define CHART_BLANK_LAST            0
+
+/**
+ * @brief Draw the line collected from the last samples and move to the next line.
+ *
+ * @param[in,out] Copy_Chart The chart.
+ */
+static void CHART_DrawLine(CHART_t *Copy_Chart);
+
+/**
+ * @brief Change the trace span of a line, sending only the pixels that change color.
+ *
+ * @param[in,out] Copy_Chart The chart.
+ * @param[in]     Copy_Line  The line.
+ * @param[in]     Copy_First The first position of the new span.
+ * @param[in]     Copy_Last  The last position of the new span, below Copy_First for a blank line.
+ */
+static void CHART_SetSpan(CHART_t *Copy_Chart, u16 Copy_Line, u16 Copy_First, u16 Copy_Last);
+
+/**
+ * @brief Fill positions of a line.
+ *
+ * @param[in] Copy_Chart The chart.
+ * @param[in] Copy_Line  The line.
+ * @param[in] Copy_First The first position.
+ * @param[in] Copy_Last  The last position; nothing is drawn when it is below Copy_First.
+ * @param[in] Copy_Color The color.
+ */
+static void CHART_FillSpan(const CHART_t *Copy_Chart, u16 Copy_Line, s32 Copy_First, s32 Copy_Last, u16 Copy_Color);
+
+/**
+ * @brief Position of a value across a line.
+ *
+ * @param[in] Copy_Chart The chart.
+ * @param[in] Copy_Value The value.
+ * @return The position, 0 for the minimum to Range - 1 for the maximum.
+ */
+static u16 CHART_GetPosition(const CHART_t *Copy_Chart, s32 Copy_Value);
+
+#endif /**< __CHART_PRIVATE_H__ */
@@ -0,0 +1,202 @@
+/**
+ * @file CHART_program.c
+ * @brief This file contains the implementation of the strip chart.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "CHART_config.h"
+#include "CHART_interface.h"
+#include "CHART_private.h"
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u8 CHART_Init(CHART_t *Copy_Chart, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, u8 Copy_Mode, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height,
+              s32 Copy_Min, s32 Copy_Max, u16 Copy_Decimation, u16 Copy_Foreground, u16 Copy_Background, u16 *Copy_Spans)
+{
+    u16 Local_Index;
+
+    if ((Copy_Chart == NULL) || (Copy_TftDisplay == NULL) || (Copy_Spans == NULL) || (Copy_Width == 0) || (Copy_Height == 0) || (Copy_Max <= Copy_Min) || (Copy_Decimation == 0))
+    {
+        return 1;
+    }
+
+    Copy_Chart->TftDisplay = Copy_TftDisplay;
+    Copy_Chart->SpiPeripheral = Copy_SpiPeripheral;
+    Copy_Chart->Mode = Copy_Mode;
+    Copy_Chart->IsFull = 0;
+    Copy_Chart->X = Copy_XPosition;
+    Copy_Chart->Y = Copy_YPosition;
+    Copy_Chart->Lines = (Copy_Mode == CHART_SCROLL) ? Copy_Height : Copy_Width;
+    Copy_Chart->Range = (Copy_Mode == CHART_SCROLL) ? Copy_Width : Copy_Height;
+    Copy_Chart->Foreground = Copy_Foreground;
+    Copy_Chart->Background = Copy_Background;
+    Copy_Chart->Min = Copy_Min;
+    Copy_Chart->Max = Copy_Max;
+    Copy_Chart->Decimation = Copy_Decimation;
+    Copy_Chart->Count = 0;
+    Copy_Chart->Previous = CHART_NONE;
+    Copy_Chart->Line = 0;
+    Copy_Chart->Spans = Copy_Spans;
+
+    for (Local_Index = 0; Local_Index < Copy_Chart->Lines; Local_Index++)
+    {
+        Copy_Spans[2 * Local_Index] = CHART_BLANK_FIRST;
+        Copy_Spans[(2 * Local_Index) + 1] = CHART_BLANK_LAST;
+    }
+
+    if (Copy_Mode == CHART_SCROLL)
+    {
+        if (TFT_SetScrollArea(Copy_TftDisplay, Copy_SpiPeripheral, Copy_YPosition, Copy_Height) != 0)
+        {
+            return 1;
+        }
+        TFT_SetScrollStart(Copy_TftDisplay, Copy_SpiPeripheral, Copy_YPosition, Copy_Height, Copy_YPosition);
+    }
+    TFT_FillRect(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition, Copy_Width, Copy_Height, Copy_Background);
+
+    return 0;
+}
+
+void CHART_AddSample(CHART_t *Copy_Chart, s32 Copy_Value)
+{
+    if (Copy_Chart->Count == 0)
+    {
+        Copy_Chart->Low = Copy_Value;
+        Copy_Chart->High = Copy_Value;
+    }
+    else if (Copy_Value < Copy_Chart->Low)
+    {
+        Copy_Chart->Low = Copy_Value;
+    }
+    else if (Copy_Value > Copy_Chart->High)
+    {
+        Copy_Chart->High = Copy_Value;
+    }
+    Copy_Chart->Last = Copy_Value;
+
+    if (++Copy_Chart->Count >= Copy_Chart->Decimation)
+    {
+        CHART_DrawLine(Copy_Chart);
+        Copy_Chart->Count = 0;
+    }
+}
+
+static void CHART_DrawLine(CHART_t *Copy_Chart)
+{
+    u16 Local_First = CHART_GetPosition(Copy_Chart, Copy_Chart->Low);
+    u16 Local_Last = CHART_GetPosition(Copy_Chart, Copy_Chart->High);
+
+    /**< Join the previous line so steep edges stay continuous */
+    if (Copy_Chart->Previous != CHART_NONE)
+    {
+        if (Copy_Chart->Previous < Local_First)
+        {
+            Local_First = Copy_Chart->Previous;
+        }
+        else if (Copy_Chart->Previous > Local_Last)
+        {
+            Local_Last = Copy_Chart->Previous;
+        }
+    }
+    Copy_Chart->Previous = CHART_GetPosition(Copy_Chart, Copy_Chart->Last);
+
+    CHART_SetSpan(Copy_Chart, Copy_Chart->Line, Local_First, Local_Last);
+    if ((Copy_Chart->Mode == CHART_SWEEP) && (CHART_SWEEP_GAP > 0) && (CHART_SWEEP_GAP < Copy_Chart->Lines))
+    {
+        CHART_SetSpan(Copy_Chart, (Copy_Chart->Line + CHART_SWEEP_GAP) % Copy_Chart->Lines, CHART_BLANK_FIRST, CHART_BLANK_LAST);
+    }
+
+    if (++Copy_Chart->Line >= Copy_Chart->Lines)
+    {
+        Copy_Chart->Line = 0;
+        Copy_Chart->IsFull = 1;
+    }
+
+    /**< The oldest line, reused next, goes to the top and the newest to the bottom */
+    if ((Copy_Chart->Mode == CHART_SCROLL) && Copy_Chart->IsFull)
+    {
+        TFT_SetScrollStart(Copy_Chart->TftDisplay, Copy_Chart->SpiPeripheral, Copy_Chart->Y, Copy_Chart->Lines, Copy_Chart->Y + Copy_Chart->Line);
+    }
+}
+
+static void CHART_SetSpan(CHART_t *Copy_Chart, u16 Copy_Line, u16 Copy_First, u16 Copy_Last)
+{
+    u16 *Local_Span = &Copy_Chart->Spans[2 * Copy_Line];
+    s32 Local_OldFirst = Local_Span[0];
+    s32 Local_OldLast = Local_Span[1];
+    s32 Local_First = Copy_First;
+    s32 Local_Last = Copy_Last;
+
+    if (Local_OldFirst > Local_OldLast)
+    {
+        CHART_FillSpan(Copy_Chart, Copy_Line, Local_First, Local_Last, Copy_Chart->Foreground);
+    }
+    else if (Local_First > Local_Last)
+    {
+        CHART_FillSpan(Copy_Chart, Copy_Line, Local_OldFirst, Local_OldLast, Copy_Chart->Background);
+    }
+    else
+    {
+        /**< Erase the old trace outside the new one, then draw the new trace outside the old one */
+        CHART_FillSpan(Copy_Chart, Copy_Line, Local_OldFirst, (Local_OldLast < Local_First) ? Local_OldLast : (Local_First - 1), Copy_Chart->Background);
+        CHART_FillSpan(Copy_Chart, Copy_Line, (Local_OldFirst > Local_Last) ? Local_OldFirst : (Local_Last + 1), Local_OldLast, Copy_Chart->Background);
+        CHART_FillSpan(Copy_Chart, Copy_Line, Local_First, (Local_Last < Local_OldFirst) ? Local_Last : (Local_OldFirst - 1), Copy_Chart->Foreground);
+        CHART_FillSpan(Copy_Chart, Copy_Line, (Local_First > Local_OldLast) ? Local_First : (Local_OldLast + 1), Local_Last, Copy_Chart->Foreground);
+    }
+
+    Local_Span[0] = Copy_First;
+    Local_Span[1] = Copy_Last;
+}
+
+static void CHART_FillSpan(const CHART_t *Copy_Chart, u16 Copy_Line, s32 Copy_First, s32 Copy_Last, u16 Copy_Color)
+{
+    if (Copy_First > Copy_Last)
+    {
+        return;
+    }
+
+    if (Copy_Chart->Mode == CHART_SCROLL)
+    {
+        /**< Lines are rows of the scrolling area, the minimum on the left */
+        TFT_FillRect(Copy_Chart->TftDisplay, Copy_Chart->SpiPeripheral, Copy_Chart->X + Copy_First, Copy_Chart->Y + Copy_Line, Copy_Last - Copy_First + 1, 1, Copy_Color);
+    }
+    else
+    {
+        /**< Lines are columns, the minimum at the bottom */
+        TFT_FillRect(Copy_Chart->TftDisplay, Copy_Chart->SpiPeripheral, Copy_Chart->X + Copy_Line, Copy_Chart->Y + Copy_Chart->Range - 1 - Copy_Last, 1, Copy_Last - Copy_First + 1, Copy_Color);
+    }
+}
+
+static u16 CHART_GetPosition(const CHART_t *Copy_Chart, s32 Copy_Value)
+{
+    u32 Local_Span = (u32)Copy_Chart->Max - (u32)Copy_Chart->Min;
+    u32 Local_Offset;
+
+    if (Copy_Value <= Copy_Chart->Min)
+    {
+        return 0;
+    }
+    if (Copy_Value >= Copy_Chart->Max)
+    {
+        return Copy_Chart->Range - 1;
+    }
+    Local_Offset = (u32)Copy_Value - (u32)Copy_Chart->Min;
+
+    /**< Keep offset * range within 32 bits */
+    while (Local_Span > 0xFFFF)
+    {
+        Local_Span >>= 1;
+        Local_Offset >>= 1;
+    }
+
+    return (u16)((Local_Offset * (Copy_Chart->Range - 1)) / Local_Span);
+}
@@ -0,0 +1,23 @@
+/**
+ * @file CONSOLE_config.h
+ * @brief This file contains the configuration options for the TFT text console.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __CONSOLE_CONFIG_H__
+#define __CONSOLE_CONFIG_H__
+
+/**
+ * @brief Size in characters of the stack buffer used by CONSOLE_Printf.
+ */
+#define CONSOLE_PRINTF_BUFFER_SIZE  128
+
+/**
+ * @brief Distance between tab stops in columns.
+ */
+#define CONSOLE_TAB_WIDTH           4
+
+#endif /**< __CONSOLE_CONFIG_H__ */
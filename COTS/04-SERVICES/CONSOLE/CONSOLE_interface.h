@@ -0,0 +1,135 @@
+/**
+ * @file CONSOLE_interface.h
+ * @brief This file contains the public interface of the TFT text console.
+ *
+ * The console prints text line after line on a TFT display and scrolls with the
+ * controller's hardware vertical scrolling: the screen is a ring of text lines in the frame
+ * memory, and scrolling by one line costs one scroll start command plus clearing the new
+ * line, instead of redrawing the whole screen.
+ *
+ * A VT100 subset is understood:
+ * - '\\n' (new line, back to the first column), '\\r', '\\b' and '\\t';
+ * - ESC [ n m: 0 reset, 1 bright, 22 normal, 30-37/90-97 text color, 39 default text
+ *   color, 40-47/100-107 background color, 49 default background color. Bright (bold)
+ *   turns the text color, set before or after it, from one of the 8 normal ANSI colors to
+ *   its bright version; a default text color is brightened when it is one of them too;
+ * - ESC [ row ; col H (or f), ESC [ n A/B/C/D: cursor position and moves;
+ * - ESC [ n J: 0 erase to the end of the screen, 2 erase the screen;
+ * - ESC [ n K: 0 erase to the end of the line, 2 erase the line.
+ *
+ * Cursor columns are counted in widths of the space character, so cursor positioning
+ * assumes a monospaced font.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Include SPI_interface.h and TFT_interface.h before this file.
+ *
+ * @note Example Usage:
+ * @code
+ * static CONSOLE_t console;
+ *
+ * CONSOLE_Init(&console, &tftConfig, spi, &Font_Terminus12, TFT_COLOR_WHITE, TFT_COLOR_BLACK);
+ * CONSOLE_Print(&console, "\033[32mOK\033[0m boot done\n");
+ * CONSOLE_Printf(&console, "temp = %d C\n", temperature);
+ * @endcode
+ */
+
+#ifndef __CONSOLE_INTERFACE_H__
+#define __CONSOLE_INTERFACE_H__
+
+/**
+ * @brief Maximum number of numeric parameters of an escape sequence.
+ */
+#define CONSOLE_MAX_PARAMS          4
+
+/**
+ * @brief State of one console.
+ */
+typedef struct {
+    const TFT_Config_t *TftDisplay;     /**< The display. */
+    SPI_t SpiPeripheral;                /**< The SPI peripheral of the display. */
+    const TFT_Font_t *Font;             /**< The font. */
+    u16 Foreground;                     /**< Current text color (RGB565). */
+    u16 Background;                     /**< Current background color (RGB565). */
+    u16 DefaultForeground;              /**< Text color restored by ESC [ 0 m. */
+    u16 DefaultBackground;              /**< Background color restored by ESC [ 0 m. */
+    u16 Rows;                           /**< Number of text lines on the screen. */
+    u16 FirstLine;                      /**< Line slot of the frame memory shown at the top. */
+    u16 CursorRow;                      /**< Cursor line, 0 is the top line of the screen. */
+    u16 CursorX;                        /**< Cursor X-coordinate in pixels. */
+    u8 CellWidth;                       /**< Width of a column (the space character) in pixels. */
+    u8 Bright;                          /**< Set by ESC [ 1 m. */
+    u8 ForegroundIndex;                 /**< ANSI color 0-15 of the text color, CONSOLE_NO_ANSI_COLOR for another color. */
+    u8 State;                           /**< Escape sequence parser state. */
+    u8 ParamCount;                      /**< Number of parameters of the current sequence. */
+    u16 Params[CONSOLE_MAX_PARAMS];     /**< Parameters of the current sequence. */
+} CONSOLE_t;
+
+/**
+ * @brief Initializes a console and clears the screen.
+ *
+ * The scrolling area is set to the whole number of text lines fitting on the screen; the
+ * rows left under the last line are cleared and stay fixed.
+ *
+ * @param[out] Copy_Console       The console to initialize.
+ * @param[in]  Copy_TftDisplay    The display, already initialized with @ref TFT_Init.
+ * @param[in]  Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in]  Copy_Font          The font.
+ * @param[in]  Copy_Foreground    The default text color (RGB565).
+ * @param[in]  Copy_Background    The default background color (RGB565).
+ *
+ * @retval     0                  The console was initialized.
+ * @retval     1                  A pointer is NULL, the font is taller than the screen or
+ *                                the screen does not fit in the scrolling frame memory.
+ */
+u8 CONSOLE_Init(CONSOLE_t *Copy_Console, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, const TFT_Font_t *Copy_Font, u16 Copy_Foreground, u16 Copy_Background);
+
+/**
+ * @brief Clears the screen and moves the cursor to the top-left corner.
+ *
+ * @param[in,out] Copy_Console The console.
+ */
+void CONSOLE_Clear(CONSOLE_t *Copy_Console);
+
+/**
+ * @brief Prints one character or feeds one byte of an escape sequence.
+ *
+ * @param[in,out] Copy_Console   The console.
+ * @param[in]     Copy_Character The character.
+ */
+void CONSOLE_PutChar(CONSOLE_t *Copy_Console, char Copy_Character);
+
+/**
+ * @brief Prints a buffer.
+ *
+ * Suited to be called from the C library write hook to send printf output to the console.
+ *
+ * @param[in,out] Copy_Console The console.
+ * @param[in]     Copy_Data    The characters.
+ * @param[in]     Copy_Length  The number of characters.
+ */
+void CONSOLE_Write(CONSOLE_t *Copy_Console, const char *Copy_Data, u32 Copy_Length);
+
+/**
+ * @brief Prints a null-terminated string.
+ *
+ * @param[in,out] Copy_Console The console.
+ * @param[in]     Copy_Text    The string.
+ */
+void CONSOLE_Print(CONSOLE_t *Copy_Console, const char *Copy_Text);
+
+/**
+ * @brief Prints formatted text.
+ *
+ * The text is formatted with vsnprintf into a stack buffer of
+ * @ref CONSOLE_PRINTF_BUFFER_SIZE characters; longer output is truncated.
+ *
+ * @param[in,out] Copy_Console The console.
+ * @param[in]     Copy_Format  The printf format string.
+ * @param[in]     ...          The values to format.
+ */
+void CONSOLE_Printf(CONSOLE_t *Copy_Console, const char *Copy_Format, ...);
+
+#endif /**< __CONSOLE_INTERFACE_H__ */
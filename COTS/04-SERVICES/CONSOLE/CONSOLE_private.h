@@ -0,0 +1,110 @@
+/**
+ * @file CONSOLE_private.h
+ * @brief This file contains the private interface of the TFT text console.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __CONSOLE_PRIVATE_H__
+#define __CONSOLE_PRIVATE_H__
+
+/**
+ * @brief Escape sequence parser states.
+ */
+#define CONSOLE_STATE_TEXT          0   /**< Printing characters. */
+#define CONSOLE_STATE_ESCAPE        1   /**< ESC received. */
+#define CONSOLE_STATE_CSI           2   /**< ESC [ received, reading parameters. */
+
+#define CONSOLE_ESCAPE              0x1B
+
+/**
+ * @brief Value of CONSOLE_t::ForegroundIndex when the text color is not an ANSI color.
+ */
+#define CONSOLE_NO_ANSI_COLOR       0xFF
+
+/**
+ * @brief Y-coordinate of a text line in the frame memory.
+ *
+ * @param[in] Copy_Console The console.
+ * @param[in] Copy_Row     The line, 0 is the top line of the screen.
+ *
+ * @return The frame memory row of the top of the line.
+ */
+static u16 CONSOLE_LineY(const CONSOLE_t *Copy_Console, u16 Copy_Row);
+
+/**
+ * @brief Moves the cursor to the start of the next line, scrolling at the bottom.
+ *
+ * Scrolling clears the top line, which becomes the new bottom line, and moves the
+ * scroll start one line down.
+ *
+ * @param[in,out] Copy_Console The console.
+ *
+ * @retval None
+ */
+static void CONSOLE_NewLine(CONSOLE_t *Copy_Console);
+
+/**
+ * @brief Draws a printable character at the cursor, wrapping at the end of the line.
+ *
+ * @param[in,out] Copy_Console   The console.
+ * @param[in]     Copy_Character The character.
+ *
+ * @retval None
+ */
+static void CONSOLE_DrawCharacter(CONSOLE_t *Copy_Console, u8 Copy_Character);
+
+/**
+ * @brief Fills part of a text line with the background color.
+ *
+ * @param[in] Copy_Console The console.
+ * @param[in] Copy_Row     The line, 0 is the top line of the screen.
+ * @param[in] Copy_X       X-coordinate where the erased part starts; it ends at the right edge.
+ *
+ * @retval None
+ */
+static void CONSOLE_EraseLine(const CONSOLE_t *Copy_Console, u16 Copy_Row, u16 Copy_X);
+
+/**
+ * @brief Executes a complete ESC [ sequence.
+ *
+ * @param[in,out] Copy_Console The console, with the parameters of the sequence.
+ * @param[in]     Copy_Final   The final character of the sequence.
+ *
+ * @retval None
+ */
+static void CONSOLE_ExecuteCsi(CONSOLE_t *Copy_Console, u8 Copy_Final);
+
+/**
+ * @brief Sets the text color to the default one.
+ *
+ * @param[in,out] Copy_Console The console.
+ *
+ * @retval None
+ */
+static void CONSOLE_SetDefaultForeground(CONSOLE_t *Copy_Console);
+
+/**
+ * @brief Sets the text color from its ANSI color and the bright attribute.
+ *
+ * @param[in,out] Copy_Console The console.
+ * @param[in]     Copy_Index   The ANSI color: 0-7 are brightened when bright is set, 8-15 are always bright.
+ *
+ * @retval None
+ */
+static void CONSOLE_SetAnsiForeground(CONSOLE_t *Copy_Console, u8 Copy_Index);
+
+/**
+ * @brief Applies the parameters of an ESC [ m sequence.
+ *
+ * @param[in,out] Copy_Console The console, with the parameters of the sequence.
+ *
+ * @retval None
+ */
+static void CONSOLE_SetGraphicRendition(CONSOLE_t *Copy_Console);
+
+#endif /**< __CONSOLE_PRIVATE_H__ */
@@ -0,0 +1,440 @@
+/**
+ * @file CONSOLE_program.c
+ * @brief This file contains the implementation of the TFT text console.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#include <stdarg.h>
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "CONSOLE_config.h"
+#include "CONSOLE_interface.h"
+#include "CONSOLE_private.h"
+
+/**
+ * @brief The 16 ANSI colors in RGB565: normal 0-7, bright 8-15.
+ */
+static const u16 CONSOLE_AnsiColors[16] =
+{
+    0x0000, 0xA800, 0x0540, 0xAAA0, 0x0015, 0xA815, 0x0555, 0xAD55,
+    0x52AA, 0xFAAA, 0x57EA, 0xFFEA, 0x52BF, 0xFABF, 0x57FF, 0xFFFF
+};
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u8 CONSOLE_Init(CONSOLE_t *Copy_Console, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, const TFT_Font_t *Copy_Font, u16 Copy_Foreground, u16 Copy_Background)
+{
+    u8 Local_u8ErrorStatus = 0;
+    u16 Local_ScrollRows;
+
+    if ((Copy_Console == NULL) || (Copy_TftDisplay == NULL) || (Copy_Font == NULL) || (Copy_Font->TFT_LineHeight == 0))
+    {
+        Local_u8ErrorStatus = 1;
+    }
+    else
+    {
+        Copy_Console->TftDisplay = Copy_TftDisplay;
+        Copy_Console->SpiPeripheral = Copy_SpiPeripheral;
+        Copy_Console->Font = Copy_Font;
+        Copy_Console->Background = Copy_Background;
+        Copy_Console->DefaultForeground = Copy_Foreground;
+        Copy_Console->DefaultBackground = Copy_Background;
+        Copy_Console->Bright = 0;
+        CONSOLE_SetDefaultForeground(Copy_Console);
+        Copy_Console->State = CONSOLE_STATE_TEXT;
+        Copy_Console->ParamCount = 0;
+
+        /**< Columns are as wide as the space character */
+        if ((' ' >= Copy_Font->TFT_FirstChar) && (' ' <= Copy_Font->TFT_LastChar))
+        {
+            Copy_Console->CellWidth = Copy_Font->TFT_Glyphs[' ' - Copy_Font->TFT_FirstChar].TFT_XAdvance;
+        }
+        else
+        {
+            Copy_Console->CellWidth = Copy_Font->TFT_Glyphs[0].TFT_XAdvance;
+        }
+        if (Copy_Console->CellWidth == 0)
+        {
+            Copy_Console->CellWidth = 1;
+        }
+
+        /**< The scrolling area holds a whole number of lines */
+        Copy_Console->Rows = Copy_TftDisplay->TFT_Controller->TFT_Height / Copy_Font->TFT_LineHeight;
+        Local_ScrollRows = Copy_Console->Rows * Copy_Font->TFT_LineHeight;
+
+        if ((Copy_Console->Rows == 0) || (TFT_SetScrollArea(Copy_TftDisplay, Copy_SpiPeripheral, 0, Local_ScrollRows) != 0))
+        {
+            Local_u8ErrorStatus = 1;
+        }
+        else
+        {
+            /**< Rows under the last line stay fixed */
+            TFT_FillRect(Copy_TftDisplay, Copy_SpiPeripheral, 0, Local_ScrollRows, Copy_TftDisplay->TFT_Controller->TFT_Width,
+                         Copy_TftDisplay->TFT_Controller->TFT_Height - Local_ScrollRows, Copy_Background);
+            CONSOLE_Clear(Copy_Console);
+        }
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+void CONSOLE_Clear(CONSOLE_t *Copy_Console)
+{
+    Copy_Console->FirstLine = 0;
+    Copy_Console->CursorRow = 0;
+    Copy_Console->CursorX = 0;
+
+    TFT_SetScrollStart(Copy_Console->TftDisplay, Copy_Console->SpiPeripheral, 0, Copy_Console->Rows * Copy_Console->Font->TFT_LineHeight, 0);
+    TFT_FillRect(Copy_Console->TftDisplay, Copy_Console->SpiPeripheral, 0, 0, Copy_Console->TftDisplay->TFT_Controller->TFT_Width,
+                 Copy_Console->Rows * Copy_Console->Font->TFT_LineHeight, Copy_Console->Background);
+}
+
+void CONSOLE_PutChar(CONSOLE_t *Copy_Console, char Copy_Character)
+{
+    u8 Local_Character = (u8)Copy_Character;
+    u16 Local_TabStop;
+    u8 Local_Index;
+
+    switch (Copy_Console->State)
+    {
+    case CONSOLE_STATE_TEXT:
+        if (Local_Character == CONSOLE_ESCAPE)
+        {
+            Copy_Console->State = CONSOLE_STATE_ESCAPE;
+        }
+        else if (Local_Character == '\n')
+        {
+            CONSOLE_NewLine(Copy_Console);
+        }
+        else if (Local_Character == '\r')
+        {
+            Copy_Console->CursorX = 0;
+        }
+        else if (Local_Character == '\b')
+        {
+            Copy_Console->CursorX = (Copy_Console->CursorX > Copy_Console->CellWidth) ? (Copy_Console->CursorX - Copy_Console->CellWidth) : 0;
+        }
+        else if (Local_Character == '\t')
+        {
+            Local_TabStop = (Copy_Console->CursorX / (Copy_Console->CellWidth * CONSOLE_TAB_WIDTH) + 1) * (Copy_Console->CellWidth * CONSOLE_TAB_WIDTH);
+            if (Local_TabStop >= Copy_Console->TftDisplay->TFT_Controller->TFT_Width)
+            {
+                CONSOLE_NewLine(Copy_Console);
+            }
+            else
+            {
+                Copy_Console->CursorX = Local_TabStop;
+            }
+        }
+        else if (Local_Character >= ' ')
+        {
+            CONSOLE_DrawCharacter(Copy_Console, Local_Character);
+        }
+        break;
+
+    case CONSOLE_STATE_ESCAPE:
+        if (Local_Character == '[')
+        {
+            /**< Start of a control sequence, all parameters default to 0 */
+            Copy_Console->State = CONSOLE_STATE_CSI;
+            Copy_Console->ParamCount = 0;
+            for (Local_Index = 0; Local_Index < CONSOLE_MAX_PARAMS; Local_Index++)
+            {
+                Copy_Console->Params[Local_Index] = 0;
+            }
+        }
+        else
+        {
+            /**< Other escape sequences are not supported and dropped */
+            Copy_Console->State = CONSOLE_STATE_TEXT;
+        }
+        break;
+
+    case CONSOLE_STATE_CSI:
+        if ((Local_Character >= '0') && (Local_Character <= '9'))
+        {
+            if (Copy_Console->ParamCount == 0)
+            {
+                Copy_Console->ParamCount = 1;
+            }
+            if (Copy_Console->Params[Copy_Console->ParamCount - 1] < 1000)
+            {
+                Copy_Console->Params[Copy_Console->ParamCount - 1] = Copy_Console->Params[Copy_Console->ParamCount - 1] * 10 + (Local_Character - '0');
+            }
+        }
+        else if (Local_Character == ';')
+        {
+            if (Copy_Console->ParamCount == 0)
+            {
+                Copy_Console->ParamCount = 1;
+            }
+            if (Copy_Console->ParamCount < CONSOLE_MAX_PARAMS)
+            {
+                Copy_Console->ParamCount++;
+            }
+        }
+        else if ((Local_Character >= 0x40) && (Local_Character <= 0x7E))
+        {
+            CONSOLE_ExecuteCsi(Copy_Console, Local_Character);
+            Copy_Console->State = CONSOLE_STATE_TEXT;
+        }
+        break;
+
+    default:
+        Copy_Console->State = CONSOLE_STATE_TEXT;
+        break;
+    }
+}
+
+void CONSOLE_Write(CONSOLE_t *Copy_Console, const char *Copy_Data, u32 Copy_Length)
+{
+    while (Copy_Length-- > 0)
+    {
+        CONSOLE_PutChar(Copy_Console, *Copy_Data++);
+    }
+}
+
+void CONSOLE_Print(CONSOLE_t *Copy_Console, const char *Copy_Text)
+{
+    while (*Copy_Text != '\0')
+    {
+        CONSOLE_PutChar(Copy_Console, *Copy_Text++);
+    }
+}
+
+void CONSOLE_Printf(CONSOLE_t *Copy_Console, const char *Copy_Format, ...)
+{
+    char Local_Buffer[CONSOLE_PRINTF_BUFFER_SIZE];
+    va_list Local_Args;
+    s32 Local_Length;
+
+    va_start(Local_Args, Copy_Format);
+    Local_Length = vsnprintf(Local_Buffer, sizeof(Local_Buffer), Copy_Format, Local_Args);
+    va_end(Local_Args);
+
+    if (Local_Length > 0)
+    {
+        /**< Truncated output: print what fits in the buffer */
+        if (Local_Length >= (s32)sizeof(Local_Buffer))
+        {
+            Local_Length = sizeof(Local_Buffer) - 1;
+        }
+        CONSOLE_Write(Copy_Console, Local_Buffer, (u32)Local_Length);
+    }
+}
+
+static u16 CONSOLE_LineY(const CONSOLE_t *Copy_Console, u16 Copy_Row)
+{
+    return ((Copy_Console->FirstLine + Copy_Row) % Copy_Console->Rows) * Copy_Console->Font->TFT_LineHeight;
+}
+
+static void CONSOLE_NewLine(CONSOLE_t *Copy_Console)
+{
+    Copy_Console->CursorX = 0;
+
+    if ((Copy_Console->CursorRow + 1) < Copy_Console->Rows)
+    {
+        Copy_Console->CursorRow++;
+    }
+    else
+    {
+        /**< The top line scrolls out: clear it, it comes back as the new bottom line */
+        CONSOLE_EraseLine(Copy_Console, 0, 0);
+        Copy_Console->FirstLine++;
+        if (Copy_Console->FirstLine == Copy_Console->Rows)
+        {
+            Copy_Console->FirstLine = 0;
+        }
+        TFT_SetScrollStart(Copy_Console->TftDisplay, Copy_Console->SpiPeripheral, 0, Copy_Console->Rows * Copy_Console->Font->TFT_LineHeight,
+                           Copy_Console->FirstLine * Copy_Console->Font->TFT_LineHeight);
+    }
+}
+
+static void CONSOLE_DrawCharacter(CONSOLE_t *Copy_Console, u8 Copy_Character)
+{
+    const TFT_Font_t *Local_Font = Copy_Console->Font;
+    char Local_Text[2];
+    u8 Local_Advance;
+
+    if ((Copy_Character < Local_Font->TFT_FirstChar) || (Copy_Character > Local_Font->TFT_LastChar))
+    {
+        return;
+    }
+
+    /**< Wrap when the character does not fit on the line */
+    Local_Advance = Local_Font->TFT_Glyphs[Copy_Character - Local_Font->TFT_FirstChar].TFT_XAdvance;
+    if (((u32)Copy_Console->CursorX + Local_Advance) > Copy_Console->TftDisplay->TFT_Controller->TFT_Width)
+    {
+        CONSOLE_NewLine(Copy_Console);
+    }
+
+    Local_Text[0] = (char)Copy_Character;
+    Local_Text[1] = '\0';
+    TFT_DrawText(Copy_Console->TftDisplay, Copy_Console->SpiPeripheral, Copy_Console->CursorX, CONSOLE_LineY(Copy_Console, Copy_Console->CursorRow),
+                 Local_Text, Local_Font, Copy_Console->Foreground, Copy_Console->Background);
+    Copy_Console->CursorX += Local_Advance;
+}
+
+static void CONSOLE_EraseLine(const CONSOLE_t *Copy_Console, u16 Copy_Row, u16 Copy_X)
+{
+    u16 Local_Width = Copy_Console->TftDisplay->TFT_Controller->TFT_Width;
+
+    if (Copy_X < Local_Width)
+    {
+        TFT_FillRect(Copy_Console->TftDisplay, Copy_Console->SpiPeripheral, Copy_X, CONSOLE_LineY(Copy_Console, Copy_Row),
+                     Local_Width - Copy_X, Copy_Console->Font->TFT_LineHeight, Copy_Console->Background);
+    }
+}
+
+static void CONSOLE_ExecuteCsi(CONSOLE_t *Copy_Console, u8 Copy_Final)
+{
+    u16 Local_Width = Copy_Console->TftDisplay->TFT_Controller->TFT_Width;
+    u16 Local_Mode = Copy_Console->Params[0];
+    u16 Local_Count = (Copy_Console->Params[0] > 0) ? Copy_Console->Params[0] : 1;
+    u32 Local_Distance = (u32)Local_Count * Copy_Console->CellWidth;
+    u16 Local_Row;
+
+    switch (Copy_Final)
+    {
+    case 'm':
+        CONSOLE_SetGraphicRendition(Copy_Console);
+        break;
+
+    case 'H':
+    case 'f':
+        /**< 1-based row and column, 0 counts as 1 */
+        Local_Row = (Copy_Console->Params[0] > 0) ? (Copy_Console->Params[0] - 1) : 0;
+        Copy_Console->CursorRow = (Local_Row < Copy_Console->Rows) ? Local_Row : (Copy_Console->Rows - 1);
+        Local_Distance = (Copy_Console->Params[1] > 0) ? ((u32)(Copy_Console->Params[1] - 1) * Copy_Console->CellWidth) : 0;
+        Copy_Console->CursorX = (Local_Distance < Local_Width) ? (u16)Local_Distance : Local_Width;
+        break;
+
+    case 'A':
+        Copy_Console->CursorRow = (Copy_Console->CursorRow > Local_Count) ? (Copy_Console->CursorRow - Local_Count) : 0;
+        break;
+
+    case 'B':
+        Copy_Console->CursorRow = (((u32)Copy_Console->CursorRow + Local_Count) < Copy_Console->Rows) ? (Copy_Console->CursorRow + Local_Count) : (Copy_Console->Rows - 1);
+        break;
+
+    case 'C':
+        Copy_Console->CursorX = ((Copy_Console->CursorX + Local_Distance) < Local_Width) ? (u16)(Copy_Console->CursorX + Local_Distance) : Local_Width;
+        break;
+
+    case 'D':
+        Copy_Console->CursorX = (Copy_Console->CursorX > Local_Distance) ? (u16)(Copy_Console->CursorX - Local_Distance) : 0;
+        break;
+
+    case 'J':
+        /**< 0: from the cursor to the end of the screen, 2: the whole screen */
+        if ((Local_Mode == 0) || (Local_Mode == 2))
+        {
+            Local_Row = (Local_Mode == 0) ? Copy_Console->CursorRow : 0;
+            CONSOLE_EraseLine(Copy_Console, Local_Row, (Local_Mode == 0) ? Copy_Console->CursorX : 0);
+            for (Local_Row++; Local_Row < Copy_Console->Rows; Local_Row++)
+            {
+                CONSOLE_EraseLine(Copy_Console, Local_Row, 0);
+            }
+        }
+        break;
+
+    case 'K':
+        /**< 0: from the cursor to the end of the line, 2: the whole line */
+        if ((Local_Mode == 0) || (Local_Mode == 2))
+        {
+            CONSOLE_EraseLine(Copy_Console, Copy_Console->CursorRow, (Local_Mode == 0) ? Copy_Console->CursorX : 0);
+        }
+        break;
+
+    default:
+        /**< Unsupported sequence, ignored */
+        break;
+    }
+}
+
+static void CONSOLE_SetDefaultForeground(CONSOLE_t *Copy_Console)
+{
+    u8 Local_Index;
+
+    /**< A default equal to a normal ANSI color is brightened like it */
+    for (Local_Index = 0; Local_Index < 8; Local_Index++)
+    {
+        if (CONSOLE_AnsiColors[Local_Index] == Copy_Console->DefaultForeground)
+        {
+            CONSOLE_SetAnsiForeground(Copy_Console, Local_Index);
+            return;
+        }
+    }
+
+    Copy_Console->ForegroundIndex = CONSOLE_NO_ANSI_COLOR;
+    Copy_Console->Foreground = Copy_Console->DefaultForeground;
+}
+
+static void CONSOLE_SetAnsiForeground(CONSOLE_t *Copy_Console, u8 Copy_Index)
+{
+    Copy_Console->ForegroundIndex = Copy_Index;
+    Copy_Console->Foreground = CONSOLE_AnsiColors[((Copy_Index < 8) && Copy_Console->Bright) ? (Copy_Index + 8) : Copy_Index];
+}
+
+static void CONSOLE_SetGraphicRendition(CONSOLE_t *Copy_Console)
+{
+    u8 Local_Index = 0;
+    u16 Local_Param;
+
+    /**< ESC [ m is ESC [ 0 m */
+    do
+    {
+        Local_Param = Copy_Console->Params[Local_Index];
+
+        if (Local_Param == 0)
+        {
+            Copy_Console->Background = Copy_Console->DefaultBackground;
+            Copy_Console->Bright = 0;
+            CONSOLE_SetDefaultForeground(Copy_Console);
+        }
+        else if ((Local_Param == 1) || (Local_Param == 22))
+        {
+            /**< The current text color changes too */
+            Copy_Console->Bright = (Local_Param == 1);
+            if (Copy_Console->ForegroundIndex != CONSOLE_NO_ANSI_COLOR)
+            {
+                CONSOLE_SetAnsiForeground(Copy_Console, Copy_Console->ForegroundIndex);
+            }
+        }
+        else if ((Local_Param >= 30) && (Local_Param <= 37))
+        {
+            CONSOLE_SetAnsiForeground(Copy_Console, (u8)(Local_Param - 30));
+        }
+        else if (Local_Param == 39)
+        {
+            CONSOLE_SetDefaultForeground(Copy_Console);
+        }
+        else if ((Local_Param >= 40) && (Local_Param <= 47))
+        {
+            Copy_Console->Background = CONSOLE_AnsiColors[Local_Param - 40];
+        }
+        else if (Local_Param == 49)
+        {
+            Copy_Console->Background = Copy_Console->DefaultBackground;
+        }
+        else if ((Local_Param >= 90) && (Local_Param <= 97))
+        {
+            CONSOLE_SetAnsiForeground(Copy_Console, (u8)((Local_Param - 90) + 8));
+        }
+        else if ((Local_Param >= 100) && (Local_Param <= 107))
+        {
+            Copy_Console->Background = CONSOLE_AnsiColors[(Local_Param - 100) + 8];
+        }
+
+        Local_Index++;
+    } while (Local_Index < Copy_Console->ParamCount);
+}
@@ -0,0 +1,27 @@
+/**
+ * @file DIRTY_config.h
+ * @brief This file contains the configuration options for the dirty-rectangle manager.
+ *
+ * The merge decision compares bus bytes. Adjust the values to the display interface used.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __DIRTY_CONFIG_H__
+#define __DIRTY_CONFIG_H__
+
+/**
+ * @brief Bytes needed to open an address window.
+ *
+ * CASET + 4 parameters, RASET + 4 parameters and RAMWR on the TFT core.
+ */
+#define DIRTY_WINDOW_SETUP_BYTES    11
+
+/**
+ * @brief Bytes sent per pixel (2 for RGB565).
+ */
+#define DIRTY_BYTES_PER_PIXEL       2
+
+#endif /**< __DIRTY_CONFIG_H__ */
@@ -0,0 +1,144 @@
+/**
+ * @file DIRTY_interface.h
+ * @brief This file contains the public interface of the dirty-rectangle manager.
+ *
+ * The dirty-rectangle manager collects the screen areas changed since the last refresh and
+ * sends only those areas to a TFT display. Marked rectangles are merged when sending their
+ * bounding box is cheaper than sending them one by one, so the number of address windows
+ * stays low without sending much unchanged area.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Include SPI_interface.h and TFT_interface.h before this file.
+ *
+ * @note Example Usage:
+ * @code
+ * static DIRTY_Rect_t rects[8];
+ * static DIRTY_Region_t region;
+ *
+ * DIRTY_Init(&region, rects, 8, 320, 480);
+ *
+ * /// The value at (200, 40) changed in the frame buffer
+ * DIRTY_MarkRect(&region, 200, 40, 80, 24);
+ *
+ * /// Send only the changed areas of the frame
+ * DIRTY_FlushImage(&region, &tftConfig, spi, frame);
+ * @endcode
+ */
+
+#ifndef __DIRTY_INTERFACE_H__
+#define __DIRTY_INTERFACE_H__
+
+/**
+ * @brief A screen rectangle.
+ */
+typedef struct {
+    u16 X;          /**< X-coordinate of the top-left corner. */
+    u16 Y;          /**< Y-coordinate of the top-left corner. */
+    u16 Width;      /**< Width in pixels. */
+    u16 Height;     /**< Height in pixels. */
+} DIRTY_Rect_t;
+
+/**
+ * @brief The dirty region of one display.
+ *
+ * The rectangle storage is provided by the caller through @ref DIRTY_Init, so each display
+ * can have its own region with the number of rectangles it needs.
+ */
+typedef struct {
+    DIRTY_Rect_t *Rects;    /**< Storage for the dirty rectangles. */
+    u8 Capacity;            /**< Number of rectangles the storage can hold. */
+    u8 Count;               /**< Number of dirty rectangles. */
+    u16 ScreenWidth;        /**< Width of the display in pixels. */
+    u16 ScreenHeight;       /**< Height of the display in pixels. */
+} DIRTY_Region_t;
+
+/**
+ * @brief Callback that redraws one rectangle of the screen.
+ *
+ * Used by @ref DIRTY_Flush. The callback must draw the whole rectangle, for example with
+ * @ref TFT_BurstWritePixels or the TFT drawing functions.
+ */
+typedef void (*DIRTY_Redraw_t)(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const DIRTY_Rect_t *Copy_Rect);
+
+/**
+ * @brief Initializes an empty dirty region.
+ *
+ * @param[out] Copy_Region      The region to initialize.
+ * @param[in]  Copy_Rects       Storage for Copy_Capacity rectangles.
+ * @param[in]  Copy_Capacity    Number of rectangles in Copy_Rects (at least 1).
+ * @param[in]  Copy_ScreenWidth The width of the display in pixels.
+ * @param[in]  Copy_ScreenHeight The height of the display in pixels.
+ *
+ * @retval     0                The region was initialized.
+ * @retval     1                Copy_Region or Copy_Rects is NULL, or Copy_Capacity is 0.
+ */
+u8 DIRTY_Init(DIRTY_Region_t *Copy_Region, DIRTY_Rect_t *Copy_Rects, u8 Copy_Capacity, u16 Copy_ScreenWidth, u16 Copy_ScreenHeight);
+
+/**
+ * @brief Marks a rectangle of the screen as changed.
+ *
+ * The rectangle is clipped to the screen. It is then merged with every dirty rectangle for
+ * which one window over the bounding box costs no more bytes than two windows. When the
+ * storage is full, it is merged with the rectangle that grows the least.
+ *
+ * @param[in,out] Copy_Region The dirty region.
+ * @param[in] Copy_XPosition  The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition  The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width      The width of the rectangle in pixels.
+ * @param[in] Copy_Height     The height of the rectangle in pixels.
+ *
+ * @retval None
+ */
+void DIRTY_MarkRect(DIRTY_Region_t *Copy_Region, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height);
+
+/**
+ * @brief Marks the whole screen as changed.
+ *
+ * @param[in,out] Copy_Region The dirty region.
+ *
+ * @retval None
+ */
+void DIRTY_MarkAll(DIRTY_Region_t *Copy_Region);
+
+/**
+ * @brief Returns the number of bytes a flush of the region would send over the bus.
+ *
+ * Counts the address window setup of every rectangle and two bytes per pixel.
+ *
+ * @param[in] Copy_Region The dirty region.
+ *
+ * @return The number of bytes.
+ */
+u32 DIRTY_GetFlushCost(const DIRTY_Region_t *Copy_Region);
+
+/**
+ * @brief Redraws every dirty rectangle through a callback and clears the region.
+ *
+ * @param[in,out] Copy_Region    The dirty region.
+ * @param[in] Copy_TftDisplay    Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Redraw        Called once per dirty rectangle.
+ *
+ * @retval None
+ */
+void DIRTY_Flush(DIRTY_Region_t *Copy_Region, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, DIRTY_Redraw_t Copy_Redraw);
+
+/**
+ * @brief Sends the dirty rectangles of a full-screen frame and clears the region.
+ *
+ * Each dirty rectangle is sent from the frame as one window and one burst with
+ * @ref TFT_BurstWriteStride.
+ *
+ * @param[in,out] Copy_Region    The dirty region.
+ * @param[in] Copy_TftDisplay    Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Frame         Full-screen frame in RGB565, ScreenWidth pixels per row.
+ *
+ * @retval None
+ */
+void DIRTY_FlushImage(DIRTY_Region_t *Copy_Region, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u16 *Copy_Frame);
+
+#endif /**< __DIRTY_INTERFACE_H__ */
@@ -0,0 +1,45 @@
+/**
+ * @file DIRTY_private.h
+ * @brief This file contains the private interface of the dirty-rectangle manager.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __DIRTY_PRIVATE_H__
+#define __DIRTY_PRIVATE_H__
+
+/**
+ * @brief Bytes needed to send one rectangle (window setup and pixels).
+ *
+ * @param[in] Copy_Rect The rectangle.
+ *
+ * @return The number of bytes.
+ */
+static u32 DIRTY_RectCost(const DIRTY_Rect_t *Copy_Rect);
+
+/**
+ * @brief Computes the bounding box of two rectangles.
+ *
+ * @param[in]  Copy_First  The first rectangle.
+ * @param[in]  Copy_Second The second rectangle.
+ * @param[out] Copy_Union  The bounding box.
+ *
+ * @retval None
+ */
+static void DIRTY_UnionRect(const DIRTY_Rect_t *Copy_First, const DIRTY_Rect_t *Copy_Second, DIRTY_Rect_t *Copy_Union);
+
+/**
+ * @brief Removes one rectangle from the region (the last one takes its place).
+ *
+ * @param[in,out] Copy_Region The dirty region.
+ * @param[in] Copy_Index      Index of the rectangle to remove.
+ *
+ * @retval None
+ */
+static void DIRTY_RemoveRect(DIRTY_Region_t *Copy_Region, u8 Copy_Index);
+
+#endif /**< __DIRTY_PRIVATE_H__ */
@@ -0,0 +1,198 @@
+/**
+ * @file DIRTY_program.c
+ * @brief This file contains the implementation of the dirty-rectangle manager.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "DIRTY_config.h"
+#include "DIRTY_interface.h"
+#include "DIRTY_private.h"
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u8 DIRTY_Init(DIRTY_Region_t *Copy_Region, DIRTY_Rect_t *Copy_Rects, u8 Copy_Capacity, u16 Copy_ScreenWidth, u16 Copy_ScreenHeight)
+{
+    u8 Local_u8ErrorStatus = 0;
+
+    if ((Copy_Region != NULL) && (Copy_Rects != NULL) && (Copy_Capacity > 0))
+    {
+        Copy_Region->Rects = Copy_Rects;
+        Copy_Region->Capacity = Copy_Capacity;
+        Copy_Region->Count = 0;
+        Copy_Region->ScreenWidth = Copy_ScreenWidth;
+        Copy_Region->ScreenHeight = Copy_ScreenHeight;
+    }
+    else
+    {
+        Local_u8ErrorStatus = 1;
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+void DIRTY_MarkRect(DIRTY_Region_t *Copy_Region, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height)
+{
+    DIRTY_Rect_t Local_Rect;
+    DIRTY_Rect_t Local_Union;
+    u32 Local_Separate;
+    u32 Local_Merged;
+    u32 Local_Growth;
+    u32 Local_BestGrowth;
+    u8 Local_Best;
+    u8 Local_Index;
+    u8 Local_Merging;
+
+    /**< Nothing to mark outside the screen */
+    if ((Copy_XPosition < Copy_Region->ScreenWidth) && (Copy_YPosition < Copy_Region->ScreenHeight) &&
+        (Copy_Width > 0) && (Copy_Height > 0))
+    {
+        /**< Clip to the screen */
+        if (((u32)Copy_XPosition + Copy_Width) > Copy_Region->ScreenWidth)
+        {
+            Copy_Width = Copy_Region->ScreenWidth - Copy_XPosition;
+        }
+        if (((u32)Copy_YPosition + Copy_Height) > Copy_Region->ScreenHeight)
+        {
+            Copy_Height = Copy_Region->ScreenHeight - Copy_YPosition;
+        }
+
+        Local_Rect.X = Copy_XPosition;
+        Local_Rect.Y = Copy_YPosition;
+        Local_Rect.Width = Copy_Width;
+        Local_Rect.Height = Copy_Height;
+
+        /**< Absorb every rectangle that is cheaper to send together with the new one.
+             A merged rectangle can make a new merge worthwhile, so repeat until none is left. */
+        do
+        {
+            Local_Merging = 0;
+            for (Local_Index = 0; Local_Index < Copy_Region->Count; Local_Index++)
+            {
+                DIRTY_UnionRect(&Local_Rect, &Copy_Region->Rects[Local_Index], &Local_Union);
+                Local_Separate = DIRTY_RectCost(&Local_Rect) + DIRTY_RectCost(&Copy_Region->Rects[Local_Index]);
+                Local_Merged = DIRTY_RectCost(&Local_Union);
+
+                if (Local_Merged <= Local_Separate)
+                {
+                    Local_Rect = Local_Union;
+                    DIRTY_RemoveRect(Copy_Region, Local_Index);
+                    Local_Merging = 1;
+                    break;
+                }
+            }
+
+            /**< No free slot left: merge with the rectangle that grows the least */
+            if ((Local_Merging == 0) && (Copy_Region->Count == Copy_Region->Capacity))
+            {
+                Local_Best = 0;
+                Local_BestGrowth = 0xFFFFFFFF;
+                for (Local_Index = 0; Local_Index < Copy_Region->Count; Local_Index++)
+                {
+                    DIRTY_UnionRect(&Local_Rect, &Copy_Region->Rects[Local_Index], &Local_Union);
+                    Local_Growth = DIRTY_RectCost(&Local_Union) - DIRTY_RectCost(&Copy_Region->Rects[Local_Index]);
+                    if (Local_Growth < Local_BestGrowth)
+                    {
+                        Local_BestGrowth = Local_Growth;
+                        Local_Best = Local_Index;
+                    }
+                }
+                DIRTY_UnionRect(&Local_Rect, &Copy_Region->Rects[Local_Best], &Local_Rect);
+                DIRTY_RemoveRect(Copy_Region, Local_Best);
+                Local_Merging = 1;
+            }
+        } while (Local_Merging);
+
+        Copy_Region->Rects[Copy_Region->Count] = Local_Rect;
+        Copy_Region->Count++;
+    }
+}
+
+void DIRTY_MarkAll(DIRTY_Region_t *Copy_Region)
+{
+    Copy_Region->Rects[0].X = 0;
+    Copy_Region->Rects[0].Y = 0;
+    Copy_Region->Rects[0].Width = Copy_Region->ScreenWidth;
+    Copy_Region->Rects[0].Height = Copy_Region->ScreenHeight;
+    Copy_Region->Count = 1;
+}
+
+u32 DIRTY_GetFlushCost(const DIRTY_Region_t *Copy_Region)
+{
+    u32 Local_Cost = 0;
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < Copy_Region->Count; Local_Index++)
+    {
+        Local_Cost += DIRTY_RectCost(&Copy_Region->Rects[Local_Index]);
+    }
+
+    return Local_Cost;
+}
+
+void DIRTY_Flush(DIRTY_Region_t *Copy_Region, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, DIRTY_Redraw_t Copy_Redraw)
+{
+    u8 Local_Index;
+
+    if (Copy_Redraw != NULL)
+    {
+        for (Local_Index = 0; Local_Index < Copy_Region->Count; Local_Index++)
+        {
+            Copy_Redraw(Copy_TftDisplay, Copy_SpiPeripheral, &Copy_Region->Rects[Local_Index]);
+        }
+    }
+
+    Copy_Region->Count = 0;
+}
+
+void DIRTY_FlushImage(DIRTY_Region_t *Copy_Region, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, const u16 *Copy_Frame)
+{
+    const DIRTY_Rect_t *Local_Rect;
+    u8 Local_Index;
+
+    if (Copy_Frame != NULL)
+    {
+        for (Local_Index = 0; Local_Index < Copy_Region->Count; Local_Index++)
+        {
+            Local_Rect = &Copy_Region->Rects[Local_Index];
+            TFT_BurstWriteStride(Copy_TftDisplay, Copy_SpiPeripheral, Local_Rect->X, Local_Rect->Y, Local_Rect->Width, Local_Rect->Height,
+                                 &Copy_Frame[((u32)Local_Rect->Y * Copy_Region->ScreenWidth) + Local_Rect->X], Copy_Region->ScreenWidth);
+        }
+    }
+
+    Copy_Region->Count = 0;
+}
+
+static u32 DIRTY_RectCost(const DIRTY_Rect_t *Copy_Rect)
+{
+    return DIRTY_WINDOW_SETUP_BYTES + (DIRTY_BYTES_PER_PIXEL * (u32)Copy_Rect->Width * Copy_Rect->Height);
+}
+
+static void DIRTY_UnionRect(const DIRTY_Rect_t *Copy_First, const DIRTY_Rect_t *Copy_Second, DIRTY_Rect_t *Copy_Union)
+{
+    u16 Local_Left   = (Copy_First->X < Copy_Second->X) ? Copy_First->X : Copy_Second->X;
+    u16 Local_Top    = (Copy_First->Y < Copy_Second->Y) ? Copy_First->Y : Copy_Second->Y;
+    u16 Local_Right  = ((Copy_First->X + Copy_First->Width) > (Copy_Second->X + Copy_Second->Width)) ?
+                       (Copy_First->X + Copy_First->Width) : (Copy_Second->X + Copy_Second->Width);
+    u16 Local_Bottom = ((Copy_First->Y + Copy_First->Height) > (Copy_Second->Y + Copy_Second->Height)) ?
+                       (Copy_First->Y + Copy_First->Height) : (Copy_Second->Y + Copy_Second->Height);
+
+    Copy_Union->X = Local_Left;
+    Copy_Union->Y = Local_Top;
+    Copy_Union->Width = Local_Right - Local_Left;
+    Copy_Union->Height = Local_Bottom - Local_Top;
+}
+
+static void DIRTY_RemoveRect(DIRTY_Region_t *Copy_Region, u8 Copy_Index)
+{
+    Copy_Region->Count--;
+    Copy_Region->Rects[Copy_Index] = Copy_Region->Rects[Copy_Region->Count];
+}
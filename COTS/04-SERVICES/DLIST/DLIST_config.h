@@ -0,0 +1,20 @@
+/**
+ * @file DLIST_config.h
+ * @brief This file contains the configuration options for the display list recorder.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __DLIST_CONFIG_H__
+#define __DLIST_CONFIG_H__
+
+/**
+ * @brief Longest run of pixels and one-row fills sent as one window at replay.
+ *
+ * The run is gathered on the stack, 2 bytes per pixel.
+ */
+#define DLIST_RUN_PIXELS            64
+
+#endif /**< __DLIST_CONFIG_H__ */
@@ -0,0 +1,187 @@
+/**
+ * @file DLIST_interface.h
+ * @brief This file contains the public interface of the display list recorder.
+ *
+ * Draw calls are recorded into a caller-provided byte buffer (7 to 21 bytes per call) instead
+ * of being sent one by one. @ref DLIST_Flush then prepares the list before replaying it
+ * straight to the TFT display:
+ * - fills of one color that extend each other into a rectangle become one fill;
+ * - commands fully covered by a later opaque command are dropped;
+ * - commands are moved into top-to-bottom, left-to-right order, as far as they do not overlap
+ *   a command they would pass;
+ * - pixels and one-row fills that follow each other on a row are sent as one window.
+ * The screen shows the same pixels as with the direct calls, with fewer address windows and
+ * without the overdraw.
+ *
+ * Unlike the band renderer (RENDER) no pixel buffer is needed, but overlapping commands still
+ * send their overlapping pixels; the preparation costs O(n^2) box tests for n commands.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Include SPI_interface.h, TFT_interface.h and DLIST_config.h before this file.
+ *
+ * @note Example Usage:
+ * @code
+ * static u8 buffer[1024];
+ * static DLIST_List_t list;
+ *
+ * DLIST_Init(&list, buffer, sizeof(buffer), 320, 480);
+ * DLIST_FillRect(&list, 0, 0, 320, 40, TFT_COLOR_BLUE);
+ * DLIST_DrawText(&list, 8, 12, "Status", &font, TFT_COLOR_WHITE, TFT_COLOR_BLUE);
+ * DLIST_DrawPixel(&list, 100, 200, TFT_COLOR_RED);
+ * DLIST_Flush(&list, &tftConfig, spi, NULL);
+ * @endcode
+ */
+
+#ifndef __DLIST_INTERFACE_H__
+#define __DLIST_INTERFACE_H__
+
+/**
+ * @brief What a flush did, see @ref DLIST_Flush.
+ */
+typedef struct {
+    u16 Recorded;           /**< Commands in the list. */
+    u16 Merged;             /**< Fills merged into another fill. */
+    u16 Culled;             /**< Commands dropped: off screen or covered by a later command. */
+    u16 Draws;              /**< Draw calls made to the TFT core at replay. */
+} DLIST_Stats_t;
+
+/**
+ * @brief A display list.
+ *
+ * The buffer is provided by the caller through @ref DLIST_Init. Commands are stored from its
+ * start and a 2-byte index per command from its end.
+ */
+typedef struct {
+    u8 *Buffer;             /**< Storage for the commands. */
+    u16 Size;               /**< Size of the storage in bytes. */
+    u16 Used;               /**< Bytes used by the commands. */
+    u16 Count;              /**< Number of recorded commands. */
+    u16 ScreenWidth;        /**< Width of the display in pixels. */
+    u16 ScreenHeight;       /**< Height of the display in pixels. */
+} DLIST_List_t;
+
+/**
+ * @brief Initializes an empty display list.
+ *
+ * @param[out] Copy_List         The display list.
+ * @param[in]  Copy_Buffer       Storage for the commands.
+ * @param[in]  Copy_Size         Size of Copy_Buffer in bytes.
+ * @param[in]  Copy_ScreenWidth  The width of the display in pixels.
+ * @param[in]  Copy_ScreenHeight The height of the display in pixels.
+ *
+ * @retval     0                 The list was initialized.
+ * @retval     1                 Copy_List or Copy_Buffer is NULL.
+ */
+u8 DLIST_Init(DLIST_List_t *Copy_List, u8 *Copy_Buffer, u16 Copy_Size, u16 Copy_ScreenWidth, u16 Copy_ScreenHeight);
+
+/**
+ * @brief Removes all the commands of a display list without drawing them.
+ *
+ * @param[in,out] Copy_List The display list.
+ *
+ * @retval None
+ */
+void DLIST_Clear(DLIST_List_t *Copy_List);
+
+/**
+ * @brief Records a filled rectangle (11 bytes).
+ *
+ * @param[in,out] Copy_List      The display list.
+ * @param[in]     Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in]     Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in]     Copy_Width     The width in pixels.
+ * @param[in]     Copy_Height    The height in pixels.
+ * @param[in]     Copy_Color     The fill color in RGB565.
+ *
+ * @retval        0              The command was recorded (or is empty).
+ * @retval        1              The display list is full.
+ */
+u8 DLIST_FillRect(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color);
+
+/**
+ * @brief Records a horizontal line, a fill of one row.
+ *
+ * @retval 0 The command was recorded.
+ * @retval 1 The display list is full.
+ */
+u8 DLIST_DrawHLine(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length, u16 Copy_Color);
+
+/**
+ * @brief Records a vertical line, a fill of one column.
+ *
+ * @retval 0 The command was recorded.
+ * @retval 1 The display list is full.
+ */
+u8 DLIST_DrawVLine(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length, u16 Copy_Color);
+
+/**
+ * @brief Records a pixel (7 bytes).
+ *
+ * @param[in,out] Copy_List      The display list.
+ * @param[in]     Copy_XPosition The X-coordinate of the pixel.
+ * @param[in]     Copy_YPosition The Y-coordinate of the pixel.
+ * @param[in]     Copy_Color     The color in RGB565.
+ *
+ * @retval        0              The command was recorded.
+ * @retval        1              The display list is full.
+ */
+u8 DLIST_DrawPixel(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Color);
+
+/**
+ * @brief Records an RGB565 image, drawn with @ref TFT_BurstWriteStride and clipped to the
+ * screen.
+ *
+ * @param[in,out] Copy_List      The display list.
+ * @param[in]     Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in]     Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in]     Copy_Width     The width in pixels.
+ * @param[in]     Copy_Height    The height in pixels.
+ * @param[in]     Copy_Pixels    Width * Height pixels, row by row. Must stay valid until the flush.
+ *
+ * @retval        0              The command was recorded.
+ * @retval        1              The display list is full or Copy_Pixels is NULL.
+ */
+u8 DLIST_DrawImage(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Pixels);
+
+/**
+ * @brief Records text with an opaque background, drawn with @ref TFT_DrawText.
+ *
+ * A single line of text covers its whole box and hides the commands recorded before it.
+ *
+ * @param[in,out] Copy_List       The display list.
+ * @param[in]     Copy_XPosition  The X-coordinate of the left edge of the text.
+ * @param[in]     Copy_YPosition  The Y-coordinate of the top of the first line.
+ * @param[in]     Copy_Text       The null-terminated text. Must stay valid until the flush.
+ * @param[in]     Copy_Font       The font.
+ * @param[in]     Copy_Color      The text color in RGB565.
+ * @param[in]     Copy_Background The background color in RGB565.
+ *
+ * @retval        0               The command was recorded.
+ * @retval        1               The display list is full, or Copy_Text or Copy_Font is NULL.
+ */
+u8 DLIST_DrawText(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color, u16 Copy_Background);
+
+/**
+ * @brief Records text drawn over what is below it, with @ref TFT_DrawTextTransparent.
+ *
+ * @retval 0 The command was recorded.
+ * @retval 1 The display list is full, or Copy_Text or Copy_Font is NULL.
+ */
+u8 DLIST_DrawTextTransparent(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color);
+
+/**
+ * @brief Merges, culls and sorts the recorded commands, draws them and clears the list.
+ *
+ * @param[in,out] Copy_List          The display list.
+ * @param[in]     Copy_TftDisplay    Pointer to the TFT display configuration structure.
+ * @param[in]     Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[out]    Copy_Stats         What the flush did, or NULL.
+ *
+ * @retval None
+ */
+void DLIST_Flush(DLIST_List_t *Copy_List, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, DLIST_Stats_t *Copy_Stats);
+
+#endif /**< __DLIST_INTERFACE_H__ */
@@ -0,0 +1,228 @@
+/**
+ * @file DLIST_private.h
+ * @brief This file contains the private interface of the display list recorder.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __DLIST_PRIVATE_H__
+#define __DLIST_PRIVATE_H__
+
+/**
+ * @brief Command codes, the first byte of every command.
+ *
+ * Every command but a pixel starts with its box: code, X, Y, width, height (u16, little
+ * endian). A pixel is code, X, Y and color.
+ */
+#define DLIST_NONE                  0       /**< Dropped at flush. */
+#define DLIST_FILL                  1       /**< Box, color. */
+#define DLIST_PIXEL                 2       /**< X, Y, color. */
+#define DLIST_IMAGE                 3       /**< Box, pixels pointer. */
+#define DLIST_TEXT                  4       /**< Box, color, background, font and text pointers. */
+#define DLIST_TEXT_TRANSPARENT      5       /**< Box, color, unused, font and text pointers. */
+
+/**
+ * @brief Offsets of the fields in a command.
+ */
+#define DLIST_BOX_BYTES             9                           /**< Code and box. */
+#define DLIST_PIXEL_COLOR           5                           /**< Color of a pixel. */
+#define DLIST_COLOR                 DLIST_BOX_BYTES             /**< Color of a fill or a text. */
+#define DLIST_BACKGROUND            (DLIST_BOX_BYTES + 2)       /**< Background of a text. */
+#define DLIST_FONT                  (DLIST_BOX_BYTES + 4)       /**< Font of a text. */
+#define DLIST_STRING                (DLIST_FONT + sizeof(void *)) /**< Characters of a text. */
+#define DLIST_PIXELS                DLIST_BOX_BYTES             /**< Pixels of an image. */
+
+/**
+ * @brief A screen rectangle, right and bottom exclusive.
+ */
+typedef struct {
+    u16 Left;
+    u16 Top;
+    u16 Right;
+    u16 Bottom;
+} DLIST_Box_t;
+
+/**
+ * @brief Reads a little-endian 16-bit value.
+ *
+ * @param[in] Copy_Data The two bytes.
+ *
+ * @return The value.
+ */
+static u16 DLIST_ReadU16(const u8 *Copy_Data);
+
+/**
+ * @brief Writes a little-endian 16-bit value.
+ *
+ * @param[out] Copy_Data  The two bytes.
+ * @param[in]  Copy_Value The value.
+ *
+ * @retval None
+ */
+static void DLIST_WriteU16(u8 *Copy_Data, u16 Copy_Value);
+
+/**
+ * @brief Reads a pointer stored byte by byte (commands are not aligned).
+ *
+ * @param[in] Copy_Data The bytes of the pointer.
+ *
+ * @return The pointer.
+ */
+static const void *DLIST_ReadPointer(const u8 *Copy_Data);
+
+/**
+ * @brief Stores a pointer byte by byte.
+ *
+ * @param[out] Copy_Data    Room for sizeof(void *) bytes.
+ * @param[in]  Copy_Pointer The pointer.
+ *
+ * @retval None
+ */
+static void DLIST_WritePointer(u8 *Copy_Data, const void *Copy_Pointer);
+
+/**
+ * @brief Reserves room for a command and appends its index.
+ *
+ * @param[in,out] Copy_List The display list.
+ * @param[in]     Copy_Size Size of the command in bytes.
+ *
+ * @return The command, or NULL when the list is full.
+ */
+static u8 *DLIST_AddCommand(DLIST_List_t *Copy_List, u8 Copy_Size);
+
+/**
+ * @brief Appends a command made of a box followed by fields.
+ *
+ * @param[in,out] Copy_List The display list.
+ * @param[in]     Copy_Code The command code.
+ * @param[in]     Copy_XPosition The X-coordinate of the box.
+ * @param[in]     Copy_YPosition The Y-coordinate of the box.
+ * @param[in]     Copy_Width The width of the box.
+ * @param[in]     Copy_Height The height of the box.
+ * @param[in]     Copy_Size Size of the fields in bytes.
+ *
+ * @return The fields of the command, or NULL when the list is full.
+ */
+static u8 *DLIST_AddBoxCommand(DLIST_List_t *Copy_List, u8 Copy_Code, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u8 Copy_Size);
+
+/**
+ * @brief Appends a text command.
+ *
+ * @retval 0 The command was recorded.
+ * @retval 1 The display list is full, or Copy_Text or Copy_Font is NULL.
+ */
+static u8 DLIST_AddText(DLIST_List_t *Copy_List, u8 Copy_Code, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color, u16 Copy_Background);
+
+/**
+ * @brief Returns a command by its position in the drawing order.
+ *
+ * @param[in] Copy_List  The display list.
+ * @param[in] Copy_Index The position, 0 to Count - 1.
+ *
+ * @return The command.
+ */
+static u8 *DLIST_GetCommand(const DLIST_List_t *Copy_List, u16 Copy_Index);
+
+/**
+ * @brief Computes the box of a command, clipped to the screen.
+ *
+ * @param[in]  Copy_List    The display list.
+ * @param[in]  Copy_Command The command.
+ * @param[out] Copy_Box     The box.
+ *
+ * @retval 0 The box is on the screen.
+ * @retval 1 The command draws nothing.
+ */
+static u8 DLIST_GetBox(const DLIST_List_t *Copy_List, const u8 *Copy_Command, DLIST_Box_t *Copy_Box);
+
+/**
+ * @brief Tells if a command writes every pixel of its box.
+ *
+ * @param[in] Copy_Command The command.
+ *
+ * @return 1 for fills, pixels, images and one line of opaque text, 0 otherwise.
+ */
+static u8 DLIST_IsOpaque(const u8 *Copy_Command);
+
+/**
+ * @brief Tells if two boxes share a pixel.
+ *
+ * @return 1 when they overlap, 0 otherwise.
+ */
+static u8 DLIST_Overlaps(const DLIST_Box_t *Copy_First, const DLIST_Box_t *Copy_Second);
+
+/**
+ * @brief Tells if a box contains another.
+ *
+ * @return 1 when Copy_Inner is inside Copy_Outer, 0 otherwise.
+ */
+static u8 DLIST_Contains(const DLIST_Box_t *Copy_Outer, const DLIST_Box_t *Copy_Inner);
+
+/**
+ * @brief Tells if a command can be drawn earlier, at a given position of the drawing order.
+ *
+ * @param[in] Copy_List  The display list.
+ * @param[in] Copy_From  Position of the command.
+ * @param[in] Copy_To    The earlier position.
+ * @param[in] Copy_Box   Box of the command.
+ *
+ * @return 1 when no command between the two positions overlaps Copy_Box, 0 otherwise.
+ */
+static u8 DLIST_CanMoveBack(const DLIST_List_t *Copy_List, u16 Copy_From, u16 Copy_To, const DLIST_Box_t *Copy_Box);
+
+/**
+ * @brief Merges the fills that extend or repeat an earlier fill of the same color into it.
+ *
+ * @param[in,out] Copy_List  The display list.
+ *
+ * @return The number of merged commands.
+ */
+static u16 DLIST_MergeFills(DLIST_List_t *Copy_List);
+
+/**
+ * @brief Drops the commands that are off screen or covered by a later opaque command.
+ *
+ * @param[in,out] Copy_List  The display list.
+ *
+ * @return The number of dropped commands.
+ */
+static u16 DLIST_Cull(DLIST_List_t *Copy_List);
+
+/**
+ * @brief Sorts the drawing order top to bottom and left to right, keeping the order of
+ * overlapping commands (insertion sort that stops at an overlapping command).
+ *
+ * @param[in,out] Copy_List  The display list.
+ *
+ * @retval None
+ */
+static void DLIST_Sort(DLIST_List_t *Copy_List);
+
+/**
+ * @brief Tells if a command can join a run: a pixel or a one-row fill.
+ *
+ * @param[in]  Copy_List    The display list.
+ * @param[in]  Copy_Command The command.
+ * @param[out] Copy_Box     Its box, clipped to the screen.
+ *
+ * @return 1 when it can, 0 otherwise.
+ */
+static u8 DLIST_IsRunPart(const DLIST_List_t *Copy_List, const u8 *Copy_Command, DLIST_Box_t *Copy_Box);
+
+/**
+ * @brief Draws one command, or a run of commands on one row starting with it.
+ *
+ * @param[in] Copy_List          The display list.
+ * @param[in] Copy_TftDisplay    Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Index         Position of the command in the drawing order.
+ *
+ * @return Position of the next command to draw.
+ */
+static u16 DLIST_Replay(const DLIST_List_t *Copy_List, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_Index);
+
+#endif /**< __DLIST_PRIVATE_H__ */
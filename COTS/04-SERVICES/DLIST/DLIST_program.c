@@ -0,0 +1,616 @@
+/**
+ * @file DLIST_program.c
+ * @brief This file contains the implementation of the display list recorder.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "DLIST_config.h"
+#include "DLIST_interface.h"
+#include "DLIST_private.h"
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u8 DLIST_Init(DLIST_List_t *Copy_List, u8 *Copy_Buffer, u16 Copy_Size, u16 Copy_ScreenWidth, u16 Copy_ScreenHeight)
+{
+    u8 Local_u8ErrorStatus = 0;
+
+    if ((Copy_List != NULL) && (Copy_Buffer != NULL))
+    {
+        Copy_List->Buffer = Copy_Buffer;
+        Copy_List->Size = Copy_Size;
+        Copy_List->Used = 0;
+        Copy_List->Count = 0;
+        Copy_List->ScreenWidth = Copy_ScreenWidth;
+        Copy_List->ScreenHeight = Copy_ScreenHeight;
+    }
+    else
+    {
+        Local_u8ErrorStatus = 1;
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+void DLIST_Clear(DLIST_List_t *Copy_List)
+{
+    Copy_List->Used = 0;
+    Copy_List->Count = 0;
+}
+
+u8 DLIST_FillRect(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color)
+{
+    u8 *Local_Fields;
+
+    /**< Nothing to draw */
+    if ((Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return 0;
+    }
+
+    Local_Fields = DLIST_AddBoxCommand(Copy_List, DLIST_FILL, Copy_XPosition, Copy_YPosition, Copy_Width, Copy_Height, 2);
+    if (Local_Fields == NULL)
+    {
+        return 1;
+    }
+    DLIST_WriteU16(Local_Fields, Copy_Color);
+
+    return 0;
+}
+
+u8 DLIST_DrawHLine(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length, u16 Copy_Color)
+{
+    return DLIST_FillRect(Copy_List, Copy_XPosition, Copy_YPosition, Copy_Length, 1, Copy_Color);
+}
+
+u8 DLIST_DrawVLine(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Length, u16 Copy_Color)
+{
+    return DLIST_FillRect(Copy_List, Copy_XPosition, Copy_YPosition, 1, Copy_Length, Copy_Color);
+}
+
+u8 DLIST_DrawPixel(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Color)
+{
+    u8 *Local_Command = DLIST_AddCommand(Copy_List, DLIST_PIXEL_COLOR + 2);
+
+    if (Local_Command == NULL)
+    {
+        return 1;
+    }
+    Local_Command[0] = DLIST_PIXEL;
+    DLIST_WriteU16(&Local_Command[1], Copy_XPosition);
+    DLIST_WriteU16(&Local_Command[3], Copy_YPosition);
+    DLIST_WriteU16(&Local_Command[DLIST_PIXEL_COLOR], Copy_Color);
+
+    return 0;
+}
+
+u8 DLIST_DrawImage(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Pixels)
+{
+    u8 *Local_Fields;
+
+    if (Copy_Pixels == NULL)
+    {
+        return 1;
+    }
+
+    Local_Fields = DLIST_AddBoxCommand(Copy_List, DLIST_IMAGE, Copy_XPosition, Copy_YPosition, Copy_Width, Copy_Height, sizeof(void *));
+    if (Local_Fields == NULL)
+    {
+        return 1;
+    }
+    DLIST_WritePointer(Local_Fields, Copy_Pixels);
+
+    return 0;
+}
+
+u8 DLIST_DrawText(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color, u16 Copy_Background)
+{
+    return DLIST_AddText(Copy_List, DLIST_TEXT, Copy_XPosition, Copy_YPosition, Copy_Text, Copy_Font, Copy_Color, Copy_Background);
+}
+
+u8 DLIST_DrawTextTransparent(DLIST_List_t *Copy_List, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color)
+{
+    return DLIST_AddText(Copy_List, DLIST_TEXT_TRANSPARENT, Copy_XPosition, Copy_YPosition, Copy_Text, Copy_Font, Copy_Color, 0);
+}
+
+void DLIST_Flush(DLIST_List_t *Copy_List, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, DLIST_Stats_t *Copy_Stats)
+{
+    DLIST_Stats_t Local_Stats = {0, 0, 0, 0};
+    u16 Local_Index = 0;
+    u8 Local_Code;
+
+    Local_Stats.Recorded = Copy_List->Count;
+
+    /**< Merge first: a merged fill can hide more commands */
+    Local_Stats.Merged = DLIST_MergeFills(Copy_List);
+    Local_Stats.Culled = DLIST_Cull(Copy_List);
+    DLIST_Sort(Copy_List);
+
+    while (Local_Index < Copy_List->Count)
+    {
+        Local_Code = DLIST_GetCommand(Copy_List, Local_Index)[0];
+        Local_Index = DLIST_Replay(Copy_List, Copy_TftDisplay, Copy_SpiPeripheral, Local_Index);
+        if (Local_Code != DLIST_NONE)
+        {
+            Local_Stats.Draws++;
+        }
+    }
+
+    DLIST_Clear(Copy_List);
+    if (Copy_Stats != NULL)
+    {
+        *Copy_Stats = Local_Stats;
+    }
+}
+
+static u16 DLIST_ReadU16(const u8 *Copy_Data)
+{
+    return (u16)(Copy_Data[0] | ((u16)Copy_Data[1] << 8));
+}
+
+static void DLIST_WriteU16(u8 *Copy_Data, u16 Copy_Value)
+{
+    Copy_Data[0] = (u8)Copy_Value;
+    Copy_Data[1] = (u8)(Copy_Value >> 8);
+}
+
+static const void *DLIST_ReadPointer(const u8 *Copy_Data)
+{
+    const void *Local_Pointer;
+    u8 *Local_Bytes = (u8 *)&Local_Pointer;
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < sizeof(void *); Local_Index++)
+    {
+        Local_Bytes[Local_Index] = Copy_Data[Local_Index];
+    }
+
+    return Local_Pointer;
+}
+
+static void DLIST_WritePointer(u8 *Copy_Data, const void *Copy_Pointer)
+{
+    const u8 *Local_Bytes = (const u8 *)&Copy_Pointer;
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < sizeof(void *); Local_Index++)
+    {
+        Copy_Data[Local_Index] = Local_Bytes[Local_Index];
+    }
+}
+
+static u8 *DLIST_AddCommand(DLIST_List_t *Copy_List, u8 Copy_Size)
+{
+    u8 *Local_Command;
+
+    /**< Commands grow from the start of the buffer, their indices from its end */
+    if (((u32)Copy_List->Used + Copy_Size + 2 * ((u32)Copy_List->Count + 1)) > Copy_List->Size)
+    {
+        return NULL;
+    }
+
+    Local_Command = &Copy_List->Buffer[Copy_List->Used];
+    DLIST_WriteU16(&Copy_List->Buffer[Copy_List->Size - 2 * (Copy_List->Count + 1)], Copy_List->Used);
+    Copy_List->Used += Copy_Size;
+    Copy_List->Count++;
+
+    return Local_Command;
+}
+
+static u8 *DLIST_AddBoxCommand(DLIST_List_t *Copy_List, u8 Copy_Code, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u8 Copy_Size)
+{
+    u8 *Local_Command = DLIST_AddCommand(Copy_List, DLIST_BOX_BYTES + Copy_Size);
+
+    if (Local_Command == NULL)
+    {
+        return NULL;
+    }
+    Local_Command[0] = Copy_Code;
+    DLIST_WriteU16(&Local_Command[1], Copy_XPosition);
+    DLIST_WriteU16(&Local_Command[3], Copy_YPosition);
+    DLIST_WriteU16(&Local_Command[5], Copy_Width);
+    DLIST_WriteU16(&Local_Command[7], Copy_Height);
+
+    return &Local_Command[DLIST_BOX_BYTES];
+}
+
+static u8 DLIST_AddText(DLIST_List_t *Copy_List, u8 Copy_Code, u16 Copy_XPosition, u16 Copy_YPosition, const char *Copy_Text, const TFT_Font_t *Copy_Font, u16 Copy_Color, u16 Copy_Background)
+{
+    const char *Local_Character;
+    u16 Local_Height;
+    u8 *Local_Fields;
+
+    if ((Copy_Text == NULL) || (Copy_Font == NULL))
+    {
+        return 1;
+    }
+
+    /**< Box of the character cells: the longest line, every line */
+    Local_Height = Copy_Font->TFT_LineHeight;
+    for (Local_Character = Copy_Text; *Local_Character != '\0'; Local_Character++)
+    {
+        if (*Local_Character == '\n')
+        {
+            Local_Height += Copy_Font->TFT_LineHeight;
+        }
+    }
+
+    Local_Fields = DLIST_AddBoxCommand(Copy_List, Copy_Code, Copy_XPosition, Copy_YPosition, TFT_GetTextWidth(Copy_Text, Copy_Font), Local_Height,
+                                       4 + 2 * sizeof(void *));
+    if (Local_Fields == NULL)
+    {
+        return 1;
+    }
+    DLIST_WriteU16(&Local_Fields[0], Copy_Color);
+    DLIST_WriteU16(&Local_Fields[2], Copy_Background);
+    DLIST_WritePointer(&Local_Fields[4], Copy_Font);
+    DLIST_WritePointer(&Local_Fields[4 + sizeof(void *)], Copy_Text);
+
+    return 0;
+}
+
+static u8 *DLIST_GetCommand(const DLIST_List_t *Copy_List, u16 Copy_Index)
+{
+    return &Copy_List->Buffer[DLIST_ReadU16(&Copy_List->Buffer[Copy_List->Size - 2 * (Copy_Index + 1)])];
+}
+
+static u8 DLIST_GetBox(const DLIST_List_t *Copy_List, const u8 *Copy_Command, DLIST_Box_t *Copy_Box)
+{
+    u32 Local_Right;
+    u32 Local_Bottom;
+
+    Copy_Box->Left = DLIST_ReadU16(&Copy_Command[1]);
+    Copy_Box->Top = DLIST_ReadU16(&Copy_Command[3]);
+    if (Copy_Command[0] == DLIST_PIXEL)
+    {
+        Local_Right = (u32)Copy_Box->Left + 1;
+        Local_Bottom = (u32)Copy_Box->Top + 1;
+    }
+    else
+    {
+        Local_Right = (u32)Copy_Box->Left + DLIST_ReadU16(&Copy_Command[5]);
+        Local_Bottom = (u32)Copy_Box->Top + DLIST_ReadU16(&Copy_Command[7]);
+    }
+
+    /**< Clip to the screen */
+    if (Local_Right > Copy_List->ScreenWidth)
+    {
+        Local_Right = Copy_List->ScreenWidth;
+    }
+    if (Local_Bottom > Copy_List->ScreenHeight)
+    {
+        Local_Bottom = Copy_List->ScreenHeight;
+    }
+    if ((Local_Right <= Copy_Box->Left) || (Local_Bottom <= Copy_Box->Top))
+    {
+        return 1;
+    }
+    Copy_Box->Right = (u16)Local_Right;
+    Copy_Box->Bottom = (u16)Local_Bottom;
+
+    return 0;
+}
+
+static u8 DLIST_IsOpaque(const u8 *Copy_Command)
+{
+    const TFT_Font_t *Local_Font;
+
+    switch (Copy_Command[0])
+    {
+    case DLIST_FILL:
+    case DLIST_PIXEL:
+    case DLIST_IMAGE:
+        return 1;
+
+    case DLIST_TEXT:
+        /**< The cells of one line cover the box; lines of different lengths do not */
+        Local_Font = (const TFT_Font_t *)DLIST_ReadPointer(&Copy_Command[DLIST_FONT]);
+        return DLIST_ReadU16(&Copy_Command[7]) == Local_Font->TFT_LineHeight;
+
+    default:
+        return 0;
+    }
+}
+
+static u8 DLIST_Overlaps(const DLIST_Box_t *Copy_First, const DLIST_Box_t *Copy_Second)
+{
+    return (Copy_First->Left < Copy_Second->Right) && (Copy_Second->Left < Copy_First->Right) &&
+           (Copy_First->Top < Copy_Second->Bottom) && (Copy_Second->Top < Copy_First->Bottom);
+}
+
+static u8 DLIST_Contains(const DLIST_Box_t *Copy_Outer, const DLIST_Box_t *Copy_Inner)
+{
+    return (Copy_Outer->Left <= Copy_Inner->Left) && (Copy_Outer->Right >= Copy_Inner->Right) &&
+           (Copy_Outer->Top <= Copy_Inner->Top) && (Copy_Outer->Bottom >= Copy_Inner->Bottom);
+}
+
+static u8 DLIST_CanMoveBack(const DLIST_List_t *Copy_List, u16 Copy_From, u16 Copy_To, const DLIST_Box_t *Copy_Box)
+{
+    const u8 *Local_Command;
+    DLIST_Box_t Local_Box;
+    u16 Local_Index;
+
+    for (Local_Index = Copy_To + 1; Local_Index < Copy_From; Local_Index++)
+    {
+        Local_Command = DLIST_GetCommand(Copy_List, Local_Index);
+        if ((Local_Command[0] != DLIST_NONE) && (DLIST_GetBox(Copy_List, Local_Command, &Local_Box) == 0) &&
+            DLIST_Overlaps(&Local_Box, Copy_Box))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static u16 DLIST_MergeFills(DLIST_List_t *Copy_List)
+{
+    u8 *Local_Fill;
+    u8 *Local_Other;
+    DLIST_Box_t Local_Box;
+    DLIST_Box_t Local_OtherBox;
+    u16 Local_Color;
+    u16 Local_Index;
+    u16 Local_OtherIndex;
+    u16 Local_Merged = 0;
+    u8 Local_Merging;
+    u8 Local_Extends;
+
+    for (Local_Index = 0; Local_Index < Copy_List->Count; Local_Index++)
+    {
+        Local_Fill = DLIST_GetCommand(Copy_List, Local_Index);
+        if ((Local_Fill[0] != DLIST_FILL) || (DLIST_GetBox(Copy_List, Local_Fill, &Local_Box) != 0))
+        {
+            continue;
+        }
+        Local_Color = DLIST_ReadU16(&Local_Fill[DLIST_COLOR]);
+
+        /**< A grown fill can touch fills it did not touch before, so repeat until none is left */
+        do
+        {
+            Local_Merging = 0;
+            for (Local_OtherIndex = Local_Index + 1; Local_OtherIndex < Copy_List->Count; Local_OtherIndex++)
+            {
+                Local_Other = DLIST_GetCommand(Copy_List, Local_OtherIndex);
+                if (((Local_Other[0] == DLIST_FILL) && (DLIST_ReadU16(&Local_Other[DLIST_COLOR]) == Local_Color)) ||
+                    ((Local_Other[0] == DLIST_PIXEL) && (DLIST_ReadU16(&Local_Other[DLIST_PIXEL_COLOR]) == Local_Color)))
+                {
+                    if (DLIST_GetBox(Copy_List, Local_Other, &Local_OtherBox) != 0)
+                    {
+                        continue;
+                    }
+
+                    /**< Same rows and side by side, same columns and one above the other, or inside */
+                    Local_Extends = ((Local_Box.Top == Local_OtherBox.Top) && (Local_Box.Bottom == Local_OtherBox.Bottom) &&
+                                     (Local_Box.Right >= Local_OtherBox.Left) && (Local_OtherBox.Right >= Local_Box.Left)) ||
+                                    ((Local_Box.Left == Local_OtherBox.Left) && (Local_Box.Right == Local_OtherBox.Right) &&
+                                     (Local_Box.Bottom >= Local_OtherBox.Top) && (Local_OtherBox.Bottom >= Local_Box.Top)) ||
+                                    DLIST_Contains(&Local_Box, &Local_OtherBox);
+
+                    /**< The other fill is drawn earlier: nothing in between may cover it */
+                    if (Local_Extends && DLIST_CanMoveBack(Copy_List, Local_OtherIndex, Local_Index, &Local_OtherBox))
+                    {
+                        if (Local_OtherBox.Left < Local_Box.Left)
+                        {
+                            Local_Box.Left = Local_OtherBox.Left;
+                        }
+                        if (Local_OtherBox.Top < Local_Box.Top)
+                        {
+                            Local_Box.Top = Local_OtherBox.Top;
+                        }
+                        if (Local_OtherBox.Right > Local_Box.Right)
+                        {
+                            Local_Box.Right = Local_OtherBox.Right;
+                        }
+                        if (Local_OtherBox.Bottom > Local_Box.Bottom)
+                        {
+                            Local_Box.Bottom = Local_OtherBox.Bottom;
+                        }
+                        Local_Other[0] = DLIST_NONE;
+                        Local_Merged++;
+                        Local_Merging = 1;
+                    }
+                }
+            }
+        } while (Local_Merging);
+
+        /**< Store the box, now clipped, and maybe grown */
+        DLIST_WriteU16(&Local_Fill[1], Local_Box.Left);
+        DLIST_WriteU16(&Local_Fill[3], Local_Box.Top);
+        DLIST_WriteU16(&Local_Fill[5], Local_Box.Right - Local_Box.Left);
+        DLIST_WriteU16(&Local_Fill[7], Local_Box.Bottom - Local_Box.Top);
+    }
+
+    return Local_Merged;
+}
+
+static u16 DLIST_Cull(DLIST_List_t *Copy_List)
+{
+    u8 *Local_Command;
+    const u8 *Local_Cover;
+    DLIST_Box_t Local_Box;
+    DLIST_Box_t Local_CoverBox;
+    u16 Local_Index;
+    u16 Local_CoverIndex;
+    u16 Local_Culled = 0;
+
+    for (Local_Index = 0; Local_Index < Copy_List->Count; Local_Index++)
+    {
+        Local_Command = DLIST_GetCommand(Copy_List, Local_Index);
+        if (Local_Command[0] == DLIST_NONE)
+        {
+            continue;
+        }
+
+        /**< Off screen */
+        if (DLIST_GetBox(Copy_List, Local_Command, &Local_Box) != 0)
+        {
+            Local_Command[0] = DLIST_NONE;
+            Local_Culled++;
+            continue;
+        }
+
+        /**< Overdrawn by a later command */
+        for (Local_CoverIndex = Local_Index + 1; Local_CoverIndex < Copy_List->Count; Local_CoverIndex++)
+        {
+            Local_Cover = DLIST_GetCommand(Copy_List, Local_CoverIndex);
+            if ((Local_Cover[0] != DLIST_NONE) && DLIST_IsOpaque(Local_Cover) &&
+                (DLIST_GetBox(Copy_List, Local_Cover, &Local_CoverBox) == 0) && DLIST_Contains(&Local_CoverBox, &Local_Box))
+            {
+                Local_Command[0] = DLIST_NONE;
+                Local_Culled++;
+                break;
+            }
+        }
+    }
+
+    return Local_Culled;
+}
+
+static void DLIST_Sort(DLIST_List_t *Copy_List)
+{
+    u8 *Local_Indices = &Copy_List->Buffer[Copy_List->Size - 2 * Copy_List->Count];
+    const u8 *Local_Command;
+    const u8 *Local_Previous;
+    DLIST_Box_t Local_Box;
+    DLIST_Box_t Local_PreviousBox;
+    u16 Local_Offset;
+    u16 Local_Index;
+    u16 Local_Position;
+
+    /**< Position k of the drawing order is stored at Size - 2 * (k + 1): the indices run backwards
+         from the end of the buffer, so Local_Indices[2 * (Count - 1 - k)] holds position k */
+    for (Local_Index = 1; Local_Index < Copy_List->Count; Local_Index++)
+    {
+        Local_Command = DLIST_GetCommand(Copy_List, Local_Index);
+        if (Local_Command[0] == DLIST_NONE)
+        {
+            continue;
+        }
+        Local_Offset = DLIST_ReadU16(&Local_Indices[2 * (Copy_List->Count - 1 - Local_Index)]);
+        DLIST_GetBox(Copy_List, Local_Command, &Local_Box);
+
+        /**< Move the command back past the commands that come after it on the screen and that
+             it does not overlap; dropped commands are passed freely */
+        for (Local_Position = Local_Index; Local_Position > 0; Local_Position--)
+        {
+            Local_Previous = DLIST_GetCommand(Copy_List, Local_Position - 1);
+            if (Local_Previous[0] != DLIST_NONE)
+            {
+                DLIST_GetBox(Copy_List, Local_Previous, &Local_PreviousBox);
+                if ((Local_PreviousBox.Top < Local_Box.Top) ||
+                    ((Local_PreviousBox.Top == Local_Box.Top) && (Local_PreviousBox.Left <= Local_Box.Left)) ||
+                    DLIST_Overlaps(&Local_PreviousBox, &Local_Box))
+                {
+                    break;
+                }
+            }
+            DLIST_WriteU16(&Local_Indices[2 * (Copy_List->Count - 1 - Local_Position)],
+                           DLIST_ReadU16(&Local_Indices[2 * (Copy_List->Count - Local_Position)]));
+        }
+        DLIST_WriteU16(&Local_Indices[2 * (Copy_List->Count - 1 - Local_Position)], Local_Offset);
+    }
+}
+
+static u8 DLIST_IsRunPart(const DLIST_List_t *Copy_List, const u8 *Copy_Command, DLIST_Box_t *Copy_Box)
+{
+    return ((Copy_Command[0] == DLIST_PIXEL) || (Copy_Command[0] == DLIST_FILL)) &&
+           (DLIST_GetBox(Copy_List, Copy_Command, Copy_Box) == 0) && ((Copy_Box->Bottom - Copy_Box->Top) == 1);
+}
+
+static u16 DLIST_Replay(const DLIST_List_t *Copy_List, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_Index)
+{
+    u16 Local_Run[DLIST_RUN_PIXELS];
+    const u8 *Local_Command = DLIST_GetCommand(Copy_List, Copy_Index);
+    const u8 *Local_Next;
+    DLIST_Box_t Local_Box;
+    DLIST_Box_t Local_NextBox;
+    u16 Local_Length = 0;
+    u16 Local_Color;
+    u16 Local_Index;
+    u16 Local_Parts = 0;
+
+    if (Local_Command[0] == DLIST_NONE)
+    {
+        return Copy_Index + 1;
+    }
+
+    /**< Pixels and one-row fills that follow each other on a row: one window for all */
+    if (DLIST_IsRunPart(Copy_List, Local_Command, &Local_Box))
+    {
+        for (Local_Index = Copy_Index; Local_Index < Copy_List->Count; Local_Index++)
+        {
+            Local_Next = DLIST_GetCommand(Copy_List, Local_Index);
+            if (Local_Next[0] == DLIST_NONE)
+            {
+                continue;
+            }
+            if (!DLIST_IsRunPart(Copy_List, Local_Next, &Local_NextBox) || (Local_NextBox.Top != Local_Box.Top) ||
+                (Local_NextBox.Left != (Local_Box.Left + Local_Length)) ||
+                ((Local_Length + Local_NextBox.Right - Local_NextBox.Left) > DLIST_RUN_PIXELS))
+            {
+                break;
+            }
+
+            Local_Color = DLIST_ReadU16(&Local_Next[(Local_Next[0] == DLIST_PIXEL) ? DLIST_PIXEL_COLOR : DLIST_COLOR]);
+            while (Local_NextBox.Left < Local_NextBox.Right)
+            {
+                Local_Run[Local_Length++] = Local_Color;
+                Local_NextBox.Left++;
+            }
+            Local_Parts++;
+        }
+
+        if (Local_Parts > 1)
+        {
+            TFT_BurstWritePixels(Copy_TftDisplay, Copy_SpiPeripheral, Local_Box.Left, Local_Box.Top, Local_Length, 1, Local_Run);
+            return Local_Index;
+        }
+    }
+
+    DLIST_GetBox(Copy_List, Local_Command, &Local_Box);
+    switch (Local_Command[0])
+    {
+    case DLIST_FILL:
+        TFT_BurstWriteColor(Copy_TftDisplay, Copy_SpiPeripheral, Local_Box.Left, Local_Box.Top, Local_Box.Right - Local_Box.Left,
+                            Local_Box.Bottom - Local_Box.Top, DLIST_ReadU16(&Local_Command[DLIST_COLOR]));
+        break;
+
+    case DLIST_PIXEL:
+        TFT_BurstWriteColor(Copy_TftDisplay, Copy_SpiPeripheral, Local_Box.Left, Local_Box.Top, 1, 1,
+                            DLIST_ReadU16(&Local_Command[DLIST_PIXEL_COLOR]));
+        break;
+
+    case DLIST_IMAGE:
+        /**< Clipped on the right and at the bottom only, so the first pixel does not move */
+        TFT_BurstWriteStride(Copy_TftDisplay, Copy_SpiPeripheral, Local_Box.Left, Local_Box.Top, Local_Box.Right - Local_Box.Left,
+                             Local_Box.Bottom - Local_Box.Top, (const u16 *)DLIST_ReadPointer(&Local_Command[DLIST_PIXELS]),
+                             DLIST_ReadU16(&Local_Command[5]));
+        break;
+
+    case DLIST_TEXT:
+        TFT_DrawText(Copy_TftDisplay, Copy_SpiPeripheral, Local_Box.Left, Local_Box.Top, (const char *)DLIST_ReadPointer(&Local_Command[DLIST_STRING]),
+                     (const TFT_Font_t *)DLIST_ReadPointer(&Local_Command[DLIST_FONT]), DLIST_ReadU16(&Local_Command[DLIST_COLOR]),
+                     DLIST_ReadU16(&Local_Command[DLIST_BACKGROUND]));
+        break;
+
+    case DLIST_TEXT_TRANSPARENT:
+        TFT_DrawTextTransparent(Copy_TftDisplay, Copy_SpiPeripheral, Local_Box.Left, Local_Box.Top,
+                                (const char *)DLIST_ReadPointer(&Local_Command[DLIST_STRING]),
+                                (const TFT_Font_t *)DLIST_ReadPointer(&Local_Command[DLIST_FONT]), DLIST_ReadU16(&Local_Command[DLIST_COLOR]));
+        break;
+
+    default:
+        break;
+    }
+
+    return Copy_Index + 1;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file FRAME_interface.h
+ * @brief This file contains the public interface of the frame pacer.
+ *
+ * The frame pacer synchronizes drawing with the panel refresh through the tearing effect
+ * (TE) output of the controller. TE is wired to a GPIO pin and counted by its EXTI
+ * interrupt; @ref FRAME_Begin returns right on a TE edge, so the following writes start
+ * at the vertical blanking and run ahead of the scan instead of crossing it.
+ *
+ * Frames are paced every FRAME_Period refresh periods (1 for the full refresh rate, 2 for
+ * half of it, ...). When rendering a frame takes longer than its budget, the slot it
+ * missed is skipped: the next frame waits for the following slot rather than starting in
+ * the middle of a scan, and @ref FRAME_Begin reports the skipped slots so animations can
+ * advance by the elapsed time.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Include SPI_interface.h and TFT_interface.h before this file. Enable the clocks of
+ * the TE GPIO port and of AFIO before @ref FRAME_Init.
+ *
+ * @note A write stays tear-free while it finishes before the scan reaches it. Over SPI a
+ * full screen takes several refresh periods, so keep paced frames to regions that can be
+ * sent within one period, or move the pulse below a region with @ref TFT_SetTearScanline.
+ *
+ * @note Example Usage:
+ * @code
+ * FRAME_Init(&tftConfig, spi, GPIO_PORTB, 0, 2);  /// TE on PB0, 30 fps on a 60 Hz panel
+ *
+ * while (1)
+ * {
+ *     u8 skipped = FRAME_Begin();                 /// returns on the TE edge
+ *     MoveSprites(1 + skipped);
+ *     DrawSprites();
+ * }
+ * @endcode
+ */
+
+#ifndef __FRAME_INTERFACE_H__
+#define __FRAME_INTERFACE_H__
+
+/**
+ * @brief Turns the TE output of the controller on and starts counting its pulses.
+ *
+ * The pin is set as a floating input, routed to its EXTI line (the line number is the pin
+ * number) and its rising edge interrupt is enabled. The EXTI callback is taken by the frame
+ * pacer.
+ *
+ * @param[in] Copy_TftDisplay    The display, already initialized with @ref TFT_Init.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_Port          The GPIO port of the TE pin (GPIO_PORTA, ...).
+ * @param[in] Copy_Pin           The GPIO pin of the TE pin, 0 to 15.
+ * @param[in] Copy_Period        The number of refresh periods per frame, at least 1.
+ *
+ * @retval    0                  The pacer was started.
+ * @retval    1                  Copy_TftDisplay is NULL, the pin is above 15 or the period is 0.
+ */
+u8 FRAME_Init(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, u8 Copy_Port, u8 Copy_Pin, u8 Copy_Period);
+
+/**
+ * @brief Waits for the start of the next frame.
+ *
+ * Returns on the TE edge of the next frame slot. When the slot edge has already passed
+ * (the previous frame overran its budget), the slot is dropped and the next one is awaited.
+ *
+ * @return The number of slots skipped since the previous frame, 0 when on time (saturated
+ *         at 255).
+ */
+u8 FRAME_Begin(void);
+
+/**
+ * @brief Counts one TE pulse.
+ *
+ * Called from the EXTI interrupt; tests without a panel call it from a simulated TE
+ * source.
+ */
+void FRAME_OnTearingEffect(void);
+
+/**
+ * @brief Gets the number of TE pulses since @ref FRAME_Init.
+ *
+ * @return The number of pulses, wrapping at 2^32.
+ */
+u32 FRAME_GetTearCount(void);
+
+/**
+ * @brief Gets the number of slots skipped since @ref FRAME_Init.
+ *
+ * @return The number of skipped slots.
+ */
+u32 FRAME_GetSkippedCount(void);
+
+#endif /**< __FRAME_INTERFACE_H__ */
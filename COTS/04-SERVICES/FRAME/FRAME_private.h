@@ -0,0 +1,43 @@
+/**
+ * @file FRAME_private.h
+ * @brief This file contains the private interface of the frame pacer.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __FRAME_PRIVATE_H__
+#define __FRAME_PRIVATE_H__
+
+/**
+ * @brief Number of TE pulses, counted by the EXTI interrupt.
+ */
+static volatile u32 FRAME_TearCount = 0;
+
+/**
+ * @brief TE pulse starting the next frame.
+ */
+static u32 FRAME_Deadline = 0;
+
+/**
+ * @brief Refresh periods per frame.
+ */
+static u8 FRAME_Period = 1;
+
+/**
+ * @brief Number of skipped slots.
+ */
+static u32 FRAME_SkippedCount = 0;
+
+/**
+ * @brief Interrupt vector of an EXTI line.
+ *
+ * @param[in] Copy_Line The EXTI line, 0 to 15.
+ * @return The NVIC interrupt number.
+ */
+static IRQn_Type FRAME_GetIrq(u8 Copy_Line);
+
+#endif /**< __FRAME_PRIVATE_H__ */
@@ -0,0 +1,109 @@
+/**
+ * @file FRAME_program.c
+ * @brief This file contains the implementation of the frame pacer.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "GPIO_interface.h"
+#include "NVIC_interface.h"
+#include "EXTI_interface.h"
+#include "AFIO_interface.h"
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "FRAME_interface.h"
+#include "FRAME_private.h"
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u8 FRAME_Init(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, u8 Copy_Port, u8 Copy_Pin, u8 Copy_Period)
+{
+    u8 Local_u8ErrorStatus = 0;
+
+    if ((Copy_TftDisplay == NULL) || (Copy_Pin > 15) || (Copy_Period == 0))
+    {
+        Local_u8ErrorStatus = 1;
+    }
+    else
+    {
+        FRAME_Period = Copy_Period;
+        FRAME_SkippedCount = 0;
+
+        /**< TE pin -> EXTI line of the same number, rising edge at the start of the blanking */
+        GPIO_SetPinMode(Copy_Port, Copy_Pin, GPIO_INPUT_FLOATING);
+        AFIO_SetEXTIPinConfiguration(Copy_Pin, Copy_Port);
+        EXTI_SetCallBack(FRAME_OnTearingEffect);
+        EXTI_SetSignalLatch(Copy_Pin, EXTI_RISING);
+        EXTI_EnableEXTI(Copy_Pin);
+        NVIC_EnableIRQ(FRAME_GetIrq(Copy_Pin));
+
+        TFT_SetTearingEffect(Copy_TftDisplay, Copy_SpiPeripheral, 1);
+
+        /**< The first frame starts on the next pulse */
+        FRAME_Deadline = FRAME_TearCount + 1;
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+u8 FRAME_Begin(void)
+{
+    u32 Local_Skipped = 0;
+
+    /**< Late: the pulse of this slot is gone and the scan is under way, wait for the next slot */
+    while ((s32)(FRAME_TearCount - FRAME_Deadline) >= 0)
+    {
+        FRAME_Deadline += FRAME_Period;
+        Local_Skipped++;
+    }
+    FRAME_SkippedCount += Local_Skipped;
+
+    /**< Return on the pulse itself, the writes follow right behind it */
+    while ((s32)(FRAME_TearCount - FRAME_Deadline) < 0)
+    {
+    }
+    FRAME_Deadline += FRAME_Period;
+
+    return (Local_Skipped > 255) ? 255 : (u8)Local_Skipped;
+}
+
+void FRAME_OnTearingEffect(void)
+{
+    FRAME_TearCount++;
+}
+
+u32 FRAME_GetTearCount(void)
+{
+    return FRAME_TearCount;
+}
+
+u32 FRAME_GetSkippedCount(void)
+{
+    return FRAME_SkippedCount;
+}
+
+static IRQn_Type FRAME_GetIrq(u8 Copy_Line)
+{
+    IRQn_Type Local_Irq;
+
+    if (Copy_Line < 5)
+    {
+        Local_Irq = NVIC_EXTI0_IRQn + Copy_Line;
+    }
+    else if (Copy_Line < 10)
+    {
+        Local_Irq = NVIC_EXTI9_5_IRQn;
+    }
+    else
+    {
+        Local_Irq = NVIC_EXTI15_10_IRQn;
+    }
+
+    return Local_Irq;
+}
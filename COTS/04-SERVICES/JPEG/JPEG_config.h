@@ -0,0 +1,21 @@
+/**
+ * @file JPEG_config.h
+ * @brief This file contains the configuration options for the JPEG decoder.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __JPEG_CONFIG_H__
+#define __JPEG_CONFIG_H__
+
+/**
+ * @brief Huffman codes of up to this many bits are decoded by one table lookup, longer codes
+ * bit by bit. Each of the four Huffman tables of @ref JPEG_t holds a lookup table of
+ * 2^JPEG_HUFFMAN_LOOKUP_BITS entries of 2 bytes: 2 KB of RAM in total at 8 bits, 512 bytes
+ * at 6 bits. Most codes of usual images are 8 bits or less. Range: 1 to 12.
+ */
+#define JPEG_HUFFMAN_LOOKUP_BITS    8
+
+#endif /**< __JPEG_CONFIG_H__ */
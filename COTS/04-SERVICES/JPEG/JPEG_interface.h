@@ -0,0 +1,156 @@
+/**
+ * @file JPEG_interface.h
+ * @brief This file contains the public interface of the JPEG decoder.
+ *
+ * Decodes baseline JPEG files stored in flash straight to the TFT, without a frame buffer:
+ * every MCU (8x8 to 16x16 pixels) is decoded, converted to RGB565 and written to the panel
+ * as its own address window and burst; at 1/8, where an MCU is 1x1 to 2x2 pixels, the MCUs of
+ * a row are gathered into strips of up to 256 pixels. A photo is 10 to 20 times smaller in flash than the
+ * same picture as an RGB565 @ref TFT_Image_t.
+ *
+ * Supported files:
+ * - baseline (SOF0) or extended sequential (SOF1) Huffman coding, 8-bit samples, one
+ *   interleaved scan;
+ * - grayscale, or YCbCr with 4:4:4, 4:2:2, 4:4:0 or 4:2:0 subsampling (chroma 1x1, luma
+ *   1x1 to 2x2);
+ * - restart intervals.
+ * Progressive, arithmetic-coded, lossless and 12-bit files are refused.
+ *
+ * The output matches libjpeg with its default integer IDCT and without fancy upsampling:
+ * chroma samples are replicated. Images can be reduced by 2, 4 or 8 while decoding with the
+ * reduced IDCTs of libjpeg, which cost less than the full one; at 1/8 only the DC
+ * coefficient of each block is used and no IDCT is computed. Reduced subsampled chroma is
+ * computed at the scale of the luma and replicated too, where libjpeg uses a larger IDCT
+ * for it: reduced 4:2:0 images differ from libjpeg by some levels in smooth areas and more
+ * along sharp color edges.
+ *
+ * All the state, tables and MCU buffers are in @ref JPEG_t (about 4.2 KB with
+ * @ref JPEG_HUFFMAN_LOOKUP_BITS at 8); the decoder needs about 300 bytes of stack and no
+ * other memory.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Include SPI_interface.h, TFT_interface.h and JPEG_config.h before this file.
+ *
+ * @note The image is clipped to the right and bottom edges of the screen. The MCUs right of
+ * the screen are read past without computing their samples, and decoding stops at the
+ * first MCU row below the screen. The scaled size is the image size divided by 2, 4 or 8,
+ * rounded up.
+ *
+ * @note Example Usage:
+ * @code
+ * extern const u8 Photo_jpg[];
+ * extern const u32 Photo_jpg_size;
+ * static JPEG_t jpeg;
+ *
+ * if (JPEG_Prepare(&jpeg, Photo_jpg, Photo_jpg_size) == 0)
+ * {
+ *     /// a 640x480 photo on a 320x480 panel: 320x240 at 1/2
+ *     JPEG_Draw(&jpeg, &tftConfig, spi, 0, 120, JPEG_SCALE_1_2);
+ * }
+ * @endcode
+ */
+
+#ifndef __JPEG_INTERFACE_H__
+#define __JPEG_INTERFACE_H__
+
+/**
+ * @brief Reductions applied while decoding.
+ */
+typedef enum {
+    JPEG_SCALE_1 = 0,               /**< Full size. */
+    JPEG_SCALE_1_2,                 /**< Half size, 4x4 IDCT. */
+    JPEG_SCALE_1_4,                 /**< Quarter size, 2x2 IDCT. */
+    JPEG_SCALE_1_8                  /**< One pixel per 8x8 block, no IDCT. */
+} JPEG_Scale_t;
+
+/**
+ * @brief A Huffman table, in canonical form.
+ */
+typedef struct {
+    const u8 *Values;               /**< Symbols by increasing code, in the JPEG data. */
+    s32 MaxCode[17];                /**< Largest code of each length (1 to 16), -1 when there is none. */
+    s32 ValueOffset[17];            /**< Index in Values of the codes of each length, minus their first code. */
+    u16 Lookup[1 << JPEG_HUFFMAN_LOOKUP_BITS]; /**< Length << 8 | symbol for the next JPEG_HUFFMAN_LOOKUP_BITS bits, 0 for a longer code. */
+} JPEG_Huffman_t;
+
+/**
+ * @brief A color component of the frame.
+ */
+typedef struct {
+    u8 Id;                          /**< Component identifier of the file. */
+    u8 HSampling;                   /**< Horizontal sampling factor. */
+    u8 VSampling;                   /**< Vertical sampling factor. */
+    u8 QuantTable;                  /**< Quantization table, 0 to 3. */
+    u8 DcTable;                     /**< DC Huffman table, 0 or 1. */
+    u8 AcTable;                     /**< AC Huffman table, 0 or 1. */
+    s16 Predictor;                  /**< DC value of the previous block. */
+} JPEG_Component_t;
+
+/**
+ * @brief Decoder state of one JPEG file.
+ *
+ * Filled by @ref JPEG_Prepare; the application should only read Width and Height.
+ */
+typedef struct {
+    const u8 *Data;                 /**< The file. */
+    const u8 *End;                  /**< First byte past the file. */
+    const u8 *Scan;                 /**< First byte of the entropy-coded data. */
+    u16 Width;                      /**< Image width in pixels. */
+    u16 Height;                     /**< Image height in pixels. */
+    u8 Components;                  /**< 1 (grayscale) or 3 (YCbCr). */
+    u8 MaxHSampling;                /**< Horizontal sampling factor of the luma: MCU width / 8. */
+    u8 MaxVSampling;                /**< Vertical sampling factor of the luma: MCU height / 8. */
+    u8 Tables;                      /**< Tables defined: bits 0-3 quantization, 4-5 DC, 6-7 AC. */
+    u16 RestartInterval;            /**< MCUs between restart markers, 0 for none. */
+    JPEG_Component_t Component[3];  /**< Components, in frame order. */
+    u16 Quant[4][64];               /**< Quantization tables, in zigzag order. */
+    JPEG_Huffman_t Huffman[4];      /**< DC tables 0 and 1, then AC tables 0 and 1. */
+    const u8 *Read;                 /**< Next byte of the entropy-coded data. */
+    u32 Bits;                       /**< Bits read ahead, most significant first. */
+    u8 BitCount;                    /**< Number of bits read ahead. */
+    u8 Samples[6][64];              /**< Samples of the blocks of one MCU, luma blocks then Cb and Cr. */
+    u16 Pixels[16 * 16];            /**< The MCU in RGB565 row by row, or at 1/8 a strip of MCUs. */
+} JPEG_t;
+
+/**
+ * @brief Reads the headers of a JPEG file and prepares its decoding.
+ *
+ * The file is parsed up to its first scan: quantization and Huffman tables, frame header,
+ * restart interval. The file stays in place (usually flash) and must remain available
+ * while the image is drawn.
+ *
+ * @param[out] Copy_Jpeg The decoder state.
+ * @param[in]  Copy_Data The JPEG file.
+ * @param[in]  Copy_Size Size of the file in bytes.
+ *
+ * @retval     0         The image can be drawn; Copy_Jpeg->Width and Height give its size.
+ * @retval     1         A pointer is NULL or the file is not a valid JPEG file.
+ * @retval     2         The file uses a feature the decoder does not support (see above).
+ */
+u8 JPEG_Prepare(JPEG_t *Copy_Jpeg, const u8 *Copy_Data, u32 Copy_Size);
+
+/**
+ * @brief Decodes a prepared JPEG file to the TFT.
+ *
+ * The MCUs are decoded left to right and top to bottom, each written as one address window
+ * and burst (at 1/8, one window per strip of MCUs). Only the part of the image on the screen
+ * is written. The image can be drawn any number of times.
+ *
+ * @param[in,out] Copy_Jpeg          The decoder state, prepared by @ref JPEG_Prepare.
+ * @param[in]     Copy_TftDisplay    The display.
+ * @param[in]     Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in]     Copy_XPosition     X-coordinate of the top-left corner of the image.
+ * @param[in]     Copy_YPosition     Y-coordinate of the top-left corner of the image.
+ * @param[in]     Copy_Scale         A @ref JPEG_Scale_t.
+ *
+ * @retval        0                  The image was drawn, or is entirely off the screen.
+ * @retval        1                  The decoder is not prepared, the scale is invalid or the
+ *                                   entropy-coded data is corrupt; the MCUs before the error
+ *                                   are drawn.
+ */
+u8 JPEG_Draw(JPEG_t *Copy_Jpeg, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u8 Copy_Scale);
+
+#endif /**< __JPEG_INTERFACE_H__ */
@@ -0,0 +1,225 @@
+/**
+ * @file JPEG_private.h
+ * @brief This file contains the private interface of the JPEG decoder.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __JPEG_PRIVATE_H__
+#define __JPEG_PRIVATE_H__
+
+/**
+ * @brief Markers, the byte following 0xFF.
+ */
+#define JPEG_SOF0                   0xC0    /**< Baseline frame. */
+#define JPEG_SOF1                   0xC1    /**< Extended sequential frame. */
+#define JPEG_DHT                    0xC4
+#define JPEG_SOI                    0xD8
+#define JPEG_EOI                    0xD9
+#define JPEG_SOS                    0xDA
+#define JPEG_DQT                    0xDB
+#define JPEG_DRI                    0xDD
+#define JPEG_RST0                   0xD0
+#define JPEG_RST7                   0xD7
+
+/**
+ * @brief Bits of JPEG_t.Tables.
+ */
+#define JPEG_TABLE_QUANT            0       /**< + table number, 0 to 3. */
+#define JPEG_TABLE_DC               4       /**< + table number, 0 or 1. */
+#define JPEG_TABLE_AC               6       /**< + table number, 0 or 1. */
+
+/**
+ * @brief Fixed-point constants of the libjpeg integer IDCTs (jidctint.c, jidctred.c):
+ * FIX_x is x scaled by 2^JPEG_CONST_BITS.
+ */
+#define JPEG_CONST_BITS             13
+#define JPEG_PASS1_BITS             2
+#define JPEG_FIX_0_211164243        1730
+#define JPEG_FIX_0_298631336        2446
+#define JPEG_FIX_0_390180644        3196
+#define JPEG_FIX_0_509795579        4176
+#define JPEG_FIX_0_541196100        4433
+#define JPEG_FIX_0_601344887        4926
+#define JPEG_FIX_0_720959822        5906
+#define JPEG_FIX_0_765366865        6270
+#define JPEG_FIX_0_850430095        6967
+#define JPEG_FIX_0_899976223        7373
+#define JPEG_FIX_1_061594337        8697
+#define JPEG_FIX_1_175875602        9633
+#define JPEG_FIX_1_272758580        10426
+#define JPEG_FIX_1_451774981        11893
+#define JPEG_FIX_1_501321110        12299
+#define JPEG_FIX_1_847759065        15137
+#define JPEG_FIX_1_961570560        16069
+#define JPEG_FIX_2_053119869        16819
+#define JPEG_FIX_2_172734803        17799
+#define JPEG_FIX_2_562915447        20995
+#define JPEG_FIX_3_072711026        25172
+#define JPEG_FIX_3_624509785        29692
+
+/**
+ * @brief Divide by 2^Bits, rounding.
+ */
+#define JPEG_DESCALE(Value, Bits)   (((Value) + ((s32)1 << ((Bits) - 1))) >> (Bits))
+
+/**
+ * @brief YCbCr to RGB factors of libjpeg (jdcolor.c), scaled by 2^16.
+ */
+#define JPEG_CR_R                   91881   /**< 1.40200 */
+#define JPEG_CB_G                   22554   /**< 0.34414 */
+#define JPEG_CR_G                   46802   /**< 0.71414 */
+#define JPEG_CB_B                   116130  /**< 1.77200 */
+#define JPEG_ONE_HALF               32768
+
+/**
+ * @brief Read a big-endian 16-bit value.
+ *
+ * @param[in] Copy_Data The two bytes.
+ * @return The value.
+ */
+static u16 JPEG_ReadU16(const u8 *Copy_Data);
+
+/**
+ * @brief Parse a DQT segment.
+ *
+ * @param[in,out] Copy_Jpeg    The decoder state.
+ * @param[in]     Copy_Segment The segment, after its length.
+ * @param[in]     Copy_Length  The length of the segment, without its length field.
+ * @return 0 when the tables are valid, 1 otherwise.
+ */
+static u8 JPEG_ParseQuant(JPEG_t *Copy_Jpeg, const u8 *Copy_Segment, u16 Copy_Length);
+
+/**
+ * @brief Parse a DHT segment.
+ *
+ * @param[in,out] Copy_Jpeg    The decoder state.
+ * @param[in]     Copy_Segment The segment, after its length.
+ * @param[in]     Copy_Length  The length of the segment, without its length field.
+ * @return 0 when the tables are valid, 1 when they are invalid, 2 for tables 2 and 3.
+ */
+static u8 JPEG_ParseHuffman(JPEG_t *Copy_Jpeg, const u8 *Copy_Segment, u16 Copy_Length);
+
+/**
+ * @brief Build the canonical form and the lookup table of a Huffman table.
+ *
+ * @param[out] Copy_Table  The table.
+ * @param[in]  Copy_Counts Number of codes of each length, 1 to 16 bits.
+ * @param[in]  Copy_Values The symbols, by increasing code.
+ * @return 0 when the code lengths form a valid prefix code, 1 otherwise.
+ */
+static u8 JPEG_BuildHuffman(JPEG_Huffman_t *Copy_Table, const u8 *Copy_Counts, const u8 *Copy_Values);
+
+/**
+ * @brief Parse a SOF0 or SOF1 segment.
+ *
+ * @param[in,out] Copy_Jpeg    The decoder state.
+ * @param[in]     Copy_Segment The segment, after its length.
+ * @param[in]     Copy_Length  The length of the segment, without its length field.
+ * @return 0 when the frame can be decoded, 1 when it is invalid, 2 when it is not supported.
+ */
+static u8 JPEG_ParseFrame(JPEG_t *Copy_Jpeg, const u8 *Copy_Segment, u16 Copy_Length);
+
+/**
+ * @brief Parse a SOS segment.
+ *
+ * @param[in,out] Copy_Jpeg    The decoder state.
+ * @param[in]     Copy_Segment The segment, after its length.
+ * @param[in]     Copy_Length  The length of the segment, without its length field.
+ * @return 0 when the scan can be decoded, 1 when it is invalid, 2 when it is not supported.
+ */
+static u8 JPEG_ParseScan(JPEG_t *Copy_Jpeg, const u8 *Copy_Segment, u16 Copy_Length);
+
+/**
+ * @brief Read ahead at least 25 bits of entropy-coded data, removing the stuffed zero bytes.
+ *
+ * Reading stops at a marker; zero bits are read instead.
+ *
+ * @param[in,out] Copy_Jpeg The decoder state.
+ */
+static void JPEG_FillBits(JPEG_t *Copy_Jpeg);
+
+/**
+ * @brief Read bits of entropy-coded data.
+ *
+ * @param[in,out] Copy_Jpeg  The decoder state.
+ * @param[in]     Copy_Count Number of bits, 0 to 16.
+ * @return The bits, first bit most significant.
+ */
+static u16 JPEG_GetBits(JPEG_t *Copy_Jpeg, u8 Copy_Count);
+
+/**
+ * @brief Decode a Huffman symbol.
+ *
+ * @param[in,out] Copy_Jpeg  The decoder state.
+ * @param[in]     Copy_Table The Huffman table.
+ * @return The symbol, or -1 for a code that is not in the table.
+ */
+static s16 JPEG_DecodeSymbol(JPEG_t *Copy_Jpeg, const JPEG_Huffman_t *Copy_Table);
+
+/**
+ * @brief Decode a block and compute its samples at the given scale.
+ *
+ * @param[in,out] Copy_Jpeg      The decoder state.
+ * @param[in,out] Copy_Component The component of the block.
+ * @param[in]     Copy_Scale     A @ref JPEG_Scale_t.
+ * @param[out]    Copy_Samples   (8 >> Copy_Scale)^2 samples, row by row, or NULL to only read
+ *                               past the block: neither its coefficients nor its IDCT are computed.
+ * @return 0 when the block was decoded, 1 when its data is corrupt.
+ */
+static u8 JPEG_DecodeBlock(JPEG_t *Copy_Jpeg, JPEG_Component_t *Copy_Component, u8 Copy_Scale, u8 *Copy_Samples);
+
+/**
+ * @brief 8x8 inverse DCT (jpeg_idct_islow).
+ *
+ * @param[in]  Copy_Coefficients Dequantized coefficients, in natural order.
+ * @param[out] Copy_Samples      8x8 samples.
+ */
+static void JPEG_Idct8(const s32 *Copy_Coefficients, u8 *Copy_Samples);
+
+/**
+ * @brief Inverse DCT reduced to 4x4 samples (jpeg_idct_4x4).
+ *
+ * @param[in]  Copy_Coefficients Dequantized coefficients, in natural order.
+ * @param[out] Copy_Samples      4x4 samples.
+ */
+static void JPEG_Idct4(const s32 *Copy_Coefficients, u8 *Copy_Samples);
+
+/**
+ * @brief Inverse DCT reduced to 2x2 samples (jpeg_idct_2x2).
+ *
+ * @param[in]  Copy_Coefficients Dequantized coefficients, in natural order.
+ * @param[out] Copy_Samples      2x2 samples.
+ */
+static void JPEG_Idct2(const s32 *Copy_Coefficients, u8 *Copy_Samples);
+
+/**
+ * @brief Clamp a value to a sample.
+ *
+ * @param[in] Copy_Value The value.
+ * @return The value limited to 0 to 255.
+ */
+static u8 JPEG_Clamp(s32 Copy_Value);
+
+/**
+ * @brief Skip to the restart marker ending the current interval and reset the DC predictions.
+ *
+ * @param[in,out] Copy_Jpeg The decoder state.
+ */
+static void JPEG_Restart(JPEG_t *Copy_Jpeg);
+
+/**
+ * @brief Convert the samples of an MCU to RGB565 pixels.
+ *
+ * @param[in]  Copy_Jpeg   The decoder state.
+ * @param[in]  Copy_Scale  A @ref JPEG_Scale_t.
+ * @param[out] Copy_Pixels The top-left pixel of the MCU, in JPEG_t.Pixels.
+ * @param[in]  Copy_Stride Pixels from one row of the MCU to the next.
+ */
+static void JPEG_ConvertMcu(const JPEG_t *Copy_Jpeg, u8 Copy_Scale, u16 *Copy_Pixels, u16 Copy_Stride);
+
+#endif /**< __JPEG_PRIVATE_H__ */
@@ -0,0 +1,1013 @@
+/**
+ * @file JPEG_program.c
+ * @brief This file contains the implementation of the JPEG decoder.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "JPEG_config.h"
+#include "JPEG_interface.h"
+#include "JPEG_private.h"
+
+/**
+ * @brief Position in the 8x8 block (natural order) of each coefficient of the zigzag order.
+ */
+static const u8 JPEG_ZigZag[64] =
+{
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u8 JPEG_Prepare(JPEG_t *Copy_Jpeg, const u8 *Copy_Data, u32 Copy_Size)
+{
+    const u8 *Local_Read;
+    const u8 *Local_Segment;
+    u16 Local_Length;
+    u8 Local_Marker;
+    u8 Local_Status = 0;
+
+    if ((Copy_Jpeg == NULL) || (Copy_Data == NULL) || (Copy_Size < 4) || (Copy_Data[0] != 0xFF) || (Copy_Data[1] != JPEG_SOI))
+    {
+        return 1;
+    }
+
+    Copy_Jpeg->Data = Copy_Data;
+    Copy_Jpeg->End = Copy_Data + Copy_Size;
+    Copy_Jpeg->Scan = NULL;
+    Copy_Jpeg->Width = 0;
+    Copy_Jpeg->Height = 0;
+    Copy_Jpeg->Components = 0;
+    Copy_Jpeg->Tables = 0;
+    Copy_Jpeg->RestartInterval = 0;
+
+    Local_Read = Copy_Data + 2;
+    while (Local_Status == 0)
+    {
+        /**< A marker, possibly after fill bytes */
+        if ((Local_Read >= Copy_Jpeg->End) || (*Local_Read != 0xFF))
+        {
+            return 1;
+        }
+        while ((Local_Read < Copy_Jpeg->End) && (*Local_Read == 0xFF))
+        {
+            Local_Read++;
+        }
+        if (Local_Read >= Copy_Jpeg->End)
+        {
+            return 1;
+        }
+        Local_Marker = *Local_Read++;
+
+        /**< Markers without a segment; the image ends before its scan */
+        if ((Local_Marker == JPEG_EOI) || (Local_Marker == JPEG_SOI))
+        {
+            return 1;
+        }
+        if ((Local_Marker == 0x01) || ((Local_Marker >= JPEG_RST0) && (Local_Marker <= JPEG_RST7)))
+        {
+            continue;
+        }
+
+        if ((Copy_Jpeg->End - Local_Read) < 2)
+        {
+            return 1;
+        }
+        Local_Length = JPEG_ReadU16(Local_Read);
+        if ((Local_Length < 2) || (Local_Length > (Copy_Jpeg->End - Local_Read)))
+        {
+            return 1;
+        }
+        Local_Segment = Local_Read + 2;
+        Local_Length -= 2;
+
+        switch (Local_Marker)
+        {
+        case JPEG_DQT:
+            Local_Status = JPEG_ParseQuant(Copy_Jpeg, Local_Segment, Local_Length);
+            break;
+
+        case JPEG_DHT:
+            Local_Status = JPEG_ParseHuffman(Copy_Jpeg, Local_Segment, Local_Length);
+            break;
+
+        case JPEG_SOF0:
+        case JPEG_SOF1:
+            Local_Status = (Copy_Jpeg->Components != 0) ? 1 : JPEG_ParseFrame(Copy_Jpeg, Local_Segment, Local_Length);
+            break;
+
+        case JPEG_DRI:
+            Local_Status = (Local_Length < 2) ? 1 : 0;
+            if (Local_Status == 0)
+            {
+                Copy_Jpeg->RestartInterval = JPEG_ReadU16(Local_Segment);
+            }
+            break;
+
+        case JPEG_SOS:
+            Local_Status = (Copy_Jpeg->Components == 0) ? 1 : JPEG_ParseScan(Copy_Jpeg, Local_Segment, Local_Length);
+            if (Local_Status == 0)
+            {
+                Copy_Jpeg->Scan = Local_Segment + Local_Length;
+                return 0;
+            }
+            break;
+
+        default:
+            /**< Progressive, lossless and arithmetic-coded frames (SOF2 to SOF15, DAC) */
+            if ((Local_Marker >= 0xC2) && (Local_Marker <= 0xCF))
+            {
+                Local_Status = 2;
+            }
+            /**< APPn, COM and the other segments are skipped */
+            break;
+        }
+
+        Local_Read = Local_Segment + Local_Length;
+    }
+
+    return Local_Status;
+}
+
+u8 JPEG_Draw(JPEG_t *Copy_Jpeg, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition, u8 Copy_Scale)
+{
+    u16 Local_McuWidth;
+    u16 Local_McuHeight;
+    u16 Local_ImageWidth;
+    u16 Local_ImageHeight;
+    u16 Local_DrawWidth;
+    u16 Local_DrawHeight;
+    u16 Local_StripWidth;
+    u16 Local_StripX;
+    u16 Local_X;
+    u16 Local_Y;
+    u16 Local_RestartLeft;
+    u8 Local_Component;
+    u8 Local_Blocks;
+    u8 Local_Block;
+    u8 Local_Sample;
+
+    if ((Copy_Jpeg == NULL) || (Copy_Jpeg->Scan == NULL) || (Copy_Scale > JPEG_SCALE_1_8))
+    {
+        return 1;
+    }
+
+    Local_McuWidth = (8 * Copy_Jpeg->MaxHSampling) >> Copy_Scale;
+    Local_McuHeight = (8 * Copy_Jpeg->MaxVSampling) >> Copy_Scale;
+    Local_ImageWidth = (Copy_Jpeg->Width + (1 << Copy_Scale) - 1) >> Copy_Scale;
+    Local_ImageHeight = (Copy_Jpeg->Height + (1 << Copy_Scale) - 1) >> Copy_Scale;
+
+    /**< Visible part of the image: the rest is clipped at the right and bottom of the screen */
+    if ((Copy_XPosition >= Copy_TftDisplay->TFT_Controller->TFT_Width) || (Copy_YPosition >= Copy_TftDisplay->TFT_Controller->TFT_Height))
+    {
+        return 0;
+    }
+    Local_DrawWidth = Copy_TftDisplay->TFT_Controller->TFT_Width - Copy_XPosition;
+    Local_DrawWidth = (Local_ImageWidth < Local_DrawWidth) ? Local_ImageWidth : Local_DrawWidth;
+    Local_DrawHeight = Copy_TftDisplay->TFT_Controller->TFT_Height - Copy_YPosition;
+    Local_DrawHeight = (Local_ImageHeight < Local_DrawHeight) ? Local_ImageHeight : Local_DrawHeight;
+
+    /**< One window per MCU, except at 1/8 where the 1x1 to 2x2 MCUs of a row share a strip of Pixels */
+    Local_StripWidth = (Copy_Scale == JPEG_SCALE_1_8) ? (u16)((sizeof(Copy_Jpeg->Pixels) / sizeof(Copy_Jpeg->Pixels[0])) / Local_McuHeight) : Local_McuWidth;
+
+    Copy_Jpeg->Read = Copy_Jpeg->Scan;
+    Copy_Jpeg->Bits = 0;
+    Copy_Jpeg->BitCount = 0;
+    for (Local_Component = 0; Local_Component < Copy_Jpeg->Components; Local_Component++)
+    {
+        Copy_Jpeg->Component[Local_Component].Predictor = 0;
+    }
+    Local_RestartLeft = Copy_Jpeg->RestartInterval;
+
+    /**< The rows below the screen are not decoded */
+    for (Local_Y = 0; Local_Y < Local_DrawHeight; Local_Y += Local_McuHeight)
+    {
+        Local_StripX = 0;
+        for (Local_X = 0; Local_X < Local_ImageWidth; Local_X += Local_McuWidth)
+        {
+            if (Copy_Jpeg->RestartInterval != 0)
+            {
+                if (Local_RestartLeft == 0)
+                {
+                    JPEG_Restart(Copy_Jpeg);
+                    Local_RestartLeft = Copy_Jpeg->RestartInterval;
+                }
+                Local_RestartLeft--;
+            }
+
+            /**< Luma blocks left to right and top to bottom, then one Cb and one Cr block; the MCUs
+                 right of the screen are only read past */
+            Local_Sample = 0;
+            for (Local_Component = 0; Local_Component < Copy_Jpeg->Components; Local_Component++)
+            {
+                Local_Blocks = (Local_Component == 0) ? (Copy_Jpeg->MaxHSampling * Copy_Jpeg->MaxVSampling) : 1;
+                for (Local_Block = 0; Local_Block < Local_Blocks; Local_Block++)
+                {
+                    if (JPEG_DecodeBlock(Copy_Jpeg, &Copy_Jpeg->Component[Local_Component], Copy_Scale,
+                                         (Local_X < Local_DrawWidth) ? Copy_Jpeg->Samples[Local_Sample] : NULL) != 0)
+                    {
+                        return 1;
+                    }
+                    Local_Sample++;
+                }
+            }
+            if (Local_X >= Local_DrawWidth)
+            {
+                continue;
+            }
+
+            /**< Write the strip when it is full or reaches the right edge, cut at the visible part */
+            JPEG_ConvertMcu(Copy_Jpeg, Copy_Scale, Copy_Jpeg->Pixels + (Local_X - Local_StripX), Local_StripWidth);
+            if (((Local_X + Local_McuWidth - Local_StripX) >= Local_StripWidth) || ((Local_X + Local_McuWidth) >= Local_DrawWidth))
+            {
+                TFT_BurstWriteStride(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition + Local_StripX, Copy_YPosition + Local_Y,
+                                     (((Local_X + Local_McuWidth) < Local_DrawWidth) ? (Local_X + Local_McuWidth) : Local_DrawWidth) - Local_StripX,
+                                     ((Local_DrawHeight - Local_Y) < Local_McuHeight) ? (Local_DrawHeight - Local_Y) : Local_McuHeight,
+                                     Copy_Jpeg->Pixels, Local_StripWidth);
+                Local_StripX = Local_X + Local_McuWidth;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static u16 JPEG_ReadU16(const u8 *Copy_Data)
+{
+    return (u16)((Copy_Data[0] << 8) | Copy_Data[1]);
+}
+
+static u8 JPEG_ParseQuant(JPEG_t *Copy_Jpeg, const u8 *Copy_Segment, u16 Copy_Length)
+{
+    u8 Local_Precision;
+    u8 Local_Table;
+    u8 Local_Index;
+    u16 Local_Size;
+
+    while (Copy_Length > 0)
+    {
+        Local_Precision = Copy_Segment[0] >> 4;
+        Local_Table = Copy_Segment[0] & 0x0F;
+        Local_Size = (Local_Precision != 0) ? 129 : 65;
+        if ((Local_Precision > 1) || (Local_Table > 3) || (Copy_Length < Local_Size))
+        {
+            return 1;
+        }
+
+        for (Local_Index = 0; Local_Index < 64; Local_Index++)
+        {
+            Copy_Jpeg->Quant[Local_Table][Local_Index] = (Local_Precision != 0) ? JPEG_ReadU16(&Copy_Segment[1 + 2 * Local_Index]) : Copy_Segment[1 + Local_Index];
+        }
+        SET_BIT(Copy_Jpeg->Tables, (JPEG_TABLE_QUANT + Local_Table));
+
+        Copy_Segment += Local_Size;
+        Copy_Length -= Local_Size;
+    }
+
+    return 0;
+}
+
+static u8 JPEG_ParseHuffman(JPEG_t *Copy_Jpeg, const u8 *Copy_Segment, u16 Copy_Length)
+{
+    u8 Local_Class;
+    u8 Local_Table;
+    u8 Local_Length;
+    u16 Local_Symbols;
+
+    while (Copy_Length > 0)
+    {
+        if (Copy_Length < 17)
+        {
+            return 1;
+        }
+        Local_Class = Copy_Segment[0] >> 4;
+        Local_Table = Copy_Segment[0] & 0x0F;
+        Local_Symbols = 0;
+        for (Local_Length = 1; Local_Length <= 16; Local_Length++)
+        {
+            Local_Symbols += Copy_Segment[Local_Length];
+        }
+        if ((Local_Class > 1) || (Local_Symbols > 256) || (Copy_Length < 17 + Local_Symbols))
+        {
+            return 1;
+        }
+        /**< Tables 2 and 3 only exist in extended files */
+        if (Local_Table > 1)
+        {
+            return 2;
+        }
+
+        if (JPEG_BuildHuffman(&Copy_Jpeg->Huffman[2 * Local_Class + Local_Table], &Copy_Segment[1], &Copy_Segment[17]) != 0)
+        {
+            return 1;
+        }
+        SET_BIT(Copy_Jpeg->Tables, (((Local_Class != 0) ? JPEG_TABLE_AC : JPEG_TABLE_DC) + Local_Table));
+
+        Copy_Segment += 17 + Local_Symbols;
+        Copy_Length -= 17 + Local_Symbols;
+    }
+
+    return 0;
+}
+
+static u8 JPEG_BuildHuffman(JPEG_Huffman_t *Copy_Table, const u8 *Copy_Counts, const u8 *Copy_Values)
+{
+    u32 Local_Code = 0;
+    u16 Local_Index = 0;
+    u16 Local_Entry;
+    u16 Local_Fill;
+    u8 Local_Length;
+    u8 Local_Count;
+
+    for (Local_Entry = 0; Local_Entry < (1 << JPEG_HUFFMAN_LOOKUP_BITS); Local_Entry++)
+    {
+        Copy_Table->Lookup[Local_Entry] = 0;
+    }
+
+    /**< Canonical codes: consecutive values for one length, doubled for the next length */
+    for (Local_Length = 1; Local_Length <= 16; Local_Length++)
+    {
+        Copy_Table->ValueOffset[Local_Length] = (s32)Local_Index - (s32)Local_Code;
+        for (Local_Count = 0; Local_Count < Copy_Counts[Local_Length - 1]; Local_Count++)
+        {
+            /**< A short code fills every entry starting with its bits */
+            if (Local_Length <= JPEG_HUFFMAN_LOOKUP_BITS)
+            {
+                Local_Entry = (u16)(Local_Code << (JPEG_HUFFMAN_LOOKUP_BITS - Local_Length));
+                for (Local_Fill = 0; Local_Fill < (1 << (JPEG_HUFFMAN_LOOKUP_BITS - Local_Length)); Local_Fill++)
+                {
+                    Copy_Table->Lookup[Local_Entry + Local_Fill] = (u16)((Local_Length << 8) | Copy_Values[Local_Index]);
+                }
+            }
+            Local_Code++;
+            Local_Index++;
+        }
+        if (Local_Code > ((u32)1 << Local_Length))
+        {
+            return 1;
+        }
+        Copy_Table->MaxCode[Local_Length] = (Copy_Counts[Local_Length - 1] != 0) ? (s32)Local_Code - 1 : -1;
+        Local_Code <<= 1;
+    }
+    Copy_Table->Values = Copy_Values;
+
+    return 0;
+}
+
+static u8 JPEG_ParseFrame(JPEG_t *Copy_Jpeg, const u8 *Copy_Segment, u16 Copy_Length)
+{
+    JPEG_Component_t *Local_Component;
+    u8 Local_Count;
+    u8 Local_Index;
+
+    if (Copy_Length < 6)
+    {
+        return 1;
+    }
+    Local_Count = Copy_Segment[5];
+    if (Copy_Length < 6 + 3 * Local_Count)
+    {
+        return 1;
+    }
+    /**< 12-bit samples, height given by a DNL marker, CMYK */
+    if ((Copy_Segment[0] != 8) || (JPEG_ReadU16(&Copy_Segment[1]) == 0) || ((Local_Count != 1) && (Local_Count != 3)))
+    {
+        return 2;
+    }
+
+    Copy_Jpeg->Height = JPEG_ReadU16(&Copy_Segment[1]);
+    Copy_Jpeg->Width = JPEG_ReadU16(&Copy_Segment[3]);
+    if (Copy_Jpeg->Width == 0)
+    {
+        return 1;
+    }
+
+    for (Local_Index = 0; Local_Index < Local_Count; Local_Index++)
+    {
+        Local_Component = &Copy_Jpeg->Component[Local_Index];
+        Local_Component->Id = Copy_Segment[6 + 3 * Local_Index];
+        Local_Component->HSampling = Copy_Segment[7 + 3 * Local_Index] >> 4;
+        Local_Component->VSampling = Copy_Segment[7 + 3 * Local_Index] & 0x0F;
+        Local_Component->QuantTable = Copy_Segment[8 + 3 * Local_Index];
+        if ((Local_Component->HSampling < 1) || (Local_Component->HSampling > 4) || (Local_Component->VSampling < 1) ||
+            (Local_Component->VSampling > 4) || (Local_Component->QuantTable > 3))
+        {
+            return 1;
+        }
+    }
+
+    /**< A single component is one block per MCU, whatever its sampling factors */
+    Copy_Jpeg->MaxHSampling = 1;
+    Copy_Jpeg->MaxVSampling = 1;
+    if (Local_Count == 3)
+    {
+        if ((Copy_Jpeg->Component[0].HSampling > 2) || (Copy_Jpeg->Component[0].VSampling > 2) ||
+            (Copy_Jpeg->Component[1].HSampling != 1) || (Copy_Jpeg->Component[1].VSampling != 1) ||
+            (Copy_Jpeg->Component[2].HSampling != 1) || (Copy_Jpeg->Component[2].VSampling != 1))
+        {
+            return 2;
+        }
+        Copy_Jpeg->MaxHSampling = Copy_Jpeg->Component[0].HSampling;
+        Copy_Jpeg->MaxVSampling = Copy_Jpeg->Component[0].VSampling;
+    }
+    Copy_Jpeg->Components = Local_Count;
+
+    return 0;
+}
+
+static u8 JPEG_ParseScan(JPEG_t *Copy_Jpeg, const u8 *Copy_Segment, u16 Copy_Length)
+{
+    JPEG_Component_t *Local_Component;
+    u8 Local_Count;
+    u8 Local_Index;
+    u8 Local_Tables;
+
+    if (Copy_Length < 1)
+    {
+        return 1;
+    }
+    Local_Count = Copy_Segment[0];
+    if (Copy_Length < 4 + 2 * Local_Count)
+    {
+        return 1;
+    }
+    /**< One scan per component, or spectral selection / successive approximation */
+    if ((Local_Count != Copy_Jpeg->Components) || (Copy_Segment[1 + 2 * Local_Count] != 0) ||
+        (Copy_Segment[2 + 2 * Local_Count] != 63) || (Copy_Segment[3 + 2 * Local_Count] != 0))
+    {
+        return 2;
+    }
+
+    /**< The components of a scan are in frame order */
+    for (Local_Index = 0; Local_Index < Local_Count; Local_Index++)
+    {
+        Local_Component = &Copy_Jpeg->Component[Local_Index];
+        Local_Tables = Copy_Segment[2 + 2 * Local_Index];
+        if (Copy_Segment[1 + 2 * Local_Index] != Local_Component->Id)
+        {
+            return 1;
+        }
+        Local_Component->DcTable = Local_Tables >> 4;
+        Local_Component->AcTable = Local_Tables & 0x0F;
+        if ((Local_Component->DcTable > 1) || (Local_Component->AcTable > 1))
+        {
+            return 2;
+        }
+        if ((GET_BIT(Copy_Jpeg->Tables, (JPEG_TABLE_QUANT + Local_Component->QuantTable)) == 0) ||
+            (GET_BIT(Copy_Jpeg->Tables, (JPEG_TABLE_DC + Local_Component->DcTable)) == 0) ||
+            (GET_BIT(Copy_Jpeg->Tables, (JPEG_TABLE_AC + Local_Component->AcTable)) == 0))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void JPEG_FillBits(JPEG_t *Copy_Jpeg)
+{
+    u8 Local_Byte;
+
+    while (Copy_Jpeg->BitCount <= 24)
+    {
+        Local_Byte = 0;
+        if (Copy_Jpeg->Read < Copy_Jpeg->End)
+        {
+            Local_Byte = *Copy_Jpeg->Read;
+            if (Local_Byte != 0xFF)
+            {
+                Copy_Jpeg->Read++;
+            }
+            else if (((Copy_Jpeg->Read + 1) < Copy_Jpeg->End) && (Copy_Jpeg->Read[1] == 0x00))
+            {
+                /**< A stuffed 0xFF data byte */
+                Copy_Jpeg->Read += 2;
+            }
+            else
+            {
+                /**< A marker: stay on it and feed zeros */
+                Local_Byte = 0;
+            }
+        }
+        Copy_Jpeg->Bits |= (u32)Local_Byte << (24 - Copy_Jpeg->BitCount);
+        Copy_Jpeg->BitCount += 8;
+    }
+}
+
+static u16 JPEG_GetBits(JPEG_t *Copy_Jpeg, u8 Copy_Count)
+{
+    u16 Local_Value;
+
+    if (Copy_Count == 0)
+    {
+        return 0;
+    }
+    if (Copy_Jpeg->BitCount < Copy_Count)
+    {
+        JPEG_FillBits(Copy_Jpeg);
+    }
+
+    Local_Value = (u16)(Copy_Jpeg->Bits >> (32 - Copy_Count));
+    Copy_Jpeg->Bits <<= Copy_Count;
+    Copy_Jpeg->BitCount -= Copy_Count;
+
+    return Local_Value;
+}
+
+static s16 JPEG_DecodeSymbol(JPEG_t *Copy_Jpeg, const JPEG_Huffman_t *Copy_Table)
+{
+    u32 Local_Code;
+    u16 Local_Entry;
+    u8 Local_Length;
+
+    if (Copy_Jpeg->BitCount < 16)
+    {
+        JPEG_FillBits(Copy_Jpeg);
+    }
+
+    Local_Entry = Copy_Table->Lookup[Copy_Jpeg->Bits >> (32 - JPEG_HUFFMAN_LOOKUP_BITS)];
+    if (Local_Entry != 0)
+    {
+        Local_Length = Local_Entry >> 8;
+        Copy_Jpeg->Bits <<= Local_Length;
+        Copy_Jpeg->BitCount -= Local_Length;
+        return Local_Entry & 0xFF;
+    }
+
+    /**< Longer codes, one bit at a time */
+    for (Local_Length = JPEG_HUFFMAN_LOOKUP_BITS + 1; Local_Length <= 16; Local_Length++)
+    {
+        Local_Code = Copy_Jpeg->Bits >> (32 - Local_Length);
+        if ((s32)Local_Code <= Copy_Table->MaxCode[Local_Length])
+        {
+            Copy_Jpeg->Bits <<= Local_Length;
+            Copy_Jpeg->BitCount -= Local_Length;
+            return Copy_Table->Values[(s32)Local_Code + Copy_Table->ValueOffset[Local_Length]];
+        }
+    }
+
+    return -1;
+}
+
+static u8 JPEG_DecodeBlock(JPEG_t *Copy_Jpeg, JPEG_Component_t *Copy_Component, u8 Copy_Scale, u8 *Copy_Samples)
+{
+    s32 Local_Coefficients[64];
+    const u16 *Local_Quant = Copy_Jpeg->Quant[Copy_Component->QuantTable];
+    const JPEG_Huffman_t *Local_AcTable = &Copy_Jpeg->Huffman[2 + Copy_Component->AcTable];
+    s32 Local_Value;
+    s16 Local_Symbol;
+    u8 Local_Size;
+    u8 Local_Index;
+
+    /**< DC: difference with the previous block of the component */
+    Local_Symbol = JPEG_DecodeSymbol(Copy_Jpeg, &Copy_Jpeg->Huffman[Copy_Component->DcTable]);
+    if ((Local_Symbol < 0) || (Local_Symbol > 11))
+    {
+        return 1;
+    }
+    Local_Size = (u8)Local_Symbol;
+    Local_Value = JPEG_GetBits(Copy_Jpeg, Local_Size);
+    if ((Local_Size != 0) && (Local_Value < ((s32)1 << (Local_Size - 1))))
+    {
+        Local_Value -= ((s32)1 << Local_Size) - 1;
+    }
+    Copy_Component->Predictor += (s16)Local_Value;
+
+    if (Copy_Samples == NULL)
+    {
+        /**< Only read past the block: no coefficient is kept */
+        Copy_Scale = JPEG_SCALE_1_8;
+    }
+    else if (Copy_Scale != JPEG_SCALE_1_8)
+    {
+        for (Local_Index = 1; Local_Index < 64; Local_Index++)
+        {
+            Local_Coefficients[Local_Index] = 0;
+        }
+    }
+    Local_Coefficients[0] = (s32)Copy_Component->Predictor * Local_Quant[0];
+
+    /**< AC: run of zeros and size of the next coefficient; only skipped at 1/8 */
+    for (Local_Index = 1; Local_Index < 64; Local_Index++)
+    {
+        Local_Symbol = JPEG_DecodeSymbol(Copy_Jpeg, Local_AcTable);
+        if (Local_Symbol < 0)
+        {
+            return 1;
+        }
+        Local_Size = Local_Symbol & 0x0F;
+        if (Local_Size == 0)
+        {
+            /**< End of block, or a run of 16 zeros */
+            if ((Local_Symbol >> 4) != 15)
+            {
+                break;
+            }
+            Local_Index += 15;
+            continue;
+        }
+
+        Local_Index += Local_Symbol >> 4;
+        if (Local_Index > 63)
+        {
+            return 1;
+        }
+        Local_Value = JPEG_GetBits(Copy_Jpeg, Local_Size);
+        if (Copy_Scale != JPEG_SCALE_1_8)
+        {
+            if (Local_Value < ((s32)1 << (Local_Size - 1)))
+            {
+                Local_Value -= ((s32)1 << Local_Size) - 1;
+            }
+            Local_Coefficients[JPEG_ZigZag[Local_Index]] = Local_Value * Local_Quant[Local_Index];
+        }
+    }
+
+    if (Copy_Samples == NULL)
+    {
+        return 0;
+    }
+
+    switch (Copy_Scale)
+    {
+    case JPEG_SCALE_1:
+        JPEG_Idct8(Local_Coefficients, Copy_Samples);
+        break;
+
+    case JPEG_SCALE_1_2:
+        JPEG_Idct4(Local_Coefficients, Copy_Samples);
+        break;
+
+    case JPEG_SCALE_1_4:
+        JPEG_Idct2(Local_Coefficients, Copy_Samples);
+        break;
+
+    default:
+        /**< The DC coefficient is 8 times the average of the block */
+        Copy_Samples[0] = JPEG_Clamp(JPEG_DESCALE(Local_Coefficients[0], 3) + 128);
+        break;
+    }
+
+    return 0;
+}
+
+static void JPEG_Idct8(const s32 *Copy_Coefficients, u8 *Copy_Samples)
+{
+    s32 Local_Workspace[64];
+    const s32 *Local_Input;
+    s32 *Local_Work;
+    u8 *Local_Output;
+    s32 Local_Tmp0, Local_Tmp1, Local_Tmp2, Local_Tmp3;
+    s32 Local_Tmp10, Local_Tmp11, Local_Tmp12, Local_Tmp13;
+    s32 Local_Z1, Local_Z2, Local_Z3, Local_Z4, Local_Z5;
+    u8 Local_Index;
+
+    /**< Pass 1: columns, results scaled up by 2^JPEG_PASS1_BITS */
+    for (Local_Index = 0; Local_Index < 8; Local_Index++)
+    {
+        Local_Input = &Copy_Coefficients[Local_Index];
+        Local_Work = &Local_Workspace[Local_Index];
+
+        /**< Columns without AC terms are common: their output is constant */
+        if ((Local_Input[8] == 0) && (Local_Input[16] == 0) && (Local_Input[24] == 0) && (Local_Input[32] == 0) &&
+            (Local_Input[40] == 0) && (Local_Input[48] == 0) && (Local_Input[56] == 0))
+        {
+            Local_Tmp0 = Local_Input[0] * ((s32)1 << JPEG_PASS1_BITS);
+            Local_Work[0] = Local_Work[8] = Local_Work[16] = Local_Work[24] = Local_Tmp0;
+            Local_Work[32] = Local_Work[40] = Local_Work[48] = Local_Work[56] = Local_Tmp0;
+            continue;
+        }
+
+        /**< Even part */
+        Local_Z2 = Local_Input[16];
+        Local_Z3 = Local_Input[48];
+        Local_Z1 = (Local_Z2 + Local_Z3) * JPEG_FIX_0_541196100;
+        Local_Tmp2 = Local_Z1 - Local_Z3 * JPEG_FIX_1_847759065;
+        Local_Tmp3 = Local_Z1 + Local_Z2 * JPEG_FIX_0_765366865;
+        Local_Tmp0 = (Local_Input[0] + Local_Input[32]) * ((s32)1 << JPEG_CONST_BITS);
+        Local_Tmp1 = (Local_Input[0] - Local_Input[32]) * ((s32)1 << JPEG_CONST_BITS);
+        Local_Tmp10 = Local_Tmp0 + Local_Tmp3;
+        Local_Tmp13 = Local_Tmp0 - Local_Tmp3;
+        Local_Tmp11 = Local_Tmp1 + Local_Tmp2;
+        Local_Tmp12 = Local_Tmp1 - Local_Tmp2;
+
+        /**< Odd part */
+        Local_Tmp0 = Local_Input[56];
+        Local_Tmp1 = Local_Input[40];
+        Local_Tmp2 = Local_Input[24];
+        Local_Tmp3 = Local_Input[8];
+        Local_Z1 = Local_Tmp0 + Local_Tmp3;
+        Local_Z2 = Local_Tmp1 + Local_Tmp2;
+        Local_Z3 = Local_Tmp0 + Local_Tmp2;
+        Local_Z4 = Local_Tmp1 + Local_Tmp3;
+        Local_Z5 = (Local_Z3 + Local_Z4) * JPEG_FIX_1_175875602;
+        Local_Tmp0 *= JPEG_FIX_0_298631336;
+        Local_Tmp1 *= JPEG_FIX_2_053119869;
+        Local_Tmp2 *= JPEG_FIX_3_072711026;
+        Local_Tmp3 *= JPEG_FIX_1_501321110;
+        Local_Z1 *= -JPEG_FIX_0_899976223;
+        Local_Z2 *= -JPEG_FIX_2_562915447;
+        Local_Z3 = Local_Z3 * -JPEG_FIX_1_961570560 + Local_Z5;
+        Local_Z4 = Local_Z4 * -JPEG_FIX_0_390180644 + Local_Z5;
+        Local_Tmp0 += Local_Z1 + Local_Z3;
+        Local_Tmp1 += Local_Z2 + Local_Z4;
+        Local_Tmp2 += Local_Z2 + Local_Z3;
+        Local_Tmp3 += Local_Z1 + Local_Z4;
+
+        Local_Work[0] = JPEG_DESCALE(Local_Tmp10 + Local_Tmp3, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+        Local_Work[56] = JPEG_DESCALE(Local_Tmp10 - Local_Tmp3, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+        Local_Work[8] = JPEG_DESCALE(Local_Tmp11 + Local_Tmp2, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+        Local_Work[48] = JPEG_DESCALE(Local_Tmp11 - Local_Tmp2, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+        Local_Work[16] = JPEG_DESCALE(Local_Tmp12 + Local_Tmp1, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+        Local_Work[40] = JPEG_DESCALE(Local_Tmp12 - Local_Tmp1, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+        Local_Work[24] = JPEG_DESCALE(Local_Tmp13 + Local_Tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+        Local_Work[32] = JPEG_DESCALE(Local_Tmp13 - Local_Tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+    }
+
+    /**< Pass 2: rows, removing the pass 1 scaling and the factor 8 of the DCT */
+    for (Local_Index = 0; Local_Index < 8; Local_Index++)
+    {
+        Local_Work = &Local_Workspace[8 * Local_Index];
+        Local_Output = &Copy_Samples[8 * Local_Index];
+
+        if ((Local_Work[1] == 0) && (Local_Work[2] == 0) && (Local_Work[3] == 0) && (Local_Work[4] == 0) &&
+            (Local_Work[5] == 0) && (Local_Work[6] == 0) && (Local_Work[7] == 0))
+        {
+            Local_Output[0] = JPEG_Clamp(JPEG_DESCALE(Local_Work[0], JPEG_PASS1_BITS + 3) + 128);
+            Local_Output[1] = Local_Output[2] = Local_Output[3] = Local_Output[0];
+            Local_Output[4] = Local_Output[5] = Local_Output[6] = Local_Output[7] = Local_Output[0];
+            continue;
+        }
+
+        Local_Z2 = Local_Work[2];
+        Local_Z3 = Local_Work[6];
+        Local_Z1 = (Local_Z2 + Local_Z3) * JPEG_FIX_0_541196100;
+        Local_Tmp2 = Local_Z1 - Local_Z3 * JPEG_FIX_1_847759065;
+        Local_Tmp3 = Local_Z1 + Local_Z2 * JPEG_FIX_0_765366865;
+        Local_Tmp0 = (Local_Work[0] + Local_Work[4]) * ((s32)1 << JPEG_CONST_BITS);
+        Local_Tmp1 = (Local_Work[0] - Local_Work[4]) * ((s32)1 << JPEG_CONST_BITS);
+        Local_Tmp10 = Local_Tmp0 + Local_Tmp3;
+        Local_Tmp13 = Local_Tmp0 - Local_Tmp3;
+        Local_Tmp11 = Local_Tmp1 + Local_Tmp2;
+        Local_Tmp12 = Local_Tmp1 - Local_Tmp2;
+
+        Local_Tmp0 = Local_Work[7];
+        Local_Tmp1 = Local_Work[5];
+        Local_Tmp2 = Local_Work[3];
+        Local_Tmp3 = Local_Work[1];
+        Local_Z1 = Local_Tmp0 + Local_Tmp3;
+        Local_Z2 = Local_Tmp1 + Local_Tmp2;
+        Local_Z3 = Local_Tmp0 + Local_Tmp2;
+        Local_Z4 = Local_Tmp1 + Local_Tmp3;
+        Local_Z5 = (Local_Z3 + Local_Z4) * JPEG_FIX_1_175875602;
+        Local_Tmp0 *= JPEG_FIX_0_298631336;
+        Local_Tmp1 *= JPEG_FIX_2_053119869;
+        Local_Tmp2 *= JPEG_FIX_3_072711026;
+        Local_Tmp3 *= JPEG_FIX_1_501321110;
+        Local_Z1 *= -JPEG_FIX_0_899976223;
+        Local_Z2 *= -JPEG_FIX_2_562915447;
+        Local_Z3 = Local_Z3 * -JPEG_FIX_1_961570560 + Local_Z5;
+        Local_Z4 = Local_Z4 * -JPEG_FIX_0_390180644 + Local_Z5;
+        Local_Tmp0 += Local_Z1 + Local_Z3;
+        Local_Tmp1 += Local_Z2 + Local_Z4;
+        Local_Tmp2 += Local_Z2 + Local_Z3;
+        Local_Tmp3 += Local_Z1 + Local_Z4;
+
+        Local_Output[0] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp10 + Local_Tmp3, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128);
+        Local_Output[7] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp10 - Local_Tmp3, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128);
+        Local_Output[1] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp11 + Local_Tmp2, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128);
+        Local_Output[6] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp11 - Local_Tmp2, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128);
+        Local_Output[2] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp12 + Local_Tmp1, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128);
+        Local_Output[5] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp12 - Local_Tmp1, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128);
+        Local_Output[3] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp13 + Local_Tmp0, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128);
+        Local_Output[4] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp13 - Local_Tmp0, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128);
+    }
+}
+
+static void JPEG_Idct4(const s32 *Copy_Coefficients, u8 *Copy_Samples)
+{
+    s32 Local_Workspace[32];
+    const s32 *Local_Input;
+    s32 *Local_Work;
+    u8 *Local_Output;
+    s32 Local_Tmp0, Local_Tmp2, Local_Tmp10, Local_Tmp12;
+    u8 Local_Index;
+
+    /**< Pass 1: columns; column 4 is not used by pass 2 */
+    for (Local_Index = 0; Local_Index < 8; Local_Index++)
+    {
+        if (Local_Index == 4)
+        {
+            continue;
+        }
+        Local_Input = &Copy_Coefficients[Local_Index];
+        Local_Work = &Local_Workspace[Local_Index];
+
+        if ((Local_Input[8] == 0) && (Local_Input[16] == 0) && (Local_Input[24] == 0) &&
+            (Local_Input[40] == 0) && (Local_Input[48] == 0) && (Local_Input[56] == 0))
+        {
+            Local_Tmp0 = Local_Input[0] * ((s32)1 << JPEG_PASS1_BITS);
+            Local_Work[0] = Local_Work[8] = Local_Work[16] = Local_Work[24] = Local_Tmp0;
+            continue;
+        }
+
+        Local_Tmp0 = Local_Input[0] * ((s32)1 << (JPEG_CONST_BITS + 1));
+        Local_Tmp2 = Local_Input[16] * JPEG_FIX_1_847759065 - Local_Input[48] * JPEG_FIX_0_765366865;
+        Local_Tmp10 = Local_Tmp0 + Local_Tmp2;
+        Local_Tmp12 = Local_Tmp0 - Local_Tmp2;
+
+        Local_Tmp0 = -Local_Input[56] * JPEG_FIX_0_211164243 + Local_Input[40] * JPEG_FIX_1_451774981
+                     - Local_Input[24] * JPEG_FIX_2_172734803 + Local_Input[8] * JPEG_FIX_1_061594337;
+        Local_Tmp2 = -Local_Input[56] * JPEG_FIX_0_509795579 - Local_Input[40] * JPEG_FIX_0_601344887
+                     + Local_Input[24] * JPEG_FIX_0_899976223 + Local_Input[8] * JPEG_FIX_2_562915447;
+
+        Local_Work[0] = JPEG_DESCALE(Local_Tmp10 + Local_Tmp2, JPEG_CONST_BITS - JPEG_PASS1_BITS + 1);
+        Local_Work[24] = JPEG_DESCALE(Local_Tmp10 - Local_Tmp2, JPEG_CONST_BITS - JPEG_PASS1_BITS + 1);
+        Local_Work[8] = JPEG_DESCALE(Local_Tmp12 + Local_Tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS + 1);
+        Local_Work[16] = JPEG_DESCALE(Local_Tmp12 - Local_Tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS + 1);
+    }
+
+    /**< Pass 2: the 4 rows */
+    for (Local_Index = 0; Local_Index < 4; Local_Index++)
+    {
+        Local_Work = &Local_Workspace[8 * Local_Index];
+        Local_Output = &Copy_Samples[4 * Local_Index];
+
+        if ((Local_Work[1] == 0) && (Local_Work[2] == 0) && (Local_Work[3] == 0) &&
+            (Local_Work[5] == 0) && (Local_Work[6] == 0) && (Local_Work[7] == 0))
+        {
+            Local_Output[0] = JPEG_Clamp(JPEG_DESCALE(Local_Work[0], JPEG_PASS1_BITS + 3) + 128);
+            Local_Output[1] = Local_Output[2] = Local_Output[3] = Local_Output[0];
+            continue;
+        }
+
+        Local_Tmp0 = Local_Work[0] * ((s32)1 << (JPEG_CONST_BITS + 1));
+        Local_Tmp2 = Local_Work[2] * JPEG_FIX_1_847759065 - Local_Work[6] * JPEG_FIX_0_765366865;
+        Local_Tmp10 = Local_Tmp0 + Local_Tmp2;
+        Local_Tmp12 = Local_Tmp0 - Local_Tmp2;
+
+        Local_Tmp0 = -Local_Work[7] * JPEG_FIX_0_211164243 + Local_Work[5] * JPEG_FIX_1_451774981
+                     - Local_Work[3] * JPEG_FIX_2_172734803 + Local_Work[1] * JPEG_FIX_1_061594337;
+        Local_Tmp2 = -Local_Work[7] * JPEG_FIX_0_509795579 - Local_Work[5] * JPEG_FIX_0_601344887
+                     + Local_Work[3] * JPEG_FIX_0_899976223 + Local_Work[1] * JPEG_FIX_2_562915447;
+
+        Local_Output[0] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp10 + Local_Tmp2, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3 + 1) + 128);
+        Local_Output[3] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp10 - Local_Tmp2, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3 + 1) + 128);
+        Local_Output[1] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp12 + Local_Tmp0, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3 + 1) + 128);
+        Local_Output[2] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp12 - Local_Tmp0, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3 + 1) + 128);
+    }
+}
+
+static void JPEG_Idct2(const s32 *Copy_Coefficients, u8 *Copy_Samples)
+{
+    s32 Local_Workspace[16];
+    const s32 *Local_Input;
+    s32 *Local_Work;
+    s32 Local_Tmp0, Local_Tmp10;
+    u8 Local_Index;
+
+    /**< Pass 1: columns; the even columns but 0 are not used by pass 2 */
+    for (Local_Index = 0; Local_Index < 8; Local_Index++)
+    {
+        if ((Local_Index == 2) || (Local_Index == 4) || (Local_Index == 6))
+        {
+            continue;
+        }
+        Local_Input = &Copy_Coefficients[Local_Index];
+        Local_Work = &Local_Workspace[Local_Index];
+
+        if ((Local_Input[8] == 0) && (Local_Input[24] == 0) && (Local_Input[40] == 0) && (Local_Input[56] == 0))
+        {
+            Local_Work[0] = Local_Work[8] = Local_Input[0] * ((s32)1 << JPEG_PASS1_BITS);
+            continue;
+        }
+
+        Local_Tmp10 = Local_Input[0] * ((s32)1 << (JPEG_CONST_BITS + 2));
+        Local_Tmp0 = -Local_Input[56] * JPEG_FIX_0_720959822 + Local_Input[40] * JPEG_FIX_0_850430095
+                     - Local_Input[24] * JPEG_FIX_1_272758580 + Local_Input[8] * JPEG_FIX_3_624509785;
+
+        Local_Work[0] = JPEG_DESCALE(Local_Tmp10 + Local_Tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS + 2);
+        Local_Work[8] = JPEG_DESCALE(Local_Tmp10 - Local_Tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS + 2);
+    }
+
+    /**< Pass 2: the 2 rows */
+    for (Local_Index = 0; Local_Index < 2; Local_Index++)
+    {
+        Local_Work = &Local_Workspace[8 * Local_Index];
+
+        if ((Local_Work[1] == 0) && (Local_Work[3] == 0) && (Local_Work[5] == 0) && (Local_Work[7] == 0))
+        {
+            Copy_Samples[2 * Local_Index] = JPEG_Clamp(JPEG_DESCALE(Local_Work[0], JPEG_PASS1_BITS + 3) + 128);
+            Copy_Samples[2 * Local_Index + 1] = Copy_Samples[2 * Local_Index];
+            continue;
+        }
+
+        Local_Tmp10 = Local_Work[0] * ((s32)1 << (JPEG_CONST_BITS + 2));
+        Local_Tmp0 = -Local_Work[7] * JPEG_FIX_0_720959822 + Local_Work[5] * JPEG_FIX_0_850430095
+                     - Local_Work[3] * JPEG_FIX_1_272758580 + Local_Work[1] * JPEG_FIX_3_624509785;
+
+        Copy_Samples[2 * Local_Index] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp10 + Local_Tmp0, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3 + 2) + 128);
+        Copy_Samples[2 * Local_Index + 1] = JPEG_Clamp(JPEG_DESCALE(Local_Tmp10 - Local_Tmp0, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3 + 2) + 128);
+    }
+}
+
+static u8 JPEG_Clamp(s32 Copy_Value)
+{
+    if (Copy_Value < 0)
+    {
+        return 0;
+    }
+    if (Copy_Value > 255)
+    {
+        return 255;
+    }
+    return (u8)Copy_Value;
+}
+
+static void JPEG_Restart(JPEG_t *Copy_Jpeg)
+{
+    u8 Local_Component;
+
+    /**< The rest of the byte is padding; the bit reader stopped on the marker */
+    Copy_Jpeg->Bits = 0;
+    Copy_Jpeg->BitCount = 0;
+    while (((Copy_Jpeg->Read + 1) < Copy_Jpeg->End) && (Copy_Jpeg->Read[0] == 0xFF) && (Copy_Jpeg->Read[1] == 0xFF))
+    {
+        Copy_Jpeg->Read++;
+    }
+    if (((Copy_Jpeg->Read + 1) < Copy_Jpeg->End) && (Copy_Jpeg->Read[0] == 0xFF) &&
+        (Copy_Jpeg->Read[1] >= JPEG_RST0) && (Copy_Jpeg->Read[1] <= JPEG_RST7))
+    {
+        Copy_Jpeg->Read += 2;
+    }
+
+    for (Local_Component = 0; Local_Component < Copy_Jpeg->Components; Local_Component++)
+    {
+        Copy_Jpeg->Component[Local_Component].Predictor = 0;
+    }
+}
+
+static void JPEG_ConvertMcu(const JPEG_t *Copy_Jpeg, u8 Copy_Scale, u16 *Copy_Pixels, u16 Copy_Stride)
+{
+    const u8 *Local_Cb = Copy_Jpeg->Samples[Copy_Jpeg->MaxHSampling * Copy_Jpeg->MaxVSampling];
+    const u8 *Local_Cr = Copy_Jpeg->Samples[Copy_Jpeg->MaxHSampling * Copy_Jpeg->MaxVSampling + 1];
+    u16 *Local_Pixel;
+    u8 Local_BlockShift = 3 - Copy_Scale;
+    u8 Local_BlockMask = (8 >> Copy_Scale) - 1;
+    u8 Local_HShift = Copy_Jpeg->MaxHSampling - 1;
+    u8 Local_VShift = Copy_Jpeg->MaxVSampling - 1;
+    u8 Local_Width = Copy_Jpeg->MaxHSampling << Local_BlockShift;
+    u8 Local_Height = Copy_Jpeg->MaxVSampling << Local_BlockShift;
+    s32 Local_RedOffset = 0;
+    s32 Local_GreenOffset = 0;
+    s32 Local_BlueOffset = 0;
+    s32 Local_Cb0;
+    s32 Local_Cr0;
+    u8 Local_Luma;
+    u8 Local_Chroma;
+    u8 Local_X;
+    u8 Local_Y;
+
+    for (Local_Y = 0; Local_Y < Local_Height; Local_Y++)
+    {
+        Local_Pixel = Copy_Pixels + (u16)(Local_Y * Copy_Stride);
+        for (Local_X = 0; Local_X < Local_Width; Local_X++)
+        {
+            Local_Luma = Copy_Jpeg->Samples[(Local_Y >> Local_BlockShift) * Copy_Jpeg->MaxHSampling + (Local_X >> Local_BlockShift)]
+                                           [((Local_Y & Local_BlockMask) << Local_BlockShift) + (Local_X & Local_BlockMask)];
+
+            if (Copy_Jpeg->Components == 1)
+            {
+                *Local_Pixel++ = (u16)(((Local_Luma & 0xF8) << 8) | ((Local_Luma & 0xFC) << 3) | (Local_Luma >> 3));
+                continue;
+            }
+
+            /**< Chroma terms once per chroma sample, replicated over the luma samples it covers */
+            if ((Local_X & Local_HShift) == 0)
+            {
+                Local_Chroma = ((Local_Y >> Local_VShift) << Local_BlockShift) + (Local_X >> Local_HShift);
+                Local_Cb0 = (s32)Local_Cb[Local_Chroma] - 128;
+                Local_Cr0 = (s32)Local_Cr[Local_Chroma] - 128;
+                Local_RedOffset = (JPEG_CR_R * Local_Cr0 + JPEG_ONE_HALF) >> 16;
+                Local_GreenOffset = (-JPEG_CB_G * Local_Cb0 - JPEG_CR_G * Local_Cr0 + JPEG_ONE_HALF) >> 16;
+                Local_BlueOffset = (JPEG_CB_B * Local_Cb0 + JPEG_ONE_HALF) >> 16;
+            }
+
+            *Local_Pixel++ = (u16)(((JPEG_Clamp(Local_Luma + Local_RedOffset) & 0xF8) << 8) |
+                                   ((JPEG_Clamp(Local_Luma + Local_GreenOffset) & 0xFC) << 3) |
+                                   (JPEG_Clamp(Local_Luma + Local_BlueOffset) >> 3));
+        }
+    }
+}
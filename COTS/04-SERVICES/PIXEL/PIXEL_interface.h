@@ -0,0 +1,111 @@
+/**
+ * @file PIXEL_interface.h
+ * @brief This file contains the public interface of the RGB565 pixel kernels.
+ *
+ * The kernels blend, fill gradients and convert colors on RGB565 pixel buffers, e.g. the band
+ * buffer of the band renderer before it is sent to the TFT display. They avoid unpacking the
+ * channels one by one:
+ * - a pixel is spread over a 32-bit word (green in the upper half, red and blue in the lower
+ *   half) so the three channels are scaled by one multiplication;
+ * - gradients step red and blue together, in the two halves of one 32-bit accumulator;
+ * - spans are read and written two pixels per 32-bit access when they are word aligned.
+ *
+ * Alpha values are 0 (background only) to 255 (foreground only). They are reduced to 33
+ * levels (0..32) internally, so a channel can differ by up to two steps from exact 8-bit
+ * arithmetic.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note The 32-bit accesses assume a little-endian CPU (the Cortex-M3 is).
+ *
+ * @note Example Usage:
+ * @code
+ * static u16 band[128 * 16];
+ *
+ * PIXEL_GradientSpan(band, 128, TFT_COLOR_BLUE, TFT_COLOR_BLACK);     /// one gradient line
+ * PIXEL_BlendColor(&band[128], TFT_COLOR_WHITE, 128, 64);              /// 25 % white veil
+ * PIXEL_BlendSpan(&band[256], icon, 32, 128);                          /// half transparent icon
+ * @endcode
+ */
+
+#ifndef __PIXEL_INTERFACE_H__
+#define __PIXEL_INTERFACE_H__
+
+/**
+ * @brief Blends two colors.
+ *
+ * @param[in] Copy_Background The background color (RGB565).
+ * @param[in] Copy_Foreground The foreground color (RGB565).
+ * @param[in] Copy_Alpha      Opacity of the foreground, 0 to 255.
+ *
+ * @return The blended color (RGB565).
+ */
+u16 PIXEL_Blend(u16 Copy_Background, u16 Copy_Foreground, u8 Copy_Alpha);
+
+/**
+ * @brief Blends a span of pixels over another one with a constant opacity.
+ *
+ * Copy_Destination[i] = blend(Copy_Destination[i], Copy_Source[i], Copy_Alpha).
+ *
+ * @param[in,out] Copy_Destination The background pixels, replaced by the result.
+ * @param[in]     Copy_Source      The foreground pixels.
+ * @param[in]     Copy_Count       The number of pixels.
+ * @param[in]     Copy_Alpha       Opacity of the foreground, 0 to 255.
+ */
+void PIXEL_BlendSpan(u16 *Copy_Destination, const u16 *Copy_Source, u32 Copy_Count, u8 Copy_Alpha);
+
+/**
+ * @brief Blends a span of pixels over another one with one opacity per pixel.
+ *
+ * Copy_Destination[i] = blend(Copy_Destination[i], Copy_Source[i], Copy_Alphas[i]), e.g. for
+ * an anti-aliased sprite with an 8-bit alpha mask.
+ *
+ * @param[in,out] Copy_Destination The background pixels, replaced by the result.
+ * @param[in]     Copy_Source      The foreground pixels.
+ * @param[in]     Copy_Alphas      The opacity of every foreground pixel, 0 to 255.
+ * @param[in]     Copy_Count       The number of pixels.
+ */
+void PIXEL_BlendSpanAlpha(u16 *Copy_Destination, const u16 *Copy_Source, const u8 *Copy_Alphas, u32 Copy_Count);
+
+/**
+ * @brief Blends one color over a span of pixels with a constant opacity.
+ *
+ * The color term is computed once, so every pixel costs one multiplication (tints, veils,
+ * shadows).
+ *
+ * @param[in,out] Copy_Destination The background pixels, replaced by the result.
+ * @param[in]     Copy_Color       The color blended over them (RGB565).
+ * @param[in]     Copy_Count       The number of pixels.
+ * @param[in]     Copy_Alpha       Opacity of the color, 0 to 255.
+ */
+void PIXEL_BlendColor(u16 *Copy_Destination, u16 Copy_Color, u32 Copy_Count, u8 Copy_Alpha);
+
+/**
+ * @brief Fills a span with a linear gradient.
+ *
+ * The first pixel is Copy_StartColor and the last one Copy_EndColor; each channel is
+ * interpolated in fixed point and rounded to the nearest value.
+ *
+ * @param[out] Copy_Destination The pixels to fill.
+ * @param[in]  Copy_Count       The number of pixels.
+ * @param[in]  Copy_StartColor  The color of the first pixel (RGB565).
+ * @param[in]  Copy_EndColor    The color of the last pixel (RGB565).
+ */
+void PIXEL_GradientSpan(u16 *Copy_Destination, u32 Copy_Count, u16 Copy_StartColor, u16 Copy_EndColor);
+
+/**
+ * @brief Converts RGB888 pixels to RGB565.
+ *
+ * The source holds 3 bytes per pixel in R, G, B order (e.g. decoded image rows). Each
+ * channel keeps its top bits. Four pixels are converted from three 32-bit words when the
+ * source and the destination are word aligned.
+ *
+ * @param[out] Copy_Destination The RGB565 pixels.
+ * @param[in]  Copy_Source      The RGB888 pixels, 3 * Copy_Count bytes.
+ * @param[in]  Copy_Count       The number of pixels.
+ */
+void PIXEL_ConvertRgb888(u16 *Copy_Destination, const u8 *Copy_Source, u32 Copy_Count);
+
+#endif /**< __PIXEL_INTERFACE_H__ */
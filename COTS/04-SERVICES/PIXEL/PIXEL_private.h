@@ -0,0 +1,85 @@
+/**
+ * @file PIXEL_private.h
+ * @brief This file contains the private interface of the RGB565 pixel kernels.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __PIXEL_PRIVATE_H__
+#define __PIXEL_PRIVATE_H__
+
+/**
+ * @brief Channels of a spread pixel: green in bits 21..26, red in bits 11..15, blue in bits 0..4.
+ *
+ * The free bits above every channel hold the product of the channel by an alpha of up to 32.
+ */
+#define PIXEL_SPREAD_MASK           0x07E0F81FUL
+
+/**
+ * @brief Spreads an RGB565 pixel over a 32-bit word.
+ */
+#define PIXEL_SPREAD(Color)         ((((u32)(Color)) | ((u32)(Color) << 16)) & PIXEL_SPREAD_MASK)
+
+/**
+ * @brief Packs a spread pixel back to RGB565.
+ */
+#define PIXEL_PACK(Spread)          ((u16)((Spread) | ((Spread) >> 16)))
+
+/**
+ * @brief Blends two spread pixels with an alpha of 0..32.
+ *
+ * Equal to (Foreground * Alpha + Background * (32 - Alpha)) / 32 for every channel, rounded
+ * down; the borrows of the subtraction stay in the free bits and are masked out.
+ */
+#define PIXEL_BLEND_SPREAD(Background, Foreground, Alpha) \
+    (((((((Foreground) - (Background)) * (Alpha)) >> 5) + (Background))) & PIXEL_SPREAD_MASK)
+
+/**
+ * @brief Reduces an alpha of 0..255 to 0..32.
+ */
+#define PIXEL_ALPHA_LEVEL(Alpha)    (((u32)(Alpha) + 4) >> 3)
+
+/**
+ * @brief True when a pointer is aligned on a 32-bit word.
+ */
+#define PIXEL_IS_WORD_ALIGNED(Pointer)  ((((uintptr_t)(Pointer)) & 0x03) == 0)
+
+/**
+ * @brief 32-bit word of the two-pixel paths.
+ *
+ * The spans are u16 and u8 buffers: words are read and written through this type, which may
+ * alias any object, so the compiler keeps them ordered with the pixel accesses around them.
+ */
+typedef u32 __attribute__((__may_alias__)) PIXEL_Word_t;
+
+/**
+ * @brief Fixed-point gradient lanes: red and blue are 5.11 values in the upper and lower
+ * halves of one accumulator, green is a 6.16 value in its own.
+ */
+#define PIXEL_RB_FRACTION_BITS      11
+#define PIXEL_G_FRACTION_BITS       16
+
+/**
+ * @brief Divides a signed channel difference, rounded to the nearest.
+ *
+ * @param[in] Copy_Difference The difference, in fixed point.
+ * @param[in] Copy_Steps      The number of steps, positive.
+ *
+ * @return The step per pixel.
+ */
+static s32 PIXEL_DivideRounded(s32 Copy_Difference, s32 Copy_Steps);
+
+/**
+ * @brief Converts one RGB888 pixel to RGB565.
+ *
+ * @param[in] Copy_Source The pixel, 3 bytes in R, G, B order.
+ *
+ * @return The pixel in RGB565.
+ */
+static u16 PIXEL_ConvertPixel(const u8 *Copy_Source);
+
+#endif /**< __PIXEL_PRIVATE_H__ */
@@ -0,0 +1,278 @@
+/**
+ * @file PIXEL_program.c
+ * @brief This file contains the implementation of the RGB565 pixel kernels.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#include <stdint.h>
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< SERVICES */
+#include "PIXEL_interface.h"
+#include "PIXEL_private.h"
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u16 PIXEL_Blend(u16 Copy_Background, u16 Copy_Foreground, u8 Copy_Alpha)
+{
+    u32 Local_Result = PIXEL_BLEND_SPREAD(PIXEL_SPREAD(Copy_Background), PIXEL_SPREAD(Copy_Foreground), PIXEL_ALPHA_LEVEL(Copy_Alpha));
+
+    return PIXEL_PACK(Local_Result);
+}
+
+void PIXEL_BlendSpan(u16 *Copy_Destination, const u16 *Copy_Source, u32 Copy_Count, u8 Copy_Alpha)
+{
+    u32 Local_Alpha = PIXEL_ALPHA_LEVEL(Copy_Alpha);
+    PIXEL_Word_t *Local_Destination;
+    const PIXEL_Word_t *Local_Source;
+    u32 Local_Background;
+    u32 Local_Foreground;
+    u32 Local_Low;
+    u32 Local_High;
+    u32 Local_Pairs;
+
+    if ((Copy_Destination == NULL) || (Copy_Source == NULL) || (Local_Alpha == 0))
+    {
+        return;
+    }
+
+    if (Local_Alpha == 32)
+    {
+        /**< Opaque: plain copy */
+        while (Copy_Count-- > 0)
+        {
+            *Copy_Destination++ = *Copy_Source++;
+        }
+        return;
+    }
+
+    /**< One pixel first when it brings the destination to a word boundary */
+    if ((Copy_Count > 0) && !PIXEL_IS_WORD_ALIGNED(Copy_Destination))
+    {
+        *Copy_Destination = PIXEL_PACK(PIXEL_BLEND_SPREAD(PIXEL_SPREAD(*Copy_Destination), PIXEL_SPREAD(*Copy_Source), Local_Alpha));
+        Copy_Destination++;
+        Copy_Source++;
+        Copy_Count--;
+    }
+
+    /**< Two pixels per 32-bit load and store when the source is aligned too */
+    if (PIXEL_IS_WORD_ALIGNED(Copy_Source))
+    {
+        Local_Destination = (PIXEL_Word_t *)Copy_Destination;
+        Local_Source = (const PIXEL_Word_t *)Copy_Source;
+        for (Local_Pairs = Copy_Count >> 1; Local_Pairs > 0; Local_Pairs--)
+        {
+            Local_Background = *Local_Destination;
+            Local_Foreground = *Local_Source++;
+            Local_Low = PIXEL_BLEND_SPREAD(PIXEL_SPREAD(Local_Background & 0xFFFF), PIXEL_SPREAD(Local_Foreground & 0xFFFF), Local_Alpha);
+            Local_High = PIXEL_BLEND_SPREAD(PIXEL_SPREAD(Local_Background >> 16), PIXEL_SPREAD(Local_Foreground >> 16), Local_Alpha);
+            *Local_Destination++ = PIXEL_PACK(Local_Low) | ((u32)PIXEL_PACK(Local_High) << 16);
+        }
+        Copy_Destination = (u16 *)Local_Destination;
+        Copy_Source = (const u16 *)Local_Source;
+        Copy_Count &= 1;
+    }
+
+    /**< The rest one by one */
+    while (Copy_Count-- > 0)
+    {
+        *Copy_Destination = PIXEL_PACK(PIXEL_BLEND_SPREAD(PIXEL_SPREAD(*Copy_Destination), PIXEL_SPREAD(*Copy_Source), Local_Alpha));
+        Copy_Destination++;
+        Copy_Source++;
+    }
+}
+
+void PIXEL_BlendSpanAlpha(u16 *Copy_Destination, const u16 *Copy_Source, const u8 *Copy_Alphas, u32 Copy_Count)
+{
+    u32 Local_Alpha;
+
+    if ((Copy_Destination == NULL) || (Copy_Source == NULL) || (Copy_Alphas == NULL))
+    {
+        return;
+    }
+
+    while (Copy_Count-- > 0)
+    {
+        /**< Masks are mostly fully transparent or opaque: skip the multiplication for them */
+        Local_Alpha = PIXEL_ALPHA_LEVEL(*Copy_Alphas++);
+        if (Local_Alpha == 32)
+        {
+            *Copy_Destination = *Copy_Source;
+        }
+        else if (Local_Alpha != 0)
+        {
+            *Copy_Destination = PIXEL_PACK(PIXEL_BLEND_SPREAD(PIXEL_SPREAD(*Copy_Destination), PIXEL_SPREAD(*Copy_Source), Local_Alpha));
+        }
+        Copy_Destination++;
+        Copy_Source++;
+    }
+}
+
+void PIXEL_BlendColor(u16 *Copy_Destination, u16 Copy_Color, u32 Copy_Count, u8 Copy_Alpha)
+{
+    u32 Local_Alpha = PIXEL_ALPHA_LEVEL(Copy_Alpha);
+    u32 Local_ColorTerm;
+    u32 Local_Weight;
+    PIXEL_Word_t *Local_Destination;
+    u32 Local_Pair;
+    u32 Local_Low;
+    u32 Local_High;
+    u32 Local_Pairs;
+
+    if ((Copy_Destination == NULL) || (Local_Alpha == 0))
+    {
+        return;
+    }
+
+    /**< Color * Alpha once, every pixel is then Background * (32 - Alpha) + ColorTerm */
+    Local_ColorTerm = PIXEL_SPREAD(Copy_Color) * Local_Alpha;
+    Local_Weight = 32 - Local_Alpha;
+
+    if ((Copy_Count > 0) && !PIXEL_IS_WORD_ALIGNED(Copy_Destination))
+    {
+        *Copy_Destination = PIXEL_PACK(((PIXEL_SPREAD(*Copy_Destination) * Local_Weight + Local_ColorTerm) >> 5) & PIXEL_SPREAD_MASK);
+        Copy_Destination++;
+        Copy_Count--;
+    }
+
+    /**< Two pixels per 32-bit load and store */
+    Local_Destination = (PIXEL_Word_t *)Copy_Destination;
+    for (Local_Pairs = Copy_Count >> 1; Local_Pairs > 0; Local_Pairs--)
+    {
+        Local_Pair = *Local_Destination;
+        Local_Low = ((PIXEL_SPREAD(Local_Pair & 0xFFFF) * Local_Weight + Local_ColorTerm) >> 5) & PIXEL_SPREAD_MASK;
+        Local_High = ((PIXEL_SPREAD(Local_Pair >> 16) * Local_Weight + Local_ColorTerm) >> 5) & PIXEL_SPREAD_MASK;
+        *Local_Destination++ = PIXEL_PACK(Local_Low) | ((u32)PIXEL_PACK(Local_High) << 16);
+    }
+    Copy_Destination = (u16 *)Local_Destination;
+
+    if (Copy_Count & 1)
+    {
+        *Copy_Destination = PIXEL_PACK(((PIXEL_SPREAD(*Copy_Destination) * Local_Weight + Local_ColorTerm) >> 5) & PIXEL_SPREAD_MASK);
+    }
+}
+
+void PIXEL_GradientSpan(u16 *Copy_Destination, u32 Copy_Count, u16 Copy_StartColor, u16 Copy_EndColor)
+{
+    u32 Local_RedBlue;
+    u32 Local_RedBlueStep;
+    u32 Local_Green;
+    u32 Local_GreenStep;
+    s32 Local_Steps;
+    s32 Local_RedStep;
+    s32 Local_BlueStep;
+    u16 Local_First;
+    u16 Local_Second;
+    PIXEL_Word_t *Local_Destination;
+    u32 Local_Pairs;
+
+    if ((Copy_Destination == NULL) || (Copy_Count == 0))
+    {
+        return;
+    }
+
+    /**< Red and blue share one accumulator, each lane rounded by half a step */
+    Local_RedBlue = ((u32)(Copy_StartColor >> 11) << (16 + PIXEL_RB_FRACTION_BITS)) | ((u32)(Copy_StartColor & 0x1F) << PIXEL_RB_FRACTION_BITS);
+    Local_RedBlue += (1UL << (16 + PIXEL_RB_FRACTION_BITS - 1)) | (1UL << (PIXEL_RB_FRACTION_BITS - 1));
+    Local_Green = ((u32)((Copy_StartColor >> 5) & 0x3F) << PIXEL_G_FRACTION_BITS) + (1UL << (PIXEL_G_FRACTION_BITS - 1));
+
+    Local_RedBlueStep = 0;
+    Local_GreenStep = 0;
+    if (Copy_Count > 1)
+    {
+        /**< Signed step of every channel per pixel */
+        Local_Steps = (s32)(Copy_Count - 1);
+        Local_RedStep = PIXEL_DivideRounded(((s32)(Copy_EndColor >> 11) - (s32)(Copy_StartColor >> 11)) * (1L << PIXEL_RB_FRACTION_BITS), Local_Steps);
+        Local_BlueStep = PIXEL_DivideRounded(((s32)(Copy_EndColor & 0x1F) - (s32)(Copy_StartColor & 0x1F)) * (1L << PIXEL_RB_FRACTION_BITS), Local_Steps);
+        Local_GreenStep = (u32)PIXEL_DivideRounded(((s32)((Copy_EndColor >> 5) & 0x3F) - (s32)((Copy_StartColor >> 5) & 0x3F)) * (1L << PIXEL_G_FRACTION_BITS), Local_Steps);
+
+        /**< Both lanes in one step, modulo 2^32: exact as no lane leaves 0..0xFFFF between the end colors */
+        Local_RedBlueStep = ((u32)Local_RedStep << 16) + (u32)Local_BlueStep;
+    }
+
+    if (!PIXEL_IS_WORD_ALIGNED(Copy_Destination))
+    {
+        *Copy_Destination++ = (u16)(((Local_RedBlue >> 16) & 0xF800) | ((Local_Green >> (PIXEL_G_FRACTION_BITS - 5)) & 0x07E0) | ((Local_RedBlue >> PIXEL_RB_FRACTION_BITS) & 0x001F));
+        Local_RedBlue += Local_RedBlueStep;
+        Local_Green += Local_GreenStep;
+        Copy_Count--;
+    }
+
+    /**< Two pixels per 32-bit store */
+    Local_Destination = (PIXEL_Word_t *)Copy_Destination;
+    for (Local_Pairs = Copy_Count >> 1; Local_Pairs > 0; Local_Pairs--)
+    {
+        Local_First = (u16)(((Local_RedBlue >> 16) & 0xF800) | ((Local_Green >> (PIXEL_G_FRACTION_BITS - 5)) & 0x07E0) | ((Local_RedBlue >> PIXEL_RB_FRACTION_BITS) & 0x001F));
+        Local_RedBlue += Local_RedBlueStep;
+        Local_Green += Local_GreenStep;
+        Local_Second = (u16)(((Local_RedBlue >> 16) & 0xF800) | ((Local_Green >> (PIXEL_G_FRACTION_BITS - 5)) & 0x07E0) | ((Local_RedBlue >> PIXEL_RB_FRACTION_BITS) & 0x001F));
+        Local_RedBlue += Local_RedBlueStep;
+        Local_Green += Local_GreenStep;
+        *Local_Destination++ = Local_First | ((u32)Local_Second << 16);
+    }
+    Copy_Destination = (u16 *)Local_Destination;
+
+    if (Copy_Count & 1)
+    {
+        *Copy_Destination = (u16)(((Local_RedBlue >> 16) & 0xF800) | ((Local_Green >> (PIXEL_G_FRACTION_BITS - 5)) & 0x07E0) | ((Local_RedBlue >> PIXEL_RB_FRACTION_BITS) & 0x001F));
+    }
+}
+
+void PIXEL_ConvertRgb888(u16 *Copy_Destination, const u8 *Copy_Source, u32 Copy_Count)
+{
+    const PIXEL_Word_t *Local_Source;
+    PIXEL_Word_t *Local_Destination;
+    u32 Local_Word0;
+    u32 Local_Word1;
+    u32 Local_Word2;
+    u32 Local_Groups;
+
+    if ((Copy_Destination == NULL) || (Copy_Source == NULL))
+    {
+        return;
+    }
+
+    if (PIXEL_IS_WORD_ALIGNED(Copy_Source) && PIXEL_IS_WORD_ALIGNED(Copy_Destination))
+    {
+        /**< Four pixels from three words: R0G0B0R1 G1B1R2G2 B2R3G3B3 (first byte lowest) */
+        Local_Source = (const PIXEL_Word_t *)Copy_Source;
+        Local_Destination = (PIXEL_Word_t *)Copy_Destination;
+        for (Local_Groups = Copy_Count >> 2; Local_Groups > 0; Local_Groups--)
+        {
+            Local_Word0 = *Local_Source++;
+            Local_Word1 = *Local_Source++;
+            Local_Word2 = *Local_Source++;
+            *Local_Destination++ = ((Local_Word0 << 8) & 0xF800) | ((Local_Word0 >> 5) & 0x07E0) | ((Local_Word0 >> 19) & 0x001F) |
+                                   (((Local_Word0 >> 16) & 0xF800) | ((Local_Word1 << 3) & 0x07E0) | ((Local_Word1 >> 11) & 0x001F)) << 16;
+            *Local_Destination++ = ((Local_Word1 >> 8) & 0xF800) | ((Local_Word1 >> 21) & 0x07E0) | ((Local_Word2 >> 3) & 0x001F) |
+                                   ((Local_Word2 & 0xF800) | ((Local_Word2 >> 13) & 0x07E0) | ((Local_Word2 >> 27) & 0x001F)) << 16;
+        }
+        Copy_Source = (const u8 *)Local_Source;
+        Copy_Destination = (u16 *)Local_Destination;
+        Copy_Count &= 3;
+    }
+
+    while (Copy_Count-- > 0)
+    {
+        *Copy_Destination++ = PIXEL_ConvertPixel(Copy_Source);
+        Copy_Source += 3;
+    }
+}
+
+static s32 PIXEL_DivideRounded(s32 Copy_Difference, s32 Copy_Steps)
+{
+    if (Copy_Difference < 0)
+    {
+        return -((-Copy_Difference + (Copy_Steps / 2)) / Copy_Steps);
+    }
+
+    return (Copy_Difference + (Copy_Steps / 2)) / Copy_Steps;
+}
+
+static u16 PIXEL_ConvertPixel(const u8 *Copy_Source)
+{
+    /**< Keep the top bits of every channel */
+    return (u16)(((u16)(Copy_Source[0] & 0xF8) << 8) | ((u16)(Copy_Source[1] & 0xFC) << 3) | (Copy_Source[2] >> 3));
+}
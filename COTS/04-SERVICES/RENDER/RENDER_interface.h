@@ -0,0 +1,177 @@
+/**
+ * @file RENDER_interface.h
+ * @brief This file contains the public interface of the band renderer.
+ *
+ * The band renderer composes a screen without a frame buffer. Draw calls are recorded into a
+ * display list; the screen (or a part of it) is then rasterized band by band into a small
+ * caller-provided buffer, and each band is sent to the TFT display as one window and one burst.
+ * Overlapping commands are composed in the buffer in list order, so every pixel is sent once.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Include SPI_interface.h and TFT_interface.h before this file.
+ *
+ * @note Example Usage:
+ * @code
+ * static RENDER_Cmd_t cmds[16];
+ * static u16 band[128 * 16];       /// 16 lines of the 128x160 ST7735S, 4 KB
+ * static RENDER_List_t list;
+ *
+ * RENDER_Init(&list, cmds, 16);
+ * RENDER_FillRect(&list, 10, 10, 100, 40, TFT_COLOR_BLUE);
+ * RENDER_Image(&list, 30, 20, 32, 32, icon);
+ * RENDER_Draw(&list, &tftConfig, spi, band, 128 * 16, TFT_COLOR_BLACK);
+ * @endcode
+ */
+
+#ifndef __RENDER_INTERFACE_H__
+#define __RENDER_INTERFACE_H__
+
+/**
+ * @brief Types of display list commands.
+ */
+typedef enum
+{
+    RENDER_FILL_RECT,   /**< Rectangle filled with one color. */
+    RENDER_IMAGE,       /**< RGB565 image, Width * Height pixels row by row. */
+    RENDER_CUSTOM       /**< Drawn by a caller-provided rasterizer. */
+} RENDER_CmdType_t;
+
+typedef struct RENDER_Cmd RENDER_Cmd_t;
+
+/**
+ * @brief Rasterizer of a @ref RENDER_CUSTOM command.
+ *
+ * Called for every band that intersects the command's bounding box. It must only write the
+ * band pixels inside both the band and the bounding box. Pixel (x, y) of the screen is
+ * Copy_Band[(y - Copy_BandY) * Copy_BandWidth + (x - Copy_BandX)].
+ */
+typedef void (*RENDER_Rasterizer_t)(const RENDER_Cmd_t *Copy_Cmd, u16 *Copy_Band, u16 Copy_BandX, u16 Copy_BandY, u16 Copy_BandWidth, u16 Copy_BandHeight);
+
+/**
+ * @brief One display list command.
+ */
+struct RENDER_Cmd {
+    RENDER_CmdType_t Type;          /**< Command type. */
+    s16 X;                          /**< X-coordinate of the bounding box (may be off screen). */
+    s16 Y;                          /**< Y-coordinate of the bounding box (may be off screen). */
+    u16 Width;                      /**< Width of the bounding box in pixels. */
+    u16 Height;                     /**< Height of the bounding box in pixels. */
+    u16 Color;                      /**< Fill color (RENDER_FILL_RECT). */
+    const void *Data;               /**< Pixels (RENDER_IMAGE) or rasterizer context (RENDER_CUSTOM). */
+    RENDER_Rasterizer_t Rasterizer; /**< Rasterizer (RENDER_CUSTOM). */
+};
+
+/**
+ * @brief A display list.
+ *
+ * The command storage is provided by the caller through @ref RENDER_Init.
+ */
+typedef struct {
+    RENDER_Cmd_t *Cmds;     /**< Storage for the commands. */
+    u8 Capacity;            /**< Number of commands the storage can hold. */
+    u8 Count;               /**< Number of recorded commands. */
+} RENDER_List_t;
+
+/**
+ * @brief Initializes an empty display list.
+ *
+ * @param[out] Copy_List    The display list.
+ * @param[in] Copy_Cmds     Storage for Copy_Capacity commands.
+ * @param[in] Copy_Capacity Number of commands in Copy_Cmds.
+ *
+ * @retval 0 The list was initialized.
+ * @retval 1 Copy_List or Copy_Cmds is NULL, or Copy_Capacity is 0.
+ */
+u8 RENDER_Init(RENDER_List_t *Copy_List, RENDER_Cmd_t *Copy_Cmds, u8 Copy_Capacity);
+
+/**
+ * @brief Removes all the commands of a display list.
+ *
+ * @param[in,out] Copy_List The display list.
+ *
+ * @retval None
+ */
+void RENDER_Clear(RENDER_List_t *Copy_List);
+
+/**
+ * @brief Records a filled rectangle.
+ *
+ * @param[in,out] Copy_List The display list.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The width in pixels.
+ * @param[in] Copy_Height The height in pixels.
+ * @param[in] Copy_Color The fill color in RGB565.
+ *
+ * @retval 0 The command was recorded.
+ * @retval 1 The display list is full.
+ */
+u8 RENDER_FillRect(RENDER_List_t *Copy_List, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color);
+
+/**
+ * @brief Records an image.
+ *
+ * @param[in,out] Copy_List The display list.
+ * @param[in] Copy_XPosition The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width The width in pixels.
+ * @param[in] Copy_Height The height in pixels.
+ * @param[in] Copy_Pixels Width * Height pixels in RGB565, row by row. Must stay valid until drawn.
+ *
+ * @retval 0 The command was recorded.
+ * @retval 1 The display list is full or Copy_Pixels is NULL.
+ */
+u8 RENDER_Image(RENDER_List_t *Copy_List, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Pixels);
+
+/**
+ * @brief Records a command drawn by a custom rasterizer (text, shapes, ...).
+ *
+ * @param[in,out] Copy_List The display list.
+ * @param[in] Copy_XPosition The X-coordinate of the bounding box.
+ * @param[in] Copy_YPosition The Y-coordinate of the bounding box.
+ * @param[in] Copy_Width The width of the bounding box in pixels.
+ * @param[in] Copy_Height The height of the bounding box in pixels.
+ * @param[in] Copy_Rasterizer The rasterizer, see @ref RENDER_Rasterizer_t.
+ * @param[in] Copy_Context Passed to the rasterizer in the command's Data field.
+ *
+ * @retval 0 The command was recorded.
+ * @retval 1 The display list is full or Copy_Rasterizer is NULL.
+ */
+u8 RENDER_Custom(RENDER_List_t *Copy_List, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, RENDER_Rasterizer_t Copy_Rasterizer, const void *Copy_Context);
+
+/**
+ * @brief Renders a rectangle of the screen band by band.
+ *
+ * The band height is the number of full rows of the area that fit in the buffer. Each band
+ * is cleared to the background color, every command that intersects it is drawn in list
+ * order, and the band is sent with @ref TFT_BurstWritePixels.
+ *
+ * @param[in] Copy_List The display list.
+ * @param[in] Copy_TftDisplay Pointer to the TFT display configuration structure.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral to be used for communication.
+ * @param[in] Copy_Buffer The band buffer.
+ * @param[in] Copy_BufferPixels Size of the band buffer in pixels (at least Copy_Width).
+ * @param[in] Copy_Background The background color in RGB565.
+ * @param[in] Copy_XPosition The X-coordinate of the area.
+ * @param[in] Copy_YPosition The Y-coordinate of the area.
+ * @param[in] Copy_Width The width of the area in pixels.
+ * @param[in] Copy_Height The height of the area in pixels.
+ *
+ * @retval 0 The area was rendered.
+ * @retval 1 The buffer cannot hold one row of the area.
+ */
+u8 RENDER_DrawRegion(const RENDER_List_t *Copy_List, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 *Copy_Buffer, u32 Copy_BufferPixels,
+                     u16 Copy_Background, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height);
+
+/**
+ * @brief Renders the whole screen band by band, see @ref RENDER_DrawRegion.
+ *
+ * @retval 0 The screen was rendered.
+ * @retval 1 The buffer cannot hold one row of the screen.
+ */
+u8 RENDER_Draw(const RENDER_List_t *Copy_List, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 *Copy_Buffer, u32 Copy_BufferPixels, u16 Copy_Background);
+
+#endif /**< __RENDER_INTERFACE_H__ */
@@ -0,0 +1,40 @@
+/**
+ * @file RENDER_private.h
+ * @brief This file contains the private interface of the band renderer.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __RENDER_PRIVATE_H__
+#define __RENDER_PRIVATE_H__
+
+/**
+ * @brief Appends a command to a display list.
+ *
+ * @param[in,out] Copy_List The display list.
+ * @param[in] Copy_Cmd The command to copy into the list.
+ *
+ * @retval 0 The command was recorded.
+ * @retval 1 The display list is full.
+ */
+static u8 RENDER_AddCmd(RENDER_List_t *Copy_List, const RENDER_Cmd_t *Copy_Cmd);
+
+/**
+ * @brief Draws one command into a band buffer.
+ *
+ * @param[in] Copy_Cmd The command.
+ * @param[out] Copy_Band The band buffer.
+ * @param[in] Copy_BandX The screen X-coordinate of the band's first column.
+ * @param[in] Copy_BandY The screen Y-coordinate of the band's first row.
+ * @param[in] Copy_BandWidth The band width in pixels.
+ * @param[in] Copy_BandHeight The band height in pixels.
+ *
+ * @retval None
+ */
+static void RENDER_DrawCmd(const RENDER_Cmd_t *Copy_Cmd, u16 *Copy_Band, u16 Copy_BandX, u16 Copy_BandY, u16 Copy_BandWidth, u16 Copy_BandHeight);
+
+#endif /**< __RENDER_PRIVATE_H__ */
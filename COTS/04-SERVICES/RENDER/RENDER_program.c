@@ -0,0 +1,202 @@
+/**
+ * @file RENDER_program.c
+ * @brief This file contains the implementation of the band renderer.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "RENDER_interface.h"
+#include "RENDER_private.h"
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u8 RENDER_Init(RENDER_List_t *Copy_List, RENDER_Cmd_t *Copy_Cmds, u8 Copy_Capacity)
+{
+    u8 Local_u8ErrorStatus = 0;
+
+    if ((Copy_List != NULL) && (Copy_Cmds != NULL) && (Copy_Capacity > 0))
+    {
+        Copy_List->Cmds = Copy_Cmds;
+        Copy_List->Capacity = Copy_Capacity;
+        Copy_List->Count = 0;
+    }
+    else
+    {
+        Local_u8ErrorStatus = 1;
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+void RENDER_Clear(RENDER_List_t *Copy_List)
+{
+    Copy_List->Count = 0;
+}
+
+u8 RENDER_FillRect(RENDER_List_t *Copy_List, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color)
+{
+    RENDER_Cmd_t Local_Cmd = {RENDER_FILL_RECT, Copy_XPosition, Copy_YPosition, Copy_Width, Copy_Height, Copy_Color, NULL, NULL};
+
+    return RENDER_AddCmd(Copy_List, &Local_Cmd);
+}
+
+u8 RENDER_Image(RENDER_List_t *Copy_List, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const u16 *Copy_Pixels)
+{
+    RENDER_Cmd_t Local_Cmd = {RENDER_IMAGE, Copy_XPosition, Copy_YPosition, Copy_Width, Copy_Height, 0, Copy_Pixels, NULL};
+    u8 Local_u8ErrorStatus = 1;
+
+    if (Copy_Pixels != NULL)
+    {
+        Local_u8ErrorStatus = RENDER_AddCmd(Copy_List, &Local_Cmd);
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+u8 RENDER_Custom(RENDER_List_t *Copy_List, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, RENDER_Rasterizer_t Copy_Rasterizer, const void *Copy_Context)
+{
+    RENDER_Cmd_t Local_Cmd = {RENDER_CUSTOM, Copy_XPosition, Copy_YPosition, Copy_Width, Copy_Height, 0, Copy_Context, Copy_Rasterizer};
+    u8 Local_u8ErrorStatus = 1;
+
+    if (Copy_Rasterizer != NULL)
+    {
+        Local_u8ErrorStatus = RENDER_AddCmd(Copy_List, &Local_Cmd);
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+u8 RENDER_DrawRegion(const RENDER_List_t *Copy_List, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 *Copy_Buffer, u32 Copy_BufferPixels,
+                     u16 Copy_Background, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height)
+{
+    u16 Local_BandRows;
+    u16 Local_BandY;
+    u16 Local_BandHeight;
+    u32 Local_Pixel;
+    u32 Local_BandPixels;
+    u8 Local_Index;
+    u8 Local_u8ErrorStatus = 0;
+
+    if ((Copy_Buffer == NULL) || (Copy_Width == 0) || (Copy_BufferPixels < Copy_Width))
+    {
+        Local_u8ErrorStatus = 1;
+    }
+    else
+    {
+        /**< As many full rows as the buffer holds */
+        Local_BandRows = ((Copy_BufferPixels / Copy_Width) > Copy_Height) ? Copy_Height : (u16)(Copy_BufferPixels / Copy_Width);
+
+        for (Local_BandY = Copy_YPosition; Local_BandY < (u32)Copy_YPosition + Copy_Height; Local_BandY += Local_BandHeight)
+        {
+            Local_BandHeight = (((u32)Copy_YPosition + Copy_Height - Local_BandY) < Local_BandRows) ?
+                               (u16)(Copy_YPosition + Copy_Height - Local_BandY) : Local_BandRows;
+            Local_BandPixels = (u32)Copy_Width * Local_BandHeight;
+
+            /**< Start from the background */
+            for (Local_Pixel = 0; Local_Pixel < Local_BandPixels; Local_Pixel++)
+            {
+                Copy_Buffer[Local_Pixel] = Copy_Background;
+            }
+
+            /**< Compose the commands in list order (later commands are on top) */
+            for (Local_Index = 0; Local_Index < Copy_List->Count; Local_Index++)
+            {
+                RENDER_DrawCmd(&Copy_List->Cmds[Local_Index], Copy_Buffer, Copy_XPosition, Local_BandY, Copy_Width, Local_BandHeight);
+            }
+
+            /**< One window, one burst per band */
+            TFT_BurstWritePixels(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Local_BandY, Copy_Width, Local_BandHeight, Copy_Buffer);
+        }
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+u8 RENDER_Draw(const RENDER_List_t *Copy_List, const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 *Copy_Buffer, u32 Copy_BufferPixels, u16 Copy_Background)
+{
+    return RENDER_DrawRegion(Copy_List, Copy_TftDisplay, Copy_SpiPeripheral, Copy_Buffer, Copy_BufferPixels, Copy_Background,
+                             0, 0, Copy_TftDisplay->TFT_Controller->TFT_Width, Copy_TftDisplay->TFT_Controller->TFT_Height);
+}
+
+static u8 RENDER_AddCmd(RENDER_List_t *Copy_List, const RENDER_Cmd_t *Copy_Cmd)
+{
+    u8 Local_u8ErrorStatus = 0;
+
+    if (Copy_List->Count < Copy_List->Capacity)
+    {
+        Copy_List->Cmds[Copy_List->Count] = *Copy_Cmd;
+        Copy_List->Count++;
+    }
+    else
+    {
+        Local_u8ErrorStatus = 1;
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+static void RENDER_DrawCmd(const RENDER_Cmd_t *Copy_Cmd, u16 *Copy_Band, u16 Copy_BandX, u16 Copy_BandY, u16 Copy_BandWidth, u16 Copy_BandHeight)
+{
+    s32 Local_Left;
+    s32 Local_Top;
+    s32 Local_Right;
+    s32 Local_Bottom;
+    s32 Local_Row;
+    s32 Local_Column;
+    u16 *Local_Destination;
+    const u16 *Local_Source;
+
+    /**< Intersection of the command's box with the band */
+    Local_Left   = (Copy_Cmd->X > Copy_BandX) ? Copy_Cmd->X : Copy_BandX;
+    Local_Top    = (Copy_Cmd->Y > Copy_BandY) ? Copy_Cmd->Y : Copy_BandY;
+    Local_Right  = (((s32)Copy_Cmd->X + Copy_Cmd->Width) < ((s32)Copy_BandX + Copy_BandWidth)) ?
+                   ((s32)Copy_Cmd->X + Copy_Cmd->Width) : ((s32)Copy_BandX + Copy_BandWidth);
+    Local_Bottom = (((s32)Copy_Cmd->Y + Copy_Cmd->Height) < ((s32)Copy_BandY + Copy_BandHeight)) ?
+                   ((s32)Copy_Cmd->Y + Copy_Cmd->Height) : ((s32)Copy_BandY + Copy_BandHeight);
+
+    /**< Nothing to draw when the command misses the band */
+    if ((Local_Left < Local_Right) && (Local_Top < Local_Bottom))
+    {
+        switch (Copy_Cmd->Type)
+        {
+            case RENDER_FILL_RECT:
+                for (Local_Row = Local_Top; Local_Row < Local_Bottom; Local_Row++)
+                {
+                    Local_Destination = &Copy_Band[((Local_Row - Copy_BandY) * Copy_BandWidth) + (Local_Left - Copy_BandX)];
+                    for (Local_Column = Local_Left; Local_Column < Local_Right; Local_Column++)
+                    {
+                        *Local_Destination++ = Copy_Cmd->Color;
+                    }
+                }
+                break;
+
+            case RENDER_IMAGE:
+                for (Local_Row = Local_Top; Local_Row < Local_Bottom; Local_Row++)
+                {
+                    Local_Destination = &Copy_Band[((Local_Row - Copy_BandY) * Copy_BandWidth) + (Local_Left - Copy_BandX)];
+                    Local_Source = &((const u16 *)Copy_Cmd->Data)[((Local_Row - Copy_Cmd->Y) * Copy_Cmd->Width) + (Local_Left - Copy_Cmd->X)];
+                    for (Local_Column = Local_Left; Local_Column < Local_Right; Local_Column++)
+                    {
+                        *Local_Destination++ = *Local_Source++;
+                    }
+                }
+                break;
+
+            case RENDER_CUSTOM:
+                Copy_Cmd->Rasterizer(Copy_Cmd, Copy_Band, Copy_BandX, Copy_BandY, Copy_BandWidth, Copy_BandHeight);
+                break;
+
+            default:
+                /**< Unknown command: nothing to draw */
+                break;
+        }
+    }
+}
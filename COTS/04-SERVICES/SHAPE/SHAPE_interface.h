@@ -0,0 +1,180 @@
+/**
+ * @file SHAPE_interface.h
+ * @brief This file contains the public interface of the shape rasterizer.
+ *
+ * The rasterizer draws circles, arcs, rounded rectangles, triangles and convex polygons on a
+ * TFT display. Shapes are cut into horizontal spans, and every span is sent with
+ * @ref TFT_FillRect as one address window and one color burst; consecutive rows with the
+ * same spans are merged into one taller rectangle, so e.g. the straight sides of a rounded
+ * rectangle cost one window each. No pixel is addressed on its own.
+ *
+ * Coordinates are signed: shapes may lie partly or completely outside the screen and are
+ * clipped on all four edges.
+ *
+ * A pixel belongs to a circle of radius R when its centre is closer than R + 1/2 to the
+ * circle centre, so a circle is 2R + 1 pixels wide and the outline is the ring between the
+ * radii R - 1/2 and R + 1/2.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Include SPI_interface.h and TFT_interface.h before this file.
+ *
+ * @note Example Usage:
+ * @code
+ * static const SHAPE_Point_t arrow[] = {{60, 10}, {90, 40}, {70, 40}, {70, 70}, {50, 70}, {50, 40}, {30, 40}};
+ *
+ * SHAPE_FillRoundRect(&tftConfig, spi, 10, 100, 108, 40, 8, 0x001F);     /// blue button
+ * SHAPE_DrawArc(&tftConfig, spi, 64, 64, 50, 6, 135, 45, 0x07E0);        /// 270 degree gauge
+ * SHAPE_FillTriangle(&tftConfig, spi, 64, 20, 100, 80, 28, 80, 0xF800);
+ * SHAPE_DrawPolygon(&tftConfig, spi, arrow, 7, 0xFFFF);                  /// not convex: outline only
+ * @endcode
+ */
+
+#ifndef __SHAPE_INTERFACE_H__
+#define __SHAPE_INTERFACE_H__
+
+/**
+ * @brief A vertex of a triangle or a polygon.
+ */
+typedef struct {
+    s16 X;                          /**< X-coordinate in pixels. */
+    s16 Y;                          /**< Y-coordinate in pixels. */
+} SHAPE_Point_t;
+
+/**
+ * @brief Fills a circle.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_XCenter       The X-coordinate of the centre.
+ * @param[in] Copy_YCenter       The Y-coordinate of the centre.
+ * @param[in] Copy_Radius        The radius in pixels; 0 draws one pixel.
+ * @param[in] Copy_Color         The color (RGB565).
+ */
+void SHAPE_FillCircle(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Color);
+
+/**
+ * @brief Draws the one pixel wide outline of a circle.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_XCenter       The X-coordinate of the centre.
+ * @param[in] Copy_YCenter       The Y-coordinate of the centre.
+ * @param[in] Copy_Radius        The radius in pixels.
+ * @param[in] Copy_Color         The color (RGB565).
+ */
+void SHAPE_DrawCircle(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Color);
+
+/**
+ * @brief Draws a thick arc of a circle.
+ *
+ * Angles are in degrees, 0 points right and they grow clockwise on the screen (90 points
+ * down). The arc goes clockwise from Copy_StartAngle to Copy_EndAngle and wraps through 0
+ * when the end angle is the smaller one; equal angles draw the whole ring. The arc covers
+ * the pixels of the ring between the radii Copy_Radius - Copy_Thickness + 1/2 and
+ * Copy_Radius + 1/2 inside the angle; a thickness above the radius draws a pie slice.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_XCenter       The X-coordinate of the centre.
+ * @param[in] Copy_YCenter       The Y-coordinate of the centre.
+ * @param[in] Copy_Radius        The outer radius in pixels.
+ * @param[in] Copy_Thickness     The width of the ring in pixels, at least 1.
+ * @param[in] Copy_StartAngle    The angle of the start of the arc, in degrees.
+ * @param[in] Copy_EndAngle      The angle of the end of the arc, in degrees.
+ * @param[in] Copy_Color         The color (RGB565).
+ */
+void SHAPE_DrawArc(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Thickness, u16 Copy_StartAngle, u16 Copy_EndAngle, u16 Copy_Color);
+
+/**
+ * @brief Fills a rectangle with rounded corners.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_XPosition     The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition     The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width         The width in pixels.
+ * @param[in] Copy_Height        The height in pixels.
+ * @param[in] Copy_Radius        The corner radius, reduced to fit in half the shorter side.
+ * @param[in] Copy_Color         The color (RGB565).
+ */
+void SHAPE_FillRoundRect(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Radius, u16 Copy_Color);
+
+/**
+ * @brief Draws the one pixel wide outline of a rectangle with rounded corners.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_XPosition     The X-coordinate of the top-left corner.
+ * @param[in] Copy_YPosition     The Y-coordinate of the top-left corner.
+ * @param[in] Copy_Width         The width in pixels.
+ * @param[in] Copy_Height        The height in pixels.
+ * @param[in] Copy_Radius        The corner radius, reduced to fit in half the shorter side.
+ * @param[in] Copy_Color         The color (RGB565).
+ */
+void SHAPE_DrawRoundRect(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Radius, u16 Copy_Color);
+
+/**
+ * @brief Fills a triangle.
+ *
+ * The pixels whose centre lies inside the triangle or on its edges are drawn.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_X0            The X-coordinate of the first vertex.
+ * @param[in] Copy_Y0            The Y-coordinate of the first vertex.
+ * @param[in] Copy_X1            The X-coordinate of the second vertex.
+ * @param[in] Copy_Y1            The Y-coordinate of the second vertex.
+ * @param[in] Copy_X2            The X-coordinate of the third vertex.
+ * @param[in] Copy_Y2            The Y-coordinate of the third vertex.
+ * @param[in] Copy_Color         The color (RGB565).
+ */
+void SHAPE_FillTriangle(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_X0, s16 Copy_Y0, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, u16 Copy_Color);
+
+/**
+ * @brief Draws the outline of a triangle.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_X0            The X-coordinate of the first vertex.
+ * @param[in] Copy_Y0            The Y-coordinate of the first vertex.
+ * @param[in] Copy_X1            The X-coordinate of the second vertex.
+ * @param[in] Copy_Y1            The Y-coordinate of the second vertex.
+ * @param[in] Copy_X2            The X-coordinate of the third vertex.
+ * @param[in] Copy_Y2            The Y-coordinate of the third vertex.
+ * @param[in] Copy_Color         The color (RGB565).
+ */
+void SHAPE_DrawTriangle(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_X0, s16 Copy_Y0, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, u16 Copy_Color);
+
+/**
+ * @brief Fills a convex polygon.
+ *
+ * The pixels whose centre lies inside the polygon or on its edges are drawn. Every row is
+ * filled from the leftmost to the rightmost edge crossing it, so a concave polygon is
+ * filled up to its row-wise hull.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_Points        The vertices, in either winding order.
+ * @param[in] Copy_Count         The number of vertices, at least 3.
+ * @param[in] Copy_Color         The color (RGB565).
+ */
+void SHAPE_FillPolygon(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, const SHAPE_Point_t *Copy_Points, u8 Copy_Count, u16 Copy_Color);
+
+/**
+ * @brief Draws the outline of a polygon, convex or not.
+ *
+ * Every edge is clipped to the screen and drawn with @ref TFT_DrawLine.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_Points        The vertices.
+ * @param[in] Copy_Count         The number of vertices, at least 2; the last one is joined
+ *                               to the first one.
+ * @param[in] Copy_Color         The color (RGB565).
+ */
+void SHAPE_DrawPolygon(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, const SHAPE_Point_t *Copy_Points, u8 Copy_Count, u16 Copy_Color);
+
+#endif /**< __SHAPE_INTERFACE_H__ */
@@ -0,0 +1,213 @@
+/**
+ * @file SHAPE_private.h
+ * @brief This file contains the private interface of the shape rasterizer.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __SHAPE_PRIVATE_H__
+#define __SHAPE_PRIVATE_H__
+
+/**
+ * @brief Maximum number of spans in one row: a ring row has two, and an arc wider than a
+ * half turn can split each of them in two.
+ */
+#define SHAPE_MAX_ROW_SPANS         4
+
+/**
+ * @brief Bound of an unlimited interval, far beyond any screen coordinate.
+ */
+#define SHAPE_INFINITY              0x3FFFFFFFL
+
+/**
+ * @brief Fixed-point one of the sine table.
+ */
+#define SHAPE_SINE_ONE              16384
+
+/**
+ * @brief Cohen-Sutherland outcodes of the line clipper.
+ */
+#define SHAPE_OUT_LEFT              0x01
+#define SHAPE_OUT_RIGHT             0x02
+#define SHAPE_OUT_TOP               0x04
+#define SHAPE_OUT_BOTTOM            0x08
+
+/**
+ * @brief Rows waiting to be drawn: consecutive rows with the same spans are drawn as one
+ * rectangle per span.
+ */
+typedef struct {
+    const TFT_Config_t *TftDisplay;             /**< The display. */
+    SPI_t SpiPeripheral;                        /**< The SPI peripheral of the display. */
+    u16 Color;                                  /**< The color of the shape. */
+    s32 Top;                                    /**< First row of the pending rows. */
+    s32 Rows;                                   /**< Number of pending rows, 0 when none. */
+    u8 Count;                                   /**< Number of spans of the pending rows. */
+    s32 Spans[2 * SHAPE_MAX_ROW_SPANS];         /**< Left and right ends of the spans, on screen. */
+} SHAPE_Batch_t;
+
+/**
+ * @brief Angle of an arc: the directions of its ends, in fixed point.
+ */
+typedef struct {
+    s32 StartX;                     /**< Cosine of the start angle. */
+    s32 StartY;                     /**< Sine of the start angle. */
+    s32 EndX;                       /**< Cosine of the end angle. */
+    s32 EndY;                       /**< Sine of the end angle. */
+    u8 IsWide;                      /**< 1 when the arc is wider than a half turn. */
+} SHAPE_Sector_t;
+
+/**
+ * @brief Start an empty batch.
+ *
+ * @param[out] Copy_Batch         The batch.
+ * @param[in]  Copy_TftDisplay    The display.
+ * @param[in]  Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in]  Copy_Color         The color of the shape.
+ */
+static void SHAPE_InitBatch(SHAPE_Batch_t *Copy_Batch, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, u16 Copy_Color);
+
+/**
+ * @brief Add one row to a batch, drawing the pending rows when it differs from them.
+ *
+ * @param[in,out] Copy_Batch The batch.
+ * @param[in]     Copy_Y     The row; rows are added from top to bottom.
+ * @param[in]     Copy_Spans Left and right ends of the spans, from left to right; spans with
+ *                           the left end past the right end are empty.
+ * @param[in]     Copy_Count The number of spans.
+ */
+static void SHAPE_AddRow(SHAPE_Batch_t *Copy_Batch, s32 Copy_Y, const s32 *Copy_Spans, u8 Copy_Count);
+
+/**
+ * @brief Draw the pending rows of a batch.
+ *
+ * @param[in,out] Copy_Batch The batch.
+ */
+static void SHAPE_FlushBatch(SHAPE_Batch_t *Copy_Batch);
+
+/**
+ * @brief Rasterize a rounded rectangle, its outline or an arc of it.
+ *
+ * A circle is a square whose corner radius is half its side.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_Left          The left column of the shape.
+ * @param[in] Copy_Top           The top row of the shape.
+ * @param[in] Copy_Right         The right column of the shape.
+ * @param[in] Copy_Bottom        The bottom row of the shape.
+ * @param[in] Copy_Radius        The corner radius, fitting in half the shorter side.
+ * @param[in] Copy_Thickness     The width of the outline, 0 to fill the shape.
+ * @param[in] Copy_Sector        The angle to keep, around the centre of the shape, or NULL.
+ * @param[in] Copy_Color         The color.
+ */
+static void SHAPE_DrawRounded(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom, u32 Copy_Radius, u32 Copy_Thickness, const SHAPE_Sector_t *Copy_Sector, u16 Copy_Color);
+
+/**
+ * @brief Find the span of a rounded rectangle in one row.
+ *
+ * @param[in]  Copy_Left   The left column of the rectangle.
+ * @param[in]  Copy_Top    The top row of the rectangle.
+ * @param[in]  Copy_Right  The right column of the rectangle.
+ * @param[in]  Copy_Bottom The bottom row of the rectangle.
+ * @param[in]  Copy_Radius The corner radius.
+ * @param[in]  Copy_Y      The row, between Copy_Top and Copy_Bottom.
+ * @param[out] Copy_Span   Receives the left and right ends of the span.
+ */
+static void SHAPE_GetRoundedSpan(s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom, u32 Copy_Radius, s32 Copy_Y, s32 *Copy_Span);
+
+/**
+ * @brief Keep the parts of the spans of one row that lie inside the angle of an arc.
+ *
+ * @param[in]     Copy_Sector  The angle.
+ * @param[in]     Copy_XCenter The X-coordinate of the centre of the arc.
+ * @param[in]     Copy_DY      The row, relative to the centre of the arc.
+ * @param[in,out] Copy_Spans   The spans, replaced by the kept parts.
+ * @param[in]     Copy_Count   The number of spans.
+ * @return The number of kept parts.
+ */
+static u8 SHAPE_ClipToSector(const SHAPE_Sector_t *Copy_Sector, s32 Copy_XCenter, s32 Copy_DY, s32 *Copy_Spans, u8 Copy_Count);
+
+/**
+ * @brief Find the integers Copy_DX with Copy_A * Copy_DX + Copy_B >= 0.
+ *
+ * @param[in]  Copy_A        The slope.
+ * @param[in]  Copy_B        The offset.
+ * @param[out] Copy_Interval Receives the first and last solutions, first > last when none.
+ */
+static void SHAPE_GetHalfLine(s32 Copy_A, s32 Copy_B, s32 *Copy_Interval);
+
+/**
+ * @brief Divide, rounded towards minus infinity.
+ *
+ * @param[in] Copy_Numerator   The numerator.
+ * @param[in] Copy_Denominator The denominator, positive.
+ * @return The quotient.
+ */
+static s32 SHAPE_FloorDivide(s32 Copy_Numerator, s32 Copy_Denominator);
+
+/**
+ * @brief Integer square root.
+ *
+ * @param[in] Copy_Value The value.
+ * @return The largest integer whose square does not exceed Copy_Value.
+ */
+static u32 SHAPE_SquareRoot(u32 Copy_Value);
+
+/**
+ * @brief Sine of an angle in whole degrees.
+ *
+ * @param[in] Copy_Angle The angle in degrees, 0 to 449.
+ * @return The sine, in units of @ref SHAPE_SINE_ONE.
+ */
+static s32 SHAPE_GetSine(u16 Copy_Angle);
+
+/**
+ * @brief Find where the edge of a polygon crosses a row.
+ *
+ * @param[in]  Copy_From     The first end of the edge.
+ * @param[in]  Copy_To       The second end of the edge.
+ * @param[in]  Copy_Y        The row, between the rows of the two ends.
+ * @param[out] Copy_Interval Receives the first and last pixel centres at or after and at or
+ *                           before the crossing.
+ */
+static void SHAPE_GetEdgeCrossing(const SHAPE_Point_t *Copy_From, const SHAPE_Point_t *Copy_To, s32 Copy_Y, s32 *Copy_Interval);
+
+/**
+ * @brief Clip a line to the screen and draw it.
+ *
+ * @param[in] Copy_TftDisplay    The display.
+ * @param[in] Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in] Copy_From          The first end.
+ * @param[in] Copy_To            The second end.
+ * @param[in] Copy_Color         The color.
+ */
+static void SHAPE_DrawClippedLine(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, const SHAPE_Point_t *Copy_From, const SHAPE_Point_t *Copy_To, u16 Copy_Color);
+
+/**
+ * @brief Cohen-Sutherland outcode of a point.
+ *
+ * @param[in] Copy_X      The X-coordinate.
+ * @param[in] Copy_Y      The Y-coordinate.
+ * @param[in] Copy_Width  The screen width.
+ * @param[in] Copy_Height The screen height.
+ * @return The SHAPE_OUT_ flags of the screen edges the point is beyond.
+ */
+static u8 SHAPE_GetOutcode(s32 Copy_X, s32 Copy_Y, s32 Copy_Width, s32 Copy_Height);
+
+/**
+ * @brief Interpolate a coordinate along a line, rounded to the nearest.
+ *
+ * @param[in] Copy_From  The coordinate at the first end.
+ * @param[in] Copy_To    The coordinate at the second end.
+ * @param[in] Copy_Part  The distance from the first end, up to Copy_Whole and of the same sign.
+ * @param[in] Copy_Whole The distance between the ends, not 0.
+ * @return The coordinate at Copy_Part.
+ */
+static s32 SHAPE_Interpolate(s32 Copy_From, s32 Copy_To, s32 Copy_Part, s32 Copy_Whole);
+
+#endif /**< __SHAPE_PRIVATE_H__ */
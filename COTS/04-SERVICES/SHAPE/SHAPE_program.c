@@ -0,0 +1,674 @@
+/**
+ * @file SHAPE_program.c
+ * @brief This file contains the implementation of the shape rasterizer.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "SHAPE_interface.h"
+#include "SHAPE_private.h"
+
+/**
+ * @brief Sine of 0 to 90 degrees in units of SHAPE_SINE_ONE.
+ */
+static const u16 SHAPE_SineTable[91] =
+{
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384
+};
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void SHAPE_FillCircle(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Color)
+{
+    SHAPE_DrawRounded(Copy_TftDisplay, Copy_SpiPeripheral, (s32)Copy_XCenter - Copy_Radius, (s32)Copy_YCenter - Copy_Radius,
+                      (s32)Copy_XCenter + Copy_Radius, (s32)Copy_YCenter + Copy_Radius, Copy_Radius, 0, NULL, Copy_Color);
+}
+
+void SHAPE_DrawCircle(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Color)
+{
+    SHAPE_DrawRounded(Copy_TftDisplay, Copy_SpiPeripheral, (s32)Copy_XCenter - Copy_Radius, (s32)Copy_YCenter - Copy_Radius,
+                      (s32)Copy_XCenter + Copy_Radius, (s32)Copy_YCenter + Copy_Radius, Copy_Radius, 1, NULL, Copy_Color);
+}
+
+void SHAPE_DrawArc(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XCenter, s16 Copy_YCenter, u16 Copy_Radius, u16 Copy_Thickness, u16 Copy_StartAngle, u16 Copy_EndAngle, u16 Copy_Color)
+{
+    SHAPE_Sector_t Local_Sector;
+    u16 Local_Sweep;
+
+    if (Copy_Thickness == 0)
+    {
+        return;
+    }
+
+    Copy_StartAngle %= 360;
+    Copy_EndAngle %= 360;
+    Local_Sweep = (u16)((Copy_EndAngle + 360 - Copy_StartAngle) % 360);
+
+    /**< Directions of the two ends, the cosine is the sine a quarter turn later */
+    Local_Sector.StartX = SHAPE_GetSine(Copy_StartAngle + 90);
+    Local_Sector.StartY = SHAPE_GetSine(Copy_StartAngle);
+    Local_Sector.EndX = SHAPE_GetSine(Copy_EndAngle + 90);
+    Local_Sector.EndY = SHAPE_GetSine(Copy_EndAngle);
+    Local_Sector.IsWide = (Local_Sweep > 180) ? 1 : 0;
+
+    SHAPE_DrawRounded(Copy_TftDisplay, Copy_SpiPeripheral, (s32)Copy_XCenter - Copy_Radius, (s32)Copy_YCenter - Copy_Radius,
+                      (s32)Copy_XCenter + Copy_Radius, (s32)Copy_YCenter + Copy_Radius, Copy_Radius, Copy_Thickness,
+                      (Local_Sweep == 0) ? NULL : &Local_Sector, Copy_Color);
+}
+
+void SHAPE_FillRoundRect(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Radius, u16 Copy_Color)
+{
+    u16 Local_MaxRadius;
+
+    if ((Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    Local_MaxRadius = (u16)((((Copy_Width < Copy_Height) ? Copy_Width : Copy_Height) - 1) / 2);
+    if (Copy_Radius > Local_MaxRadius)
+    {
+        Copy_Radius = Local_MaxRadius;
+    }
+
+    SHAPE_DrawRounded(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition, (s32)Copy_XPosition + Copy_Width - 1,
+                      (s32)Copy_YPosition + Copy_Height - 1, Copy_Radius, 0, NULL, Copy_Color);
+}
+
+void SHAPE_DrawRoundRect(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_XPosition, s16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, u16 Copy_Radius, u16 Copy_Color)
+{
+    u16 Local_MaxRadius;
+
+    if ((Copy_Width == 0) || (Copy_Height == 0))
+    {
+        return;
+    }
+
+    Local_MaxRadius = (u16)((((Copy_Width < Copy_Height) ? Copy_Width : Copy_Height) - 1) / 2);
+    if (Copy_Radius > Local_MaxRadius)
+    {
+        Copy_Radius = Local_MaxRadius;
+    }
+
+    SHAPE_DrawRounded(Copy_TftDisplay, Copy_SpiPeripheral, Copy_XPosition, Copy_YPosition, (s32)Copy_XPosition + Copy_Width - 1,
+                      (s32)Copy_YPosition + Copy_Height - 1, Copy_Radius, 1, NULL, Copy_Color);
+}
+
+void SHAPE_FillTriangle(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_X0, s16 Copy_Y0, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, u16 Copy_Color)
+{
+    SHAPE_Point_t Local_Points[3];
+
+    Local_Points[0].X = Copy_X0;
+    Local_Points[0].Y = Copy_Y0;
+    Local_Points[1].X = Copy_X1;
+    Local_Points[1].Y = Copy_Y1;
+    Local_Points[2].X = Copy_X2;
+    Local_Points[2].Y = Copy_Y2;
+
+    SHAPE_FillPolygon(Copy_TftDisplay, Copy_SpiPeripheral, Local_Points, 3, Copy_Color);
+}
+
+void SHAPE_DrawTriangle(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s16 Copy_X0, s16 Copy_Y0, s16 Copy_X1, s16 Copy_Y1, s16 Copy_X2, s16 Copy_Y2, u16 Copy_Color)
+{
+    SHAPE_Point_t Local_Points[3];
+
+    Local_Points[0].X = Copy_X0;
+    Local_Points[0].Y = Copy_Y0;
+    Local_Points[1].X = Copy_X1;
+    Local_Points[1].Y = Copy_Y1;
+    Local_Points[2].X = Copy_X2;
+    Local_Points[2].Y = Copy_Y2;
+
+    SHAPE_DrawPolygon(Copy_TftDisplay, Copy_SpiPeripheral, Local_Points, 3, Copy_Color);
+}
+
+void SHAPE_FillPolygon(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, const SHAPE_Point_t *Copy_Points, u8 Copy_Count, u16 Copy_Color)
+{
+    SHAPE_Batch_t Local_Batch;
+    const SHAPE_Point_t *Local_From;
+    const SHAPE_Point_t *Local_To;
+    s32 Local_Span[2];
+    s32 Local_Crossing[2];
+    s32 Local_Y;
+    s32 Local_Last;
+    u8 Local_Index;
+
+    if ((Copy_Points == NULL) || (Copy_Count < 3))
+    {
+        return;
+    }
+
+    /**< Rows of the polygon, clipped to the screen */
+    Local_Y = Copy_Points[0].Y;
+    Local_Last = Copy_Points[0].Y;
+    for (Local_Index = 1; Local_Index < Copy_Count; Local_Index++)
+    {
+        if (Copy_Points[Local_Index].Y < Local_Y)
+        {
+            Local_Y = Copy_Points[Local_Index].Y;
+        }
+        if (Copy_Points[Local_Index].Y > Local_Last)
+        {
+            Local_Last = Copy_Points[Local_Index].Y;
+        }
+    }
+    if (Local_Y < 0)
+    {
+        Local_Y = 0;
+    }
+    if (Local_Last >= Copy_TftDisplay->TFT_Controller->TFT_Height)
+    {
+        Local_Last = Copy_TftDisplay->TFT_Controller->TFT_Height - 1;
+    }
+
+    SHAPE_InitBatch(&Local_Batch, Copy_TftDisplay, Copy_SpiPeripheral, Copy_Color);
+    for (; Local_Y <= Local_Last; Local_Y++)
+    {
+        /**< A convex polygon covers the row from its leftmost to its rightmost edge crossing */
+        Local_Span[0] = SHAPE_INFINITY;
+        Local_Span[1] = -SHAPE_INFINITY;
+        for (Local_Index = 0; Local_Index < Copy_Count; Local_Index++)
+        {
+            Local_From = &Copy_Points[Local_Index];
+            Local_To = &Copy_Points[((Local_Index + 1) == Copy_Count) ? 0 : (Local_Index + 1)];
+
+            if (Local_From->Y == Local_To->Y)
+            {
+                /**< A horizontal edge covers its whole length on its row */
+                if (Local_From->Y != Local_Y)
+                {
+                    continue;
+                }
+                Local_Crossing[0] = (Local_From->X < Local_To->X) ? Local_From->X : Local_To->X;
+                Local_Crossing[1] = (Local_From->X < Local_To->X) ? Local_To->X : Local_From->X;
+            }
+            else if (((Local_Y >= Local_From->Y) && (Local_Y <= Local_To->Y)) || ((Local_Y >= Local_To->Y) && (Local_Y <= Local_From->Y)))
+            {
+                SHAPE_GetEdgeCrossing(Local_From, Local_To, Local_Y, Local_Crossing);
+            }
+            else
+            {
+                continue;
+            }
+
+            if (Local_Crossing[0] < Local_Span[0])
+            {
+                Local_Span[0] = Local_Crossing[0];
+            }
+            if (Local_Crossing[1] > Local_Span[1])
+            {
+                Local_Span[1] = Local_Crossing[1];
+            }
+        }
+        SHAPE_AddRow(&Local_Batch, Local_Y, Local_Span, 1);
+    }
+    SHAPE_FlushBatch(&Local_Batch);
+}
+
+void SHAPE_DrawPolygon(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, const SHAPE_Point_t *Copy_Points, u8 Copy_Count, u16 Copy_Color)
+{
+    u8 Local_Index;
+
+    if ((Copy_Points == NULL) || (Copy_Count < 2))
+    {
+        return;
+    }
+
+    for (Local_Index = 0; (Local_Index + 1) < Copy_Count; Local_Index++)
+    {
+        SHAPE_DrawClippedLine(Copy_TftDisplay, Copy_SpiPeripheral, &Copy_Points[Local_Index], &Copy_Points[Local_Index + 1], Copy_Color);
+    }
+
+    /**< Close the outline, two points are a single line */
+    if (Copy_Count > 2)
+    {
+        SHAPE_DrawClippedLine(Copy_TftDisplay, Copy_SpiPeripheral, &Copy_Points[Copy_Count - 1], &Copy_Points[0], Copy_Color);
+    }
+}
+
+static void SHAPE_InitBatch(SHAPE_Batch_t *Copy_Batch, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, u16 Copy_Color)
+{
+    Copy_Batch->TftDisplay = Copy_TftDisplay;
+    Copy_Batch->SpiPeripheral = Copy_SpiPeripheral;
+    Copy_Batch->Color = Copy_Color;
+    Copy_Batch->Top = 0;
+    Copy_Batch->Rows = 0;
+    Copy_Batch->Count = 0;
+}
+
+static void SHAPE_AddRow(SHAPE_Batch_t *Copy_Batch, s32 Copy_Y, const s32 *Copy_Spans, u8 Copy_Count)
+{
+    s32 Local_Spans[2 * SHAPE_MAX_ROW_SPANS];
+    s32 Local_Right = (s32)Copy_Batch->TftDisplay->TFT_Controller->TFT_Width - 1;
+    s32 Local_Left;
+    s32 Local_End;
+    u8 Local_Kept = 0;
+    u8 Local_Index;
+    u8 Local_IsSame;
+
+    /**< Clip the spans to the screen, drop the empty ones */
+    for (Local_Index = 0; Local_Index < Copy_Count; Local_Index++)
+    {
+        Local_Left = (Copy_Spans[2 * Local_Index] < 0) ? 0 : Copy_Spans[2 * Local_Index];
+        Local_End = (Copy_Spans[(2 * Local_Index) + 1] > Local_Right) ? Local_Right : Copy_Spans[(2 * Local_Index) + 1];
+        if (Local_Left <= Local_End)
+        {
+            Local_Spans[2 * Local_Kept] = Local_Left;
+            Local_Spans[(2 * Local_Kept) + 1] = Local_End;
+            Local_Kept++;
+        }
+    }
+
+    /**< Same spans as the row above: the pending rectangles grow by one row */
+    Local_IsSame = ((Copy_Batch->Rows > 0) && (Copy_Y == (Copy_Batch->Top + Copy_Batch->Rows)) && (Local_Kept == Copy_Batch->Count)) ? 1 : 0;
+    for (Local_Index = 0; (Local_Index < (2 * Local_Kept)) && Local_IsSame; Local_Index++)
+    {
+        if (Local_Spans[Local_Index] != Copy_Batch->Spans[Local_Index])
+        {
+            Local_IsSame = 0;
+        }
+    }
+    if (Local_IsSame)
+    {
+        Copy_Batch->Rows++;
+        return;
+    }
+
+    SHAPE_FlushBatch(Copy_Batch);
+    Copy_Batch->Top = Copy_Y;
+    Copy_Batch->Rows = 1;
+    Copy_Batch->Count = Local_Kept;
+    for (Local_Index = 0; Local_Index < (2 * Local_Kept); Local_Index++)
+    {
+        Copy_Batch->Spans[Local_Index] = Local_Spans[Local_Index];
+    }
+}
+
+static void SHAPE_FlushBatch(SHAPE_Batch_t *Copy_Batch)
+{
+    u8 Local_Index;
+
+    /**< One window and one burst per span */
+    for (Local_Index = 0; (Copy_Batch->Rows > 0) && (Local_Index < Copy_Batch->Count); Local_Index++)
+    {
+        TFT_FillRect(Copy_Batch->TftDisplay, Copy_Batch->SpiPeripheral, (u16)Copy_Batch->Spans[2 * Local_Index], (u16)Copy_Batch->Top,
+                     (u16)(Copy_Batch->Spans[(2 * Local_Index) + 1] - Copy_Batch->Spans[2 * Local_Index] + 1), (u16)Copy_Batch->Rows, Copy_Batch->Color);
+    }
+    Copy_Batch->Rows = 0;
+}
+
+static void SHAPE_DrawRounded(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom, u32 Copy_Radius, u32 Copy_Thickness, const SHAPE_Sector_t *Copy_Sector, u16 Copy_Color)
+{
+    SHAPE_Batch_t Local_Batch;
+    s32 Local_Spans[2 * SHAPE_MAX_ROW_SPANS];
+    s32 Local_Inner[2];
+    s32 Local_InnerLeft = Copy_Left + (s32)Copy_Thickness;
+    s32 Local_InnerTop = Copy_Top + (s32)Copy_Thickness;
+    s32 Local_InnerRight = Copy_Right - (s32)Copy_Thickness;
+    s32 Local_InnerBottom = Copy_Bottom - (s32)Copy_Thickness;
+    u32 Local_InnerRadius = (Copy_Radius > Copy_Thickness) ? (Copy_Radius - Copy_Thickness) : 0;
+    u8 Local_HasInner = ((Copy_Thickness > 0) && (Local_InnerLeft <= Local_InnerRight) && (Local_InnerTop <= Local_InnerBottom)) ? 1 : 0;
+    s32 Local_Y = (Copy_Top < 0) ? 0 : Copy_Top;
+    s32 Local_Last = Copy_Bottom;
+    u8 Local_Count;
+
+    if (Local_Last >= Copy_TftDisplay->TFT_Controller->TFT_Height)
+    {
+        Local_Last = Copy_TftDisplay->TFT_Controller->TFT_Height - 1;
+    }
+
+    SHAPE_InitBatch(&Local_Batch, Copy_TftDisplay, Copy_SpiPeripheral, Copy_Color);
+    for (; Local_Y <= Local_Last; Local_Y++)
+    {
+        SHAPE_GetRoundedSpan(Copy_Left, Copy_Top, Copy_Right, Copy_Bottom, Copy_Radius, Local_Y, Local_Spans);
+        Local_Count = 1;
+
+        /**< Outlines: cut out the inner shape, leaving a left and a right span */
+        if (Local_HasInner && (Local_Y >= Local_InnerTop) && (Local_Y <= Local_InnerBottom))
+        {
+            SHAPE_GetRoundedSpan(Local_InnerLeft, Local_InnerTop, Local_InnerRight, Local_InnerBottom, Local_InnerRadius, Local_Y, Local_Inner);
+            Local_Spans[3] = Local_Spans[1];
+            Local_Spans[1] = Local_Inner[0] - 1;
+            Local_Spans[2] = Local_Inner[1] + 1;
+            Local_Count = 2;
+        }
+
+        if (Copy_Sector != NULL)
+        {
+            Local_Count = SHAPE_ClipToSector(Copy_Sector, (Copy_Left + Copy_Right) / 2, Local_Y - ((Copy_Top + Copy_Bottom) / 2), Local_Spans, Local_Count);
+        }
+
+        SHAPE_AddRow(&Local_Batch, Local_Y, Local_Spans, Local_Count);
+    }
+    SHAPE_FlushBatch(&Local_Batch);
+}
+
+static void SHAPE_GetRoundedSpan(s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom, u32 Copy_Radius, s32 Copy_Y, s32 *Copy_Span)
+{
+    u32 Local_DY = 0;
+    u32 Local_Half = Copy_Radius;
+
+    /**< Rows of the corners: the half width of a circle of radius + 1/2 */
+    if (Copy_Y < (Copy_Top + (s32)Copy_Radius))
+    {
+        Local_DY = (u32)(Copy_Top + (s32)Copy_Radius - Copy_Y);
+    }
+    else if (Copy_Y > (Copy_Bottom - (s32)Copy_Radius))
+    {
+        Local_DY = (u32)(Copy_Y - (Copy_Bottom - (s32)Copy_Radius));
+    }
+    if (Local_DY != 0)
+    {
+        Local_Half = SHAPE_SquareRoot((Copy_Radius * Copy_Radius) + Copy_Radius - (Local_DY * Local_DY));
+    }
+
+    Copy_Span[0] = Copy_Left + (s32)Copy_Radius - (s32)Local_Half;
+    Copy_Span[1] = Copy_Right - (s32)Copy_Radius + (s32)Local_Half;
+}
+
+static u8 SHAPE_ClipToSector(const SHAPE_Sector_t *Copy_Sector, s32 Copy_XCenter, s32 Copy_DY, s32 *Copy_Spans, u8 Copy_Count)
+{
+    s32 Local_Parts[2 * SHAPE_MAX_ROW_SPANS];
+    s32 Local_First[2];
+    s32 Local_Second[2];
+    s32 Local_Left;
+    s32 Local_Right;
+    u8 Local_Kept = 0;
+    u8 Local_Index;
+
+    if (!Copy_Sector->IsWide)
+    {
+        /**< Inside both ends: clockwise from the start and counterclockwise from the end */
+        SHAPE_GetHalfLine(-Copy_Sector->StartY, Copy_Sector->StartX * Copy_DY, Local_First);
+        SHAPE_GetHalfLine(Copy_Sector->EndY, -Copy_Sector->EndX * Copy_DY, Local_Second);
+    }
+    else
+    {
+        /**< Wider than a half turn: outside the excluded angle from the end to the start */
+        SHAPE_GetHalfLine(-Copy_Sector->EndY, (Copy_Sector->EndX * Copy_DY) - 1, Local_First);
+        SHAPE_GetHalfLine(Copy_Sector->StartY, (-Copy_Sector->StartX * Copy_DY) - 1, Local_Second);
+    }
+
+    /**< The interval of the row kept (narrow arcs) or excluded (wide arcs) */
+    Local_Left = ((Local_First[0] > Local_Second[0]) ? Local_First[0] : Local_Second[0]) + Copy_XCenter;
+    Local_Right = ((Local_First[1] < Local_Second[1]) ? Local_First[1] : Local_Second[1]) + Copy_XCenter;
+
+    for (Local_Index = 0; Local_Index < Copy_Count; Local_Index++)
+    {
+        s32 Local_SpanLeft = Copy_Spans[2 * Local_Index];
+        s32 Local_SpanRight = Copy_Spans[(2 * Local_Index) + 1];
+
+        if (!Copy_Sector->IsWide)
+        {
+            Local_Parts[2 * Local_Kept] = (Local_SpanLeft > Local_Left) ? Local_SpanLeft : Local_Left;
+            Local_Parts[(2 * Local_Kept) + 1] = (Local_SpanRight < Local_Right) ? Local_SpanRight : Local_Right;
+            Local_Kept++;
+        }
+        else if (Local_Left > Local_Right)
+        {
+            /**< Nothing of the row is excluded */
+            Local_Parts[2 * Local_Kept] = Local_SpanLeft;
+            Local_Parts[(2 * Local_Kept) + 1] = Local_SpanRight;
+            Local_Kept++;
+        }
+        else
+        {
+            Local_Parts[2 * Local_Kept] = Local_SpanLeft;
+            Local_Parts[(2 * Local_Kept) + 1] = (Local_SpanRight < (Local_Left - 1)) ? Local_SpanRight : (Local_Left - 1);
+            Local_Parts[(2 * Local_Kept) + 2] = (Local_SpanLeft > (Local_Right + 1)) ? Local_SpanLeft : (Local_Right + 1);
+            Local_Parts[(2 * Local_Kept) + 3] = Local_SpanRight;
+            Local_Kept += 2;
+        }
+    }
+
+    for (Local_Index = 0; Local_Index < (2 * Local_Kept); Local_Index++)
+    {
+        Copy_Spans[Local_Index] = Local_Parts[Local_Index];
+    }
+
+    return Local_Kept;
+}
+
+static void SHAPE_GetHalfLine(s32 Copy_A, s32 Copy_B, s32 *Copy_Interval)
+{
+    Copy_Interval[0] = -SHAPE_INFINITY;
+    Copy_Interval[1] = SHAPE_INFINITY;
+
+    if (Copy_A > 0)
+    {
+        Copy_Interval[0] = -SHAPE_FloorDivide(Copy_B, Copy_A);
+    }
+    else if (Copy_A < 0)
+    {
+        Copy_Interval[1] = SHAPE_FloorDivide(Copy_B, -Copy_A);
+    }
+    else if (Copy_B < 0)
+    {
+        /**< Parallel to the row and on the wrong side */
+        Copy_Interval[0] = SHAPE_INFINITY;
+        Copy_Interval[1] = -SHAPE_INFINITY;
+    }
+}
+
+static s32 SHAPE_FloorDivide(s32 Copy_Numerator, s32 Copy_Denominator)
+{
+    s32 Local_Quotient = Copy_Numerator / Copy_Denominator;
+
+    if (((Copy_Numerator % Copy_Denominator) != 0) && (Copy_Numerator < 0))
+    {
+        Local_Quotient--;
+    }
+
+    return Local_Quotient;
+}
+
+static u32 SHAPE_SquareRoot(u32 Copy_Value)
+{
+    u32 Local_Root = 0;
+    u32 Local_Bit = 1UL << 30;
+
+    while (Local_Bit > Copy_Value)
+    {
+        Local_Bit >>= 2;
+    }
+
+    /**< One result bit per iteration, from the top */
+    while (Local_Bit != 0)
+    {
+        if (Copy_Value >= (Local_Root + Local_Bit))
+        {
+            Copy_Value -= Local_Root + Local_Bit;
+            Local_Root = (Local_Root >> 1) + Local_Bit;
+        }
+        else
+        {
+            Local_Root >>= 1;
+        }
+        Local_Bit >>= 2;
+    }
+
+    return Local_Root;
+}
+
+static s32 SHAPE_GetSine(u16 Copy_Angle)
+{
+    s32 Local_Sine;
+
+    Copy_Angle %= 360;
+    if (Copy_Angle <= 90)
+    {
+        Local_Sine = SHAPE_SineTable[Copy_Angle];
+    }
+    else if (Copy_Angle <= 180)
+    {
+        Local_Sine = SHAPE_SineTable[180 - Copy_Angle];
+    }
+    else if (Copy_Angle <= 270)
+    {
+        Local_Sine = -(s32)SHAPE_SineTable[Copy_Angle - 180];
+    }
+    else
+    {
+        Local_Sine = -(s32)SHAPE_SineTable[360 - Copy_Angle];
+    }
+
+    return Local_Sine;
+}
+
+static void SHAPE_GetEdgeCrossing(const SHAPE_Point_t *Copy_From, const SHAPE_Point_t *Copy_To, s32 Copy_Y, s32 *Copy_Interval)
+{
+    const SHAPE_Point_t *Local_Temp;
+    s32 Local_XDelta;
+    u32 Local_Height;
+    u32 Local_Product;
+    u32 Local_Quotient;
+    u32 Local_IsInexact;
+
+    /**< Walk the edge downwards */
+    if (Copy_From->Y > Copy_To->Y)
+    {
+        Local_Temp = Copy_From;
+        Copy_From = Copy_To;
+        Copy_To = Local_Temp;
+    }
+
+    /**< |dx| * (y - y0) is at most 65535 * 65535 and fits in 32 unsigned bits */
+    Local_XDelta = (s32)Copy_To->X - Copy_From->X;
+    Local_Height = (u32)((s32)Copy_To->Y - Copy_From->Y);
+    Local_Product = (u32)((Local_XDelta < 0) ? -Local_XDelta : Local_XDelta) * (u32)(Copy_Y - Copy_From->Y);
+    Local_Quotient = Local_Product / Local_Height;
+    Local_IsInexact = ((Local_Product % Local_Height) != 0) ? 1 : 0;
+
+    if (Local_XDelta >= 0)
+    {
+        Copy_Interval[0] = Copy_From->X + (s32)(Local_Quotient + Local_IsInexact);
+        Copy_Interval[1] = Copy_From->X + (s32)Local_Quotient;
+    }
+    else
+    {
+        Copy_Interval[0] = Copy_From->X - (s32)Local_Quotient;
+        Copy_Interval[1] = Copy_From->X - (s32)(Local_Quotient + Local_IsInexact);
+    }
+}
+
+static void SHAPE_DrawClippedLine(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, const SHAPE_Point_t *Copy_From, const SHAPE_Point_t *Copy_To, u16 Copy_Color)
+{
+    s32 Local_Width = Copy_TftDisplay->TFT_Controller->TFT_Width;
+    s32 Local_Height = Copy_TftDisplay->TFT_Controller->TFT_Height;
+    s32 Local_X0 = Copy_From->X;
+    s32 Local_Y0 = Copy_From->Y;
+    s32 Local_X1 = Copy_To->X;
+    s32 Local_Y1 = Copy_To->Y;
+    s32 Local_X;
+    s32 Local_Y;
+    u8 Local_Code0 = SHAPE_GetOutcode(Local_X0, Local_Y0, Local_Width, Local_Height);
+    u8 Local_Code1 = SHAPE_GetOutcode(Local_X1, Local_Y1, Local_Width, Local_Height);
+    u8 Local_Code;
+
+    /**< Cohen-Sutherland: move the outside end onto the crossed screen edge until both ends are inside.
+     *   The new ends are interpolated on the original line so the rounding errors do not add up */
+    while ((Local_Code0 | Local_Code1) != 0)
+    {
+        if ((Local_Code0 & Local_Code1) != 0)
+        {
+            /**< Both ends beyond the same edge */
+            return;
+        }
+
+        Local_Code = (Local_Code0 != 0) ? Local_Code0 : Local_Code1;
+        if ((Local_Code & SHAPE_OUT_TOP) != 0)
+        {
+            Local_Y = 0;
+            Local_X = SHAPE_Interpolate(Copy_From->X, Copy_To->X, Local_Y - Copy_From->Y, (s32)Copy_To->Y - Copy_From->Y);
+        }
+        else if ((Local_Code & SHAPE_OUT_BOTTOM) != 0)
+        {
+            Local_Y = Local_Height - 1;
+            Local_X = SHAPE_Interpolate(Copy_From->X, Copy_To->X, Local_Y - Copy_From->Y, (s32)Copy_To->Y - Copy_From->Y);
+        }
+        else if ((Local_Code & SHAPE_OUT_LEFT) != 0)
+        {
+            Local_X = 0;
+            Local_Y = SHAPE_Interpolate(Copy_From->Y, Copy_To->Y, Local_X - Copy_From->X, (s32)Copy_To->X - Copy_From->X);
+        }
+        else
+        {
+            Local_X = Local_Width - 1;
+            Local_Y = SHAPE_Interpolate(Copy_From->Y, Copy_To->Y, Local_X - Copy_From->X, (s32)Copy_To->X - Copy_From->X);
+        }
+
+        if (Local_Code == Local_Code0)
+        {
+            Local_X0 = Local_X;
+            Local_Y0 = Local_Y;
+            Local_Code0 = SHAPE_GetOutcode(Local_X0, Local_Y0, Local_Width, Local_Height);
+        }
+        else
+        {
+            Local_X1 = Local_X;
+            Local_Y1 = Local_Y;
+            Local_Code1 = SHAPE_GetOutcode(Local_X1, Local_Y1, Local_Width, Local_Height);
+        }
+    }
+
+    TFT_DrawLine(Copy_TftDisplay, Copy_SpiPeripheral, (u16)Local_X0, (u16)Local_Y0, (u16)Local_X1, (u16)Local_Y1, Copy_Color);
+}
+
+static u8 SHAPE_GetOutcode(s32 Copy_X, s32 Copy_Y, s32 Copy_Width, s32 Copy_Height)
+{
+    u8 Local_Code = 0;
+
+    if (Copy_X < 0)
+    {
+        Local_Code |= SHAPE_OUT_LEFT;
+    }
+    else if (Copy_X >= Copy_Width)
+    {
+        Local_Code |= SHAPE_OUT_RIGHT;
+    }
+    if (Copy_Y < 0)
+    {
+        Local_Code |= SHAPE_OUT_TOP;
+    }
+    else if (Copy_Y >= Copy_Height)
+    {
+        Local_Code |= SHAPE_OUT_BOTTOM;
+    }
+
+    return Local_Code;
+}
+
+static s32 SHAPE_Interpolate(s32 Copy_From, s32 Copy_To, s32 Copy_Part, s32 Copy_Whole)
+{
+    s32 Local_Delta = Copy_To - Copy_From;
+    u32 Local_Offset;
+
+    if (Copy_Whole < 0)
+    {
+        Copy_Whole = -Copy_Whole;
+        Copy_Part = -Copy_Part;
+    }
+
+    /**< |delta| * part is at most 65535 * 65535 and fits in 32 unsigned bits */
+    Local_Offset = (((u32)((Local_Delta < 0) ? -Local_Delta : Local_Delta) * (u32)Copy_Part) + ((u32)Copy_Whole / 2)) / (u32)Copy_Whole;
+
+    return (Local_Delta < 0) ? (Copy_From - (s32)Local_Offset) : (Copy_From + (s32)Local_Offset);
+}
@@ -0,0 +1,28 @@
+/**
+ * @file WIDGET_config.h
+ * @brief This file contains the configuration options for the widget layer.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __WIDGET_CONFIG_H__
+#define __WIDGET_CONFIG_H__
+
+/**
+ * @brief Angle of the minimum of a gauge, in degrees clockwise from 3 o'clock.
+ */
+#define WIDGET_GAUGE_START_ANGLE    135
+
+/**
+ * @brief Angle covered by a gauge from its minimum to its maximum, in degrees (below 360).
+ */
+#define WIDGET_GAUGE_SWEEP          270
+
+/**
+ * @brief Corner radius of buttons, as a divisor of their height.
+ */
+#define WIDGET_BUTTON_ROUNDING      4
+
+#endif /**< __WIDGET_CONFIG_H__ */
@@ -0,0 +1,254 @@
+/**
+ * @file WIDGET_interface.h
+ * @brief This file contains the public interface of the retained-mode widget layer.
+ *
+ * Widgets (labels, bar graphs, gauges and buttons) are statically allocated by the
+ * application and registered on a screen. The application only sets their values; every
+ * widget remembers what it last drew and @ref WIDGET_Flush, called once per frame, redraws
+ * only the widgets whose pixels change, and only the part that changes:
+ * - a label redraws from its first changed character and clears what the old text covered
+ *   beyond the new one;
+ * - a bar graph redraws the band between its old and its new length;
+ * - a gauge redraws the arc between its old and its new angle; its angle is quantized so
+ *   that one step moves the outer edge by about one pixel;
+ * - a button redraws when its pressed state or its text changes.
+ * Setting a value that draws the same pixels (e.g. a bar value change smaller than one
+ * pixel) costs nothing.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Include SPI_interface.h and TFT_interface.h before this file.
+ *
+ * @note Example Usage:
+ * @code
+ * static WIDGET_t *widgets[4];
+ * static WIDGET_t speed, fuel, title, reset;
+ * static WIDGET_Screen_t screen;
+ *
+ * WIDGET_InitScreen(&screen, &tftConfig, spi, widgets, 4, 0x0000);
+ * WIDGET_AddGauge(&screen, &speed, 10, 10, 50, 8, 0, 240, 0x07E0, 0x2104);
+ * WIDGET_AddBar(&screen, &fuel, 130, 20, 16, 80, 0, 100, 0xFFE0, 0x2104);
+ * WIDGET_AddLabel(&screen, &title, 10, 120, 100, &Font_Terminus12, 0xFFFF, 0x0000, "0 km/h");
+ * WIDGET_AddButton(&screen, &reset, 10, 140, 60, 20, &Font_Terminus12, "Reset", 0xFFFF, 0x001F, 0x0010);
+ * WIDGET_DrawAll(&screen);
+ *
+ * while (1)
+ * {
+ *     WIDGET_SetValue(&speed, ReadSpeed());
+ *     WIDGET_SetValue(&fuel, ReadFuel());
+ *     WIDGET_Flush(&screen);                /// once per frame
+ * }
+ * @endcode
+ */
+
+#ifndef __WIDGET_INTERFACE_H__
+#define __WIDGET_INTERFACE_H__
+
+/**
+ * @brief Size of the text of a label or a button, terminating null included.
+ */
+#define WIDGET_TEXT_CAPACITY        24
+
+/**
+ * @brief Types of widgets.
+ */
+typedef enum {
+    WIDGET_LABEL,                   /**< One line of text. */
+    WIDGET_BAR,                     /**< Bar graph, horizontal when wider than high, filled from the left or the bottom. */
+    WIDGET_GAUGE,                   /**< Thick arc filled clockwise from its minimum. */
+    WIDGET_BUTTON                   /**< Rounded button with a centred text, pressed or released. */
+} WIDGET_Type_t;
+
+/**
+ * @brief One widget.
+ *
+ * The fields are set by the WIDGET_Add functions and updated by the WIDGET_Set functions;
+ * the application should not write them.
+ */
+typedef struct {
+    u8 Type;                        /**< A @ref WIDGET_Type_t. */
+    u8 Flags;                       /**< Redraw requests. */
+    u16 X;                          /**< X-coordinate of the top-left corner. */
+    u16 Y;                          /**< Y-coordinate of the top-left corner. */
+    u16 Width;                      /**< Width in pixels. */
+    u16 Height;                     /**< Height in pixels. */
+    u16 Foreground;                 /**< Text, bar or arc color (RGB565). */
+    u16 Background;                 /**< Label background, empty part of bars and gauges, button face (RGB565). */
+    u16 Accent;                     /**< Face of a pressed button (RGB565). */
+    u8 Thickness;                   /**< Width of the arc of a gauge. */
+    s32 Min;                        /**< Value of an empty bar or gauge. */
+    s32 Max;                        /**< Value of a full bar or gauge. */
+    s32 Value;                      /**< Current value. */
+    u16 Level;                      /**< Bar length, gauge angle or button state to show; first changed character of a label. */
+    u16 Drawn;                      /**< Bar length, gauge angle or button state on the screen; right end of the text of a label. */
+    const TFT_Font_t *Font;         /**< Font of a label or a button. */
+    char Text[WIDGET_TEXT_CAPACITY];/**< Text of a label or a button. */
+} WIDGET_t;
+
+/**
+ * @brief The widgets of one display.
+ *
+ * The widget list storage is provided by the caller through @ref WIDGET_InitScreen.
+ */
+typedef struct {
+    const TFT_Config_t *TftDisplay; /**< The display. */
+    SPI_t SpiPeripheral;            /**< The SPI peripheral of the display. */
+    WIDGET_t **Widgets;             /**< Storage for the widget list. */
+    u8 Capacity;                    /**< Number of widgets the storage can hold. */
+    u8 Count;                       /**< Number of widgets. */
+    u16 Background;                 /**< Screen color around the widgets (RGB565). */
+} WIDGET_Screen_t;
+
+/**
+ * @brief Initializes a screen without widgets.
+ *
+ * @param[out] Copy_Screen        The screen.
+ * @param[in]  Copy_TftDisplay    The display, already initialized with @ref TFT_Init.
+ * @param[in]  Copy_SpiPeripheral The SPI peripheral of the display.
+ * @param[in]  Copy_Widgets       Storage for Copy_Capacity widget pointers.
+ * @param[in]  Copy_Capacity      Number of widgets the storage can hold.
+ * @param[in]  Copy_Background    The screen color around the widgets (RGB565).
+ *
+ * @retval     0                  The screen was initialized.
+ * @retval     1                  A pointer is NULL or Copy_Capacity is 0.
+ */
+u8 WIDGET_InitScreen(WIDGET_Screen_t *Copy_Screen, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, WIDGET_t **Copy_Widgets, u8 Copy_Capacity, u16 Copy_Background);
+
+/**
+ * @brief Adds a label.
+ *
+ * The label is one line high. The text is clipped to Copy_Width pixels: the characters that
+ * do not fit whole are not drawn, and what the text does not cover is filled with
+ * Copy_Background.
+ *
+ * @param[in,out] Copy_Screen     The screen.
+ * @param[out]    Copy_Widget     The widget.
+ * @param[in]     Copy_XPosition  The X-coordinate of the top-left corner.
+ * @param[in]     Copy_YPosition  The Y-coordinate of the top-left corner.
+ * @param[in]     Copy_Width      The width in pixels.
+ * @param[in]     Copy_Font       The font.
+ * @param[in]     Copy_Foreground The text color (RGB565).
+ * @param[in]     Copy_Background The background color (RGB565).
+ * @param[in]     Copy_Text       The initial text, truncated to @ref WIDGET_TEXT_CAPACITY - 1 characters.
+ *
+ * @retval        0               The label was added.
+ * @retval        1               A pointer is NULL or the screen is full.
+ */
+u8 WIDGET_AddLabel(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, const TFT_Font_t *Copy_Font, u16 Copy_Foreground, u16 Copy_Background, const char *Copy_Text);
+
+/**
+ * @brief Adds a bar graph.
+ *
+ * @param[in,out] Copy_Screen     The screen.
+ * @param[out]    Copy_Widget     The widget.
+ * @param[in]     Copy_XPosition  The X-coordinate of the top-left corner.
+ * @param[in]     Copy_YPosition  The Y-coordinate of the top-left corner.
+ * @param[in]     Copy_Width      The width in pixels.
+ * @param[in]     Copy_Height     The height in pixels.
+ * @param[in]     Copy_Min        The value of an empty bar.
+ * @param[in]     Copy_Max        The value of a full bar, above Copy_Min.
+ * @param[in]     Copy_Foreground The color of the bar (RGB565).
+ * @param[in]     Copy_Background The color of the empty part (RGB565).
+ *
+ * @retval        0               The bar graph was added, at its minimum.
+ * @retval        1               A pointer is NULL, the screen is full or the range is empty.
+ */
+u8 WIDGET_AddBar(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, s32 Copy_Min, s32 Copy_Max, u16 Copy_Foreground, u16 Copy_Background);
+
+/**
+ * @brief Adds a gauge.
+ *
+ * The gauge is an arc of @ref WIDGET_GAUGE_SWEEP degrees, filled clockwise from
+ * @ref WIDGET_GAUGE_START_ANGLE. Only the arc is drawn, the inside of the gauge is free for
+ * e.g. a label.
+ *
+ * @param[in,out] Copy_Screen     The screen.
+ * @param[out]    Copy_Widget     The widget.
+ * @param[in]     Copy_XPosition  The X-coordinate of the top-left corner of the bounding square.
+ * @param[in]     Copy_YPosition  The Y-coordinate of the top-left corner of the bounding square.
+ * @param[in]     Copy_Radius     The outer radius; the gauge is 2 * Copy_Radius + 1 pixels wide.
+ * @param[in]     Copy_Thickness  The width of the arc in pixels.
+ * @param[in]     Copy_Min        The value of an empty gauge.
+ * @param[in]     Copy_Max        The value of a full gauge, above Copy_Min.
+ * @param[in]     Copy_Foreground The color of the filled arc (RGB565).
+ * @param[in]     Copy_Background The color of the empty arc (RGB565).
+ *
+ * @retval        0               The gauge was added, at its minimum.
+ * @retval        1               A pointer is NULL, the screen is full, the radius or the
+ *                                thickness is 0 or the range is empty.
+ */
+u8 WIDGET_AddGauge(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Radius, u8 Copy_Thickness, s32 Copy_Min, s32 Copy_Max, u16 Copy_Foreground, u16 Copy_Background);
+
+/**
+ * @brief Adds a button.
+ *
+ * @param[in,out] Copy_Screen     The screen.
+ * @param[out]    Copy_Widget     The widget.
+ * @param[in]     Copy_XPosition  The X-coordinate of the top-left corner.
+ * @param[in]     Copy_YPosition  The Y-coordinate of the top-left corner.
+ * @param[in]     Copy_Width      The width in pixels.
+ * @param[in]     Copy_Height     The height in pixels.
+ * @param[in]     Copy_Font       The font.
+ * @param[in]     Copy_Text       The text, centred on the button.
+ * @param[in]     Copy_Foreground The text color (RGB565).
+ * @param[in]     Copy_Background The face color when released (RGB565).
+ * @param[in]     Copy_Accent     The face color when pressed (RGB565).
+ *
+ * @retval        0               The button was added, released.
+ * @retval        1               A pointer is NULL or the screen is full.
+ */
+u8 WIDGET_AddButton(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const TFT_Font_t *Copy_Font, const char *Copy_Text, u16 Copy_Foreground, u16 Copy_Background, u16 Copy_Accent);
+
+/**
+ * @brief Sets the value of a bar graph or a gauge.
+ *
+ * The value is clamped to the range. The widget is redrawn at the next flush only if its
+ * length or angle changes.
+ *
+ * @param[in,out] Copy_Widget The widget.
+ * @param[in]     Copy_Value  The value.
+ */
+void WIDGET_SetValue(WIDGET_t *Copy_Widget, s32 Copy_Value);
+
+/**
+ * @brief Sets the text of a label or a button.
+ *
+ * @param[in,out] Copy_Widget The widget.
+ * @param[in]     Copy_Text   The text, truncated to @ref WIDGET_TEXT_CAPACITY - 1 characters.
+ */
+void WIDGET_SetText(WIDGET_t *Copy_Widget, const char *Copy_Text);
+
+/**
+ * @brief Sets the state of a button.
+ *
+ * @param[in,out] Copy_Widget  The widget.
+ * @param[in]     Copy_Pressed 1 when pressed, 0 when released.
+ */
+void WIDGET_SetPressed(WIDGET_t *Copy_Widget, u8 Copy_Pressed);
+
+/**
+ * @brief Requests a complete redraw of a widget at the next flush, e.g. after drawing over it.
+ *
+ * @param[in,out] Copy_Widget The widget.
+ */
+void WIDGET_Invalidate(WIDGET_t *Copy_Widget);
+
+/**
+ * @brief Clears the screen and draws every widget completely.
+ *
+ * @param[in,out] Copy_Screen The screen.
+ */
+void WIDGET_DrawAll(WIDGET_Screen_t *Copy_Screen);
+
+/**
+ * @brief Redraws the changed parts of the widgets, to be called once per frame.
+ *
+ * @param[in,out] Copy_Screen The screen.
+ *
+ * @return The number of widgets redrawn.
+ */
+u8 WIDGET_Flush(WIDGET_Screen_t *Copy_Screen);
+
+#endif /**< __WIDGET_INTERFACE_H__ */
@@ -0,0 +1,126 @@
+/**
+ * @file WIDGET_private.h
+ * @brief This file contains the private interface of the retained-mode widget layer.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __WIDGET_PRIVATE_H__
+#define __WIDGET_PRIVATE_H__
+
+/**
+ * @brief Flags of a widget.
+ */
+#define WIDGET_FLAG_DIRTY           0x01    /**< Something to redraw. */
+#define WIDGET_FLAG_FULL            0x02    /**< Redraw the whole widget, not only the change. */
+
+/**
+ * @brief Arc length of one degree is radius * pi / 180: 57 / radius degrees move the outer
+ * edge of a gauge by one pixel.
+ */
+#define WIDGET_DEGREES_PER_RADIAN   57
+
+/**
+ * @brief Register a widget on a screen and request its first drawing.
+ *
+ * @param[in,out] Copy_Screen The screen.
+ * @param[in,out] Copy_Widget The widget, its type and geometry already set.
+ * @return 0 when registered, 1 when the screen is full.
+ */
+static u8 WIDGET_Register(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget);
+
+/**
+ * @brief Redraw a widget, completely or only its change.
+ *
+ * @param[in]     Copy_Screen The screen.
+ * @param[in,out] Copy_Widget The widget.
+ */
+static void WIDGET_Draw(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget);
+
+/**
+ * @brief Redraw a label from its first changed character, clipped to its width.
+ *
+ * @param[in]     Copy_Screen The screen.
+ * @param[in,out] Copy_Widget The label.
+ * @param[in]     Copy_IsFull 1 to redraw the whole label.
+ */
+static void WIDGET_DrawLabel(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u8 Copy_IsFull);
+
+/**
+ * @brief Redraw the band of a bar graph between its drawn and its new length.
+ *
+ * @param[in]     Copy_Screen The screen.
+ * @param[in,out] Copy_Widget The bar graph.
+ * @param[in]     Copy_IsFull 1 to redraw the whole bar.
+ */
+static void WIDGET_DrawBar(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u8 Copy_IsFull);
+
+/**
+ * @brief Redraw the arc of a gauge between its drawn and its new angle.
+ *
+ * @param[in]     Copy_Screen The screen.
+ * @param[in,out] Copy_Widget The gauge.
+ * @param[in]     Copy_IsFull 1 to redraw the whole arc.
+ */
+static void WIDGET_DrawGauge(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u8 Copy_IsFull);
+
+/**
+ * @brief Redraw a button.
+ *
+ * @param[in]     Copy_Screen The screen.
+ * @param[in,out] Copy_Widget The button.
+ */
+static void WIDGET_DrawButton(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget);
+
+/**
+ * @brief Fill a part of a bar graph along its length.
+ *
+ * @param[in] Copy_Screen The screen.
+ * @param[in] Copy_Widget The bar graph.
+ * @param[in] Copy_From   The start of the part, in pixels from the empty end.
+ * @param[in] Copy_To     The end of the part (excluded).
+ * @param[in] Copy_Color  The color.
+ */
+static void WIDGET_FillBar(const WIDGET_Screen_t *Copy_Screen, const WIDGET_t *Copy_Widget, u16 Copy_From, u16 Copy_To, u16 Copy_Color);
+
+/**
+ * @brief Compute the bar length or the gauge angle showing the value of a widget.
+ *
+ * @param[in] Copy_Widget The bar graph or gauge.
+ * @return The length in pixels or the angle in degrees.
+ */
+static u16 WIDGET_GetLevel(const WIDGET_t *Copy_Widget);
+
+/**
+ * @brief Width of the first characters of a text.
+ *
+ * @param[in] Copy_Font  The font.
+ * @param[in] Copy_Text  The text.
+ * @param[in] Copy_Count The number of characters.
+ * @return The width in pixels.
+ */
+static u16 WIDGET_GetPrefixWidth(const TFT_Font_t *Copy_Font, const char *Copy_Text, u16 Copy_Count);
+
+/**
+ * @brief Number of first characters of a text that fit whole in a width.
+ *
+ * @param[in] Copy_Font  The font.
+ * @param[in] Copy_Text  The text.
+ * @param[in] Copy_Width The width in pixels.
+ * @return The number of characters.
+ */
+static u16 WIDGET_GetFittingCount(const TFT_Font_t *Copy_Font, const char *Copy_Text, u16 Copy_Width);
+
+/**
+ * @brief Copy a text into a widget.
+ *
+ * @param[out] Copy_Widget The widget.
+ * @param[in]  Copy_Text   The text, truncated to fit.
+ */
+static void WIDGET_CopyText(WIDGET_t *Copy_Widget, const char *Copy_Text);
+
+#endif /**< __WIDGET_PRIVATE_H__ */
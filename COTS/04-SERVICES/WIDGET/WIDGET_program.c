@@ -0,0 +1,540 @@
+/**
+ * @file WIDGET_program.c
+ * @brief This file contains the implementation of the retained-mode widget layer.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "SHAPE_interface.h"
+#include "WIDGET_config.h"
+#include "WIDGET_interface.h"
+#include "WIDGET_private.h"
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u8 WIDGET_InitScreen(WIDGET_Screen_t *Copy_Screen, const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral, WIDGET_t **Copy_Widgets, u8 Copy_Capacity, u16 Copy_Background)
+{
+    u8 Local_u8ErrorStatus = 0;
+
+    if ((Copy_Screen != NULL) && (Copy_TftDisplay != NULL) && (Copy_Widgets != NULL) && (Copy_Capacity > 0))
+    {
+        Copy_Screen->TftDisplay = Copy_TftDisplay;
+        Copy_Screen->SpiPeripheral = Copy_SpiPeripheral;
+        Copy_Screen->Widgets = Copy_Widgets;
+        Copy_Screen->Capacity = Copy_Capacity;
+        Copy_Screen->Count = 0;
+        Copy_Screen->Background = Copy_Background;
+    }
+    else
+    {
+        Local_u8ErrorStatus = 1;
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+u8 WIDGET_AddLabel(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, const TFT_Font_t *Copy_Font, u16 Copy_Foreground, u16 Copy_Background, const char *Copy_Text)
+{
+    if ((Copy_Screen == NULL) || (Copy_Widget == NULL) || (Copy_Font == NULL) || (Copy_Text == NULL))
+    {
+        return 1;
+    }
+
+    Copy_Widget->Type = WIDGET_LABEL;
+    Copy_Widget->X = Copy_XPosition;
+    Copy_Widget->Y = Copy_YPosition;
+    Copy_Widget->Width = Copy_Width;
+    Copy_Widget->Height = Copy_Font->TFT_LineHeight;
+    Copy_Widget->Foreground = Copy_Foreground;
+    Copy_Widget->Background = Copy_Background;
+    Copy_Widget->Font = Copy_Font;
+    Copy_Widget->Level = 0;
+    Copy_Widget->Drawn = Copy_XPosition;
+    WIDGET_CopyText(Copy_Widget, Copy_Text);
+
+    return WIDGET_Register(Copy_Screen, Copy_Widget);
+}
+
+u8 WIDGET_AddBar(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, s32 Copy_Min, s32 Copy_Max, u16 Copy_Foreground, u16 Copy_Background)
+{
+    if ((Copy_Screen == NULL) || (Copy_Widget == NULL) || (Copy_Max <= Copy_Min))
+    {
+        return 1;
+    }
+
+    Copy_Widget->Type = WIDGET_BAR;
+    Copy_Widget->X = Copy_XPosition;
+    Copy_Widget->Y = Copy_YPosition;
+    Copy_Widget->Width = Copy_Width;
+    Copy_Widget->Height = Copy_Height;
+    Copy_Widget->Foreground = Copy_Foreground;
+    Copy_Widget->Background = Copy_Background;
+    Copy_Widget->Min = Copy_Min;
+    Copy_Widget->Max = Copy_Max;
+    Copy_Widget->Value = Copy_Min;
+    Copy_Widget->Level = 0;
+    Copy_Widget->Drawn = 0;
+
+    return WIDGET_Register(Copy_Screen, Copy_Widget);
+}
+
+u8 WIDGET_AddGauge(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Radius, u8 Copy_Thickness, s32 Copy_Min, s32 Copy_Max, u16 Copy_Foreground, u16 Copy_Background)
+{
+    if ((Copy_Screen == NULL) || (Copy_Widget == NULL) || (Copy_Radius == 0) || (Copy_Thickness == 0) || (Copy_Max <= Copy_Min))
+    {
+        return 1;
+    }
+
+    Copy_Widget->Type = WIDGET_GAUGE;
+    Copy_Widget->X = Copy_XPosition;
+    Copy_Widget->Y = Copy_YPosition;
+    Copy_Widget->Width = (2 * Copy_Radius) + 1;
+    Copy_Widget->Height = (2 * Copy_Radius) + 1;
+    Copy_Widget->Foreground = Copy_Foreground;
+    Copy_Widget->Background = Copy_Background;
+    Copy_Widget->Thickness = Copy_Thickness;
+    Copy_Widget->Min = Copy_Min;
+    Copy_Widget->Max = Copy_Max;
+    Copy_Widget->Value = Copy_Min;
+    Copy_Widget->Level = 0;
+    Copy_Widget->Drawn = 0;
+
+    return WIDGET_Register(Copy_Screen, Copy_Widget);
+}
+
+u8 WIDGET_AddButton(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u16 Copy_XPosition, u16 Copy_YPosition, u16 Copy_Width, u16 Copy_Height, const TFT_Font_t *Copy_Font, const char *Copy_Text, u16 Copy_Foreground, u16 Copy_Background, u16 Copy_Accent)
+{
+    if ((Copy_Screen == NULL) || (Copy_Widget == NULL) || (Copy_Font == NULL) || (Copy_Text == NULL))
+    {
+        return 1;
+    }
+
+    Copy_Widget->Type = WIDGET_BUTTON;
+    Copy_Widget->X = Copy_XPosition;
+    Copy_Widget->Y = Copy_YPosition;
+    Copy_Widget->Width = Copy_Width;
+    Copy_Widget->Height = Copy_Height;
+    Copy_Widget->Foreground = Copy_Foreground;
+    Copy_Widget->Background = Copy_Background;
+    Copy_Widget->Accent = Copy_Accent;
+    Copy_Widget->Font = Copy_Font;
+    Copy_Widget->Level = 0;
+    Copy_Widget->Drawn = 0;
+    WIDGET_CopyText(Copy_Widget, Copy_Text);
+
+    return WIDGET_Register(Copy_Screen, Copy_Widget);
+}
+
+void WIDGET_SetValue(WIDGET_t *Copy_Widget, s32 Copy_Value)
+{
+    if ((Copy_Widget == NULL) || ((Copy_Widget->Type != WIDGET_BAR) && (Copy_Widget->Type != WIDGET_GAUGE)))
+    {
+        return;
+    }
+
+    if (Copy_Value < Copy_Widget->Min)
+    {
+        Copy_Value = Copy_Widget->Min;
+    }
+    else if (Copy_Value > Copy_Widget->Max)
+    {
+        Copy_Value = Copy_Widget->Max;
+    }
+    Copy_Widget->Value = Copy_Value;
+
+    /**< Only a change of the drawn length or angle is worth a redraw */
+    Copy_Widget->Level = WIDGET_GetLevel(Copy_Widget);
+    if (Copy_Widget->Level != Copy_Widget->Drawn)
+    {
+        Copy_Widget->Flags |= WIDGET_FLAG_DIRTY;
+    }
+    else if ((Copy_Widget->Flags & WIDGET_FLAG_FULL) == 0)
+    {
+        Copy_Widget->Flags = 0;
+    }
+}
+
+void WIDGET_SetText(WIDGET_t *Copy_Widget, const char *Copy_Text)
+{
+    u16 Local_Index = 0;
+
+    if ((Copy_Widget == NULL) || (Copy_Text == NULL) || ((Copy_Widget->Type != WIDGET_LABEL) && (Copy_Widget->Type != WIDGET_BUTTON)))
+    {
+        return;
+    }
+
+    /**< First changed character */
+    while ((Local_Index < (WIDGET_TEXT_CAPACITY - 1)) && (Copy_Text[Local_Index] != '\0') && (Copy_Text[Local_Index] == Copy_Widget->Text[Local_Index]))
+    {
+        Local_Index++;
+    }
+    if ((Local_Index == (WIDGET_TEXT_CAPACITY - 1)) || (Copy_Text[Local_Index] == Copy_Widget->Text[Local_Index]))
+    {
+        /**< Same text */
+        return;
+    }
+
+    if (Copy_Widget->Type == WIDGET_BUTTON)
+    {
+        Copy_Widget->Flags |= WIDGET_FLAG_DIRTY | WIDGET_FLAG_FULL;
+    }
+    else if (((Copy_Widget->Flags & WIDGET_FLAG_DIRTY) == 0) || (Local_Index < Copy_Widget->Level))
+    {
+        Copy_Widget->Level = Local_Index;
+    }
+    Copy_Widget->Flags |= WIDGET_FLAG_DIRTY;
+    WIDGET_CopyText(Copy_Widget, Copy_Text);
+}
+
+void WIDGET_SetPressed(WIDGET_t *Copy_Widget, u8 Copy_Pressed)
+{
+    if ((Copy_Widget == NULL) || (Copy_Widget->Type != WIDGET_BUTTON))
+    {
+        return;
+    }
+
+    Copy_Widget->Level = (Copy_Pressed != 0) ? 1 : 0;
+    if (Copy_Widget->Level != Copy_Widget->Drawn)
+    {
+        Copy_Widget->Flags |= WIDGET_FLAG_DIRTY;
+    }
+    else if ((Copy_Widget->Flags & WIDGET_FLAG_FULL) == 0)
+    {
+        Copy_Widget->Flags = 0;
+    }
+}
+
+void WIDGET_Invalidate(WIDGET_t *Copy_Widget)
+{
+    if (Copy_Widget != NULL)
+    {
+        Copy_Widget->Flags |= WIDGET_FLAG_DIRTY | WIDGET_FLAG_FULL;
+    }
+}
+
+void WIDGET_DrawAll(WIDGET_Screen_t *Copy_Screen)
+{
+    u8 Local_Index;
+
+    if (Copy_Screen == NULL)
+    {
+        return;
+    }
+
+    TFT_FillRect(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, 0, 0, Copy_Screen->TftDisplay->TFT_Controller->TFT_Width,
+                 Copy_Screen->TftDisplay->TFT_Controller->TFT_Height, Copy_Screen->Background);
+    for (Local_Index = 0; Local_Index < Copy_Screen->Count; Local_Index++)
+    {
+        Copy_Screen->Widgets[Local_Index]->Flags = WIDGET_FLAG_DIRTY | WIDGET_FLAG_FULL;
+    }
+    WIDGET_Flush(Copy_Screen);
+}
+
+u8 WIDGET_Flush(WIDGET_Screen_t *Copy_Screen)
+{
+    u8 Local_Redrawn = 0;
+    u8 Local_Index;
+
+    if (Copy_Screen == NULL)
+    {
+        return 0;
+    }
+
+    for (Local_Index = 0; Local_Index < Copy_Screen->Count; Local_Index++)
+    {
+        if ((Copy_Screen->Widgets[Local_Index]->Flags & WIDGET_FLAG_DIRTY) != 0)
+        {
+            WIDGET_Draw(Copy_Screen, Copy_Screen->Widgets[Local_Index]);
+            Copy_Screen->Widgets[Local_Index]->Flags = 0;
+            Local_Redrawn++;
+        }
+    }
+
+    return Local_Redrawn;
+}
+
+static u8 WIDGET_Register(WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget)
+{
+    u8 Local_u8ErrorStatus = 0;
+
+    if (Copy_Screen->Count < Copy_Screen->Capacity)
+    {
+        Copy_Widget->Flags = WIDGET_FLAG_DIRTY | WIDGET_FLAG_FULL;
+        Copy_Screen->Widgets[Copy_Screen->Count++] = Copy_Widget;
+    }
+    else
+    {
+        Local_u8ErrorStatus = 1;
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+static void WIDGET_Draw(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget)
+{
+    u8 Local_IsFull = ((Copy_Widget->Flags & WIDGET_FLAG_FULL) != 0) ? 1 : 0;
+
+    switch (Copy_Widget->Type)
+    {
+        case WIDGET_LABEL:
+            WIDGET_DrawLabel(Copy_Screen, Copy_Widget, Local_IsFull);
+            break;
+
+        case WIDGET_BAR:
+            WIDGET_DrawBar(Copy_Screen, Copy_Widget, Local_IsFull);
+            break;
+
+        case WIDGET_GAUGE:
+            WIDGET_DrawGauge(Copy_Screen, Copy_Widget, Local_IsFull);
+            break;
+
+        case WIDGET_BUTTON:
+            WIDGET_DrawButton(Copy_Screen, Copy_Widget);
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void WIDGET_DrawLabel(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u8 Copy_IsFull)
+{
+    u16 Local_First = Copy_IsFull ? 0 : Copy_Widget->Level;
+    u16 Local_OldEnd = Copy_IsFull ? (Copy_Widget->X + Copy_Widget->Width) : Copy_Widget->Drawn;
+    u16 Local_Count = WIDGET_GetFittingCount(Copy_Widget->Font, Copy_Widget->Text, Copy_Widget->Width);
+    char Local_Text[WIDGET_TEXT_CAPACITY];
+    u16 Local_Index = 0;
+    u16 Local_End;
+
+    /**< The characters before the first change are already on the screen, the ones past the width are clipped */
+    if (Local_First > Local_Count)
+    {
+        Local_First = Local_Count;
+    }
+    while ((Local_First + Local_Index) < Local_Count)
+    {
+        Local_Text[Local_Index] = Copy_Widget->Text[Local_First + Local_Index];
+        Local_Index++;
+    }
+    Local_Text[Local_Index] = '\0';
+    Local_End = TFT_DrawText(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral,
+                             Copy_Widget->X + WIDGET_GetPrefixWidth(Copy_Widget->Font, Copy_Widget->Text, Local_First), Copy_Widget->Y,
+                             Local_Text, Copy_Widget->Font, Copy_Widget->Foreground, Copy_Widget->Background);
+
+    /**< Clear what the old text covered beyond the new one */
+    if (Local_End < Local_OldEnd)
+    {
+        TFT_FillRect(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, Local_End, Copy_Widget->Y, Local_OldEnd - Local_End, Copy_Widget->Height, Copy_Widget->Background);
+    }
+
+    Copy_Widget->Drawn = Local_End;
+    Copy_Widget->Level = 0;
+}
+
+static void WIDGET_DrawBar(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u8 Copy_IsFull)
+{
+    u16 Local_Length = (Copy_Widget->Width >= Copy_Widget->Height) ? Copy_Widget->Width : Copy_Widget->Height;
+
+    if (Copy_IsFull)
+    {
+        WIDGET_FillBar(Copy_Screen, Copy_Widget, 0, Copy_Widget->Level, Copy_Widget->Foreground);
+        WIDGET_FillBar(Copy_Screen, Copy_Widget, Copy_Widget->Level, Local_Length, Copy_Widget->Background);
+    }
+    else if (Copy_Widget->Level > Copy_Widget->Drawn)
+    {
+        WIDGET_FillBar(Copy_Screen, Copy_Widget, Copy_Widget->Drawn, Copy_Widget->Level, Copy_Widget->Foreground);
+    }
+    else
+    {
+        WIDGET_FillBar(Copy_Screen, Copy_Widget, Copy_Widget->Level, Copy_Widget->Drawn, Copy_Widget->Background);
+    }
+
+    Copy_Widget->Drawn = Copy_Widget->Level;
+}
+
+static void WIDGET_DrawGauge(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget, u8 Copy_IsFull)
+{
+    u16 Local_Radius = Copy_Widget->Width / 2;
+    s16 Local_XCenter = (s16)(Copy_Widget->X + Local_Radius);
+    s16 Local_YCenter = (s16)(Copy_Widget->Y + Local_Radius);
+    u16 Local_Start = WIDGET_GAUGE_START_ANGLE;
+
+    /**< Arcs include both their end rays: the filled arc is drawn last so it keeps its end ray */
+    if (Copy_IsFull)
+    {
+        if (Copy_Widget->Level < WIDGET_GAUGE_SWEEP)
+        {
+            SHAPE_DrawArc(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, Local_XCenter, Local_YCenter, Local_Radius, Copy_Widget->Thickness,
+                          Local_Start + Copy_Widget->Level, Local_Start + WIDGET_GAUGE_SWEEP, Copy_Widget->Background);
+        }
+        if (Copy_Widget->Level > 0)
+        {
+            SHAPE_DrawArc(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, Local_XCenter, Local_YCenter, Local_Radius, Copy_Widget->Thickness,
+                          Local_Start, Local_Start + Copy_Widget->Level, Copy_Widget->Foreground);
+        }
+    }
+    else if (Copy_Widget->Level > Copy_Widget->Drawn)
+    {
+        SHAPE_DrawArc(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, Local_XCenter, Local_YCenter, Local_Radius, Copy_Widget->Thickness,
+                      Local_Start + Copy_Widget->Drawn, Local_Start + Copy_Widget->Level, Copy_Widget->Foreground);
+    }
+    else if (Copy_Widget->Level < Copy_Widget->Drawn)
+    {
+        SHAPE_DrawArc(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, Local_XCenter, Local_YCenter, Local_Radius, Copy_Widget->Thickness,
+                      Local_Start + Copy_Widget->Level, Local_Start + Copy_Widget->Drawn, Copy_Widget->Background);
+        if (Copy_Widget->Level > 0)
+        {
+            /**< Give the end ray back to the filled arc */
+            SHAPE_DrawArc(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, Local_XCenter, Local_YCenter, Local_Radius, Copy_Widget->Thickness,
+                          Local_Start + Copy_Widget->Level - 1, Local_Start + Copy_Widget->Level, Copy_Widget->Foreground);
+        }
+    }
+
+    Copy_Widget->Drawn = Copy_Widget->Level;
+}
+
+static void WIDGET_DrawButton(const WIDGET_Screen_t *Copy_Screen, WIDGET_t *Copy_Widget)
+{
+    u16 Local_Face = (Copy_Widget->Level != 0) ? Copy_Widget->Accent : Copy_Widget->Background;
+    u16 Local_TextWidth = TFT_GetTextWidth(Copy_Widget->Text, Copy_Widget->Font);
+    u16 Local_X = Copy_Widget->X;
+    u16 Local_Y = Copy_Widget->Y;
+
+    SHAPE_FillRoundRect(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, (s16)Copy_Widget->X, (s16)Copy_Widget->Y, Copy_Widget->Width, Copy_Widget->Height,
+                        Copy_Widget->Height / WIDGET_BUTTON_ROUNDING, Local_Face);
+
+    /**< Centred text, its cells on the face color */
+    if (Local_TextWidth < Copy_Widget->Width)
+    {
+        Local_X += (Copy_Widget->Width - Local_TextWidth) / 2;
+    }
+    if (Copy_Widget->Font->TFT_LineHeight < Copy_Widget->Height)
+    {
+        Local_Y += (Copy_Widget->Height - Copy_Widget->Font->TFT_LineHeight) / 2;
+    }
+    TFT_DrawText(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, Local_X, Local_Y, Copy_Widget->Text, Copy_Widget->Font, Copy_Widget->Foreground, Local_Face);
+
+    Copy_Widget->Drawn = Copy_Widget->Level;
+}
+
+static void WIDGET_FillBar(const WIDGET_Screen_t *Copy_Screen, const WIDGET_t *Copy_Widget, u16 Copy_From, u16 Copy_To, u16 Copy_Color)
+{
+    if (Copy_From >= Copy_To)
+    {
+        return;
+    }
+
+    if (Copy_Widget->Width >= Copy_Widget->Height)
+    {
+        /**< Horizontal, filled from the left */
+        TFT_FillRect(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, Copy_Widget->X + Copy_From, Copy_Widget->Y, Copy_To - Copy_From, Copy_Widget->Height, Copy_Color);
+    }
+    else
+    {
+        /**< Vertical, filled from the bottom */
+        TFT_FillRect(Copy_Screen->TftDisplay, Copy_Screen->SpiPeripheral, Copy_Widget->X, Copy_Widget->Y + Copy_Widget->Height - Copy_To, Copy_Widget->Width, Copy_To - Copy_From, Copy_Color);
+    }
+}
+
+static u16 WIDGET_GetLevel(const WIDGET_t *Copy_Widget)
+{
+    u32 Local_Span = (u32)Copy_Widget->Max - (u32)Copy_Widget->Min;
+    u32 Local_Offset = (u32)Copy_Widget->Value - (u32)Copy_Widget->Min;
+    u32 Local_Length;
+    u32 Local_Level;
+    u32 Local_Step;
+
+    if (Copy_Widget->Type == WIDGET_BAR)
+    {
+        Local_Length = (Copy_Widget->Width >= Copy_Widget->Height) ? Copy_Widget->Width : Copy_Widget->Height;
+    }
+    else
+    {
+        Local_Length = WIDGET_GAUGE_SWEEP;
+    }
+
+    /**< Keep offset * length within 32 bits */
+    while (Local_Span > 0xFFFF)
+    {
+        Local_Span >>= 1;
+        Local_Offset >>= 1;
+    }
+    Local_Level = (Local_Offset * Local_Length) / Local_Span;
+
+    /**< Gauges move by steps of about one pixel on their outer edge; full stays full */
+    if ((Copy_Widget->Type == WIDGET_GAUGE) && (Local_Level < WIDGET_GAUGE_SWEEP))
+    {
+        Local_Step = (WIDGET_DEGREES_PER_RADIAN + (Copy_Widget->Width / 2) - 1) / (Copy_Widget->Width / 2);
+        Local_Level -= Local_Level % Local_Step;
+    }
+
+    return (u16)Local_Level;
+}
+
+static u16 WIDGET_GetPrefixWidth(const TFT_Font_t *Copy_Font, const char *Copy_Text, u16 Copy_Count)
+{
+    u16 Local_Width = 0;
+    u8 Local_Character;
+
+    while ((Copy_Count-- > 0) && (*Copy_Text != '\0'))
+    {
+        Local_Character = (u8)*Copy_Text++;
+        if ((Local_Character >= Copy_Font->TFT_FirstChar) && (Local_Character <= Copy_Font->TFT_LastChar))
+        {
+            Local_Width += Copy_Font->TFT_Glyphs[Local_Character - Copy_Font->TFT_FirstChar].TFT_XAdvance;
+        }
+    }
+
+    return Local_Width;
+}
+
+static u16 WIDGET_GetFittingCount(const TFT_Font_t *Copy_Font, const char *Copy_Text, u16 Copy_Width)
+{
+    u16 Local_Count = 0;
+    u16 Local_Width = 0;
+    u8 Local_Advance;
+    u8 Local_Character;
+    u8 Local_Fits = 1;
+
+    while (Local_Fits && (Copy_Text[Local_Count] != '\0'))
+    {
+        Local_Character = (u8)Copy_Text[Local_Count];
+        Local_Advance = 0;
+        if ((Local_Character >= Copy_Font->TFT_FirstChar) && (Local_Character <= Copy_Font->TFT_LastChar))
+        {
+            Local_Advance = Copy_Font->TFT_Glyphs[Local_Character - Copy_Font->TFT_FirstChar].TFT_XAdvance;
+        }
+
+        if (((u32)Local_Width + Local_Advance) > Copy_Width)
+        {
+            Local_Fits = 0;
+        }
+        else
+        {
+            Local_Width += Local_Advance;
+            Local_Count++;
+        }
+    }
+
+    return Local_Count;
+}
+
+static void WIDGET_CopyText(WIDGET_t *Copy_Widget, const char *Copy_Text)
+{
+    u16 Local_Index = 0;
+
+    while ((Local_Index < (WIDGET_TEXT_CAPACITY - 1)) && (Copy_Text[Local_Index] != '\0'))
+    {
+        Copy_Widget->Text[Local_Index] = Copy_Text[Local_Index];
+        Local_Index++;
+    }
+    Copy_Widget->Text[Local_Index] = '\0';
+}
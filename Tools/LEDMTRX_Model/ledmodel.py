@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""
+@file ledmodel.py
+@brief Measures the LED matrix refresh on the host for every brightness depth.
+
+For each LEDMTRX_GRAY_BITS value the LEDMTR driver is copied with its configuration changed
+to that depth, built with ledmtrx_model.c in place of the GPIO and SysTick drivers, and run.
+The driver rejects at build time a depth whose tick does not fit at STK_AHB_FREQUENCY, so the
+copy is built with STK_AHB_FREQUENCY set to the fastest --core-hz clock.
+The table gives the measured refresh rate, refresh interrupts per second and shortest
+SysTick period, the brightness error over a ramp of every level, the marquee frame rate, and
+for each core clock the estimated cost of a tick, the CPU load and whether a tick fits in the
+shortest bit plane.
+
+The run fails (exit status 1) when a brightness level is off by more than --max-error levels,
+when a check of the model fails (the frames of LEDMTRX_ShiftLeft, buffer swaps only at
+column 0, the marquee frames and rate; the failures are printed by the model), or when the
+model does not build with warnings as errors or exits with an error. It also fails when the
+configured depth (LEDMTRX_GRAY_BITS in LEDMRX_config.h) does not fit at the configured clock
+(STK_AHB_FREQUENCY in STK_config.h), or refreshes more than --max-refresh-error off
+LEDMTRX_REFRESH_RATE_HZ, and when the estimated tick of any depth takes more cycles than
+LEDMTRX_TICK_CYCLES in LEDMRX_private.h, the estimate the driver checks its clock with. For the other depths and clocks a tick that does not fit is reported,
+not failed: that depth needs a faster core or a lower LEDMTRX_REFRESH_RATE_HZ.
+
+The periods are modeled in microseconds, so a core clock column holds only with SysTick set up
+for that clock: STK_AHB_FREQUENCY in STK_config.h (8 MHz by default).
+
+@date 17 Oct 2026
+@version V01
+@author Mahmoud Abdelraouf Mahmoud
+
+Usage:
+    ledmodel.py [--bits 1,4,5,6,7,8] [--refresh-hz 100] [--core-hz 8000000,72000000]
+                [--cycles 200] [--max-error 0.05] [--max-refresh-error 0.05]
+                [--out report.json] [--cc gcc]
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.normpath(os.path.join(HERE, "..", ".."))
+COTS = os.path.join(ROOT, "COTS")
+LEDMTR = os.path.join(COTS, "03-HAL", "LEDMTR")
+STK_CONFIG = os.path.join(COTS, "02-MCAL", "07-STK", "STK_config.h")
+
+
+def read_define(path, name):
+    """Return the integer value of #define name in path."""
+    with open(path) as source:
+        return int(re.search(r"#define %s\s+(\d+)" % name, source.read()).group(1))
+
+
+def configure(directory, bits, refresh_hz, core_hz):
+    """Copy the driver into directory with the depth, refresh rate and core clock given."""
+    for name in os.listdir(LEDMTR):
+        shutil.copy(os.path.join(LEDMTR, name), directory)
+    path = os.path.join(directory, "LEDMRX_config.h")
+    with open(path, newline="") as source:
+        text = source.read()
+    text = re.sub(r"(#define LEDMTRX_GRAY_BITS )\d+", r"\g<1>%d" % bits, text)
+    if refresh_hz is not None:
+        text = re.sub(r"(#define LEDMTRX_REFRESH_RATE_HZ )\d+", r"\g<1>%d" % refresh_hz, text)
+    with open(path, "w", newline="") as target:
+        target.write(text)
+    # Next to LEDMRX_program.c, so it is found before the one of the STK driver
+    with open(STK_CONFIG, newline="") as source:
+        text = source.read()
+    text = re.sub(r"(#define STK_AHB_FREQUENCY\s+)\d+", r"\g<1>%d" % core_hz, text)
+    with open(os.path.join(directory, "STK_config.h"), "w", newline="") as target:
+        target.write(text)
+
+
+def build(cc, directory):
+    """Compile the model against the driver copied into directory; return the executable."""
+    includes = ["-I" + directory]
+    for path, _, _ in os.walk(COTS):
+        if os.path.normpath(path) != LEDMTR:
+            includes.append("-I" + path)
+    binary = os.path.join(directory, "ledmtrx_model")
+    sources = [os.path.join(HERE, "ledmtrx_model.c"), os.path.join(directory, "LEDMRX_program.c")]
+    command = [cc, "-std=c11", "-O2", "-Wall", "-Wextra", "-Werror"] + includes + ["-o", binary] + sources
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    if result.returncode != 0:
+        sys.exit("ledmodel: build failed\n" + result.stdout)
+    return binary
+
+
+def run(binary, args):
+    """Run the model and return its parsed report."""
+    command = [binary, "--cycles", str(args.cycles)]
+    for clock in args.core_hz:
+        command += ["--core-hz", str(clock)]
+    result = subprocess.run(command, stdout=subprocess.PIPE, text=True)
+    # Status 1 is a failed check: the report is complete and counts it
+    if result.returncode not in (0, 1):
+        sys.exit("ledmodel: model exited with status %d" % result.returncode)
+    return json.loads(result.stdout)
+
+
+def print_table(results, clocks):
+    header = "%4s %10s %8s %7s %7s %9s %7s" % ("bits", "refresh_hz", "ticks/s", "min_us", "stores", "error", "fps")
+    for clock in clocks:
+        header += "  %5.0fMHz: %6s %6s %4s" % (clock / 1e6, "tick_us", "load%", "fits")
+    print(header)
+    for entry in results:
+        line = "%4d %10.1f %8.0f %7d %7.2f %9.4f %7.2f" % (
+            entry["gray_bits"], entry["refresh_hz"], entry["ticks_per_s"], entry["min_period_us"],
+            entry["stores_per_tick"], entry["max_error_lsb"], entry["marquee_fps"])
+        for clock in entry["clocks"]:
+            line += "  %8s %7.2f %6.2f %4s" % ("", clock["tick_us"], clock["cpu_load_percent"],
+                                               "yes" if clock["fits"] else "NO")
+        print(line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Measure the LED matrix refresh per brightness depth.")
+    parser.add_argument("--bits", default="1,4,5,6,7,8", help="brightness depths to model")
+    parser.add_argument("--refresh-hz", type=int, help="LEDMTRX_REFRESH_RATE_HZ (default: the configuration)")
+    parser.add_argument("--core-hz", default="8000000,72000000", help="core clocks of the estimates")
+    parser.add_argument("--cycles", type=int, default=200, help="refresh cycles measured")
+    parser.add_argument("--max-error", type=float, default=0.05,
+                        help="largest brightness error allowed, in levels")
+    parser.add_argument("--max-refresh-error", type=float, default=0.05,
+                        help="largest refresh rate error of the configured depth, as a fraction")
+    parser.add_argument("--out", help="write the results (JSON)")
+    parser.add_argument("--cc", default="gcc", help="host C compiler")
+    args = parser.parse_args()
+    args.core_hz = [float(clock) for clock in args.core_hz.split(",")]
+
+    results = []
+    for bits in [int(value) for value in args.bits.split(",")]:
+        with tempfile.TemporaryDirectory() as directory:
+            configure(directory, bits, args.refresh_hz, max(args.core_hz))
+            results.append(run(build(args.cc, directory), args))
+
+    print_table(results, args.core_hz)
+
+    failures = ["%d bits: brightness off by %.4f levels" % (entry["gray_bits"], entry["max_error_lsb"])
+                for entry in results if entry["max_error_lsb"] > args.max_error]
+    failures += ["%d bits: %d checks failed" % (entry["gray_bits"], entry["checks_failed"])
+                 for entry in results if entry["checks_failed"]]
+
+    tick_cycles = read_define(os.path.join(LEDMTR, "LEDMRX_private.h"), "LEDMTRX_TICK_CYCLES")
+    failures += ["%d bits: a tick takes %d cycles, LEDMTRX_TICK_CYCLES is %d" % (entry["gray_bits"], entry["tick_cycles"], tick_cycles)
+                 for entry in results if entry["tick_cycles"] > tick_cycles]
+
+    # The configured depth must fit at the configured clock, whatever --core-hz models
+    gray_bits = read_define(os.path.join(LEDMTR, "LEDMRX_config.h"), "LEDMTRX_GRAY_BITS")
+    stk_hz = read_define(STK_CONFIG, "STK_AHB_FREQUENCY")
+    for entry in results:
+        if entry["gray_bits"] != gray_bits:
+            continue
+        tick_us = entry["tick_cycles"] * 1e6 / stk_hz
+        if tick_us >= entry["min_period_us"]:
+            failures.append("%d bits (configured): a %.2f us tick does not fit in %d us at STK_AHB_FREQUENCY %d Hz"
+                            % (gray_bits, tick_us, entry["min_period_us"], stk_hz))
+        if abs(entry["refresh_hz"] - entry["refresh_rate_hz"]) > args.max_refresh_error * entry["refresh_rate_hz"]:
+            failures.append("%d bits (configured): refreshes at %.1f Hz, LEDMTRX_REFRESH_RATE_HZ is %d"
+                            % (gray_bits, entry["refresh_hz"], entry["refresh_rate_hz"]))
+
+    if args.out:
+        with open(args.out, "w") as target:
+            json.dump({"results": results, "passed": not failures}, target, indent=2)
+            target.write("\n")
+
+    for line in failures:
+        print("FAILED: " + line)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,575 @@
+/**
+ * @file ledmtrx_model.c
+ * @brief Host model of the LED matrix refresh: runs the unchanged LEDMTRX driver against a
+ * simulated GPIO port and SysTick timer and prints its timing as JSON.
+ *
+ * The SysTick model counts in microseconds (the interval unit of STK_interface.h) and
+ * reloads like the hardware: a new LOAD value is only taken when the current period ends, and
+ * a period lasts LOAD + 1 counts. Between two refresh ticks the port outputs do not change, so
+ * the on-time of every LED is integrated exactly. The report gives:
+ * - refresh_hz    measured refresh cycles per second;
+ * - ticks_per_s   refresh interrupts per second;
+ * - min_period_us shortest SysTick period, the time left to the shortest bit plane;
+ * - stores_per_tick GPIO set/reset stores per tick;
+ * - max_error_lsb worst difference between the measured brightness of an LED and its level,
+ *                 in levels, over a ramp of all the levels;
+ * - tick_cycles and cycle_start_cycles the estimated cost of a tick and of the first tick of
+ *                 a refresh cycle (swap and marquee frame), from MODEL_*_CYCLES;
+ * - per core clock: the CPU load and whether a tick fits in the shortest plane, with
+ *                 STK_AHB_FREQUENCY in STK_config.h set to that clock (the driver does not
+ *                 build when it does not fit at STK_AHB_FREQUENCY).
+ *
+ * After the measurement the model checks what the refresh lights, tick by tick: the frames of
+ * LEDMTRX_ShiftLeft for several shifts, that a frame written or swapped in the middle of a
+ * refresh cycle only shows from the next column 0, and that the marquee scrolls one column per
+ * frame at its animation rate. Every failure is printed on stderr and counted in checks_failed,
+ * and the model then exits with status 1; marquee_fps is the frame rate checked.
+ *
+ * Tools/LEDMTRX_Model/ledmodel.py builds this program for every brightness depth and prints
+ * the results as a table.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     ledmtrx_model [--cycles 200] [--core-hz 8000000] [--core-hz 72000000]
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "GPIO_interface.h"
+#include "STK_interface.h"
+/**< HAL */
+#include "LEDMRX_config.h"
+#include "LEDMRX_interface.h"
+
+/**
+ * @brief Estimated Cortex-M3 cycles, from the instruction counts of the driver.
+ *
+ * MODEL_TICK_CYCLES covers the interrupt entry and exit (24), SysTick_Handler and the
+ * callback call, the bookkeeping of LEDMTRX_Refresh and STK_SetNextInterval; every
+ * GPIO_SetPortBits call adds MODEL_STORE_CYCLES. The first tick of a cycle adds the copy of
+ * the bit planes after a swap and the rendering of a marquee frame.
+ */
+#define MODEL_TICK_CYCLES           70
+#define MODEL_STORE_CYCLES          20
+#define MODEL_COPY_CYCLES_PER_BYTE  4
+#define MODEL_RENDER_CYCLES_PER_COL 40
+
+/**
+ * @brief Largest number of core clocks given on the command line.
+ */
+#define MODEL_MAX_CLOCKS            4
+
+/**
+ * @brief Refresh ticks of one refresh cycle: every bit plane of every column.
+ */
+#define MODEL_TICKS_PER_CYCLE       ((u32)LEDMTRX_NUM_COLS * LEDMTRX_GRAY_BITS)
+
+/**
+ * @brief Check failures printed; the others are only counted.
+ */
+#define MODEL_MAX_REPORTS           8
+
+/**
+ * @brief Animation rate and text of the marquee check, and the width of the strip it scrolls:
+ * the blank display, then 5 glyph columns and a blank column per character.
+ */
+#define MODEL_MARQUEE_RATE_HZ       25
+#define MODEL_MARQUEE_TEXT          "LED"
+#define MODEL_MARQUEE_WIDTH         (LEDMTRX_NUM_COLS + 3 * 6)
+
+/**< Pins of the rows and columns, from the configuration */
+static const u8 MODEL_RowPins[LEDMTRX_NUM_ROWS][2] =
+{
+    { LEDMTRX_ROW0_PIN }, { LEDMTRX_ROW1_PIN }, { LEDMTRX_ROW2_PIN }, { LEDMTRX_ROW3_PIN },
+    { LEDMTRX_ROW4_PIN }, { LEDMTRX_ROW5_PIN }, { LEDMTRX_ROW6_PIN }, { LEDMTRX_ROW7_PIN }
+};
+
+static const u8 MODEL_ColPins[LEDMTRX_NUM_COLS][2] =
+{
+    { LEDMTRX_COL0_PIN }, { LEDMTRX_COL1_PIN }, { LEDMTRX_COL2_PIN }, { LEDMTRX_COL3_PIN },
+    { LEDMTRX_COL4_PIN }, { LEDMTRX_COL5_PIN }, { LEDMTRX_COL6_PIN }, { LEDMTRX_COL7_PIN }
+};
+
+/**< The marquee strip of MODEL_MARQUEE_TEXT, glyphs from the font of LEDMRX_program.c */
+static const u8 MODEL_MarqueeColumns[MODEL_MARQUEE_WIDTH] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00,   /**< L */
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,   /**< E */
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00    /**< D */
+};
+
+/**< GPIO model: output data registers of ports A to C and the number of stores */
+static u16 MODEL_Output[3];
+static u32 MODEL_Stores = 0;
+
+/**< SysTick model: reload value in counts, callback and running state */
+static u32 MODEL_Load = 0;
+static void (*MODEL_Callback)(void) = NULL;
+static u8 MODEL_Running = 0;
+
+/**< Ticks since LEDMTRX_StartRefresh and the time they took, in microseconds */
+static u32 MODEL_Ticks = 0;
+static double MODEL_Clock = 0.0;
+
+/**< Check failures */
+static u32 MODEL_Failures = 0;
+
+/**< Measurements */
+static double MODEL_OnTime[LEDMTRX_NUM_ROWS][LEDMTRX_NUM_COLS];
+static double MODEL_Time = 0.0;
+static u32 MODEL_MinPeriod = 0xFFFFFFFF;
+
+void GPIO_SetPinMode(u8 Copy_PORT, u8 Copy_PIN, u8 Copy_Mode)
+{
+    (void)Copy_PORT;
+    (void)Copy_PIN;
+    (void)Copy_Mode;
+}
+
+void GPIO_SetPortBits(u8 Copy_PORT, u16 Copy_SetMask, u16 Copy_ResetMask)
+{
+    if (Copy_PORT < 3)
+    {
+        /**< BSRR: set wins over reset */
+        MODEL_Output[Copy_PORT] = (u16)((MODEL_Output[Copy_PORT] & ~Copy_ResetMask) | Copy_SetMask);
+        MODEL_Stores++;
+    }
+}
+
+void STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void))
+{
+    /**< Like STK_program.c: LOAD is the count, so the period is one count longer */
+    MODEL_Load = Copy_Microseconds;
+    MODEL_Callback = Copy_Callback;
+    MODEL_Running = 1;
+}
+
+void STK_SetNextInterval(u32 Copy_Microseconds)
+{
+    MODEL_Load = Copy_Microseconds - 1;
+}
+
+void STK_Stop(void)
+{
+    MODEL_Running = 0;
+}
+
+/**
+ * @brief Add a period to the on-time of the LEDs lit: row high and column low.
+ *
+ * @param Copy_Period Length of the period in microseconds.
+ */
+static void MODEL_Integrate(u32 Copy_Period)
+{
+    u8 Local_Row;
+    u8 Local_Col;
+
+    for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+    {
+        if ((MODEL_Output[MODEL_ColPins[Local_Col][0]] >> MODEL_ColPins[Local_Col][1]) & 1U)
+        {
+            continue;
+        }
+        for (Local_Row = 0; Local_Row < LEDMTRX_NUM_ROWS; Local_Row++)
+        {
+            if ((MODEL_Output[MODEL_RowPins[Local_Row][0]] >> MODEL_RowPins[Local_Row][1]) & 1U)
+            {
+                MODEL_OnTime[Local_Row][Local_Col] += Copy_Period;
+            }
+        }
+    }
+    MODEL_Time += Copy_Period;
+}
+
+/**
+ * @brief Run the SysTick model for a number of refresh ticks.
+ *
+ * @param Copy_Ticks Number of ticks.
+ * @param Copy_Measure 1 to integrate the on-times and the shortest period.
+ */
+static void MODEL_Run(u32 Copy_Ticks, u8 Copy_Measure)
+{
+    u32 Local_Tick;
+
+    for (Local_Tick = 0; (Local_Tick < Copy_Ticks) && MODEL_Running; Local_Tick++)
+    {
+        /**< The counter reloads at the end of the period, then the interrupt runs */
+        u32 Local_Next = MODEL_Load + 1;
+
+        MODEL_Callback();
+        MODEL_Ticks++;
+        MODEL_Clock += Local_Next;
+        if (Copy_Measure)
+        {
+            /**< The outputs set by the tick last until the end of the next period */
+            MODEL_Integrate(Local_Next);
+            if (Local_Next < MODEL_MinPeriod)
+            {
+                MODEL_MinPeriod = Local_Next;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Count a check failure and print the first ones.
+ *
+ * @param Copy_Format printf format of the message, followed by its arguments.
+ */
+static void MODEL_Fail(const char *Copy_Format, ...)
+{
+    va_list Local_Arguments;
+
+    MODEL_Failures++;
+    if (MODEL_Failures <= MODEL_MAX_REPORTS)
+    {
+        va_start(Local_Arguments, Copy_Format);
+        fprintf(stderr, "ledmtrx_model: %d bits: ", LEDMTRX_GRAY_BITS);
+        vfprintf(stderr, Copy_Format, Local_Arguments);
+        fprintf(stderr, "\n");
+        va_end(Local_Arguments);
+    }
+}
+
+/**
+ * @brief Run one refresh tick and read the LEDs it lit.
+ *
+ * @param Copy_Col Column lit: LEDMTRX_NUM_COLS when none or several are.
+ * @param Copy_Rows Rows lit, bit n for row n.
+ */
+static void MODEL_Step(u8 *Copy_Col, u8 *Copy_Rows)
+{
+    u8 Local_Index;
+
+    MODEL_Run(1, 0);
+
+    *Copy_Col = LEDMTRX_NUM_COLS;
+    for (Local_Index = 0; Local_Index < LEDMTRX_NUM_COLS; Local_Index++)
+    {
+        if (((MODEL_Output[MODEL_ColPins[Local_Index][0]] >> MODEL_ColPins[Local_Index][1]) & 1U) == 0)
+        {
+            *Copy_Col = (*Copy_Col == LEDMTRX_NUM_COLS) ? Local_Index : LEDMTRX_NUM_COLS + 1;
+        }
+    }
+    if (*Copy_Col > LEDMTRX_NUM_COLS)
+    {
+        *Copy_Col = LEDMTRX_NUM_COLS;
+    }
+
+    *Copy_Rows = 0;
+    for (Local_Index = 0; Local_Index < LEDMTRX_NUM_ROWS; Local_Index++)
+    {
+        *Copy_Rows |= (u8)(((MODEL_Output[MODEL_RowPins[Local_Index][0]] >> MODEL_RowPins[Local_Index][1]) & 1U) << Local_Index);
+    }
+}
+
+/**
+ * @brief Run the refresh to the start of the next refresh cycle.
+ */
+static void MODEL_AlignCycle(void)
+{
+    u8 Local_Col;
+    u8 Local_Rows;
+
+    while ((MODEL_Ticks % MODEL_TICKS_PER_CYCLE) != 0)
+    {
+        MODEL_Step(&Local_Col, &Local_Rows);
+    }
+}
+
+/**
+ * @brief Run a refresh cycle from its start and check every tick lights its column with the
+ * rows of a frame, in every bit plane. The first wrong tick is reported and the cycle is run
+ * to its end, so the next check still starts a cycle.
+ *
+ * @param Copy_Frame Rows of each column, bit n for row n.
+ * @param Copy_Check Name of the check in the failure message.
+ * @param Copy_Step Step of the check in the failure message.
+ */
+static void MODEL_ExpectCycle(const u8 *Copy_Frame, const char *Copy_Check, u32 Copy_Step)
+{
+    u32 Local_Tick;
+    u8 Local_Expected;
+    u8 Local_Col;
+    u8 Local_Rows;
+    u8 Local_Reported = 0;
+
+    for (Local_Tick = 0; Local_Tick < MODEL_TICKS_PER_CYCLE; Local_Tick++)
+    {
+        MODEL_Step(&Local_Col, &Local_Rows);
+        Local_Expected = (u8)(Local_Tick / LEDMTRX_GRAY_BITS);
+        if (!Local_Reported && ((Local_Col != Local_Expected) || (Local_Rows != Copy_Frame[Local_Expected])))
+        {
+            MODEL_Fail("%s %u: tick %u of the cycle lit column %u rows 0x%02X, expected column %u rows 0x%02X",
+                       Copy_Check, (unsigned)Copy_Step, (unsigned)Local_Tick, Local_Col, Local_Rows, Local_Expected, Copy_Frame[Local_Expected]);
+            Local_Reported = 1;
+        }
+    }
+}
+
+/**
+ * @brief Check LEDMTRX_ShiftLeft: column n shows column (n + shift) % 8 of the data, from the
+ * next refresh cycle on.
+ */
+static void MODEL_CheckShift(void)
+{
+    static const u8 Local_Data[LEDMTRX_NUM_COLS] = { 0x01, 0x82, 0x44, 0x28, 0x10, 0x3C, 0x5A, 0xFF };
+    static const u8 Local_Shifts[] = { 0, 1, 3, 7, 8, 13 };
+    u8 Local_Expected[LEDMTRX_NUM_COLS];
+    u8 Local_Index;
+    u8 Local_Col;
+
+    for (Local_Index = 0; Local_Index < sizeof(Local_Shifts); Local_Index++)
+    {
+        for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+        {
+            Local_Expected[Local_Col] = Local_Data[(Local_Col + Local_Shifts[Local_Index]) % LEDMTRX_NUM_COLS];
+        }
+        MODEL_AlignCycle();
+        LEDMTRX_ShiftLeft(Local_Data, Local_Shifts[Local_Index]);
+        MODEL_ExpectCycle(Local_Expected, "ShiftLeft by", Local_Shifts[Local_Index]);
+        MODEL_ExpectCycle(Local_Expected, "ShiftLeft by", Local_Shifts[Local_Index]);
+    }
+}
+
+/**
+ * @brief Check a frame written in the middle of a refresh cycle, by LEDMTRX_Display or by
+ * LEDMTRX_SetLedState and LEDMTRX_SwapBuffers: the rest of the cycle shows the old frame with
+ * the swap pending, the next cycle the new frame with the swap done.
+ */
+static void MODEL_CheckSwap(void)
+{
+    static const u8 Local_Frames[2][LEDMTRX_NUM_COLS] =
+    {
+        { 0x55, 0x0F, 0x33, 0x81, 0x7E, 0x18, 0xC3, 0x01 },
+        { 0xAA, 0xF0, 0xCC, 0x7E, 0x81, 0xE7, 0x3C, 0xFE }
+    };
+    const u32 Local_Positions[3] = { 1, MODEL_TICKS_PER_CYCLE / 2, MODEL_TICKS_PER_CYCLE - 1 };
+    const u8 *Local_Old;
+    const u8 *Local_New;
+    u32 Local_Tick;
+    u8 Local_Index;
+    u8 Local_UseSwap;
+    u8 Local_Reported;
+    u8 Local_Row;
+    u8 Local_Col;
+    u8 Local_Rows;
+
+    for (Local_Index = 0; Local_Index < 3; Local_Index++)
+    {
+        for (Local_UseSwap = 0; Local_UseSwap <= 1; Local_UseSwap++)
+        {
+            Local_Old = Local_Frames[Local_UseSwap];
+            Local_New = Local_Frames[Local_UseSwap ^ 1];
+            MODEL_AlignCycle();
+            LEDMTRX_Display(Local_Old);
+            MODEL_ExpectCycle(Local_Old, "swap at tick", Local_Positions[Local_Index]);
+
+            for (Local_Tick = 0; Local_Tick < Local_Positions[Local_Index]; Local_Tick++)
+            {
+                MODEL_Step(&Local_Col, &Local_Rows);
+            }
+            if (Local_UseSwap)
+            {
+                /**< The back buffer holds the frame shown: change every LED and swap */
+                for (Local_Row = 0; Local_Row < LEDMTRX_NUM_ROWS; Local_Row++)
+                {
+                    for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+                    {
+                        LEDMTRX_SetLedState(Local_Row, Local_Col, (Local_New[Local_Col] >> Local_Row) & 1U);
+                    }
+                }
+                LEDMTRX_SwapBuffers();
+            }
+            else
+            {
+                LEDMTRX_Display(Local_New);
+            }
+
+            Local_Reported = 0;
+            for (; Local_Tick < MODEL_TICKS_PER_CYCLE; Local_Tick++)
+            {
+                MODEL_Step(&Local_Col, &Local_Rows);
+                if (!Local_Reported && ((Local_Col >= LEDMTRX_NUM_COLS) || (Local_Rows != Local_Old[Local_Col]) || !LEDMTRX_IsSwapPending()))
+                {
+                    MODEL_Fail("%s at tick %u: tick %u lit column %u rows 0x%02X with the swap %s, expected the old frame before column 0",
+                               Local_UseSwap ? "SwapBuffers" : "Display", (unsigned)Local_Positions[Local_Index], (unsigned)Local_Tick,
+                               Local_Col, Local_Rows, LEDMTRX_IsSwapPending() ? "pending" : "done");
+                    Local_Reported = 1;
+                }
+            }
+            MODEL_ExpectCycle(Local_New, "swap at tick", Local_Positions[Local_Index]);
+            if (LEDMTRX_IsSwapPending())
+            {
+                MODEL_Fail("%s at tick %u: swap still pending after a whole cycle", Local_UseSwap ? "SwapBuffers" : "Display",
+                           (unsigned)Local_Positions[Local_Index]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Check the marquee over two passes of its strip: from its start, cycle n shows the
+ * frame rendered at the start of cycle n - 1, one column further along the strip every
+ * REFRESH_RATE / rate cycles and back to its start after the last column.
+ *
+ * @return The frames per second shown.
+ */
+static double MODEL_CheckMarquee(void)
+{
+    static const u8 Local_Blank[LEDMTRX_NUM_COLS] = { 0 };
+    u8 Local_Rate = (MODEL_MARQUEE_RATE_HZ < LEDMTRX_REFRESH_RATE_HZ) ? MODEL_MARQUEE_RATE_HZ : LEDMTRX_REFRESH_RATE_HZ;
+    u32 Local_Frames = 2 * MODEL_MARQUEE_WIDTH;
+    u32 Local_Cycles = (Local_Frames * LEDMTRX_REFRESH_RATE_HZ + Local_Rate - 1) / Local_Rate;
+    u8 Local_Expected[LEDMTRX_NUM_COLS];
+    double Local_Start;
+    double Local_Seconds = 0.0;
+    u32 Local_Cycle;
+    u32 Local_Offset;
+    u8 Local_Col;
+
+    MODEL_AlignCycle();
+    LEDMTRX_Display(Local_Blank);
+    MODEL_ExpectCycle(Local_Blank, "marquee cycle", 0);
+
+    LEDMTRX_SetAnimationRate(Local_Rate);
+    LEDMTRX_StartMarquee(MODEL_MARQUEE_TEXT);
+    Local_Start = MODEL_Clock;
+    for (Local_Cycle = 0; Local_Cycle <= Local_Cycles; Local_Cycle++)
+    {
+        /**< Frames rendered before this cycle; the strip starts blank like the display */
+        Local_Offset = (Local_Cycle * Local_Rate) / LEDMTRX_REFRESH_RATE_HZ;
+        Local_Offset = (Local_Offset == 0) ? 0 : (Local_Offset - 1);
+        for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+        {
+            Local_Expected[Local_Col] = MODEL_MarqueeColumns[(Local_Offset + Local_Col) % MODEL_MARQUEE_WIDTH];
+        }
+        MODEL_ExpectCycle(Local_Expected, "marquee cycle", Local_Cycle);
+        if (Local_Cycle + 1 == Local_Cycles)
+        {
+            Local_Seconds = (MODEL_Clock - Local_Start) / 1000000.0;
+        }
+    }
+    LEDMTRX_StopMarquee();
+    LEDMTRX_SetAnimationRate(LEDMTRX_ANIMATION_RATE_HZ);
+
+    /**< The frames rendered in the first Local_Cycles cycles */
+    return ((Local_Cycles * Local_Rate) / LEDMTRX_REFRESH_RATE_HZ) / Local_Seconds;
+}
+
+int main(int argc, char **argv)
+{
+    static u8 Local_Levels[LEDMTRX_NUM_ROWS * LEDMTRX_NUM_COLS];
+    double Local_Clocks[MODEL_MAX_CLOCKS];
+    u8 Local_ClockCount = 0;
+    u32 Local_Cycles = 200;
+    u32 Local_TicksPerCycle = MODEL_TICKS_PER_CYCLE;
+    u32 Local_Stores;
+    u32 Local_TickCycles;
+    u32 Local_CycleStartCycles;
+    double Local_Error;
+    double Local_MaxError = 0.0;
+    double Local_Seconds;
+    double Local_TickUs;
+    double Local_MarqueeFps;
+    int Local_Argument;
+    u8 Local_Index;
+    u8 Local_Row;
+    u8 Local_Col;
+
+    for (Local_Argument = 1; Local_Argument < argc; Local_Argument++)
+    {
+        if ((strcmp(argv[Local_Argument], "--cycles") == 0) && (Local_Argument + 1 < argc))
+        {
+            Local_Cycles = (u32)atol(argv[++Local_Argument]);
+        }
+        else if ((strcmp(argv[Local_Argument], "--core-hz") == 0) && (Local_Argument + 1 < argc) && (Local_ClockCount < MODEL_MAX_CLOCKS))
+        {
+            Local_Clocks[Local_ClockCount++] = atof(argv[++Local_Argument]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--cycles N] [--core-hz HZ]...\n", argv[0]);
+            return 2;
+        }
+    }
+    if (Local_ClockCount == 0)
+    {
+        Local_Clocks[Local_ClockCount++] = 8000000.0;
+        Local_Clocks[Local_ClockCount++] = 72000000.0;
+    }
+    if (Local_Cycles == 0)
+    {
+        fprintf(stderr, "%s: --cycles must be positive\n", argv[0]);
+        return 2;
+    }
+
+    /**< A ramp of every level over the 64 LEDs */
+    for (Local_Index = 0; Local_Index < LEDMTRX_NUM_ROWS * LEDMTRX_NUM_COLS; Local_Index++)
+    {
+        Local_Levels[Local_Index] = (u8)((Local_Index * LEDMTRX_MAX_LEVEL + (LEDMTRX_NUM_ROWS * LEDMTRX_NUM_COLS - 1) / 2) / (LEDMTRX_NUM_ROWS * LEDMTRX_NUM_COLS - 1));
+    }
+
+    LEDMTRX_Init();
+    LEDMTRX_StartRefresh();
+    LEDMTRX_DisplayGray(Local_Levels);
+
+    /**< One cycle to swap the picture in, then measure whole cycles */
+    MODEL_Run(2 * Local_TicksPerCycle, 0);
+    MODEL_Stores = 0;
+    MODEL_Run(Local_Cycles * Local_TicksPerCycle, 1);
+    Local_Stores = MODEL_Stores;
+
+    /**< What the refresh lights, after the measurement */
+    MODEL_CheckShift();
+    MODEL_CheckSwap();
+    Local_MarqueeFps = MODEL_CheckMarquee();
+
+    for (Local_Row = 0; Local_Row < LEDMTRX_NUM_ROWS; Local_Row++)
+    {
+        for (Local_Col = 0; Local_Col < LEDMTRX_NUM_COLS; Local_Col++)
+        {
+            /**< Share of the time of its column the LED was lit, in levels */
+            Local_Error = MODEL_OnTime[Local_Row][Local_Col] * LEDMTRX_NUM_COLS / MODEL_Time * LEDMTRX_MAX_LEVEL - Local_Levels[Local_Row * LEDMTRX_NUM_COLS + Local_Col];
+            if (Local_Error < 0.0)
+            {
+                Local_Error = -Local_Error;
+            }
+            if (Local_Error > Local_MaxError)
+            {
+                Local_MaxError = Local_Error;
+            }
+        }
+    }
+
+    Local_Seconds = MODEL_Time / 1000000.0;
+    Local_TickCycles = MODEL_TICK_CYCLES + (Local_Stores / (Local_Cycles * Local_TicksPerCycle)) * MODEL_STORE_CYCLES;
+    Local_CycleStartCycles = Local_TickCycles + LEDMTRX_GRAY_BITS * LEDMTRX_NUM_COLS * MODEL_COPY_CYCLES_PER_BYTE + LEDMTRX_NUM_COLS * (MODEL_RENDER_CYCLES_PER_COL + LEDMTRX_GRAY_BITS * MODEL_COPY_CYCLES_PER_BYTE);
+
+    printf("{\n  \"gray_bits\": %d,\n  \"refresh_rate_hz\": %d,\n", LEDMTRX_GRAY_BITS, LEDMTRX_REFRESH_RATE_HZ);
+    printf("  \"refresh_hz\": %.2f,\n  \"ticks_per_s\": %.0f,\n", Local_Cycles / Local_Seconds, Local_Cycles * Local_TicksPerCycle / Local_Seconds);
+    printf("  \"min_period_us\": %u,\n  \"stores_per_tick\": %.2f,\n", (unsigned)MODEL_MinPeriod, (double)Local_Stores / (Local_Cycles * Local_TicksPerCycle));
+    printf("  \"max_error_lsb\": %.4f,\n", Local_MaxError);
+    printf("  \"checks_failed\": %u,\n  \"marquee_rate_hz\": %d,\n  \"marquee_fps\": %.2f,\n", (unsigned)MODEL_Failures,
+           (MODEL_MARQUEE_RATE_HZ < LEDMTRX_REFRESH_RATE_HZ) ? MODEL_MARQUEE_RATE_HZ : LEDMTRX_REFRESH_RATE_HZ, Local_MarqueeFps);
+    printf("  \"tick_cycles\": %u,\n  \"cycle_start_cycles\": %u,\n  \"clocks\": [", (unsigned)Local_TickCycles, (unsigned)Local_CycleStartCycles);
+    for (Local_Index = 0; Local_Index < Local_ClockCount; Local_Index++)
+    {
+        Local_TickUs = Local_TickCycles * 1000000.0 / Local_Clocks[Local_Index];
+        printf("%s\n    {\"core_hz\": %.0f, \"tick_us\": %.2f, \"cpu_load_percent\": %.2f, \"fits\": %s}",
+               (Local_Index == 0) ? "" : ",", Local_Clocks[Local_Index], Local_TickUs,
+               100.0 * ((double)Local_Cycles * Local_TicksPerCycle * Local_TickCycles + (double)Local_Cycles * (Local_CycleStartCycles - Local_TickCycles)) / (Local_Seconds * Local_Clocks[Local_Index]),
+               (Local_TickUs < MODEL_MinPeriod) ? "true" : "false");
+    }
+    printf("\n  ]\n}\n");
+
+    return (MODEL_Failures == 0) ? 0 : 1;
+}
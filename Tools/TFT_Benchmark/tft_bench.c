@@ -0,0 +1,1132 @@
+/**
+ * @file tft_bench.c
+ * @brief Display benchmark: runs the same scenes on every controller against the host TFT
+ * emulator and prints the cost of each scene as JSON.
+ *
+ * Every scene is drawn through the unchanged TFT core, controller and service sources, the
+ * emulator counting what reaches the panel. For each controller and scene the report gives:
+ * - bytes     bytes clocked on SPI;
+ * - bus_cycles WR strobes on the 8080 parallel bus;
+ * - transactions chip-select cycles (CS falling edges);
+ * - commands, windows and pixels as counted by @ref TFT_EMU_Stats_t;
+ * - errors    protocol errors, always 0 for a correct driver;
+ * - time_us   the estimated wire time: bytes * 8 / spi_hz on SPI, bus_cycles * cycle_ns
+ *             on the parallel bus. Setup of the transfers by the CPU is not included;
+ * - samples   samples plotted, in the strip chart scenes only: samples / time_us is the
+ *             sample rate the wire sustains;
+ * - lines     text lines printed, in the console scenes only: lines / time_us is the
+ *             line rate the wire sustains.
+ *
+ * Coordinates are scaled to the panel so the scenes cover the same part of each screen.
+ * Tools/TFT_Benchmark/tftbench.py builds this program, runs it and checks the report
+ * against the budgets of budgets.json.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     tft_bench [--spi-hz 18000000] [--cycle-ns 100] [--screens out_dir]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "GPIO_interface.h"
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+#include "TFT_ST7735S_interface.h"
+#include "TFT_HX8357B_interface.h"
+#include "TFT_ILI9481_interface.h"
+/**< SERVICES */
+#include "SHAPE_interface.h"
+#include "WIDGET_interface.h"
+#include "CHART_interface.h"
+#include "DLIST_config.h"
+#include "DLIST_interface.h"
+#include "DIRTY_interface.h"
+#include "CONSOLE_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+
+/**
+ * @brief Size of the benchmark image and of the blit source.
+ */
+#define BENCH_IMAGE_SIZE            64
+
+/**
+ * @brief Characters and cell of the generated benchmark font.
+ */
+#define BENCH_FONT_FIRST            32
+#define BENCH_FONT_LAST             126
+#define BENCH_FONT_WIDTH            6
+#define BENCH_FONT_HEIGHT           9
+#define BENCH_FONT_GLYPH_BYTES      ((BENCH_FONT_WIDTH * BENCH_FONT_HEIGHT + 7) / 8)
+
+/**
+ * @brief Text of the text scenes, short enough for the 128 pixels of the ST7735S.
+ */
+#define BENCH_TEXT                  "Speed 123 km/h"
+
+/**
+ * @brief Size of the display list of the UI scenes, and of its icons.
+ */
+#define BENCH_LIST_BYTES            4096
+#define BENCH_ICON_SIZE             16
+
+/**
+ * @brief Samples of the strip chart scenes, and samples per chart line.
+ */
+#define BENCH_CHART_SAMPLES         4000
+#define BENCH_CHART_DECIMATION      4
+
+/**
+ * @brief Rectangles of the dirty region of the dirty-rectangle scenes.
+ */
+#define BENCH_DIRTY_RECTS           8
+
+/**
+ * @brief Lines printed in the console scenes once the screen is full.
+ */
+#define BENCH_CONSOLE_LINES         64
+
+/**
+ * @brief Pixel format command (COLMOD) and its parameters for the packing scenes: 12 bits
+ * (ST7735S only) and 18 bits.
+ */
+#define BENCH_COLMOD                0x3A
+#define BENCH_COLMOD_RGB444         0x03
+#define BENCH_COLMOD_RGB666         0x66
+
+/**
+ * @brief A panel under test.
+ */
+typedef struct {
+    const char *Name;               /**< Name in the report. */
+    TFT_Config_t Config;            /**< Display configuration. */
+    u8 Mounting;                    /**< TFT_EMU_MOUNT_ flags of the module. */
+} BENCH_Panel_t;
+
+/**
+ * @brief Panels of the report: the three controllers on SPI, the ILI9481 also on its 16-bit
+ * parallel bus (data on GPIOB, WR on PA4).
+ */
+static const BENCH_Panel_t BENCH_Panels[] = {
+    { "ST7735S",          { {0, 2}, {0, 3}, {0, 7}, {0, 1}, &TFT_ST7735S_Controller, TFT_BUS_SPI, 0, {0, 0} }, TFT_EMU_MOUNT_MIRROR_X | TFT_EMU_MOUNT_MIRROR_Y },
+    { "HX8357B",          { {0, 2}, {0, 3}, {0, 7}, {0, 1}, &TFT_HX8357B_Controller, TFT_BUS_SPI, 0, {0, 0} }, TFT_EMU_MOUNT_NORMAL },
+    { "ILI9481",          { {0, 2}, {0, 3}, {0, 7}, {0, 1}, &TFT_ILI9481_Controller, TFT_BUS_SPI, 0, {0, 0} }, TFT_EMU_MOUNT_NORMAL },
+    { "ILI9481-parallel", { {0, 2}, {0, 3}, {0, 7}, {0, 1}, &TFT_ILI9481_Controller, TFT_BUS_PARALLEL_8080, 1, {0, 4} }, TFT_EMU_MOUNT_NORMAL },
+};
+
+/**
+ * @brief Generated font, image and blit source.
+ */
+static u8 BENCH_FontBitmap[(BENCH_FONT_LAST - BENCH_FONT_FIRST + 1) * BENCH_FONT_GLYPH_BYTES];
+static TFT_Glyph_t BENCH_FontGlyphs[BENCH_FONT_LAST - BENCH_FONT_FIRST + 1];
+static TFT_Font_t BENCH_Font;
+static u8 BENCH_ImageData[BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE * 2];
+static TFT_Image_t BENCH_Image;
+static u8 BENCH_RleData[BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE * 3];
+static TFT_Image_t BENCH_RleImage;
+static u16 BENCH_BitmapPixels[BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE];
+static TFT_Bitmap_t BENCH_Bitmap;
+
+/**
+ * @brief Dashboard of the dashboard scenes.
+ */
+static WIDGET_t *BENCH_WidgetList[6];
+static WIDGET_t BENCH_Title, BENCH_Speed, BENCH_Gauge, BENCH_Fuel, BENCH_Temperature, BENCH_Button;
+static WIDGET_Screen_t BENCH_Screen;
+
+/**
+ * @brief Display list of the UI scenes, and the screen a scene is compared with (the UI
+ * drawn without the list, the frame sent whole).
+ */
+static u8 BENCH_ListBuffer[BENCH_LIST_BYTES];
+static DLIST_List_t BENCH_List;
+static u32 BENCH_UiScreen[480 * 480];
+
+/**
+ * @brief Frame buffer and dirty region of the dirty-rectangle scenes.
+ */
+static u16 BENCH_Frame[480 * 480];
+static DIRTY_Rect_t BENCH_DirtyRects[BENCH_DIRTY_RECTS];
+static DIRTY_Region_t BENCH_Dirty;
+
+/**
+ * @brief Controller descriptor and configuration of a panel switched to another pixel
+ * packing, for the packing scenes.
+ */
+static TFT_Controller_t BENCH_PackedController;
+static TFT_Config_t BENCH_PackedConfig;
+
+/**
+ * @brief Hexagon of the shape scenes, its bottom vertex below the screen.
+ */
+static SHAPE_Point_t BENCH_Hexagon[6];
+
+/**
+ * @brief Strip chart of the chart scenes.
+ */
+static CHART_t BENCH_Chart;
+static u16 BENCH_ChartSpans[2 * 480];
+
+/**
+ * @brief Text console of the console scenes.
+ */
+static CONSOLE_t BENCH_Console;
+
+/**
+ * @brief Time model and options.
+ */
+static double BENCH_SpiHz = 18000000.0;
+static double BENCH_CycleNs = 100.0;
+static const char *BENCH_ScreensDirectory;
+
+/**
+ * @brief Samples of the next entry, reported when not 0.
+ */
+static u32 BENCH_Samples = 0;
+
+/**
+ * @brief Text lines of the next entry, reported when not 0.
+ */
+static u32 BENCH_Lines = 0;
+
+/**
+ * @brief 1 until the first entry is printed, to separate the JSON entries.
+ */
+static u8 BENCH_FirstEntry = 1;
+
+/**
+ * @brief Set when a scene drawn through the display list differs from the direct drawing,
+ * a dirty-rectangle or widget update from the full redraw, or the scrolled console from the
+ * redrawn one.
+ */
+static u8 BENCH_Failed = 0;
+
+/**
+ * @brief Fill the generated font, image and blit source.
+ *
+ * The glyphs have a fixed 6x9 box and an arbitrary but fixed pattern, so text costs the
+ * same as with a real font of that size. The images are an RGB565 gradient and an RLE icon.
+ */
+static void BENCH_MakeAssets(void);
+
+/**
+ * @brief Attach a panel to the emulator and initialize it.
+ *
+ * @param[in] Copy_Panel The panel.
+ * @param[in] Copy_Spi   The SPI peripheral, NULL on the parallel bus.
+ */
+static void BENCH_StartPanel(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi);
+
+/**
+ * @brief Returns a pixel of the RLE image scene.
+ *
+ * @param[in] Copy_Index The pixel, row * width + column.
+ *
+ * @return The RGB565 color.
+ */
+static u16 BENCH_GetRlePixel(u32 Copy_Index);
+
+/**
+ * @brief Print the counts since the last call as one JSON entry and clear them.
+ *
+ * @param[in] Copy_Panel The panel.
+ * @param[in] Copy_Scene The scene name.
+ */
+static void BENCH_Report(const BENCH_Panel_t *Copy_Panel, const char *Copy_Scene);
+
+/**
+ * @brief Build the dashboard of the dashboard scenes, scaled to the panel.
+ *
+ * @param[in] Copy_Panel The panel.
+ * @param[in] Copy_Spi   The SPI peripheral.
+ */
+static void BENCH_MakeDashboard(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi);
+
+/**
+ * @brief Check the dashboard after an update against a full redraw of it, and that the speed
+ * label left no ink past its width; the redraw then stays on the screen.
+ *
+ * @param[in] Copy_Panel The panel.
+ * @param[in] Copy_Step  What the update changed, for the log.
+ */
+static void BENCH_CheckDashboard(const BENCH_Panel_t *Copy_Panel, const char *Copy_Step);
+
+/**
+ * @brief Draw a typical UI frame (header, cards with borders and progress bars, list rows,
+ * a chart plotted pixel by pixel, icons, footer), scaled to the panel.
+ *
+ * @param[in] Copy_Panel The panel.
+ * @param[in] Copy_Spi   The SPI peripheral.
+ * @param[in] Copy_List  NULL to draw with the TFT core, or the display list to record into.
+ */
+static void BENCH_DrawUi(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List);
+
+/**
+ * @brief Fill a rectangle with the TFT core or into the display list.
+ */
+static void BENCH_UiFill(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List, u16 Copy_X, u16 Copy_Y, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color);
+
+/**
+ * @brief Draw a pixel with the TFT core or into the display list.
+ */
+static void BENCH_UiPixel(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List, u16 Copy_X, u16 Copy_Y, u16 Copy_Color);
+
+/**
+ * @brief Draw opaque text with the TFT core or into the display list.
+ */
+static void BENCH_UiText(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List, u16 Copy_X, u16 Copy_Y, const char *Copy_Text, u16 Copy_Color, u16 Copy_Background);
+
+/**
+ * @brief Draw a BENCH_ICON_SIZE icon with the TFT core or into the display list.
+ */
+static void BENCH_UiIcon(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List, u16 Copy_X, u16 Copy_Y);
+
+/**
+ * @brief Fill a rectangle of the frame buffer and mark it dirty.
+ */
+static void BENCH_FrameFill(u16 Copy_ScreenWidth, u16 Copy_X, u16 Copy_Y, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color);
+
+/**
+ * @brief Draw a dashboard (header, value boxes, bar gauges, status lamps) into the frame
+ * buffer, scaled to the panel.
+ */
+static void BENCH_MakeFrame(const BENCH_Panel_t *Copy_Panel);
+
+/**
+ * @brief Change the live values of the frame buffer dashboard: two value boxes, the growth
+ * of a bar gauge and a status lamp, each marked dirty.
+ */
+static void BENCH_UpdateFrame(const BENCH_Panel_t *Copy_Panel);
+
+/**
+ * @brief Plot BENCH_CHART_SAMPLES samples of a noisy triangle wave on a strip chart.
+ *
+ * @param[in] Copy_Panel The panel.
+ * @param[in] Copy_Spi   The SPI peripheral.
+ * @param[in] Copy_Mode  A @ref CHART_Mode_t.
+ */
+static void BENCH_PlotChart(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, u8 Copy_Mode);
+
+/**
+ * @brief Print BENCH_CONSOLE_LINES log lines on a full console, scrolled by the controller,
+ * then the same lines redrawing every visible line for each new one, and check that both
+ * leave the same screen.
+ *
+ * @param[in] Copy_Panel The panel.
+ * @param[in] Copy_Spi   The SPI peripheral.
+ */
+static void BENCH_RunConsole(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi);
+
+/**
+ * @brief Switch an SPI panel to a pixel packing, then fill the screen and send the frame
+ * buffer of the dirty-rectangle scenes whole.
+ *
+ * @param[in] Copy_Panel     The panel.
+ * @param[in] Copy_Spi       The SPI peripheral.
+ * @param[in] Copy_Packing   A @ref TFT_PixelPacking_t.
+ * @param[in] Copy_Format    The COLMOD parameter of that packing.
+ * @param[in] Copy_FillScene The name of the fill scene.
+ * @param[in] Copy_FrameScene The name of the full-screen image scene.
+ */
+static void BENCH_RunPacking(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, u8 Copy_Packing, u8 Copy_Format, const char *Copy_FillScene, const char *Copy_FrameScene);
+
+/**
+ * @brief Run every scene on a panel.
+ *
+ * @param[in] Copy_Panel The panel.
+ */
+static void BENCH_RunPanel(const BENCH_Panel_t *Copy_Panel);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static void BENCH_MakeAssets(void)
+{
+    u16 Local_Character;
+    u16 Local_Bit;
+    u16 Local_Index;
+    u8 *Local_Glyph;
+    u16 Local_X;
+    u16 Local_Y;
+    u16 Local_Color;
+    u16 Local_Length;
+    u32 Local_Pixel;
+    u32 Local_Byte;
+
+    for (Local_Character = BENCH_FONT_FIRST; Local_Character <= BENCH_FONT_LAST; Local_Character++)
+    {
+        Local_Index = Local_Character - BENCH_FONT_FIRST;
+        Local_Glyph = &BENCH_FontBitmap[Local_Index * BENCH_FONT_GLYPH_BYTES];
+
+        BENCH_FontGlyphs[Local_Index].TFT_BitmapOffset = Local_Index * BENCH_FONT_GLYPH_BYTES;
+        BENCH_FontGlyphs[Local_Index].TFT_XAdvance = BENCH_FONT_WIDTH + 1;
+        BENCH_FontGlyphs[Local_Index].TFT_XOffset = 0;
+        BENCH_FontGlyphs[Local_Index].TFT_YOffset = 1;
+
+        /**< A space has no ink, like in bdf2font.py output */
+        if (Local_Character == ' ')
+        {
+            continue;
+        }
+
+        BENCH_FontGlyphs[Local_Index].TFT_Width = BENCH_FONT_WIDTH;
+        BENCH_FontGlyphs[Local_Index].TFT_Height = BENCH_FONT_HEIGHT;
+        for (Local_Bit = 0; Local_Bit < BENCH_FONT_WIDTH * BENCH_FONT_HEIGHT; Local_Bit++)
+        {
+            if (((Local_Character * 37 + Local_Bit * 11) % 5) < 2)
+            {
+                Local_Glyph[Local_Bit / 8] |= (u8)(0x80 >> (Local_Bit % 8));
+            }
+        }
+    }
+
+    BENCH_Font.TFT_Bitmap = BENCH_FontBitmap;
+    BENCH_Font.TFT_Glyphs = BENCH_FontGlyphs;
+    BENCH_Font.TFT_FirstChar = BENCH_FONT_FIRST;
+    BENCH_Font.TFT_LastChar = BENCH_FONT_LAST;
+    BENCH_Font.TFT_LineHeight = BENCH_FONT_HEIGHT + 2;
+    BENCH_Font.TFT_BitsPerPixel = 1;
+
+    for (Local_Y = 0; Local_Y < BENCH_IMAGE_SIZE; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < BENCH_IMAGE_SIZE; Local_X++)
+        {
+            Local_Color = (u16)(((Local_X >> 1) << 11) | ((Local_Y) << 5) | ((Local_X + Local_Y) >> 2));
+            Local_Index = Local_Y * BENCH_IMAGE_SIZE + Local_X;
+            BENCH_ImageData[Local_Index * 2] = (u8)(Local_Color >> 8);
+            BENCH_ImageData[Local_Index * 2 + 1] = (u8)Local_Color;
+            BENCH_BitmapPixels[Local_Index] = Local_Color;
+        }
+    }
+
+    BENCH_Image.TFT_Data = BENCH_ImageData;
+    BENCH_Image.TFT_Palette = NULL;
+    BENCH_Image.TFT_Width = BENCH_IMAGE_SIZE;
+    BENCH_Image.TFT_Height = BENCH_IMAGE_SIZE;
+    BENCH_Image.TFT_Format = TFT_IMAGE_RGB565;
+    BENCH_Image.TFT_IndexBits = 0;
+
+    BENCH_Bitmap.TFT_Pixels = BENCH_BitmapPixels;
+    BENCH_Bitmap.TFT_Width = BENCH_IMAGE_SIZE;
+    BENCH_Bitmap.TFT_Height = BENCH_IMAGE_SIZE;
+
+    /**< Icon-like RLE image: flat quadrants crossed by a shaded diagonal band, encoded like
+         imgencode.py does, runs of two or more pixels and literals of the rest */
+    Local_Pixel = 0;
+    Local_Byte = 0;
+    while (Local_Pixel < BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE)
+    {
+        Local_Length = 1;
+        while ((Local_Length < 128) && ((Local_Pixel + Local_Length) < BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE) &&
+               (BENCH_GetRlePixel(Local_Pixel + Local_Length) == BENCH_GetRlePixel(Local_Pixel)))
+        {
+            Local_Length++;
+        }
+        if (Local_Length > 1)
+        {
+            BENCH_RleData[Local_Byte++] = (u8)(0x80 | (Local_Length - 1));
+        }
+        else
+        {
+            /**< Literal up to the next pair of equal pixels */
+            while ((Local_Length < 128) && ((Local_Pixel + Local_Length) < BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE) &&
+                   (((Local_Pixel + Local_Length + 1) >= BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE) ||
+                    (BENCH_GetRlePixel(Local_Pixel + Local_Length) != BENCH_GetRlePixel(Local_Pixel + Local_Length + 1))))
+            {
+                Local_Length++;
+            }
+            BENCH_RleData[Local_Byte++] = (u8)(Local_Length - 1);
+        }
+        for (Local_Index = 0; Local_Index < ((BENCH_RleData[Local_Byte - 1] & 0x80) ? 1 : Local_Length); Local_Index++)
+        {
+            Local_Color = BENCH_GetRlePixel(Local_Pixel + Local_Index);
+            BENCH_RleData[Local_Byte++] = (u8)(Local_Color >> 8);
+            BENCH_RleData[Local_Byte++] = (u8)Local_Color;
+        }
+        Local_Pixel += Local_Length;
+    }
+
+    BENCH_RleImage.TFT_Data = BENCH_RleData;
+    BENCH_RleImage.TFT_Palette = NULL;
+    BENCH_RleImage.TFT_Width = BENCH_IMAGE_SIZE;
+    BENCH_RleImage.TFT_Height = BENCH_IMAGE_SIZE;
+    BENCH_RleImage.TFT_Format = TFT_IMAGE_RLE;
+    BENCH_RleImage.TFT_IndexBits = 0;
+}
+
+static u16 BENCH_GetRlePixel(u32 Copy_Index)
+{
+    u16 Local_X = (u16)(Copy_Index % BENCH_IMAGE_SIZE);
+    u16 Local_Y = (u16)(Copy_Index / BENCH_IMAGE_SIZE);
+    s32 Local_Distance = (s32)Local_X - Local_Y;
+    u16 Local_Color;
+
+    if ((Local_Distance > -6) && (Local_Distance < 6))
+    {
+        /**< Shaded band: a different color every pixel */
+        Local_Color = (u16)((Local_X << 11) | ((Local_Y & 0x3F) << 5) | ((Local_X + Local_Y) & 0x1F));
+    }
+    else
+    {
+        Local_Color = (Local_X < BENCH_IMAGE_SIZE / 2) ? ((Local_Y < BENCH_IMAGE_SIZE / 2) ? 0x001F : 0x07E0) :
+                                                        ((Local_Y < BENCH_IMAGE_SIZE / 2) ? 0xF800 : 0xFFE0);
+    }
+
+    return Local_Color;
+}
+
+static void BENCH_StartPanel(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi)
+{
+    const TFT_Controller_t *Local_Controller = Copy_Panel->Config.TFT_Controller;
+
+    TFT_EMU_Attach(&Copy_Panel->Config, Local_Controller->TFT_Width, Local_Controller->TFT_Height, Copy_Panel->Mounting);
+    TFT_Init(&Copy_Panel->Config, Copy_Spi);
+}
+
+static void BENCH_Report(const BENCH_Panel_t *Copy_Panel, const char *Copy_Scene)
+{
+    TFT_EMU_Stats_t Local_Stats;
+    double Local_Time;
+    char Local_Path[512];
+
+    TFT_EMU_GetStats(&Local_Stats);
+    TFT_EMU_ResetStats();
+
+    Local_Time = (Local_Stats.Bytes * 8.0 * 1e6) / BENCH_SpiHz + (Local_Stats.BusCycles * BENCH_CycleNs) / 1e3;
+
+    printf("%s\n    {\"controller\": \"%s\", \"scene\": \"%s\", \"bytes\": %u, \"bus_cycles\": %u, "
+           "\"transactions\": %u, \"commands\": %u, \"windows\": %u, \"pixels\": %u, \"errors\": %u, \"time_us\": %.1f",
+           BENCH_FirstEntry ? "" : ",", Copy_Panel->Name, Copy_Scene, Local_Stats.Bytes, Local_Stats.BusCycles,
+           Local_Stats.ChipSelects, Local_Stats.Commands, Local_Stats.Windows, Local_Stats.Pixels, Local_Stats.Errors, Local_Time);
+    if (BENCH_Samples != 0)
+    {
+        printf(", \"samples\": %u", BENCH_Samples);
+        BENCH_Samples = 0;
+    }
+    if (BENCH_Lines != 0)
+    {
+        printf(", \"lines\": %u", BENCH_Lines);
+        BENCH_Lines = 0;
+    }
+    printf("}");
+    BENCH_FirstEntry = 0;
+
+    if (BENCH_ScreensDirectory != NULL)
+    {
+        snprintf(Local_Path, sizeof(Local_Path), "%s/%s-%s.ppm", BENCH_ScreensDirectory, Copy_Panel->Name, Copy_Scene);
+        TFT_EMU_WritePpm(Local_Path);
+    }
+}
+
+static void BENCH_MakeDashboard(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi)
+{
+    u16 Local_Width = Copy_Panel->Config.TFT_Controller->TFT_Width;
+    u16 Local_Height = Copy_Panel->Config.TFT_Controller->TFT_Height;
+    u16 Local_Radius = Local_Width / 4;
+
+    WIDGET_InitScreen(&BENCH_Screen, &Copy_Panel->Config, Copy_Spi, BENCH_WidgetList, 6, 0x0000);
+    WIDGET_AddLabel(&BENCH_Screen, &BENCH_Title, 4, 4, Local_Width - 8, &BENCH_Font, 0xFFFF, 0x0000, "Dashboard");
+    WIDGET_AddGauge(&BENCH_Screen, &BENCH_Gauge, 4, 20, Local_Radius, Local_Radius / 5, 0, 240, 0x07E0, 0x2104);
+    WIDGET_AddLabel(&BENCH_Screen, &BENCH_Speed, 4, 24 + 2 * Local_Radius, Local_Width / 2, &BENCH_Font, 0xFFE0, 0x0000, "0 km/h");
+    WIDGET_AddBar(&BENCH_Screen, &BENCH_Fuel, Local_Width / 2 + 8, 20, Local_Width / 8, Local_Height / 3, 0, 100, 0xFFE0, 0x2104);
+    WIDGET_AddBar(&BENCH_Screen, &BENCH_Temperature, 4, Local_Height / 2 + 20, Local_Width - 8, Local_Height / 16, 0, 120, 0xF800, 0x2104);
+    WIDGET_AddButton(&BENCH_Screen, &BENCH_Button, 4, Local_Height - 4 - Local_Height / 8, Local_Width / 2, Local_Height / 8, &BENCH_Font, "Reset", 0xFFFF, 0x001F, 0x0010);
+}
+
+static void BENCH_CheckDashboard(const BENCH_Panel_t *Copy_Panel, const char *Copy_Step)
+{
+    u16 Local_Width = Copy_Panel->Config.TFT_Controller->TFT_Width;
+    u16 Local_Height = Copy_Panel->Config.TFT_Controller->TFT_Height;
+    u32 Local_Pixel;
+    u32 Local_Mismatches = 0;
+    u32 Local_Overflow = 0;
+    u16 Local_X;
+    u16 Local_Y;
+
+    /**< Nothing else is drawn right of the speed label */
+    for (Local_Y = BENCH_Speed.Y; Local_Y < BENCH_Speed.Y + BENCH_Speed.Height; Local_Y++)
+    {
+        for (Local_X = BENCH_Speed.X + BENCH_Speed.Width; Local_X < Local_Width; Local_X++)
+        {
+            if (TFT_EMU_GetPixel(Local_X, Local_Y) != 0)
+            {
+                Local_Overflow++;
+            }
+        }
+    }
+
+    for (Local_Pixel = 0; Local_Pixel < (u32)Local_Width * Local_Height; Local_Pixel++)
+    {
+        BENCH_UiScreen[Local_Pixel] = TFT_EMU_GetPixel(Local_Pixel % Local_Width, Local_Pixel / Local_Width);
+    }
+    WIDGET_DrawAll(&BENCH_Screen);
+    TFT_EMU_ResetStats();
+    for (Local_Pixel = 0; Local_Pixel < (u32)Local_Width * Local_Height; Local_Pixel++)
+    {
+        if (TFT_EMU_GetPixel(Local_Pixel % Local_Width, Local_Pixel / Local_Width) != BENCH_UiScreen[Local_Pixel])
+        {
+            Local_Mismatches++;
+        }
+    }
+
+    fprintf(stderr, "%s: dashboard update (%s), %u pixels differ from the full redraw, %u pixels past the label\n", Copy_Panel->Name,
+            Copy_Step, Local_Mismatches, Local_Overflow);
+    if ((Local_Mismatches != 0) || (Local_Overflow != 0))
+    {
+        BENCH_Failed = 1;
+    }
+}
+
+static void BENCH_UiFill(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List, u16 Copy_X, u16 Copy_Y, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color)
+{
+    if (Copy_List == NULL)
+    {
+        TFT_FillRect(&Copy_Panel->Config, Copy_Spi, Copy_X, Copy_Y, Copy_Width, Copy_Height, Copy_Color);
+    }
+    else
+    {
+        DLIST_FillRect(Copy_List, Copy_X, Copy_Y, Copy_Width, Copy_Height, Copy_Color);
+    }
+}
+
+static void BENCH_UiPixel(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List, u16 Copy_X, u16 Copy_Y, u16 Copy_Color)
+{
+    if (Copy_List == NULL)
+    {
+        TFT_DrawPixel(&Copy_Panel->Config, Copy_Spi, Copy_X, Copy_Y, Copy_Color);
+    }
+    else
+    {
+        DLIST_DrawPixel(Copy_List, Copy_X, Copy_Y, Copy_Color);
+    }
+}
+
+static void BENCH_UiText(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List, u16 Copy_X, u16 Copy_Y, const char *Copy_Text, u16 Copy_Color, u16 Copy_Background)
+{
+    if (Copy_List == NULL)
+    {
+        TFT_DrawText(&Copy_Panel->Config, Copy_Spi, Copy_X, Copy_Y, Copy_Text, &BENCH_Font, Copy_Color, Copy_Background);
+    }
+    else
+    {
+        DLIST_DrawText(Copy_List, Copy_X, Copy_Y, Copy_Text, &BENCH_Font, Copy_Color, Copy_Background);
+    }
+}
+
+static void BENCH_UiIcon(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List, u16 Copy_X, u16 Copy_Y)
+{
+    if (Copy_List == NULL)
+    {
+        TFT_BurstWritePixels(&Copy_Panel->Config, Copy_Spi, Copy_X, Copy_Y, BENCH_ICON_SIZE, BENCH_ICON_SIZE, BENCH_BitmapPixels);
+    }
+    else
+    {
+        DLIST_DrawImage(Copy_List, Copy_X, Copy_Y, BENCH_ICON_SIZE, BENCH_ICON_SIZE, BENCH_BitmapPixels);
+    }
+}
+
+static void BENCH_DrawUi(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, DLIST_List_t *Copy_List)
+{
+    static const char *const Local_Labels[] = { "WiFi", "Volume", "Brightness", "Alarm 07:30", "Sleep 10 min" };
+    u16 Local_Width = Copy_Panel->Config.TFT_Controller->TFT_Width;
+    u16 Local_Height = Copy_Panel->Config.TFT_Controller->TFT_Height;
+    u16 Local_CardHeight = Local_Height / 8;
+    u16 Local_RowHeight = Local_Height / 20;
+    u16 Local_ChartHeight = Local_Height / 8;
+    u16 Local_Y;
+    u16 Local_X;
+    u16 Local_Index;
+
+    /**< Background and header */
+    BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 0, 0, Local_Width, Local_Height, 0x18E3);
+    BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 0, 0, Local_Width, 20, 0x001F);
+    BENCH_UiText(Copy_Panel, Copy_Spi, Copy_List, 4, 5, "Settings", 0xFFFF, 0x001F);
+
+    /**< Cards: background, border, label, progress bar */
+    Local_Y = 24;
+    for (Local_Index = 0; Local_Index < 3; Local_Index++)
+    {
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 4, Local_Y, Local_Width - 8, Local_CardHeight, 0x2104);
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 4, Local_Y, Local_Width - 8, 1, 0x8410);
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 4, Local_Y + Local_CardHeight - 1, Local_Width - 8, 1, 0x8410);
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 4, Local_Y, 1, Local_CardHeight, 0x8410);
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, Local_Width - 5, Local_Y, 1, Local_CardHeight, 0x8410);
+        BENCH_UiText(Copy_Panel, Copy_Spi, Copy_List, 8, Local_Y + 4, Local_Labels[Local_Index], 0xFFFF, 0x2104);
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 8, Local_Y + Local_CardHeight - 8, Local_Width - 16, 4, 0x4208);
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 8, Local_Y + Local_CardHeight - 8, (Local_Width - 16) * (Local_Index + 1) / 4, 4, 0x07E0);
+        Local_Y += Local_CardHeight + 4;
+    }
+
+    /**< List rows with a separator; the last row is cleared and drawn again */
+    for (Local_Index = 0; Local_Index < 5; Local_Index++)
+    {
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 0, Local_Y, Local_Width, Local_RowHeight, (Local_Index & 1) ? 0x2945 : 0x18E3);
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 0, Local_Y + Local_RowHeight - 1, Local_Width, 1, 0x4208);
+        BENCH_UiText(Copy_Panel, Copy_Spi, Copy_List, 8, Local_Y + 1, Local_Labels[Local_Index], 0xFFFF, (Local_Index & 1) ? 0x2945 : 0x18E3);
+        Local_Y += Local_RowHeight;
+    }
+    BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 0, Local_Y - Local_RowHeight, Local_Width, Local_RowHeight, 0x18E3);
+    BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 0, Local_Y - Local_RowHeight, Local_Width, Local_RowHeight, 0x2945);
+
+    /**< Chart: background, grid, one point per column, then a row of icons; on screens tall
+         enough for them */
+    Local_Y += 4;
+    if ((Local_Y + Local_ChartHeight + 4 + BENCH_ICON_SIZE) <= (Local_Height - 16))
+    {
+        BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 4, Local_Y, Local_Width - 8, Local_ChartHeight, 0x0000);
+        for (Local_Index = 1; Local_Index < 4; Local_Index++)
+        {
+            BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 4, Local_Y + Local_ChartHeight * Local_Index / 4, Local_Width - 8, 1, 0x2104);
+        }
+        for (Local_X = 0; Local_X < Local_Width - 8; Local_X++)
+        {
+            BENCH_UiPixel(Copy_Panel, Copy_Spi, Copy_List, 4 + Local_X,
+                          Local_Y + (Local_ChartHeight - 2) * ((Local_X / 6) % 8 + (Local_X / 48) % 3) / 10 + 1, 0xFFE0);
+        }
+        Local_Y += Local_ChartHeight + 4;
+
+        for (Local_X = 4; (Local_X + BENCH_ICON_SIZE) <= Local_Width; Local_X += BENCH_ICON_SIZE + 4)
+        {
+            BENCH_UiIcon(Copy_Panel, Copy_Spi, Copy_List, Local_X, Local_Y);
+        }
+    }
+
+    /**< Footer drawn in two halves, with its text */
+    BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, 0, Local_Height - 16, Local_Width / 2, 16, 0x001F);
+    BENCH_UiFill(Copy_Panel, Copy_Spi, Copy_List, Local_Width / 2, Local_Height - 16, Local_Width - Local_Width / 2, 16, 0x001F);
+    BENCH_UiText(Copy_Panel, Copy_Spi, Copy_List, 4, Local_Height - 13, "Back", 0xFFFF, 0x001F);
+}
+
+static void BENCH_FrameFill(u16 Copy_ScreenWidth, u16 Copy_X, u16 Copy_Y, u16 Copy_Width, u16 Copy_Height, u16 Copy_Color)
+{
+    u16 Local_Row;
+    u16 Local_Column;
+
+    for (Local_Row = Copy_Y; Local_Row < Copy_Y + Copy_Height; Local_Row++)
+    {
+        for (Local_Column = Copy_X; Local_Column < Copy_X + Copy_Width; Local_Column++)
+        {
+            BENCH_Frame[(u32)Local_Row * Copy_ScreenWidth + Local_Column] = Copy_Color;
+        }
+    }
+    DIRTY_MarkRect(&BENCH_Dirty, Copy_X, Copy_Y, Copy_Width, Copy_Height);
+}
+
+static void BENCH_MakeFrame(const BENCH_Panel_t *Copy_Panel)
+{
+    u16 Local_Width = Copy_Panel->Config.TFT_Controller->TFT_Width;
+    u16 Local_Height = Copy_Panel->Config.TFT_Controller->TFT_Height;
+    u32 Local_Pixel;
+
+    /**< Background gradient, header, two value boxes, two bar gauges and their tracks, a lamp */
+    for (Local_Pixel = 0; Local_Pixel < (u32)Local_Width * Local_Height; Local_Pixel++)
+    {
+        BENCH_Frame[Local_Pixel] = (u16)(((Local_Pixel / Local_Width) * 31 / Local_Height) & 0x1F);
+    }
+    BENCH_FrameFill(Local_Width, 0, 0, Local_Width, 20, 0x001F);
+    BENCH_FrameFill(Local_Width, Local_Width / 2, Local_Height / 8, Local_Width / 3, 16, 0x2104);
+    BENCH_FrameFill(Local_Width, Local_Width / 2, Local_Height / 8 + 18, Local_Width / 3, 10, 0x2104);
+    BENCH_FrameFill(Local_Width, 8, Local_Height / 2, Local_Width - 16, 12, 0x4208);
+    BENCH_FrameFill(Local_Width, 8, Local_Height / 2, (Local_Width - 16) * 6 / 10, 12, 0x07E0);
+    BENCH_FrameFill(Local_Width, 8, Local_Height * 3 / 4, Local_Width - 16, 12, 0x4208);
+    BENCH_FrameFill(Local_Width, 8, Local_Height * 3 / 4, (Local_Width - 16) / 3, 12, 0xFD20);
+    BENCH_FrameFill(Local_Width, Local_Width - 12, 6, 8, 8, 0x8410);
+}
+
+static void BENCH_UpdateFrame(const BENCH_Panel_t *Copy_Panel)
+{
+    u16 Local_Width = Copy_Panel->Config.TFT_Controller->TFT_Width;
+    u16 Local_Height = Copy_Panel->Config.TFT_Controller->TFT_Height;
+    u16 Local_Box = Local_Width / 3;
+
+    /**< New digits in the value boxes (two adjacent areas), the bar grows from 60 to 65%, the lamp turns on */
+    BENCH_FrameFill(Local_Width, Local_Width / 2 + 2, Local_Height / 8 + 3, Local_Box / 2, 10, 0xFFFF);
+    BENCH_FrameFill(Local_Width, Local_Width / 2 + 2, Local_Height / 8 + 20, Local_Box / 3, 6, 0xFFE0);
+    BENCH_FrameFill(Local_Width, 8 + (Local_Width - 16) * 6 / 10, Local_Height / 2, (Local_Width - 16) / 20, 12, 0x07E0);
+    BENCH_FrameFill(Local_Width, Local_Width - 12, 6, 8, 8, 0xF800);
+}
+
+static void BENCH_PlotChart(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, u8 Copy_Mode)
+{
+    u16 Local_Width = Copy_Panel->Config.TFT_Controller->TFT_Width;
+    u16 Local_Height = Copy_Panel->Config.TFT_Controller->TFT_Height;
+    u32 Local_Sample;
+    s32 Local_Phase;
+
+    /**< The plot covers the middle half of the screen; setting it up is not part of the scene */
+    CHART_Init(&BENCH_Chart, &Copy_Panel->Config, Copy_Spi, Copy_Mode, 0, Local_Height / 4, Local_Width, Local_Height / 2,
+               0, 4095, BENCH_CHART_DECIMATION, 0x07E0, 0x0000, BENCH_ChartSpans);
+    TFT_EMU_ResetStats();
+
+    for (Local_Sample = 0; Local_Sample < BENCH_CHART_SAMPLES; Local_Sample++)
+    {
+        Local_Phase = (s32)(Local_Sample % 400);
+        CHART_AddSample(&BENCH_Chart, ((Local_Phase < 200) ? (Local_Phase * 20) : ((400 - Local_Phase) * 20)) + (s32)((Local_Sample * 37) % 61));
+    }
+    BENCH_Samples = BENCH_CHART_SAMPLES;
+}
+
+static void BENCH_RunConsole(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi)
+{
+    u16 Local_Width = Copy_Panel->Config.TFT_Controller->TFT_Width;
+    u16 Local_Height = Copy_Panel->Config.TFT_Controller->TFT_Height;
+    u16 Local_LineHeight = BENCH_Font.TFT_LineHeight;
+    char Local_Text[24];
+    u32 Local_Pixel;
+    u32 Local_Mismatches = 0;
+    u32 Local_Line;
+    u32 Local_Rows;
+    u32 Local_Row;
+
+    /**< A full screen of log lines, 17 columns so they fit the narrowest panel; filling it is not part of the scenes */
+    CONSOLE_Init(&BENCH_Console, &Copy_Panel->Config, Copy_Spi, &BENCH_Font, 0x07E0, 0x0000);
+    Local_Rows = BENCH_Console.Rows;
+    for (Local_Line = 0; Local_Line < Local_Rows; Local_Line++)
+    {
+        CONSOLE_Printf(&BENCH_Console, "%sline %05u t=%04u", (Local_Line == 0) ? "" : "\n", Local_Line, (Local_Line * 37) % 10000);
+    }
+    TFT_EMU_ResetStats();
+
+    /**< Each new line scrolls the top one out with the controller's vertical scrolling */
+    for (Local_Line = Local_Rows; Local_Line < Local_Rows + BENCH_CONSOLE_LINES; Local_Line++)
+    {
+        CONSOLE_Printf(&BENCH_Console, "\nline %05u t=%04u", Local_Line, (Local_Line * 37) % 10000);
+    }
+    BENCH_Lines = BENCH_CONSOLE_LINES;
+    BENCH_Report(Copy_Panel, "console_scroll");
+    for (Local_Pixel = 0; Local_Pixel < (u32)Local_Width * Local_Height; Local_Pixel++)
+    {
+        BENCH_UiScreen[Local_Pixel] = TFT_EMU_GetPixel(Local_Pixel % Local_Width, Local_Pixel / Local_Width);
+    }
+
+    /**< The same lines without scrolling: every visible line drawn again at its place */
+    CONSOLE_Clear(&BENCH_Console);
+    for (Local_Row = 0; Local_Row < Local_Rows; Local_Row++)
+    {
+        snprintf(Local_Text, sizeof(Local_Text), "line %05u t=%04u", Local_Row, (Local_Row * 37) % 10000);
+        TFT_DrawText(&Copy_Panel->Config, Copy_Spi, 0, Local_Row * Local_LineHeight, Local_Text, &BENCH_Font, 0x07E0, 0x0000);
+    }
+    TFT_EMU_ResetStats();
+    for (Local_Line = Local_Rows; Local_Line < Local_Rows + BENCH_CONSOLE_LINES; Local_Line++)
+    {
+        for (Local_Row = 0; Local_Row < Local_Rows; Local_Row++)
+        {
+            snprintf(Local_Text, sizeof(Local_Text), "line %05u t=%04u", Local_Line + 1 - Local_Rows + Local_Row,
+                     ((Local_Line + 1 - Local_Rows + Local_Row) * 37) % 10000);
+            TFT_DrawText(&Copy_Panel->Config, Copy_Spi, 0, Local_Row * Local_LineHeight, Local_Text, &BENCH_Font, 0x07E0, 0x0000);
+        }
+    }
+    BENCH_Lines = BENCH_CONSOLE_LINES;
+    BENCH_Report(Copy_Panel, "console_redraw");
+    for (Local_Pixel = 0; Local_Pixel < (u32)Local_Width * Local_Height; Local_Pixel++)
+    {
+        if (TFT_EMU_GetPixel(Local_Pixel % Local_Width, Local_Pixel / Local_Width) != BENCH_UiScreen[Local_Pixel])
+        {
+            Local_Mismatches++;
+        }
+    }
+    fprintf(stderr, "%s: console of %u lines, %u pixels differ between the scrolled and the redrawn screen\n", Copy_Panel->Name,
+            Local_Rows, Local_Mismatches);
+    if (Local_Mismatches != 0)
+    {
+        BENCH_Failed = 1;
+    }
+}
+
+static void BENCH_RunPacking(const BENCH_Panel_t *Copy_Panel, SPI_t Copy_Spi, u8 Copy_Packing, u8 Copy_Format, const char *Copy_FillScene, const char *Copy_FrameScene)
+{
+    u16 Local_Width = Copy_Panel->Config.TFT_Controller->TFT_Width;
+    u16 Local_Height = Copy_Panel->Config.TFT_Controller->TFT_Height;
+
+    /**< The same controller with the packing changed, and the panel told the new format */
+    BENCH_PackedController = *Copy_Panel->Config.TFT_Controller;
+    BENCH_PackedController.TFT_PixelFormat = Copy_Format;
+    BENCH_PackedController.TFT_PixelPacking = Copy_Packing;
+    BENCH_PackedConfig = Copy_Panel->Config;
+    BENCH_PackedConfig.TFT_Controller = &BENCH_PackedController;
+    TFT_SendCommandWithArgs(&BENCH_PackedConfig, Copy_Spi, BENCH_COLMOD, &Copy_Format, 1);
+    TFT_EMU_ResetStats();
+
+    TFT_FillRect(&BENCH_PackedConfig, Copy_Spi, 0, 0, Local_Width, Local_Height, 0x051D);
+    BENCH_Report(Copy_Panel, Copy_FillScene);
+
+    TFT_BurstWritePixels(&BENCH_PackedConfig, Copy_Spi, 0, 0, Local_Width, Local_Height, BENCH_Frame);
+    BENCH_Report(Copy_Panel, Copy_FrameScene);
+}
+
+static void BENCH_RunPanel(const BENCH_Panel_t *Copy_Panel)
+{
+    DLIST_Stats_t Local_ListStats;
+    u32 Local_Pixel;
+    u32 Local_Mismatches = 0;
+    u32 Local_DirtyCost;
+    u8 Local_DirtyRects;
+    SPI_t Local_Spi = NULL;
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    u16 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    u16 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    u16 Local_Side = (Local_Width < Local_Height) ? Local_Width : Local_Height;
+
+    if (Local_Config->TFT_Bus == TFT_BUS_SPI)
+    {
+        Local_Spi = SPI_SelectSpiPeripheral(SPI1);
+    }
+
+    BENCH_StartPanel(Copy_Panel, Local_Spi);
+    BENCH_Report(Copy_Panel, "init");
+
+    TFT_ClearScreen(Local_Config, Local_Spi);
+    BENCH_Report(Copy_Panel, "clear");
+
+    TFT_FillRect(Local_Config, Local_Spi, Local_Width / 4, Local_Height / 4, Local_Width / 2, Local_Height / 2, 0xF800);
+    BENCH_Report(Copy_Panel, "fill_rect");
+
+    TFT_DrawPixel(Local_Config, Local_Spi, Local_Width / 2, Local_Height / 2, 0xFFFF);
+    BENCH_Report(Copy_Panel, "pixel");
+
+    TFT_DrawLine(Local_Config, Local_Spi, 0, Local_Height / 2, Local_Width - 1, Local_Height / 2, 0x07E0);
+    BENCH_Report(Copy_Panel, "line_horizontal");
+
+    TFT_DrawLine(Local_Config, Local_Spi, Local_Width / 2, 0, Local_Width / 2, Local_Height - 1, 0x07E0);
+    BENCH_Report(Copy_Panel, "line_vertical");
+
+    TFT_DrawLine(Local_Config, Local_Spi, 0, Local_Height / 8, Local_Width - 1, Local_Height / 4, 0x001F);
+    BENCH_Report(Copy_Panel, "line_shallow");
+
+    TFT_DrawLine(Local_Config, Local_Spi, 0, 0, Local_Side - 1, Local_Side - 1, 0x001F);
+    BENCH_Report(Copy_Panel, "line_diagonal");
+
+    TFT_DrawLine(Local_Config, Local_Spi, Local_Width / 8, 0, Local_Width / 4, Local_Height - 1, 0x001F);
+    BENCH_Report(Copy_Panel, "line_steep");
+
+    TFT_DrawText(Local_Config, Local_Spi, 4, Local_Height / 2, BENCH_TEXT, &BENCH_Font, 0xFFFF, 0x0000);
+    BENCH_Report(Copy_Panel, "text");
+
+    TFT_DrawTextTransparent(Local_Config, Local_Spi, 4, Local_Height / 2 + 12, BENCH_TEXT, &BENCH_Font, 0xFFFF);
+    BENCH_Report(Copy_Panel, "text_transparent");
+
+    TFT_DrawImage(Local_Config, Local_Spi, 0, 0, &BENCH_Image);
+    BENCH_Report(Copy_Panel, "image_rgb565");
+
+    TFT_DrawImage(Local_Config, Local_Spi, 0, 0, &BENCH_RleImage);
+    BENCH_Report(Copy_Panel, "image_rle");
+
+    TFT_Blit(Local_Config, Local_Spi, Local_Width - BENCH_IMAGE_SIZE, 0, &BENCH_Bitmap, 0, 0, BENCH_IMAGE_SIZE, BENCH_IMAGE_SIZE, TFT_ROTATE_90);
+    BENCH_Report(Copy_Panel, "blit_rotate_90");
+
+    /**< Shapes, each one span per row, some of them crossing the screen edges */
+    TFT_ClearScreen(Local_Config, Local_Spi);
+    TFT_EMU_ResetStats();
+    SHAPE_FillCircle(Local_Config, Local_Spi, Local_Width / 2, Local_Height / 2, Local_Side / 3, 0xF800);
+    SHAPE_DrawCircle(Local_Config, Local_Spi, Local_Width / 2, Local_Height / 2, Local_Side / 2 - 2, 0xFFFF);
+    SHAPE_FillCircle(Local_Config, Local_Spi, 0, Local_Height, Local_Side / 4, 0x07E0);
+    BENCH_Report(Copy_Panel, "shape_circles");
+
+    TFT_ClearScreen(Local_Config, Local_Spi);
+    TFT_EMU_ResetStats();
+    SHAPE_DrawArc(Local_Config, Local_Spi, Local_Width / 2, Local_Height / 2, Local_Side / 2 - 2, Local_Side / 16, 135, 45, 0x4208);
+    SHAPE_DrawArc(Local_Config, Local_Spi, Local_Width / 2, Local_Height / 2, Local_Side / 2 - 2, Local_Side / 16, 135, 300, 0x07E0);
+    SHAPE_DrawArc(Local_Config, Local_Spi, Local_Width / 2, Local_Height / 2, Local_Side / 4, Local_Side, 300, 30, 0xFFE0);
+    BENCH_Report(Copy_Panel, "shape_arcs");
+
+    TFT_ClearScreen(Local_Config, Local_Spi);
+    TFT_EMU_ResetStats();
+    SHAPE_FillRoundRect(Local_Config, Local_Spi, Local_Width / 8, Local_Height / 8, Local_Width * 3 / 4, Local_Height / 4, Local_Side / 10, 0x001F);
+    SHAPE_DrawRoundRect(Local_Config, Local_Spi, Local_Width / 8, Local_Height / 2, Local_Width * 3 / 4, Local_Height / 4, Local_Side / 10, 0xFFFF);
+    SHAPE_FillRoundRect(Local_Config, Local_Spi, -(s16)(Local_Width / 8), Local_Height - Local_Height / 16, Local_Width / 2, Local_Height / 8, Local_Side / 10, 0xF81F);
+    BENCH_Report(Copy_Panel, "shape_round_rects");
+
+    TFT_ClearScreen(Local_Config, Local_Spi);
+    TFT_EMU_ResetStats();
+    SHAPE_FillTriangle(Local_Config, Local_Spi, Local_Width / 2, 0, Local_Width - 1, Local_Height / 2, 0, Local_Height * 3 / 4, 0xFD20);
+    SHAPE_DrawTriangle(Local_Config, Local_Spi, Local_Width / 2, 0, Local_Width - 1, Local_Height / 2, 0, Local_Height * 3 / 4, 0xFFFF);
+    BENCH_Hexagon[0].X = Local_Width / 4;
+    BENCH_Hexagon[0].Y = Local_Height * 3 / 4;
+    BENCH_Hexagon[1].X = Local_Width / 2;
+    BENCH_Hexagon[1].Y = Local_Height * 5 / 8;
+    BENCH_Hexagon[2].X = Local_Width * 3 / 4;
+    BENCH_Hexagon[2].Y = Local_Height * 3 / 4;
+    BENCH_Hexagon[3].X = Local_Width * 3 / 4;
+    BENCH_Hexagon[3].Y = Local_Height * 7 / 8;
+    BENCH_Hexagon[4].X = Local_Width / 2;
+    BENCH_Hexagon[4].Y = Local_Height + Local_Height / 8;
+    BENCH_Hexagon[5].X = Local_Width / 4;
+    BENCH_Hexagon[5].Y = Local_Height * 7 / 8;
+    SHAPE_FillPolygon(Local_Config, Local_Spi, BENCH_Hexagon, 6, 0x07FF);
+    SHAPE_DrawPolygon(Local_Config, Local_Spi, BENCH_Hexagon, 6, 0xFFFF);
+    BENCH_Report(Copy_Panel, "shape_polygons");
+
+    /**< Full dashboard redraw, as after a screen change */
+    BENCH_MakeDashboard(Copy_Panel, Local_Spi);
+    TFT_EMU_ResetStats();
+    WIDGET_SetValue(&BENCH_Gauge, 120);
+    WIDGET_SetValue(&BENCH_Fuel, 75);
+    WIDGET_SetValue(&BENCH_Temperature, 90);
+    WIDGET_DrawAll(&BENCH_Screen);
+    WIDGET_Flush(&BENCH_Screen);
+    BENCH_Report(Copy_Panel, "dashboard_redraw");
+
+    /**< One frame of live values */
+    WIDGET_SetValue(&BENCH_Gauge, 128);
+    WIDGET_SetValue(&BENCH_Fuel, 74);
+    WIDGET_SetValue(&BENCH_Temperature, 92);
+    WIDGET_SetText(&BENCH_Speed, "128 km/h");
+    WIDGET_Flush(&BENCH_Screen);
+    BENCH_Report(Copy_Panel, "dashboard_update");
+    BENCH_CheckDashboard(Copy_Panel, "values up");
+
+    /**< Values going down: the gauge shrinks back over its end ray, the label gets shorter */
+    WIDGET_SetValue(&BENCH_Gauge, 96);
+    WIDGET_SetValue(&BENCH_Fuel, 60);
+    WIDGET_SetValue(&BENCH_Temperature, 85);
+    WIDGET_SetText(&BENCH_Speed, "96 km/h");
+    WIDGET_Flush(&BENCH_Screen);
+    BENCH_Report(Copy_Panel, "dashboard_down");
+    BENCH_CheckDashboard(Copy_Panel, "values down");
+
+    /**< A text wider than the label is clipped, then replaced by a short one */
+    WIDGET_SetText(&BENCH_Speed, "96 km/h  cruise control");
+    WIDGET_Flush(&BENCH_Screen);
+    BENCH_CheckDashboard(Copy_Panel, "label too wide");
+    WIDGET_SetText(&BENCH_Speed, "97 km/h");
+    WIDGET_Flush(&BENCH_Screen);
+    BENCH_CheckDashboard(Copy_Panel, "label shortened");
+
+    /**< The same UI frame drawn call by call, then through the display list */
+    TFT_ClearScreen(Local_Config, Local_Spi);
+    TFT_EMU_ResetStats();
+    BENCH_DrawUi(Copy_Panel, Local_Spi, NULL);
+    BENCH_Report(Copy_Panel, "ui_direct");
+    for (Local_Pixel = 0; Local_Pixel < (u32)Local_Width * Local_Height; Local_Pixel++)
+    {
+        BENCH_UiScreen[Local_Pixel] = TFT_EMU_GetPixel(Local_Pixel % Local_Width, Local_Pixel / Local_Width);
+    }
+
+    TFT_ClearScreen(Local_Config, Local_Spi);
+    TFT_EMU_ResetStats();
+    DLIST_Init(&BENCH_List, BENCH_ListBuffer, BENCH_LIST_BYTES, Local_Width, Local_Height);
+    BENCH_DrawUi(Copy_Panel, Local_Spi, &BENCH_List);
+    DLIST_Flush(&BENCH_List, Local_Config, Local_Spi, &Local_ListStats);
+    BENCH_Report(Copy_Panel, "ui_display_list");
+    for (Local_Pixel = 0; Local_Pixel < (u32)Local_Width * Local_Height; Local_Pixel++)
+    {
+        if (TFT_EMU_GetPixel(Local_Pixel % Local_Width, Local_Pixel / Local_Width) != BENCH_UiScreen[Local_Pixel])
+        {
+            Local_Mismatches++;
+        }
+    }
+    fprintf(stderr, "%s: display list of %u commands, %u merged, %u culled, %u draws, %u pixels differ\n", Copy_Panel->Name,
+            Local_ListStats.Recorded, Local_ListStats.Merged, Local_ListStats.Culled, Local_ListStats.Draws, Local_Mismatches);
+    if (Local_Mismatches != 0)
+    {
+        BENCH_Failed = 1;
+    }
+
+    /**< One frame of live values of a frame buffer dashboard: the dirty rectangles, then the whole frame */
+    DIRTY_Init(&BENCH_Dirty, BENCH_DirtyRects, BENCH_DIRTY_RECTS, Local_Width, Local_Height);
+    BENCH_MakeFrame(Copy_Panel);
+    DIRTY_MarkAll(&BENCH_Dirty);
+    DIRTY_FlushImage(&BENCH_Dirty, Local_Config, Local_Spi, BENCH_Frame);
+    TFT_EMU_ResetStats();
+    BENCH_UpdateFrame(Copy_Panel);
+    Local_DirtyRects = BENCH_Dirty.Count;
+    Local_DirtyCost = DIRTY_GetFlushCost(&BENCH_Dirty);
+    DIRTY_FlushImage(&BENCH_Dirty, Local_Config, Local_Spi, BENCH_Frame);
+    BENCH_Report(Copy_Panel, "dirty_update");
+    for (Local_Pixel = 0; Local_Pixel < (u32)Local_Width * Local_Height; Local_Pixel++)
+    {
+        BENCH_UiScreen[Local_Pixel] = TFT_EMU_GetPixel(Local_Pixel % Local_Width, Local_Pixel / Local_Width);
+    }
+
+    TFT_BurstWritePixels(Local_Config, Local_Spi, 0, 0, Local_Width, Local_Height, BENCH_Frame);
+    BENCH_Report(Copy_Panel, "dirty_full_redraw");
+    Local_Mismatches = 0;
+    for (Local_Pixel = 0; Local_Pixel < (u32)Local_Width * Local_Height; Local_Pixel++)
+    {
+        if (TFT_EMU_GetPixel(Local_Pixel % Local_Width, Local_Pixel / Local_Width) != BENCH_UiScreen[Local_Pixel])
+        {
+            Local_Mismatches++;
+        }
+    }
+    fprintf(stderr, "%s: dirty update of %u rectangles, %u bytes estimated, %u pixels differ from the full redraw\n", Copy_Panel->Name,
+            Local_DirtyRects, Local_DirtyCost, Local_Mismatches);
+    if (Local_Mismatches != 0)
+    {
+        BENCH_Failed = 1;
+    }
+
+    /**< Strip chart fed at the decimation of a fast ADC stream */
+    TFT_ClearScreen(Local_Config, Local_Spi);
+    BENCH_PlotChart(Copy_Panel, Local_Spi, CHART_SWEEP);
+    BENCH_Report(Copy_Panel, "chart_sweep");
+
+    TFT_ClearScreen(Local_Config, Local_Spi);
+    BENCH_PlotChart(Copy_Panel, Local_Spi, CHART_SCROLL);
+    BENCH_Report(Copy_Panel, "chart_scroll");
+
+    /**< A log console, scrolled by the controller, then redrawn line by line */
+    BENCH_RunConsole(Copy_Panel, Local_Spi);
+
+    /**< Full-screen fill and frame in each pixel packing of the SPI panel, last as they change its format */
+    if (Local_Config->TFT_Bus == TFT_BUS_SPI)
+    {
+        TFT_FillRect(Local_Config, Local_Spi, 0, 0, Local_Width, Local_Height, 0x051D);
+        BENCH_Report(Copy_Panel, "fill_screen_rgb565");
+        TFT_BurstWritePixels(Local_Config, Local_Spi, 0, 0, Local_Width, Local_Height, BENCH_Frame);
+        BENCH_Report(Copy_Panel, "image_screen_rgb565");
+        if (Local_Config->TFT_Controller == &TFT_ST7735S_Controller)
+        {
+            BENCH_RunPacking(Copy_Panel, Local_Spi, TFT_PIXEL_RGB444, BENCH_COLMOD_RGB444, "fill_screen_rgb444", "image_screen_rgb444");
+        }
+        BENCH_RunPacking(Copy_Panel, Local_Spi, TFT_PIXEL_RGB666, BENCH_COLMOD_RGB666, "fill_screen_rgb666", "image_screen_rgb666");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int Local_Argument;
+    u8 Local_Panel;
+
+    for (Local_Argument = 1; Local_Argument < argc; Local_Argument++)
+    {
+        if ((strcmp(argv[Local_Argument], "--spi-hz") == 0) && (Local_Argument + 1 < argc))
+        {
+            BENCH_SpiHz = atof(argv[++Local_Argument]);
+        }
+        else if ((strcmp(argv[Local_Argument], "--cycle-ns") == 0) && (Local_Argument + 1 < argc))
+        {
+            BENCH_CycleNs = atof(argv[++Local_Argument]);
+        }
+        else if ((strcmp(argv[Local_Argument], "--screens") == 0) && (Local_Argument + 1 < argc))
+        {
+            BENCH_ScreensDirectory = argv[++Local_Argument];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--spi-hz HZ] [--cycle-ns NS] [--screens DIR]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if ((BENCH_SpiHz <= 0.0) || (BENCH_CycleNs <= 0.0))
+    {
+        fprintf(stderr, "%s: --spi-hz and --cycle-ns must be positive\n", argv[0]);
+        return 2;
+    }
+
+    BENCH_MakeAssets();
+
+    printf("{\n  \"spi_hz\": %.0f,\n  \"cycle_ns\": %.1f,\n  \"results\": [", BENCH_SpiHz, BENCH_CycleNs);
+    for (Local_Panel = 0; Local_Panel < sizeof(BENCH_Panels) / sizeof(BENCH_Panels[0]); Local_Panel++)
+    {
+        BENCH_RunPanel(&BENCH_Panels[Local_Panel]);
+    }
+    printf("\n  ]\n}\n");
+
+    return BENCH_Failed;
+}
@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""
+@file tftbench.py
+@brief Builds and runs the display benchmark on the host and checks it against budgets.
+
+tft_bench.c is built with the host TFT emulator in place of the MCAL, together with the
+TFT core, every controller and the SHAPE, WIDGET, DLIST, DIRTY, CHART and CONSOLE services. Its JSON report
+(bytes on the wire, parallel bus cycles, chip-select transactions, windows and estimated
+time per controller and scene) is checked against budgets.json:
+
+- a count above its budget is a regression and fails the run (exit status 1);
+- a protocol error reported by the emulator always fails the run;
+- time_us is only checked when the run uses the clocks the budgets were recorded with;
+- scenes without a budget are reported as new and do not fail the run.
+
+The strip chart scenes also give the sample rate the wire sustains (samples/s), and the
+console scenes the line rate (lines/s); a rate below its budget (samples_per_s, lines_per_s)
+is a regression, checked like time_us only when the clocks match. Counts below their budget are listed as improvements; record
+them with --update so the budgets follow the code. The report, with the budget and the verdict of every entry, is
+written with --out for CI artifacts.
+
+@date 17 Oct 2026
+@version V01
+@author Mahmoud Abdelraouf Mahmoud
+
+Usage:
+    tftbench.py [--spi-hz 18000000] [--cycle-ns 100] [--budgets budgets.json]
+                [--out report.json] [--screens out_dir] [--update] [--cc gcc]
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.normpath(os.path.join(HERE, "..", ".."))
+COTS = os.path.join(ROOT, "COTS")
+EMULATOR = os.path.join(ROOT, "Tools", "TFT_Emulator")
+
+SOURCES = [
+    os.path.join(HERE, "tft_bench.c"),
+    os.path.join(EMULATOR, "TFT_EMU_program.c"),
+    os.path.join(COTS, "03-HAL", "TFT_Display", "TFT_Core", "TFT_program.c"),
+    os.path.join(COTS, "03-HAL", "TFT_Display", "TFT_ST7735S", "TFT_ST7735S_program.c"),
+    os.path.join(COTS, "03-HAL", "TFT_Display", "TFT_HX8357B", "TFT_HX8357B_program.c"),
+    os.path.join(COTS, "03-HAL", "TFT_Display", "TFT_ILI9481", "TFT_ILI9481_program.c"),
+    os.path.join(COTS, "04-SERVICES", "SHAPE", "SHAPE_program.c"),
+    os.path.join(COTS, "04-SERVICES", "WIDGET", "WIDGET_program.c"),
+    os.path.join(COTS, "04-SERVICES", "DLIST", "DLIST_program.c"),
+    os.path.join(COTS, "04-SERVICES", "DIRTY", "DIRTY_program.c"),
+    os.path.join(COTS, "04-SERVICES", "CHART", "CHART_program.c"),
+    os.path.join(COTS, "04-SERVICES", "CONSOLE", "CONSOLE_program.c"),
+]
+
+# Counts checked against the budgets; time_us only when the clocks match.
+METRICS = ("bytes", "bus_cycles", "transactions", "windows", "pixels")
+
+# Units of the rates some scenes report, as units per second of wire time.
+RATES = ("samples", "lines")
+
+
+def build(cc, directory):
+    """Compile the benchmark into directory and return the path of the executable."""
+    includes = []
+    for base in (COTS, EMULATOR):
+        for path, _, _ in os.walk(base):
+            includes.append("-I" + path)
+    binary = os.path.join(directory, "tft_bench")
+    command = [cc, "-std=c11", "-O2", "-Wall", "-Wextra", "-Werror"] + includes + ["-o", binary] + SOURCES
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    if result.returncode != 0:
+        sys.exit("tftbench: build failed\n" + result.stdout)
+    return binary
+
+
+def run(binary, args):
+    """Run the benchmark and return its parsed report."""
+    command = [binary, "--spi-hz", str(args.spi_hz), "--cycle-ns", str(args.cycle_ns)]
+    if args.screens:
+        os.makedirs(args.screens, exist_ok=True)
+        command += ["--screens", args.screens]
+    result = subprocess.run(command, stdout=subprocess.PIPE, text=True)
+    if result.returncode != 0:
+        sys.exit("tftbench: benchmark exited with status %d" % result.returncode)
+    return json.loads(result.stdout)
+
+
+def check(report, budgets):
+    """Add the budget and the verdict to every entry; return (failures, improvements, new)."""
+    same_clocks = (budgets.get("spi_hz") == report["spi_hz"]
+                   and budgets.get("cycle_ns") == report["cycle_ns"])
+    tolerance = budgets.get("tolerance_percent", 0) / 100.0
+    failures, improvements, new = [], [], []
+
+    for entry in report["results"]:
+        name = "%s/%s" % (entry["controller"], entry["scene"])
+        budget = budgets.get("budgets", {}).get(entry["controller"], {}).get(entry["scene"])
+        entry["budget"] = budget
+        entry["status"] = "pass"
+
+        if entry["errors"]:
+            entry["status"] = "fail"
+            failures.append("%s: %d protocol errors" % (name, entry["errors"]))
+        if budget is None:
+            if entry["status"] == "pass":
+                entry["status"] = "new"
+            new.append(name)
+            continue
+
+        if same_clocks:
+            for unit in RATES:
+                key = unit + "_per_s"
+                if key not in budget or not entry.get(unit) or entry["time_us"] <= 0:
+                    continue
+                rate = round(entry[unit] * 1e6 / entry["time_us"], 1)
+                if rate < budget[key] * (1.0 - tolerance):
+                    entry["status"] = "fail"
+                    failures.append("%s: %s %s < budget %s" % (name, key, rate, budget[key]))
+                elif rate > budget[key]:
+                    improvements.append("%s: %s %s > budget %s" % (name, key, rate, budget[key]))
+
+        metrics = METRICS + (("time_us",) if same_clocks else ())
+        for metric in metrics:
+            if metric not in budget:
+                continue
+            limit = budget[metric] * (1.0 + tolerance)
+            if entry[metric] > limit:
+                entry["status"] = "fail"
+                failures.append("%s: %s %s > budget %s" % (name, metric, entry[metric], budget[metric]))
+            elif entry[metric] < budget[metric]:
+                improvements.append("%s: %s %s < budget %s" % (name, metric, entry[metric], budget[metric]))
+
+    report["budgets_clocks_match"] = same_clocks
+    return failures, improvements, new
+
+
+def make_budgets(report, tolerance):
+    """Return budgets recording the counts of report."""
+    budgets = {}
+    for entry in report["results"]:
+        scene = {metric: entry[metric] for metric in METRICS + ("time_us",)}
+        for unit in RATES:
+            if entry.get(unit) and entry["time_us"] > 0:
+                scene[unit + "_per_s"] = round(entry[unit] * 1e6 / entry["time_us"], 1)
+        budgets.setdefault(entry["controller"], {})[entry["scene"]] = scene
+    return {
+        "spi_hz": report["spi_hz"],
+        "cycle_ns": report["cycle_ns"],
+        "tolerance_percent": tolerance,
+        "budgets": budgets,
+    }
+
+
+def print_table(report):
+    print("%-17s %-17s %9s %9s %6s %7s %11s  %s" % ("controller", "scene", "bytes", "cycles",
+                                                   "trans", "windows", "time_us", "status"))
+    for entry in report["results"]:
+        print("%-17s %-17s %9d %9d %6d %7d %11.1f  %s" % (
+            entry["controller"], entry["scene"], entry["bytes"], entry["bus_cycles"],
+            entry["transactions"], entry["windows"], entry["time_us"], entry.get("status", "")))
+    for entry in report["results"]:
+        for unit in RATES:
+            if entry.get(unit) and entry["time_us"] > 0:
+                print("rate: %s/%s %.0f %s/s" % (entry["controller"], entry["scene"],
+                                                entry[unit] * 1e6 / entry["time_us"], unit))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the display benchmark against budgets.")
+    parser.add_argument("--spi-hz", type=int, default=18000000, help="SPI clock of the time estimate")
+    parser.add_argument("--cycle-ns", type=float, default=100.0,
+                        help="write cycle of the parallel bus in ns")
+    parser.add_argument("--budgets", default=os.path.join(HERE, "budgets.json"),
+                        help="budgets file (JSON)")
+    parser.add_argument("--out", help="write the report with budgets and verdicts (JSON)")
+    parser.add_argument("--screens", help="write a PPM screenshot after every scene")
+    parser.add_argument("--update", action="store_true",
+                        help="record the measured counts as the new budgets")
+    parser.add_argument("--tolerance", type=float,
+                        help="allowed growth in percent, stored in the budgets with --update")
+    parser.add_argument("--cc", default="gcc", help="host C compiler")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as directory:
+        report = run(build(args.cc, directory), args)
+
+    budgets = {}
+    if os.path.exists(args.budgets):
+        with open(args.budgets) as source:
+            budgets = json.load(source)
+
+    if args.update:
+        tolerance = args.tolerance if args.tolerance is not None else budgets.get("tolerance_percent", 0)
+        budgets = make_budgets(report, tolerance)
+        with open(args.budgets, "w") as target:
+            json.dump(budgets, target, indent=2)
+            target.write("\n")
+
+    failures, improvements, new = check(report, budgets)
+    report["passed"] = not failures
+    print_table(report)
+
+    if args.out:
+        with open(args.out, "w") as target:
+            json.dump(report, target, indent=2)
+            target.write("\n")
+
+    if not report["budgets_clocks_match"]:
+        print("note: clocks differ from the budgets, time_us not checked")
+    for line in improvements:
+        print("improved: " + line)
+    for name in new:
+        print("new: %s (no budget)" % name)
+    for line in failures:
+        print("REGRESSION: " + line)
+
+    print("%d entries, %d regressions" % (len(report["results"]), len(failures)))
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
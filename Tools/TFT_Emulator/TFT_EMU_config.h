@@ -0,0 +1,20 @@
+/**
+ * @file TFT_EMU_config.h
+ * @brief This file contains the configuration options for the host TFT emulator.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __TFT_EMU_CONFIG_H__
+#define __TFT_EMU_CONFIG_H__
+
+/**
+ * @brief Largest frame memory the emulator holds, in pixels; 480 x 480 covers the 320 x 480
+ * ILI9481 and HX8357B panels and the 132 x 162 ST7735S memory.
+ */
+#define TFT_EMU_MAX_WIDTH           480
+#define TFT_EMU_MAX_HEIGHT          480
+
+#endif /**< __TFT_EMU_CONFIG_H__ */
@@ -0,0 +1,175 @@
+/**
+ * @file TFT_EMU_interface.h
+ * @brief This file contains the public interface of the host TFT emulator.
+ *
+ * The emulator lets the TFT core, its controllers and the services run on a Linux host. It
+ * provides the GPIO, SPI and STK functions they call, so the drivers are built unchanged
+ * with TFT_EMU_program.c in place of the MCAL sources. The bytes that would reach the panel
+ * feed an emulated DCS controller:
+ * - column/row address set (0x2A/0x2B), memory write and write continue (0x2C/0x3C) with
+ *   the address counter wrapping inside the window like the real controllers;
+ * - memory access control (0x36): MV exchanges rows and columns, then MX and MY mirror
+ *   the columns and the rows of the frame memory;
+ * - interface pixel format (0x3A): 12, 16 and 18 bits per pixel on SPI, 16 bits on the
+ *   parallel bus;
+ * - vertical scrolling definition and start address (0x33/0x37), display on/off
+ *   (0x29/0x28), inversion on/off (0x21/0x20), software and hardware reset.
+ * Other commands and their parameters are counted and ignored.
+ *
+ * The visible screen is rendered to PPM files, compared with golden PPM files, and every
+ * transfer is counted so the cost of an operation can be tracked between commits.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Host only. Build the drivers with the emulator instead of the MCAL, e.g.:
+ * @code
+ * gcc -I<every COTS directory> -ITools/TFT_Emulator app.c Tools/TFT_Emulator/TFT_EMU_program.c \
+ *     COTS/03-HAL/TFT_Display/TFT_Core/TFT_program.c \
+ *     COTS/03-HAL/TFT_Display/TFT_ILI9481/TFT_ILI9481_program.c
+ * @endcode
+ *
+ * @note Include SPI_interface.h and TFT_interface.h before this file. One panel is emulated
+ * at a time; MADCTL's BGR and ML bits are ignored (the frame memory is shown as RGB).
+ *
+ * @note Example Usage:
+ * @code
+ * TFT_EMU_Stats_t stats;
+ * u32 mismatches;
+ *
+ * TFT_EMU_Attach(&panel, 320, 480, 0);
+ * TFT_Init(&panel, NULL);
+ *
+ * TFT_EMU_ResetStats();
+ * TFT_FillRect(&panel, NULL, 10, 10, 100, 50, 0xF800);
+ * TFT_EMU_GetStats(&stats);                   /// stats.Bytes == 10011, stats.Windows == 1
+ *
+ * TFT_EMU_WritePpm("out/fill.ppm");
+ * if (TFT_EMU_ComparePpm("golden/fill.ppm", &mismatches) || mismatches) { ... }
+ * @endcode
+ */
+
+#ifndef __TFT_EMU_INTERFACE_H__
+#define __TFT_EMU_INTERFACE_H__
+
+/**
+ * @brief Mounting of the glass on the frame memory, for @ref TFT_EMU_Attach.
+ *
+ * Some modules mount the glass mirrored and rely on MADCTL to show the image upright, e.g.
+ * the 1.8" ST7735S modules whose init table sets MX and MY.
+ */
+#define TFT_EMU_MOUNT_NORMAL        0x00    /**< Glass column 0 / row 0 is frame memory column 0 / row 0. */
+#define TFT_EMU_MOUNT_MIRROR_X      0x01    /**< Glass columns run from the last frame memory column. */
+#define TFT_EMU_MOUNT_MIRROR_Y      0x02    /**< Glass rows run from the last frame memory row. */
+
+/**
+ * @brief Transfers counted since the last @ref TFT_EMU_ResetStats.
+ */
+typedef struct {
+    u32 Bytes;                      /**< Bytes clocked on SPI. */
+    u32 BusCycles;                  /**< WR strobes on the parallel bus. */
+    u32 ChipSelects;                /**< Falling edges of CS. */
+    u32 Commands;                   /**< Command bytes (DC low). */
+    u32 Windows;                    /**< Memory writes opened (0x2C), i.e. address windows drawn. */
+    u32 Pixels;                     /**< Pixels written to the frame memory. */
+    u32 Errors;                     /**< Protocol errors: data with CS high, pixels outside the memory, unfinished pixels. */
+    f32 DelayMilliseconds;          /**< Time spent in STK_SetDelay. */
+} TFT_EMU_Stats_t;
+
+/**
+ * @brief Kinds of the entries of the transfer log, in the high byte of each entry; the low
+ * bits hold the byte or the delay.
+ */
+#define TFT_EMU_LOG_SELECT          0x01000000UL    /**< CS pulled low. */
+#define TFT_EMU_LOG_RESET           0x02000000UL    /**< RES pulled low. */
+#define TFT_EMU_LOG_COMMAND         0x03000000UL    /**< Command byte (DC low) in the low byte. */
+#define TFT_EMU_LOG_DATA            0x04000000UL    /**< Parameter byte (DC high, outside a memory write) in the low byte. */
+#define TFT_EMU_LOG_DELAY           0x05000000UL    /**< STK_SetDelay, rounded to whole milliseconds in the low 24 bits. */
+
+/**
+ * @brief Connects the emulated panel to a display configuration.
+ *
+ * The pins of the configuration (CS, DC, RES and, on the parallel bus, WR) are watched and
+ * the controller is put in its reset state: display off, 18-bit pixels, no scrolling, all
+ * the frame memory black. The statistics are cleared.
+ *
+ * @param[in] Copy_TftDisplay The display configuration used by the application.
+ * @param[in] Copy_Width      The glass width in its native orientation (MADCTL 0).
+ * @param[in] Copy_Height     The glass height in its native orientation.
+ * @param[in] Copy_Mounting   TFT_EMU_MOUNT_ flags, ORed.
+ *
+ * @retval    0               The panel is attached.
+ * @retval    1               Copy_TftDisplay is NULL or the glass is larger than the frame memory
+ *                            of the emulator (@ref TFT_EMU_MAX_WIDTH x @ref TFT_EMU_MAX_HEIGHT).
+ *
+ * @note The frame memory has the glass width and the taller of the glass height and the
+ * TFT_FrameMemoryHeight of the controller descriptor.
+ */
+u8 TFT_EMU_Attach(const TFT_Config_t *Copy_TftDisplay, u16 Copy_Width, u16 Copy_Height, u8 Copy_Mounting);
+
+/**
+ * @brief Clears the transfer statistics.
+ */
+void TFT_EMU_ResetStats(void);
+
+/**
+ * @brief Reads the transfer statistics.
+ *
+ * @param[out] Copy_Stats Receives the counts since the last @ref TFT_EMU_ResetStats.
+ */
+void TFT_EMU_GetStats(TFT_EMU_Stats_t *Copy_Stats);
+
+/**
+ * @brief Starts recording what the controller receives, e.g. the sequence sent by TFT_Init.
+ *
+ * Every chip select, reset pulse, command, parameter byte and delay is appended to the log
+ * as a TFT_EMU_LOG_ kind ORed with its value. Pixel bytes of memory writes are not recorded.
+ *
+ * @param[out] Copy_Log  The log, filled until @ref TFT_EMU_StopLog.
+ * @param[in]  Copy_Size The capacity of the log in entries; later entries are counted only.
+ */
+void TFT_EMU_StartLog(u32 *Copy_Log, u32 Copy_Size);
+
+/**
+ * @brief Stops recording the log started by @ref TFT_EMU_StartLog.
+ *
+ * @return The number of entries recorded, larger than the capacity when the log overflowed.
+ */
+u32 TFT_EMU_StopLog(void);
+
+/**
+ * @brief Reads a pixel of the visible screen.
+ *
+ * The screen is what the glass shows: mounting, scrolling, inversion and display off are
+ * applied.
+ *
+ * @param[in] Copy_X The column, in the native orientation of the glass.
+ * @param[in] Copy_Y The row, in the native orientation of the glass.
+ *
+ * @return The color as 0xRRGGBB, 0 outside the glass.
+ */
+u32 TFT_EMU_GetPixel(u16 Copy_X, u16 Copy_Y);
+
+/**
+ * @brief Writes the visible screen to a binary PPM (P6) file.
+ *
+ * @param[in] Copy_Path The file to create.
+ *
+ * @retval    0         The file was written.
+ * @retval    1         No panel is attached or the file cannot be written.
+ */
+u8 TFT_EMU_WritePpm(const char *Copy_Path);
+
+/**
+ * @brief Compares the visible screen with a PPM file, e.g. a golden image.
+ *
+ * @param[in]  Copy_Path       The PPM (P6, maxval 255) file.
+ * @param[out] Copy_Mismatches Receives the number of pixels that differ.
+ *
+ * @retval     0               The images were compared.
+ * @retval     1               No panel is attached, or the file cannot be read or has another size.
+ */
+u8 TFT_EMU_ComparePpm(const char *Copy_Path, u32 *Copy_Mismatches);
+
+#endif /**< __TFT_EMU_INTERFACE_H__ */
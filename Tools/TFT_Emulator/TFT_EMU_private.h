@@ -0,0 +1,201 @@
+/**
+ * @file TFT_EMU_private.h
+ * @brief This file contains the private interface of the host TFT emulator.
+ *
+ * This file should not be included directly by application code.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#ifndef __TFT_EMU_PRIVATE_H__
+#define __TFT_EMU_PRIVATE_H__
+
+/**
+ * @brief DCS commands handled by the emulated controller.
+ */
+#define TFT_EMU_SWRESET             0x01
+#define TFT_EMU_INVOFF              0x20
+#define TFT_EMU_INVON               0x21
+#define TFT_EMU_DISPOFF             0x28
+#define TFT_EMU_DISPON              0x29
+#define TFT_EMU_CASET               0x2A
+#define TFT_EMU_RASET               0x2B
+#define TFT_EMU_RAMWR               0x2C
+#define TFT_EMU_VSCRDEF             0x33
+#define TFT_EMU_MADCTL              0x36
+#define TFT_EMU_VSCRSAD             0x37
+#define TFT_EMU_COLMOD              0x3A
+#define TFT_EMU_RAMWRC              0x3C
+
+/**
+ * @brief Memory access control bits.
+ */
+#define TFT_EMU_MADCTL_MY           0x80
+#define TFT_EMU_MADCTL_MX           0x40
+#define TFT_EMU_MADCTL_MV           0x20
+
+/**
+ * @brief Bits per pixel of the interface pixel format (low bits of COLMOD).
+ */
+#define TFT_EMU_FORMAT_12BIT        0x03
+#define TFT_EMU_FORMAT_16BIT        0x05
+#define TFT_EMU_FORMAT_18BIT        0x06
+
+/**
+ * @brief Number of GPIO ports of the blue pill (A, B and C).
+ */
+#define TFT_EMU_PORTS               3
+
+/**
+ * @brief Register state of the emulated controller.
+ */
+typedef struct {
+    u8 Command;                     /**< Last command byte. */
+    u8 ArgIndex;                    /**< Index of the next parameter byte. */
+    u8 Args[6];                     /**< Parameter bytes received for the command. */
+    u16 ColumnStart;                /**< Column window, inclusive. */
+    u16 ColumnEnd;
+    u16 RowStart;                   /**< Row (page) window, inclusive. */
+    u16 RowEnd;
+    u16 Column;                     /**< Address counter. */
+    u16 Row;
+    u8 IsWriting;                   /**< 1 while data bytes go to the frame memory. */
+    u8 AccessControl;               /**< MADCTL. */
+    u8 PixelFormat;                 /**< TFT_EMU_FORMAT_ value. */
+    u16 TopFixedRows;               /**< Vertical scrolling definition. */
+    u16 ScrollRows;
+    u16 ScrollStart;                /**< Vertical scrolling start address. */
+    u8 IsDisplayOn;
+    u8 IsInverted;
+    u8 Partial[3];                  /**< Bytes of a pixel (or of a 12-bit pixel pair) received so far. */
+    u8 PartialCount;
+} TFT_EMU_Controller_t;
+
+/**
+ * @brief The attached display, NULL before @ref TFT_EMU_Attach.
+ */
+static const TFT_Config_t *TFT_EMU_Display;
+
+/**
+ * @brief Frame memory, 0xRRGGBB per pixel, and its size.
+ */
+static u32 TFT_EMU_Memory[TFT_EMU_MAX_HEIGHT][TFT_EMU_MAX_WIDTH];
+static u16 TFT_EMU_MemoryWidth;
+static u16 TFT_EMU_MemoryHeight;
+
+/**
+ * @brief Glass size in its native orientation.
+ */
+static u16 TFT_EMU_GlassWidth;
+static u16 TFT_EMU_GlassHeight;
+static u8 TFT_EMU_Mounting;
+
+/**
+ * @brief Output levels of the GPIO pins, one bit per pin.
+ */
+static u16 TFT_EMU_PinLevels[TFT_EMU_PORTS];
+
+static TFT_EMU_Controller_t TFT_EMU_State;
+static TFT_EMU_Stats_t TFT_EMU_Stats;
+
+/**
+ * @brief Transfer log, NULL when not recording, its capacity and the entries recorded.
+ */
+static u32 *TFT_EMU_Log;
+static u32 TFT_EMU_LogSize;
+static u32 TFT_EMU_LogCount;
+
+/**
+ * @brief Dummy register block returned by SPI_SelectSpiPeripheral.
+ */
+static SPI_RegDef_t TFT_EMU_SpiRegisters;
+
+/**
+ * @brief Put the controller registers in their reset state; the frame memory is kept.
+ */
+static void TFT_EMU_Reset(void);
+
+/**
+ * @brief Check that the attached display is selected, counting an error when it is not.
+ *
+ * @return 1 when a display is attached and its CS pin is low.
+ */
+static u8 TFT_EMU_IsSelected(void);
+
+/**
+ * @brief Get the output level of a pin.
+ *
+ * @param[in] Copy_Pin The pin.
+ * @return 1 for high, 0 for low.
+ */
+static u8 TFT_EMU_GetLevel(TFT_PinPairs Copy_Pin);
+
+/**
+ * @brief Receive one byte (one SPI byte or one 8-bit bus cycle), command or data by the DC level.
+ *
+ * @param[in] Copy_Byte The byte.
+ */
+static void TFT_EMU_ReceiveByte(u8 Copy_Byte);
+
+/**
+ * @brief Start a command: ends the previous memory write.
+ *
+ * @param[in] Copy_Command The command byte.
+ */
+static void TFT_EMU_ReceiveCommand(u8 Copy_Command);
+
+/**
+ * @brief Receive a parameter byte of the current command.
+ *
+ * @param[in] Copy_Byte The parameter byte.
+ */
+static void TFT_EMU_ReceiveParameter(u8 Copy_Byte);
+
+/**
+ * @brief Append an entry to the transfer log when it is recording.
+ *
+ * @param[in] Copy_Entry A TFT_EMU_LOG_ kind ORed with its value.
+ */
+static void TFT_EMU_Record(u32 Copy_Entry);
+
+/**
+ * @brief Receive a byte of the pixel stream in the current pixel format.
+ *
+ * @param[in] Copy_Byte The byte.
+ */
+static void TFT_EMU_ReceivePixelByte(u8 Copy_Byte);
+
+/**
+ * @brief Complete or drop the pixel bytes received so far, at the end of a transfer.
+ *
+ * A 12-bit pixel pair cut after two bytes stores its first pixel, as sent by the TFT core for
+ * an odd pixel count; any other cut pixel is a protocol error.
+ */
+static void TFT_EMU_FlushPartial(void);
+
+/**
+ * @brief Store a pixel at the address counter and advance the counter inside the window.
+ *
+ * @param[in] Copy_Color The color, 0xRRGGBB.
+ */
+static void TFT_EMU_StorePixel(u32 Copy_Color);
+
+/**
+ * @brief Convert an RGB565 color to 0xRRGGBB.
+ *
+ * @param[in] Copy_Color The RGB565 color.
+ * @return The color, 0xRRGGBB.
+ */
+static u32 TFT_EMU_ExpandRgb565(u16 Copy_Color);
+
+/**
+ * @brief Get the frame memory row shown on a row of the glass, after vertical scrolling.
+ *
+ * @param[in] Copy_Row The row of the glass.
+ * @return The frame memory row.
+ */
+static u16 TFT_EMU_GetMemoryRow(u16 Copy_Row);
+
+#endif /**< __TFT_EMU_PRIVATE_H__ */
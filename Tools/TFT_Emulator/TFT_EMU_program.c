@@ -0,0 +1,663 @@
+/**
+ * @file TFT_EMU_program.c
+ * @brief This file contains the implementation of the host TFT emulator.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+/**< LIB */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**< MCAL */
+#include "GPIO_interface.h"
+#include "SPI_interface.h"
+#include "STK_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_config.h"
+#include "TFT_EMU_interface.h"
+#include "TFT_EMU_private.h"
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+u8 TFT_EMU_Attach(const TFT_Config_t *Copy_TftDisplay, u16 Copy_Width, u16 Copy_Height, u8 Copy_Mounting)
+{
+    u16 Local_MemoryHeight = Copy_Height;
+
+    if ((Copy_TftDisplay == NULL) || (Copy_TftDisplay->TFT_Controller == NULL))
+    {
+        return 1;
+    }
+    if (Copy_TftDisplay->TFT_Controller->TFT_FrameMemoryHeight > Local_MemoryHeight)
+    {
+        Local_MemoryHeight = Copy_TftDisplay->TFT_Controller->TFT_FrameMemoryHeight;
+    }
+    if ((Copy_Width == 0) || (Copy_Height == 0) || (Copy_Width > TFT_EMU_MAX_WIDTH) || (Local_MemoryHeight > TFT_EMU_MAX_HEIGHT))
+    {
+        return 1;
+    }
+
+    TFT_EMU_Display = Copy_TftDisplay;
+    TFT_EMU_GlassWidth = Copy_Width;
+    TFT_EMU_GlassHeight = Copy_Height;
+    TFT_EMU_Mounting = Copy_Mounting;
+    TFT_EMU_MemoryWidth = Copy_Width;
+    TFT_EMU_MemoryHeight = Local_MemoryHeight;
+    memset(TFT_EMU_Memory, 0, sizeof(TFT_EMU_Memory));
+
+    /**< Idle bus: CS, RES and WR high */
+    TFT_EMU_PinLevels[Copy_TftDisplay->TFT_CSPin.TFT_Port] |= (u16)(1U << Copy_TftDisplay->TFT_CSPin.TFT_Pin);
+    TFT_EMU_PinLevels[Copy_TftDisplay->TFT_RESPin.TFT_Port] |= (u16)(1U << Copy_TftDisplay->TFT_RESPin.TFT_Pin);
+    if (Copy_TftDisplay->TFT_Bus == TFT_BUS_PARALLEL_8080)
+    {
+        TFT_EMU_PinLevels[Copy_TftDisplay->TFT_WRPin.TFT_Port] |= (u16)(1U << Copy_TftDisplay->TFT_WRPin.TFT_Pin);
+    }
+
+    TFT_EMU_Reset();
+    TFT_EMU_ResetStats();
+
+    return 0;
+}
+
+void TFT_EMU_ResetStats(void)
+{
+    memset(&TFT_EMU_Stats, 0, sizeof(TFT_EMU_Stats));
+}
+
+void TFT_EMU_GetStats(TFT_EMU_Stats_t *Copy_Stats)
+{
+    *Copy_Stats = TFT_EMU_Stats;
+}
+
+void TFT_EMU_StartLog(u32 *Copy_Log, u32 Copy_Size)
+{
+    TFT_EMU_Log = Copy_Log;
+    TFT_EMU_LogSize = Copy_Size;
+    TFT_EMU_LogCount = 0;
+}
+
+u32 TFT_EMU_StopLog(void)
+{
+    TFT_EMU_Log = NULL;
+    return TFT_EMU_LogCount;
+}
+
+u32 TFT_EMU_GetPixel(u16 Copy_X, u16 Copy_Y)
+{
+    u32 Local_Color;
+
+    if ((TFT_EMU_Display == NULL) || (Copy_X >= TFT_EMU_GlassWidth) || (Copy_Y >= TFT_EMU_GlassHeight) || !TFT_EMU_State.IsDisplayOn)
+    {
+        return 0;
+    }
+
+    /**< Glass position -> scan line and frame memory column */
+    if (TFT_EMU_Mounting & TFT_EMU_MOUNT_MIRROR_X)
+    {
+        Copy_X = TFT_EMU_MemoryWidth - 1 - Copy_X;
+    }
+    if (TFT_EMU_Mounting & TFT_EMU_MOUNT_MIRROR_Y)
+    {
+        Copy_Y = TFT_EMU_MemoryHeight - 1 - Copy_Y;
+    }
+
+    Local_Color = TFT_EMU_Memory[TFT_EMU_GetMemoryRow(Copy_Y)][Copy_X];
+    if (TFT_EMU_State.IsInverted)
+    {
+        Local_Color ^= 0xFFFFFF;
+    }
+
+    return Local_Color;
+}
+
+u8 TFT_EMU_WritePpm(const char *Copy_Path)
+{
+    FILE *Local_File;
+    u8 Local_Rgb[3];
+    u32 Local_Color;
+    u16 Local_X;
+    u16 Local_Y;
+
+    if (TFT_EMU_Display == NULL)
+    {
+        return 1;
+    }
+    Local_File = fopen(Copy_Path, "wb");
+    if (Local_File == NULL)
+    {
+        return 1;
+    }
+
+    fprintf(Local_File, "P6\n%u %u\n255\n", TFT_EMU_GlassWidth, TFT_EMU_GlassHeight);
+    for (Local_Y = 0; Local_Y < TFT_EMU_GlassHeight; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < TFT_EMU_GlassWidth; Local_X++)
+        {
+            Local_Color = TFT_EMU_GetPixel(Local_X, Local_Y);
+            Local_Rgb[0] = (u8)(Local_Color >> 16);
+            Local_Rgb[1] = (u8)(Local_Color >> 8);
+            Local_Rgb[2] = (u8)Local_Color;
+            fwrite(Local_Rgb, 1, 3, Local_File);
+        }
+    }
+
+    return (fclose(Local_File) == 0) ? 0 : 1;
+}
+
+u8 TFT_EMU_ComparePpm(const char *Copy_Path, u32 *Copy_Mismatches)
+{
+    FILE *Local_File;
+    unsigned Local_Width;
+    unsigned Local_Height;
+    unsigned Local_MaxValue;
+    u8 Local_Rgb[3];
+    u32 Local_Color;
+    u16 Local_X;
+    u16 Local_Y;
+
+    if (TFT_EMU_Display == NULL)
+    {
+        return 1;
+    }
+    Local_File = fopen(Copy_Path, "rb");
+    if (Local_File == NULL)
+    {
+        return 1;
+    }
+
+    /**< "P6", width, height and maxval, then exactly one whitespace byte before the pixels */
+    if ((fscanf(Local_File, "P6 %u %u %u", &Local_Width, &Local_Height, &Local_MaxValue) != 3) || (fgetc(Local_File) == EOF)
+        || (Local_Width != TFT_EMU_GlassWidth) || (Local_Height != TFT_EMU_GlassHeight) || (Local_MaxValue != 255))
+    {
+        fclose(Local_File);
+        return 1;
+    }
+
+    *Copy_Mismatches = 0;
+    for (Local_Y = 0; Local_Y < TFT_EMU_GlassHeight; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < TFT_EMU_GlassWidth; Local_X++)
+        {
+            if (fread(Local_Rgb, 1, 3, Local_File) != 3)
+            {
+                fclose(Local_File);
+                return 1;
+            }
+            Local_Color = ((u32)Local_Rgb[0] << 16) | ((u32)Local_Rgb[1] << 8) | Local_Rgb[2];
+            if (Local_Color != TFT_EMU_GetPixel(Local_X, Local_Y))
+            {
+                (*Copy_Mismatches)++;
+            }
+        }
+    }
+
+    fclose(Local_File);
+    return 0;
+}
+
+/****************************************< MCAL REPLACEMENT ****************************************/
+void GPIO_SetPinMode(u8 Copy_PORT, u8 Copy_PIN, u8 Copy_Mode)
+{
+    /**< Nothing to configure on the host */
+    (void)Copy_PORT;
+    (void)Copy_PIN;
+    (void)Copy_Mode;
+}
+
+void GPIO_SetPinValue(u8 Copy_PORT, u8 Copy_PIN, u8 Copy_Value)
+{
+    const TFT_Config_t *Local_Display = TFT_EMU_Display;
+    u16 Local_Mask = (u16)(1U << Copy_PIN);
+    u8 Local_Previous;
+
+    if ((Copy_PORT >= TFT_EMU_PORTS) || (Copy_PIN > 15))
+    {
+        return;
+    }
+
+    Local_Previous = (TFT_EMU_PinLevels[Copy_PORT] & Local_Mask) ? GPIO_HIGH : GPIO_LOW;
+    if (Copy_Value == GPIO_HIGH)
+    {
+        TFT_EMU_PinLevels[Copy_PORT] |= Local_Mask;
+    }
+    else
+    {
+        TFT_EMU_PinLevels[Copy_PORT] &= (u16)~Local_Mask;
+    }
+    if ((Local_Display == NULL) || (Local_Previous == Copy_Value))
+    {
+        return;
+    }
+
+    if ((Copy_PORT == Local_Display->TFT_CSPin.TFT_Port) && (Copy_PIN == Local_Display->TFT_CSPin.TFT_Pin))
+    {
+        if (Copy_Value == GPIO_LOW)
+        {
+            TFT_EMU_Stats.ChipSelects++;
+            TFT_EMU_Record(TFT_EMU_LOG_SELECT);
+        }
+        else
+        {
+            /**< The controller restarts its byte count when it is released */
+            TFT_EMU_FlushPartial();
+        }
+    }
+    else if ((Copy_PORT == Local_Display->TFT_RESPin.TFT_Port) && (Copy_PIN == Local_Display->TFT_RESPin.TFT_Pin) && (Copy_Value == GPIO_LOW))
+    {
+        TFT_EMU_Record(TFT_EMU_LOG_RESET);
+        TFT_EMU_Reset();
+    }
+}
+
+u8 GPIO_GetPinValue(u8 Copy_PORT, u8 Copy_PIN)
+{
+    if ((Copy_PORT >= TFT_EMU_PORTS) || (Copy_PIN > 15))
+    {
+        return 0;
+    }
+    return (TFT_EMU_PinLevels[Copy_PORT] >> Copy_PIN) & 1U;
+}
+
+void GPIO_WriteParallel16(u8 Copy_DataPORT, u8 Copy_StrobePORT, u8 Copy_StrobePIN, const u16 *Copy_Words, u32 Copy_Count)
+{
+    while (Copy_Count-- > 0)
+    {
+        GPIO_WriteParallelRepeated16(Copy_DataPORT, Copy_StrobePORT, Copy_StrobePIN, *Copy_Words++, 1);
+    }
+}
+
+void GPIO_WriteParallelRepeated16(u8 Copy_DataPORT, u8 Copy_StrobePORT, u8 Copy_StrobePIN, u16 Copy_Word, u32 Copy_Count)
+{
+    const TFT_Config_t *Local_Display = TFT_EMU_Display;
+
+    TFT_EMU_Stats.BusCycles += Copy_Count;
+    if (!TFT_EMU_IsSelected() || (Local_Display->TFT_Bus != TFT_BUS_PARALLEL_8080) || (Copy_DataPORT != Local_Display->TFT_DataPort)
+        || (Copy_StrobePORT != Local_Display->TFT_WRPin.TFT_Port) || (Copy_StrobePIN != Local_Display->TFT_WRPin.TFT_Pin))
+    {
+        TFT_EMU_Stats.Errors++;
+        return;
+    }
+
+    while (Copy_Count-- > 0)
+    {
+        if (!TFT_EMU_GetLevel(Local_Display->TFT_DCPin))
+        {
+            /**< Commands and parameters are on D0-D7 */
+            TFT_EMU_ReceiveByte((u8)Copy_Word);
+        }
+        else if (TFT_EMU_State.IsWriting && (TFT_EMU_State.PixelFormat == TFT_EMU_FORMAT_16BIT))
+        {
+            /**< One RGB565 pixel per cycle */
+            TFT_EMU_StorePixel(TFT_EMU_ExpandRgb565(Copy_Word));
+        }
+        else if (TFT_EMU_State.IsWriting)
+        {
+            TFT_EMU_Stats.Errors++;
+        }
+        else
+        {
+            TFT_EMU_ReceiveParameter((u8)Copy_Word);
+        }
+    }
+}
+
+void GPIO_WriteParallel8(u8 Copy_DataPORT, u8 Copy_StrobePORT, u8 Copy_StrobePIN, const u8 *Copy_Bytes, u32 Copy_Count)
+{
+    while (Copy_Count-- > 0)
+    {
+        GPIO_WriteParallelRepeated16(Copy_DataPORT, Copy_StrobePORT, Copy_StrobePIN, *Copy_Bytes++, 1);
+    }
+}
+
+SPI_t SPI_SelectSpiPeripheral(SPI_Peripheral_t Copy_SPI)
+{
+    /**< One emulated peripheral for all */
+    (void)Copy_SPI;
+    return &TFT_EMU_SpiRegisters;
+}
+
+void SPI_voidInit(SPI_t Copy_SelectedSPI, const SPI_config_t *Copy_SPIConfig)
+{
+    /**< Nothing to configure on the host */
+    (void)Copy_SelectedSPI;
+    (void)Copy_SPIConfig;
+}
+
+void SPI_voidTransfer(SPI_t Copy_SPI, u8 *Copy_TxData, u8 *Copy_RxData, u16 Copy_Size)
+{
+    /**< The controller never answers on MOSI-only wiring */
+    memset(Copy_RxData, 0, Copy_Size);
+    SPI_voidTransmit(Copy_SPI, Copy_TxData, Copy_Size);
+}
+
+void SPI_voidTransmit(SPI_t Copy_SPI, const u8 *Copy_TxData, u32 Copy_Size)
+{
+    (void)Copy_SPI;
+    TFT_EMU_Stats.Bytes += Copy_Size;
+    while (Copy_Size-- > 0)
+    {
+        if (TFT_EMU_IsSelected())
+        {
+            TFT_EMU_ReceiveByte(*Copy_TxData);
+        }
+        Copy_TxData++;
+    }
+}
+
+void SPI_voidTransmit16(SPI_t Copy_SPI, const u16 *Copy_TxData, u32 Copy_Size)
+{
+    while (Copy_Size-- > 0)
+    {
+        SPI_voidTransmitRepeated16(Copy_SPI, *Copy_TxData++, 1);
+    }
+}
+
+void SPI_voidTransmitRepeated16(SPI_t Copy_SPI, u16 Copy_Data, u32 Copy_Count)
+{
+    u8 Local_Bytes[2] = { (u8)(Copy_Data >> 8), (u8)Copy_Data };
+
+    while (Copy_Count-- > 0)
+    {
+        SPI_voidTransmit(Copy_SPI, Local_Bytes, 2);
+    }
+}
+
+void STK_Init(void)
+{
+    /**< Nothing to configure on the host */
+}
+
+void STK_SetDelay(f32 Copy_Milliseconds)
+{
+    /**< Delays return at once and are only added up */
+    TFT_EMU_Stats.DelayMilliseconds += Copy_Milliseconds;
+    TFT_EMU_Record(TFT_EMU_LOG_DELAY | (u32)(Copy_Milliseconds + 0.5f));
+}
+
+/****************************************< PRIVATE FUNCTIONS ****************************************/
+static void TFT_EMU_Reset(void)
+{
+    memset(&TFT_EMU_State, 0, sizeof(TFT_EMU_State));
+    TFT_EMU_State.ColumnEnd = TFT_EMU_MemoryWidth - 1;
+    TFT_EMU_State.RowEnd = TFT_EMU_MemoryHeight - 1;
+    TFT_EMU_State.PixelFormat = TFT_EMU_FORMAT_18BIT;
+    TFT_EMU_State.ScrollRows = TFT_EMU_MemoryHeight;
+}
+
+static u8 TFT_EMU_IsSelected(void)
+{
+    if ((TFT_EMU_Display == NULL) || TFT_EMU_GetLevel(TFT_EMU_Display->TFT_CSPin))
+    {
+        TFT_EMU_Stats.Errors++;
+        return 0;
+    }
+    return 1;
+}
+
+static u8 TFT_EMU_GetLevel(TFT_PinPairs Copy_Pin)
+{
+    return (TFT_EMU_PinLevels[Copy_Pin.TFT_Port] >> Copy_Pin.TFT_Pin) & 1U;
+}
+
+static void TFT_EMU_ReceiveByte(u8 Copy_Byte)
+{
+    if (!TFT_EMU_GetLevel(TFT_EMU_Display->TFT_DCPin))
+    {
+        TFT_EMU_ReceiveCommand(Copy_Byte);
+    }
+    else if (TFT_EMU_State.IsWriting)
+    {
+        TFT_EMU_ReceivePixelByte(Copy_Byte);
+    }
+    else
+    {
+        TFT_EMU_ReceiveParameter(Copy_Byte);
+    }
+}
+
+static void TFT_EMU_ReceiveCommand(u8 Copy_Command)
+{
+    TFT_EMU_FlushPartial();
+    TFT_EMU_Stats.Commands++;
+    TFT_EMU_Record(TFT_EMU_LOG_COMMAND | Copy_Command);
+    TFT_EMU_State.Command = Copy_Command;
+    TFT_EMU_State.ArgIndex = 0;
+    TFT_EMU_State.IsWriting = 0;
+
+    switch (Copy_Command)
+    {
+        case TFT_EMU_SWRESET:
+            TFT_EMU_Reset();
+            break;
+        case TFT_EMU_INVOFF:
+            TFT_EMU_State.IsInverted = 0;
+            break;
+        case TFT_EMU_INVON:
+            TFT_EMU_State.IsInverted = 1;
+            break;
+        case TFT_EMU_DISPOFF:
+            TFT_EMU_State.IsDisplayOn = 0;
+            break;
+        case TFT_EMU_DISPON:
+            TFT_EMU_State.IsDisplayOn = 1;
+            break;
+        case TFT_EMU_RAMWR:
+            /**< A new write starts at the top-left corner of the window */
+            TFT_EMU_Stats.Windows++;
+            TFT_EMU_State.Column = TFT_EMU_State.ColumnStart;
+            TFT_EMU_State.Row = TFT_EMU_State.RowStart;
+            TFT_EMU_State.IsWriting = 1;
+            break;
+        case TFT_EMU_RAMWRC:
+            TFT_EMU_State.IsWriting = 1;
+            break;
+        default:
+            break;
+    }
+}
+
+static void TFT_EMU_ReceiveParameter(u8 Copy_Byte)
+{
+    TFT_EMU_Controller_t *Local_State = &TFT_EMU_State;
+    u16 Local_First;
+    u16 Local_Second;
+
+    TFT_EMU_Record(TFT_EMU_LOG_DATA | Copy_Byte);
+    if (Local_State->ArgIndex >= sizeof(Local_State->Args))
+    {
+        return;
+    }
+    Local_State->Args[Local_State->ArgIndex++] = Copy_Byte;
+    Local_First = (u16)((Local_State->Args[0] << 8) | Local_State->Args[1]);
+    Local_Second = (u16)((Local_State->Args[2] << 8) | Local_State->Args[3]);
+
+    switch (Local_State->Command)
+    {
+        case TFT_EMU_CASET:
+            if (Local_State->ArgIndex == 4)
+            {
+                Local_State->ColumnStart = Local_First;
+                Local_State->ColumnEnd = Local_Second;
+            }
+            break;
+        case TFT_EMU_RASET:
+            if (Local_State->ArgIndex == 4)
+            {
+                Local_State->RowStart = Local_First;
+                Local_State->RowEnd = Local_Second;
+            }
+            break;
+        case TFT_EMU_MADCTL:
+            Local_State->AccessControl = Copy_Byte;
+            break;
+        case TFT_EMU_COLMOD:
+            Local_State->PixelFormat = Copy_Byte & 0x07;
+            break;
+        case TFT_EMU_VSCRDEF:
+            if (Local_State->ArgIndex == 6)
+            {
+                /**< The bottom fixed area is what is left below the scrolling area */
+                Local_State->TopFixedRows = Local_First;
+                Local_State->ScrollRows = Local_Second;
+            }
+            break;
+        case TFT_EMU_VSCRSAD:
+            if (Local_State->ArgIndex == 2)
+            {
+                Local_State->ScrollStart = Local_First;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void TFT_EMU_Record(u32 Copy_Entry)
+{
+    if (TFT_EMU_Log == NULL)
+    {
+        return;
+    }
+    if (TFT_EMU_LogCount < TFT_EMU_LogSize)
+    {
+        TFT_EMU_Log[TFT_EMU_LogCount] = Copy_Entry;
+    }
+    TFT_EMU_LogCount++;
+}
+
+static void TFT_EMU_ReceivePixelByte(u8 Copy_Byte)
+{
+    TFT_EMU_Controller_t *Local_State = &TFT_EMU_State;
+    u8 *Local_Bytes = Local_State->Partial;
+
+    Local_Bytes[Local_State->PartialCount++] = Copy_Byte;
+
+    switch (Local_State->PixelFormat)
+    {
+        case TFT_EMU_FORMAT_16BIT:
+            if (Local_State->PartialCount == 2)
+            {
+                TFT_EMU_StorePixel(TFT_EMU_ExpandRgb565((u16)((Local_Bytes[0] << 8) | Local_Bytes[1])));
+                Local_State->PartialCount = 0;
+            }
+            break;
+        case TFT_EMU_FORMAT_18BIT:
+            if (Local_State->PartialCount == 3)
+            {
+                /**< Each channel in the top 6 bits of its byte, widened to 8 bits */
+                TFT_EMU_StorePixel(((u32)((Local_Bytes[0] & 0xFC) | (Local_Bytes[0] >> 6)) << 16)
+                                 | ((u32)((Local_Bytes[1] & 0xFC) | (Local_Bytes[1] >> 6)) << 8)
+                                 | (u32)((Local_Bytes[2] & 0xFC) | (Local_Bytes[2] >> 6)));
+                Local_State->PartialCount = 0;
+            }
+            break;
+        case TFT_EMU_FORMAT_12BIT:
+            if (Local_State->PartialCount == 3)
+            {
+                /**< R0G0 B0R1 G1B1, 4-bit channels widened to 8 bits */
+                TFT_EMU_StorePixel(((u32)(Local_Bytes[0] >> 4) * 0x11 << 16) | ((u32)(Local_Bytes[0] & 0x0F) * 0x11 << 8) | ((u32)(Local_Bytes[1] >> 4) * 0x11));
+                TFT_EMU_StorePixel(((u32)(Local_Bytes[1] & 0x0F) * 0x11 << 16) | ((u32)(Local_Bytes[2] >> 4) * 0x11 << 8) | ((u32)(Local_Bytes[2] & 0x0F) * 0x11));
+                Local_State->PartialCount = 0;
+            }
+            break;
+        default:
+            /**< Unsupported interface pixel format */
+            TFT_EMU_Stats.Errors++;
+            Local_State->PartialCount = 0;
+            break;
+    }
+}
+
+static void TFT_EMU_FlushPartial(void)
+{
+    TFT_EMU_Controller_t *Local_State = &TFT_EMU_State;
+    u8 *Local_Bytes = Local_State->Partial;
+
+    if (Local_State->PartialCount == 0)
+    {
+        return;
+    }
+    if ((Local_State->PixelFormat == TFT_EMU_FORMAT_12BIT) && (Local_State->PartialCount == 2))
+    {
+        TFT_EMU_StorePixel(((u32)(Local_Bytes[0] >> 4) * 0x11 << 16) | ((u32)(Local_Bytes[0] & 0x0F) * 0x11 << 8) | ((u32)(Local_Bytes[1] >> 4) * 0x11));
+    }
+    else
+    {
+        TFT_EMU_Stats.Errors++;
+    }
+    Local_State->PartialCount = 0;
+}
+
+static void TFT_EMU_StorePixel(u32 Copy_Color)
+{
+    TFT_EMU_Controller_t *Local_State = &TFT_EMU_State;
+    u16 Local_X = Local_State->Column;
+    u16 Local_Y = Local_State->Row;
+    u16 Local_Swap;
+
+    /**< Exchange first, then mirror within the frame memory */
+    if (Local_State->AccessControl & TFT_EMU_MADCTL_MV)
+    {
+        Local_Swap = Local_X;
+        Local_X = Local_Y;
+        Local_Y = Local_Swap;
+    }
+    if ((Local_X < TFT_EMU_MemoryWidth) && (Local_Y < TFT_EMU_MemoryHeight))
+    {
+        if (Local_State->AccessControl & TFT_EMU_MADCTL_MX)
+        {
+            Local_X = TFT_EMU_MemoryWidth - 1 - Local_X;
+        }
+        if (Local_State->AccessControl & TFT_EMU_MADCTL_MY)
+        {
+            Local_Y = TFT_EMU_MemoryHeight - 1 - Local_Y;
+        }
+        TFT_EMU_Memory[Local_Y][Local_X] = Copy_Color;
+        TFT_EMU_Stats.Pixels++;
+    }
+    else
+    {
+        TFT_EMU_Stats.Errors++;
+    }
+
+    /**< Columns first, then rows; back to the first row after the last one */
+    if (Local_State->Column < Local_State->ColumnEnd)
+    {
+        Local_State->Column++;
+    }
+    else
+    {
+        Local_State->Column = Local_State->ColumnStart;
+        Local_State->Row = (Local_State->Row < Local_State->RowEnd) ? (u16)(Local_State->Row + 1) : Local_State->RowStart;
+    }
+}
+
+static u32 TFT_EMU_ExpandRgb565(u16 Copy_Color)
+{
+    u32 Local_Red = Copy_Color >> 11;
+    u32 Local_Green = (Copy_Color >> 5) & 0x3F;
+    u32 Local_Blue = Copy_Color & 0x1F;
+
+    return (((Local_Red << 3) | (Local_Red >> 2)) << 16) | (((Local_Green << 2) | (Local_Green >> 4)) << 8) | ((Local_Blue << 3) | (Local_Blue >> 2));
+}
+
+static u16 TFT_EMU_GetMemoryRow(u16 Copy_Row)
+{
+    const TFT_EMU_Controller_t *Local_State = &TFT_EMU_State;
+    u32 Local_Top = Local_State->TopFixedRows;
+    u32 Local_Rows = Local_State->ScrollRows;
+    u32 Local_Start = Local_State->ScrollStart;
+
+    /**< Fixed areas and invalid definitions are shown as they are */
+    if ((Copy_Row < Local_Top) || (Copy_Row >= (Local_Top + Local_Rows)) || (Local_Start < Local_Top) || (Local_Start >= (Local_Top + Local_Rows))
+        || ((Local_Top + Local_Rows) > TFT_EMU_MemoryHeight))
+    {
+        return Copy_Row;
+    }
+
+    /**< The scrolling area shows its rows from the start address on, wrapping inside the area */
+    return (u16)(Local_Top + ((Local_Start - Local_Top) + (Copy_Row - Local_Top)) % Local_Rows);
+}
@@ -0,0 +1,148 @@
+/**
+ * @file TEST_interface.h
+ * @brief This file contains the public interface of the host test support.
+ *
+ * Every test program of Tools/TFT_Tests is built with the host TFT emulator, the TFT core and
+ * every controller, like the display benchmark. This module gives them:
+ * - checks that print one line each and are counted, and the exit status of the program;
+ * - the panels under test, attached to the emulator and initialized in one call;
+ * - a generated monospaced font;
+ * - a pixel-exact comparison of the emulated glass with a reference image computed by the
+ *   test (golden images are generated, not stored in the tree);
+ * - a monotonic clock for the throughput measurements run with --bench.
+ *
+ * Tools/TFT_Tests/tfttests.py builds and runs every test program.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ * @note Host only. Include SPI_interface.h and TFT_interface.h before this file.
+ *
+ * @note Example Usage:
+ * @code
+ * int main(int argc, char **argv)
+ * {
+ *     TEST_Init(argc, argv);
+ *     TEST_Check(PIXEL_Blend(0x0000, 0xFFFF, 255) == 0xFFFF, "opaque blend");
+ *     return TEST_Finish();
+ * }
+ * @endcode
+ */
+
+#ifndef __TEST_INTERFACE_H__
+#define __TEST_INTERFACE_H__
+
+/**
+ * @brief Largest panel of the tests, in pixels on each side.
+ */
+#define TEST_MAX_SIDE               480
+
+/**
+ * @brief Cell of the generated font: every printable ASCII character is TEST_FONT_WIDTH
+ * pixels wide plus one of spacing, and the lines are TEST_FONT_HEIGHT + 2 pixels apart.
+ */
+#define TEST_FONT_WIDTH             6
+#define TEST_FONT_HEIGHT            9
+
+/**
+ * @brief A panel under test.
+ */
+typedef struct {
+    const char *Name;               /**< Name in the messages. */
+    TFT_Config_t Config;            /**< Display configuration. */
+    u8 Mounting;                    /**< TFT_EMU_MOUNT_ flags of the module. */
+} TEST_Panel_t;
+
+/**
+ * @brief The three controllers on SPI; the ST7735S module has its glass mirrored on both axes.
+ */
+extern const TEST_Panel_t TEST_Panels[];
+extern const u8 TEST_PanelCount;
+
+/**
+ * @brief Reads the options of the test program: --bench also runs the throughput measurements.
+ *
+ * @param[in] Copy_ArgumentCount The argc of main.
+ * @param[in] Copy_Arguments     The argv of main.
+ */
+void TEST_Init(int Copy_ArgumentCount, char **Copy_Arguments);
+
+/**
+ * @brief Tells whether the throughput measurements were requested.
+ *
+ * @return 1 with --bench, 0 otherwise.
+ */
+u8 TEST_IsBenchmark(void);
+
+/**
+ * @brief Counts a check and prints its result.
+ *
+ * @param[in] Copy_Passed The outcome: nonzero when the check passed.
+ * @param[in] Copy_Format printf format of the description, followed by its arguments.
+ */
+void TEST_Check(u8 Copy_Passed, const char *Copy_Format, ...);
+
+/**
+ * @brief Prints the totals.
+ *
+ * @return The exit status of the program: 0 when every check passed, 1 otherwise.
+ */
+int TEST_Finish(void);
+
+/**
+ * @brief Attaches a panel to the emulator and initializes it.
+ *
+ * @param[in] Copy_Panel The panel.
+ *
+ * @return The SPI peripheral to draw with.
+ */
+SPI_t TEST_StartPanel(const TEST_Panel_t *Copy_Panel);
+
+/**
+ * @brief Returns the generated font.
+ *
+ * The glyphs have an arbitrary but fixed pattern, different for every character, so a
+ * character drawn at the wrong place or in the wrong order changes the screen.
+ *
+ * @return The font.
+ */
+const TFT_Font_t *TEST_GetFont(void);
+
+/**
+ * @brief Copies the emulated glass into a buffer.
+ *
+ * @param[out] Copy_Screen The 0xRRGGBB colors, Copy_Width per row.
+ * @param[in]  Copy_Width  The width of the screen.
+ * @param[in]  Copy_Height The height of the screen.
+ */
+void TEST_CaptureScreen(u32 *Copy_Screen, u16 Copy_Width, u16 Copy_Height);
+
+/**
+ * @brief Compares the emulated glass with a reference image.
+ *
+ * @param[in] Copy_Reference The expected 0xRRGGBB colors, Copy_Width per row.
+ * @param[in] Copy_Width     The width of the screen.
+ * @param[in] Copy_Height    The height of the screen.
+ *
+ * @return The number of pixels that differ.
+ */
+u32 TEST_CountMismatches(const u32 *Copy_Reference, u16 Copy_Width, u16 Copy_Height);
+
+/**
+ * @brief Converts an RGB565 color to the 0xRRGGBB color the emulator shows for it.
+ *
+ * @param[in] Copy_Color The RGB565 color.
+ *
+ * @return The 0xRRGGBB color.
+ */
+u32 TEST_Rgb565ToRgb888(u16 Copy_Color);
+
+/**
+ * @brief Reads the monotonic clock.
+ *
+ * @return The time in seconds from an arbitrary origin.
+ */
+double TEST_Seconds(void);
+
+#endif /**< __TEST_INTERFACE_H__ */
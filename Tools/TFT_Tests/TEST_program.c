@@ -0,0 +1,211 @@
+/**
+ * @file TEST_program.c
+ * @brief This file contains the implementation of the host test support.
+ *
+ * @author Mahmoud Abdelraouf Mahmoud
+ * @date 17 Oct 2026
+ * @version V01
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "GPIO_interface.h"
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+#include "TFT_ST7735S_interface.h"
+#include "TFT_HX8357B_interface.h"
+#include "TFT_ILI9481_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+const TEST_Panel_t TEST_Panels[] = {
+    { "ST7735S", { {0, 2}, {0, 3}, {0, 7}, {0, 1}, &TFT_ST7735S_Controller, TFT_BUS_SPI, 0, {0, 0} }, TFT_EMU_MOUNT_MIRROR_X | TFT_EMU_MOUNT_MIRROR_Y },
+    { "HX8357B", { {0, 2}, {0, 3}, {0, 7}, {0, 1}, &TFT_HX8357B_Controller, TFT_BUS_SPI, 0, {0, 0} }, TFT_EMU_MOUNT_NORMAL },
+    { "ILI9481", { {0, 2}, {0, 3}, {0, 7}, {0, 1}, &TFT_ILI9481_Controller, TFT_BUS_SPI, 0, {0, 0} }, TFT_EMU_MOUNT_NORMAL },
+};
+
+const u8 TEST_PanelCount = sizeof(TEST_Panels) / sizeof(TEST_Panels[0]);
+
+/**
+ * @brief Characters of the generated font.
+ */
+#define TEST_FONT_FIRST             32
+#define TEST_FONT_LAST              126
+#define TEST_FONT_GLYPH_BYTES       ((TEST_FONT_WIDTH * TEST_FONT_HEIGHT + 7) / 8)
+
+/**
+ * @brief The generated font, filled on first use.
+ */
+static u8 TEST_FontBitmap[(TEST_FONT_LAST - TEST_FONT_FIRST + 1) * TEST_FONT_GLYPH_BYTES];
+static TFT_Glyph_t TEST_FontGlyphs[TEST_FONT_LAST - TEST_FONT_FIRST + 1];
+static TFT_Font_t TEST_Font;
+
+/**
+ * @brief Checks run and failed, and the --bench option.
+ */
+static u32 TEST_Checks = 0;
+static u32 TEST_Failures = 0;
+static u8 TEST_Benchmark = 0;
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+void TEST_Init(int Copy_ArgumentCount, char **Copy_Arguments)
+{
+    int Local_Argument;
+
+    for (Local_Argument = 1; Local_Argument < Copy_ArgumentCount; Local_Argument++)
+    {
+        if (strcmp(Copy_Arguments[Local_Argument], "--bench") == 0)
+        {
+            TEST_Benchmark = 1;
+        }
+    }
+}
+
+u8 TEST_IsBenchmark(void)
+{
+    return TEST_Benchmark;
+}
+
+void TEST_Check(u8 Copy_Passed, const char *Copy_Format, ...)
+{
+    va_list Local_Arguments;
+
+    TEST_Checks++;
+    if (!Copy_Passed)
+    {
+        TEST_Failures++;
+    }
+
+    printf("%s ", Copy_Passed ? "ok  " : "FAIL");
+    va_start(Local_Arguments, Copy_Format);
+    vprintf(Copy_Format, Local_Arguments);
+    va_end(Local_Arguments);
+    printf("\n");
+}
+
+int TEST_Finish(void)
+{
+    printf("%u checks, %u failed\n", TEST_Checks, TEST_Failures);
+
+    return (TEST_Failures == 0) ? 0 : 1;
+}
+
+SPI_t TEST_StartPanel(const TEST_Panel_t *Copy_Panel)
+{
+    const TFT_Controller_t *Local_Controller = Copy_Panel->Config.TFT_Controller;
+    SPI_t Local_Spi = SPI_SelectSpiPeripheral(SPI1);
+
+    TFT_EMU_Attach(&Copy_Panel->Config, Local_Controller->TFT_Width, Local_Controller->TFT_Height, Copy_Panel->Mounting);
+    TFT_Init(&Copy_Panel->Config, Local_Spi);
+
+    return Local_Spi;
+}
+
+const TFT_Font_t *TEST_GetFont(void)
+{
+    u16 Local_Character;
+    u16 Local_Index;
+    u16 Local_Bit;
+    u8 *Local_Glyph;
+
+    if (TEST_Font.TFT_Bitmap != NULL)
+    {
+        return &TEST_Font;
+    }
+
+    for (Local_Character = TEST_FONT_FIRST; Local_Character <= TEST_FONT_LAST; Local_Character++)
+    {
+        Local_Index = Local_Character - TEST_FONT_FIRST;
+        Local_Glyph = &TEST_FontBitmap[Local_Index * TEST_FONT_GLYPH_BYTES];
+
+        TEST_FontGlyphs[Local_Index].TFT_BitmapOffset = Local_Index * TEST_FONT_GLYPH_BYTES;
+        TEST_FontGlyphs[Local_Index].TFT_XAdvance = TEST_FONT_WIDTH + 1;
+        TEST_FontGlyphs[Local_Index].TFT_XOffset = 0;
+        TEST_FontGlyphs[Local_Index].TFT_YOffset = 1;
+
+        /**< A space has no ink, like in bdf2font.py output */
+        if (Local_Character == ' ')
+        {
+            continue;
+        }
+
+        TEST_FontGlyphs[Local_Index].TFT_Width = TEST_FONT_WIDTH;
+        TEST_FontGlyphs[Local_Index].TFT_Height = TEST_FONT_HEIGHT;
+        for (Local_Bit = 0; Local_Bit < TEST_FONT_WIDTH * TEST_FONT_HEIGHT; Local_Bit++)
+        {
+            if (((Local_Character * 37 + Local_Bit * 11) % 5) < 2)
+            {
+                Local_Glyph[Local_Bit / 8] |= (u8)(0x80 >> (Local_Bit % 8));
+            }
+        }
+    }
+
+    TEST_Font.TFT_Bitmap = TEST_FontBitmap;
+    TEST_Font.TFT_Glyphs = TEST_FontGlyphs;
+    TEST_Font.TFT_FirstChar = TEST_FONT_FIRST;
+    TEST_Font.TFT_LastChar = TEST_FONT_LAST;
+    TEST_Font.TFT_LineHeight = TEST_FONT_HEIGHT + 2;
+    TEST_Font.TFT_BitsPerPixel = 1;
+
+    return &TEST_Font;
+}
+
+void TEST_CaptureScreen(u32 *Copy_Screen, u16 Copy_Width, u16 Copy_Height)
+{
+    u16 Local_X;
+    u16 Local_Y;
+
+    for (Local_Y = 0; Local_Y < Copy_Height; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < Copy_Width; Local_X++)
+        {
+            Copy_Screen[(u32)Local_Y * Copy_Width + Local_X] = TFT_EMU_GetPixel(Local_X, Local_Y);
+        }
+    }
+}
+
+u32 TEST_CountMismatches(const u32 *Copy_Reference, u16 Copy_Width, u16 Copy_Height)
+{
+    u32 Local_Mismatches = 0;
+    u16 Local_X;
+    u16 Local_Y;
+
+    for (Local_Y = 0; Local_Y < Copy_Height; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < Copy_Width; Local_X++)
+        {
+            if (TFT_EMU_GetPixel(Local_X, Local_Y) != Copy_Reference[(u32)Local_Y * Copy_Width + Local_X])
+            {
+                Local_Mismatches++;
+            }
+        }
+    }
+
+    return Local_Mismatches;
+}
+
+u32 TEST_Rgb565ToRgb888(u16 Copy_Color)
+{
+    u32 Local_Red = (Copy_Color >> 11) & 0x1F;
+    u32 Local_Green = (Copy_Color >> 5) & 0x3F;
+    u32 Local_Blue = Copy_Color & 0x1F;
+
+    return (((Local_Red << 3) | (Local_Red >> 2)) << 16) | (((Local_Green << 2) | (Local_Green >> 4)) << 8) | ((Local_Blue << 3) | (Local_Blue >> 2));
+}
+
+double TEST_Seconds(void)
+{
+    struct timespec Local_Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Local_Time);
+
+    return (double)Local_Time.tv_sec + (double)Local_Time.tv_nsec * 1e-9;
+}
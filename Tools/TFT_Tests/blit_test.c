@@ -0,0 +1,203 @@
+/**
+ * @file blit_test.c
+ * @brief Host tests of TFT_Blit and TFT_BlitKeyed on every controller.
+ *
+ * A rectangle of a bitmap whose pixels all differ is drawn at every rotation, inside the
+ * screen, across each of its edges and off it, opaque and with a transparent color. The
+ * glass is compared pixel for pixel with a reference model of the rotations and clipping,
+ * and the counts with what must reach the panel: one window for an opaque blit, one window
+ * per run of opaque pixels for a keyed one, nothing for a blit off the screen.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     blit_test
+ */
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Bitmap size and the transparent color of the keyed blits.
+ */
+#define BLTEST_BITMAP_WIDTH         29
+#define BLTEST_BITMAP_HEIGHT        19
+#define BLTEST_KEY                  0xF81F
+
+/**
+ * @brief The bitmap and the expected screen.
+ */
+static u16 BLTEST_Pixels[BLTEST_BITMAP_WIDTH * BLTEST_BITMAP_HEIGHT];
+static TFT_Bitmap_t BLTEST_Bitmap;
+static u32 BLTEST_Reference[TEST_MAX_SIDE * TEST_MAX_SIDE];
+
+/**
+ * @brief Fills the bitmap: every pixel a different color, transparent diagonals and one
+ * transparent row so the keyed rows have several runs, none or one.
+ */
+static void BLTEST_MakeBitmap(void);
+
+/**
+ * @brief Blits a rectangle of the bitmap at a position on a fresh panel and checks it.
+ */
+static void BLTEST_Run(const TEST_Panel_t *Copy_Panel, s16 Copy_X, s16 Copy_Y, u16 Copy_SourceX, u16 Copy_SourceY,
+                       u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation, u8 Copy_UseKey);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static void BLTEST_MakeBitmap(void)
+{
+    u16 Local_X;
+    u16 Local_Y;
+
+    for (Local_Y = 0; Local_Y < BLTEST_BITMAP_HEIGHT; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < BLTEST_BITMAP_WIDTH; Local_X++)
+        {
+            BLTEST_Pixels[Local_Y * BLTEST_BITMAP_WIDTH + Local_X] =
+                (((Local_X + 2 * Local_Y) % 7) == 0) || (Local_Y == 9) ? BLTEST_KEY : (u16)(((Local_X + 1) << 11) | ((Local_Y + 1) << 5) | (Local_X & 0x1F));
+        }
+    }
+    BLTEST_Bitmap.TFT_Pixels = BLTEST_Pixels;
+    BLTEST_Bitmap.TFT_Width = BLTEST_BITMAP_WIDTH;
+    BLTEST_Bitmap.TFT_Height = BLTEST_BITMAP_HEIGHT;
+}
+
+static void BLTEST_Run(const TEST_Panel_t *Copy_Panel, s16 Copy_X, s16 Copy_Y, u16 Copy_SourceX, u16 Copy_SourceY,
+                       u16 Copy_Width, u16 Copy_Height, u8 Copy_Rotation, u8 Copy_UseKey)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    s32 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    s32 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    u16 Local_SourceWidth = ((Copy_SourceX + Copy_Width) > BLTEST_BITMAP_WIDTH) ? (BLTEST_BITMAP_WIDTH - Copy_SourceX) : Copy_Width;
+    u16 Local_SourceHeight = ((Copy_SourceY + Copy_Height) > BLTEST_BITMAP_HEIGHT) ? (BLTEST_BITMAP_HEIGHT - Copy_SourceY) : Copy_Height;
+    s32 Local_DrawWidth = (Copy_Rotation & 0x01) ? Local_SourceHeight : Local_SourceWidth;
+    s32 Local_DrawHeight = (Copy_Rotation & 0x01) ? Local_SourceWidth : Local_SourceHeight;
+    u32 Local_Pixels = 0;
+    u32 Local_Windows = 0;
+    TFT_EMU_Stats_t Local_Stats;
+    SPI_t Local_Spi;
+    u16 Local_Color;
+    u8 Local_IsInRun;
+    s32 Local_DX;
+    s32 Local_DY;
+    s32 Local_SX;
+    s32 Local_SY;
+
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TEST_CaptureScreen(BLTEST_Reference, (u16)Local_Width, (u16)Local_Height);
+
+    /**< Drawn pixel (dx, dy) is a source pixel by the rotation; runs are counted on the screen rows */
+    for (Local_DY = 0; Local_DY < Local_DrawHeight; Local_DY++)
+    {
+        Local_IsInRun = 0;
+        for (Local_DX = 0; Local_DX < Local_DrawWidth; Local_DX++)
+        {
+            switch (Copy_Rotation)
+            {
+                case TFT_ROTATE_90:
+                    Local_SX = Local_DY;
+                    Local_SY = Local_SourceHeight - 1 - Local_DX;
+                    break;
+                case TFT_ROTATE_180:
+                    Local_SX = Local_SourceWidth - 1 - Local_DX;
+                    Local_SY = Local_SourceHeight - 1 - Local_DY;
+                    break;
+                case TFT_ROTATE_270:
+                    Local_SX = Local_SourceWidth - 1 - Local_DY;
+                    Local_SY = Local_DX;
+                    break;
+                default:
+                    Local_SX = Local_DX;
+                    Local_SY = Local_DY;
+                    break;
+            }
+            Local_Color = BLTEST_Pixels[(Copy_SourceY + Local_SY) * BLTEST_BITMAP_WIDTH + Copy_SourceX + Local_SX];
+
+            if (((Copy_X + Local_DX) < 0) || ((Copy_X + Local_DX) >= Local_Width) || ((Copy_Y + Local_DY) < 0) || ((Copy_Y + Local_DY) >= Local_Height))
+            {
+                continue;
+            }
+            if (Copy_UseKey && (Local_Color == BLTEST_KEY))
+            {
+                Local_IsInRun = 0;
+                continue;
+            }
+            if (!Local_IsInRun)
+            {
+                Local_Windows++;
+                Local_IsInRun = Copy_UseKey;
+            }
+            BLTEST_Reference[(Copy_Y + Local_DY) * Local_Width + Copy_X + Local_DX] = TEST_Rgb565ToRgb888(Local_Color);
+            Local_Pixels++;
+        }
+    }
+    if (!Copy_UseKey && (Local_Pixels != 0))
+    {
+        Local_Windows = 1;
+    }
+
+    TFT_EMU_ResetStats();
+    if (Copy_UseKey)
+    {
+        TFT_BlitKeyed(Local_Config, Local_Spi, Copy_X, Copy_Y, &BLTEST_Bitmap, Copy_SourceX, Copy_SourceY, Copy_Width, Copy_Height, Copy_Rotation, BLTEST_KEY);
+    }
+    else
+    {
+        TFT_Blit(Local_Config, Local_Spi, Copy_X, Copy_Y, &BLTEST_Bitmap, Copy_SourceX, Copy_SourceY, Copy_Width, Copy_Height, Copy_Rotation);
+    }
+    TFT_EMU_GetStats(&Local_Stats);
+
+    TEST_Check((Local_Stats.Errors == 0) && (Local_Stats.Pixels == Local_Pixels) && (Local_Stats.Windows == Local_Windows) &&
+               (TEST_CountMismatches(BLTEST_Reference, (u16)Local_Width, (u16)Local_Height) == 0),
+               "%s: %s %ux%u at %d,%d rotated %u, %u protocol errors, %u pixels (%u expected), %u windows (%u expected), %u wrong pixels",
+               Copy_Panel->Name, Copy_UseKey ? "keyed blit" : "blit", Local_SourceWidth, Local_SourceHeight, Copy_X, Copy_Y,
+               Copy_Rotation * 90, Local_Stats.Errors, Local_Stats.Pixels, Local_Pixels, Local_Stats.Windows, Local_Windows,
+               TEST_CountMismatches(BLTEST_Reference, (u16)Local_Width, (u16)Local_Height));
+}
+
+int main(int argc, char **argv)
+{
+    const TFT_Controller_t *Local_Controller;
+    s16 Local_Width;
+    s16 Local_Height;
+    u8 Local_Panel;
+    u8 Local_Rotation;
+    u8 Local_UseKey;
+
+    TEST_Init(argc, argv);
+    BLTEST_MakeBitmap();
+
+    for (Local_Panel = 0; Local_Panel < TEST_PanelCount; Local_Panel++)
+    {
+        Local_Controller = TEST_Panels[Local_Panel].Config.TFT_Controller;
+        Local_Width = (s16)Local_Controller->TFT_Width;
+        Local_Height = (s16)Local_Controller->TFT_Height;
+        for (Local_Rotation = TFT_ROTATE_0; Local_Rotation <= TFT_ROTATE_270; Local_Rotation++)
+        {
+            for (Local_UseKey = 0; Local_UseKey <= 1; Local_UseKey++)
+            {
+                /**< Inside, across the top-left, across the bottom-right, one column and off the screen */
+                BLTEST_Run(&TEST_Panels[Local_Panel], 10, 12, 3, 2, 20, 13, Local_Rotation, Local_UseKey);
+                BLTEST_Run(&TEST_Panels[Local_Panel], -7, -5, 3, 2, 20, 13, Local_Rotation, Local_UseKey);
+                BLTEST_Run(&TEST_Panels[Local_Panel], Local_Width - 8, Local_Height - 6, 3, 2, 20, 13, Local_Rotation, Local_UseKey);
+                BLTEST_Run(&TEST_Panels[Local_Panel], -19, 30, 3, 2, 20, 13, Local_Rotation, Local_UseKey);
+                BLTEST_Run(&TEST_Panels[Local_Panel], Local_Width, 0, 3, 2, 20, 13, Local_Rotation, Local_UseKey);
+
+                /**< The whole bitmap, and a rectangle reaching past its bottom-right corner */
+                BLTEST_Run(&TEST_Panels[Local_Panel], 0, 0, 0, 0, BLTEST_BITMAP_WIDTH, BLTEST_BITMAP_HEIGHT, Local_Rotation, Local_UseKey);
+                BLTEST_Run(&TEST_Panels[Local_Panel], 40, 50, 20, 11, 30, 30, Local_Rotation, Local_UseKey);
+            }
+        }
+    }
+
+    return TEST_Finish();
+}
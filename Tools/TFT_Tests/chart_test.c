@@ -0,0 +1,197 @@
+/**
+ * @file chart_test.c
+ * @brief Host tests of the strip chart on every controller.
+ *
+ * A chart in each mode is fed more samples than its plot holds, so a sweep chart wraps and
+ * a scroll chart scrolls with the hardware scrolling of the controller (the ST7735S mirrors
+ * the rows). The expected plot is computed from the samples by a reference model of the
+ * decimation, the join to the previous line, the sweep gap and the line order, and the
+ * glass is compared with it pixel for pixel, the screen around the plot included.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     chart_test
+ */
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "CHART_config.h"
+#include "CHART_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Plot: margins to the screen edges, value range, colors and samples per line.
+ */
+#define CHTEST_MARGIN               12
+#define CHTEST_MIN                  0
+#define CHTEST_MAX                  4095
+#define CHTEST_DECIMATION           3
+#define CHTEST_FOREGROUND           0x07E0
+#define CHTEST_BACKGROUND           0x0841
+
+/**
+ * @brief Expected screen, spans of the reference model and of the chart.
+ */
+static u32 CHTEST_Reference[TEST_MAX_SIDE * TEST_MAX_SIDE];
+static s32 CHTEST_First[TEST_MAX_SIDE];
+static s32 CHTEST_Last[TEST_MAX_SIDE];
+static u16 CHTEST_Spans[2 * TEST_MAX_SIDE];
+
+/**
+ * @brief Sample number Copy_Index: a triangle wave with steps and spikes out of the range.
+ */
+static s32 CHTEST_Sample(u32 Copy_Index);
+
+/**
+ * @brief Position of a value across a line, clamped to the range.
+ */
+static s32 CHTEST_Position(s32 Copy_Value, u16 Copy_Range);
+
+/**
+ * @brief Feeds a chart of one mode past its capacity on a panel and checks the glass.
+ */
+static void CHTEST_Run(const TEST_Panel_t *Copy_Panel, u8 Copy_Mode);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static s32 CHTEST_Sample(u32 Copy_Index)
+{
+    s32 Local_Phase = (s32)(Copy_Index % 200);
+    s32 Local_Value = (Local_Phase < 100) ? (Local_Phase * 40) : ((200 - Local_Phase) * 40);
+
+    if ((Copy_Index % 97) == 0)
+    {
+        Local_Value = (Copy_Index & 1) ? 9000 : -9000;
+    }
+    else if ((Copy_Index / 150) & 1)
+    {
+        Local_Value += 300;
+    }
+
+    return Local_Value;
+}
+
+static s32 CHTEST_Position(s32 Copy_Value, u16 Copy_Range)
+{
+    if (Copy_Value <= CHTEST_MIN)
+    {
+        return 0;
+    }
+    if (Copy_Value >= CHTEST_MAX)
+    {
+        return Copy_Range - 1;
+    }
+
+    return ((Copy_Value - CHTEST_MIN) * (Copy_Range - 1)) / (CHTEST_MAX - CHTEST_MIN);
+}
+
+static void CHTEST_Run(const TEST_Panel_t *Copy_Panel, u8 Copy_Mode)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    u16 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    u16 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    u16 Local_PlotWidth = Local_Width - 2 * CHTEST_MARGIN;
+    u16 Local_PlotHeight = Local_Height - 2 * CHTEST_MARGIN;
+    u16 Local_Lines = (Copy_Mode == CHART_SCROLL) ? Local_PlotHeight : Local_PlotWidth;
+    u16 Local_Range = (Copy_Mode == CHART_SCROLL) ? Local_PlotWidth : Local_PlotHeight;
+    u32 Local_Total = (u32)Local_Lines * 5 / 2;
+    const char *Local_ModeName = (Copy_Mode == CHART_SCROLL) ? "scroll" : "sweep";
+    static CHART_t Local_Chart;
+    TFT_EMU_Stats_t Local_Stats;
+    SPI_t Local_Spi;
+    s32 Local_Previous = -1;
+    s32 Local_Low;
+    s32 Local_High;
+    s32 Local_Value;
+    u32 Local_Line;
+    u32 Local_Sample;
+    u16 Local_Slot;
+    u16 Local_Position;
+    u16 Local_X;
+    u16 Local_Y;
+    u8 Local_Status;
+
+    /**< Reference model: the trace span of every line slot after Local_Total lines */
+    for (Local_Slot = 0; Local_Slot < Local_Lines; Local_Slot++)
+    {
+        CHTEST_First[Local_Slot] = 1;
+        CHTEST_Last[Local_Slot] = 0;
+    }
+    for (Local_Line = 0; Local_Line < Local_Total; Local_Line++)
+    {
+        Local_Low = CHTEST_MAX + 1;
+        Local_High = CHTEST_MIN - 1;
+        for (Local_Sample = Local_Line * CHTEST_DECIMATION; Local_Sample < (Local_Line + 1) * CHTEST_DECIMATION; Local_Sample++)
+        {
+            Local_Value = CHTEST_Position(CHTEST_Sample(Local_Sample), Local_Range);
+            Local_Low = (Local_Value < Local_Low) ? Local_Value : Local_Low;
+            Local_High = (Local_Value > Local_High) ? Local_Value : Local_High;
+        }
+        if (Local_Previous >= 0)
+        {
+            Local_Low = (Local_Previous < Local_Low) ? Local_Previous : Local_Low;
+            Local_High = (Local_Previous > Local_High) ? Local_Previous : Local_High;
+        }
+        Local_Previous = CHTEST_Position(CHTEST_Sample((Local_Line + 1) * CHTEST_DECIMATION - 1), Local_Range);
+
+        Local_Slot = (u16)(Local_Line % Local_Lines);
+        CHTEST_First[Local_Slot] = Local_Low;
+        CHTEST_Last[Local_Slot] = Local_High;
+        if ((Copy_Mode == CHART_SWEEP) && (CHART_SWEEP_GAP > 0) && (CHART_SWEEP_GAP < Local_Lines))
+        {
+            CHTEST_First[(Local_Slot + CHART_SWEEP_GAP) % Local_Lines] = 1;
+            CHTEST_Last[(Local_Slot + CHART_SWEEP_GAP) % Local_Lines] = 0;
+        }
+    }
+
+    /**< Expected screen: the untouched screen around the plot, the oldest scroll line at the top */
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TEST_CaptureScreen(CHTEST_Reference, Local_Width, Local_Height);
+    for (Local_Y = 0; Local_Y < Local_PlotHeight; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < Local_PlotWidth; Local_X++)
+        {
+            Local_Slot = (Copy_Mode == CHART_SCROLL) ? (u16)((Local_Total + Local_Y) % Local_Lines) : Local_X;
+            Local_Position = (Copy_Mode == CHART_SCROLL) ? Local_X : (u16)(Local_PlotHeight - 1 - Local_Y);
+            CHTEST_Reference[(u32)(CHTEST_MARGIN + Local_Y) * Local_Width + CHTEST_MARGIN + Local_X] =
+                TEST_Rgb565ToRgb888(((Local_Position >= CHTEST_First[Local_Slot]) && (Local_Position <= CHTEST_Last[Local_Slot])) ? CHTEST_FOREGROUND : CHTEST_BACKGROUND);
+        }
+    }
+
+    Local_Status = CHART_Init(&Local_Chart, Local_Config, Local_Spi, Copy_Mode, CHTEST_MARGIN, CHTEST_MARGIN, Local_PlotWidth, Local_PlotHeight,
+                              CHTEST_MIN, CHTEST_MAX, CHTEST_DECIMATION, CHTEST_FOREGROUND, CHTEST_BACKGROUND, CHTEST_Spans);
+    TEST_Check(Local_Status == 0, "%s: CHART_Init in %s mode", Copy_Panel->Name, Local_ModeName);
+    for (Local_Sample = 0; Local_Sample < Local_Total * CHTEST_DECIMATION; Local_Sample++)
+    {
+        CHART_AddSample(&Local_Chart, CHTEST_Sample(Local_Sample));
+    }
+    TFT_EMU_GetStats(&Local_Stats);
+
+    TEST_Check(Local_Stats.Errors == 0, "%s: %s, %u protocol errors", Copy_Panel->Name, Local_ModeName, Local_Stats.Errors);
+    TEST_Check(TEST_CountMismatches(CHTEST_Reference, Local_Width, Local_Height) == 0, "%s: %s, %u lines through %u, %u wrong pixels",
+               Copy_Panel->Name, Local_ModeName, Local_Total, Local_Lines, TEST_CountMismatches(CHTEST_Reference, Local_Width, Local_Height));
+}
+
+int main(int argc, char **argv)
+{
+    u8 Local_Panel;
+
+    TEST_Init(argc, argv);
+
+    for (Local_Panel = 0; Local_Panel < TEST_PanelCount; Local_Panel++)
+    {
+        CHTEST_Run(&TEST_Panels[Local_Panel], CHART_SWEEP);
+        CHTEST_Run(&TEST_Panels[Local_Panel], CHART_SCROLL);
+    }
+
+    return TEST_Finish();
+}
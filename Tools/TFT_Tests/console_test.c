@@ -0,0 +1,153 @@
+/**
+ * @file console_test.c
+ * @brief Host tests of the TFT text console on every controller.
+ *
+ * The console prints more than two screens of numbered lines, scrolling with the hardware
+ * scrolling of the controller, including the ST7735S whose init table mirrors the rows.
+ * The glass is then compared pixel for pixel with the expected lines drawn without
+ * scrolling on a fresh panel.
+ *
+ * The text colors set by escape sequences are checked the same way, bright (bold) included.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     console_test
+ */
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "CONSOLE_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Colors of the console.
+ */
+#define CONTEST_FOREGROUND          0xFFFF
+#define CONTEST_BACKGROUND          0x0010
+
+/**
+ * @brief Colors sequence and the expected color of every character it prints.
+ */
+#define CONTEST_COLOR_TEXT          "\033[31mr\033[1mb\033[22mn\033[1;32mg\033[94mB\033[22mB\033[39;1md\033[0md\033[1m\033[36mc\n"
+static const u16 CONTEST_ColorExpected[] = { 0xA800, 0xFAAA, 0xA800, 0x57EA, 0x52BF, 0x52BF, CONTEST_FOREGROUND, CONTEST_FOREGROUND, 0x57FF };
+static const char CONTEST_ColorCharacters[] = "rbngBBddc";
+
+/**
+ * @brief Expected screen.
+ */
+static u32 CONTEST_Reference[TEST_MAX_SIDE * TEST_MAX_SIDE];
+
+/**
+ * @brief Text of a numbered line.
+ */
+static void CONTEST_LineText(char *Copy_Text, u32 Copy_Size, u16 Copy_Line);
+
+/**
+ * @brief Scrolls a console past two screens on a panel and checks the glass.
+ */
+static void CONTEST_Scroll(const TEST_Panel_t *Copy_Panel);
+
+/**
+ * @brief Prints text in the colors of CONTEST_COLOR_TEXT and checks the glass.
+ */
+static void CONTEST_Colors(const TEST_Panel_t *Copy_Panel);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static void CONTEST_LineText(char *Copy_Text, u32 Copy_Size, u16 Copy_Line)
+{
+    snprintf(Copy_Text, Copy_Size, "line %03u %c%c", Copy_Line, 'A' + (Copy_Line % 26), 'a' + ((Copy_Line * 7) % 26));
+}
+
+static void CONTEST_Scroll(const TEST_Panel_t *Copy_Panel)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    const TFT_Font_t *Local_Font = TEST_GetFont();
+    u16 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    u16 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    u16 Local_Rows = Local_Height / Local_Font->TFT_LineHeight;
+    u16 Local_Lines = 2 * Local_Rows + 5;
+    static CONSOLE_t Local_Console;
+    TFT_EMU_Stats_t Local_Stats;
+    char Local_Text[32];
+    SPI_t Local_Spi;
+    u16 Local_Row;
+    u16 Local_Line;
+    u8 Local_Status;
+
+    /**< Expected: the last lines from the top, the cursor on an empty bottom line */
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TFT_FillRect(Local_Config, Local_Spi, 0, 0, Local_Width, Local_Height, CONTEST_BACKGROUND);
+    for (Local_Row = 0; Local_Row < Local_Rows - 1; Local_Row++)
+    {
+        CONTEST_LineText(Local_Text, sizeof(Local_Text), Local_Lines - (Local_Rows - 1) + Local_Row);
+        TFT_DrawText(Local_Config, Local_Spi, 0, Local_Row * Local_Font->TFT_LineHeight, Local_Text, Local_Font, CONTEST_FOREGROUND, CONTEST_BACKGROUND);
+    }
+    TEST_CaptureScreen(CONTEST_Reference, Local_Width, Local_Height);
+
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    Local_Status = CONSOLE_Init(&Local_Console, Local_Config, Local_Spi, Local_Font, CONTEST_FOREGROUND, CONTEST_BACKGROUND);
+    TEST_Check(Local_Status == 0, "%s: CONSOLE_Init", Copy_Panel->Name);
+    for (Local_Line = 0; Local_Line < Local_Lines; Local_Line++)
+    {
+        CONTEST_LineText(Local_Text, sizeof(Local_Text), Local_Line);
+        CONSOLE_Printf(&Local_Console, "%s\n", Local_Text);
+    }
+    TFT_EMU_GetStats(&Local_Stats);
+
+    TEST_Check(Local_Stats.Errors == 0, "%s: %u protocol errors", Copy_Panel->Name, Local_Stats.Errors);
+    TEST_Check(TEST_CountMismatches(CONTEST_Reference, Local_Width, Local_Height) == 0, "%s: %u lines scrolled through %u rows, %u wrong pixels",
+               Copy_Panel->Name, Local_Lines, Local_Rows, TEST_CountMismatches(CONTEST_Reference, Local_Width, Local_Height));
+}
+
+static void CONTEST_Colors(const TEST_Panel_t *Copy_Panel)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    const TFT_Font_t *Local_Font = TEST_GetFont();
+    u16 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    u16 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    static CONSOLE_t Local_Console;
+    char Local_Text[2] = { 0, 0 };
+    SPI_t Local_Spi;
+    u8 Local_Index;
+
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TFT_FillRect(Local_Config, Local_Spi, 0, 0, Local_Width, Local_Height, CONTEST_BACKGROUND);
+    for (Local_Index = 0; Local_Index < sizeof(CONTEST_ColorExpected) / sizeof(CONTEST_ColorExpected[0]); Local_Index++)
+    {
+        Local_Text[0] = CONTEST_ColorCharacters[Local_Index];
+        TFT_DrawText(Local_Config, Local_Spi, Local_Index * (TEST_FONT_WIDTH + 1), 0, Local_Text, Local_Font, CONTEST_ColorExpected[Local_Index], CONTEST_BACKGROUND);
+    }
+    TEST_CaptureScreen(CONTEST_Reference, Local_Width, Local_Height);
+
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    CONSOLE_Init(&Local_Console, Local_Config, Local_Spi, Local_Font, CONTEST_FOREGROUND, CONTEST_BACKGROUND);
+    CONSOLE_Print(&Local_Console, CONTEST_COLOR_TEXT);
+
+    TEST_Check(TEST_CountMismatches(CONTEST_Reference, Local_Width, Local_Height) == 0, "%s: text colors and bright, %u wrong pixels",
+               Copy_Panel->Name, TEST_CountMismatches(CONTEST_Reference, Local_Width, Local_Height));
+}
+
+int main(int argc, char **argv)
+{
+    u8 Local_Panel;
+
+    TEST_Init(argc, argv);
+
+    for (Local_Panel = 0; Local_Panel < TEST_PanelCount; Local_Panel++)
+    {
+        CONTEST_Scroll(&TEST_Panels[Local_Panel]);
+        CONTEST_Colors(&TEST_Panels[Local_Panel]);
+    }
+
+    return TEST_Finish();
+}
@@ -0,0 +1,307 @@
+/**
+ * @file frame_test.c
+ * @brief Host tests of the frame pacer against a simulated tearing-effect signal.
+ *
+ * A SIGALRM interval timer stands in for the TE pin: every expiry calls the callback the
+ * pacer registered with EXTI, as the EXTI interrupt does, and records the time of the
+ * pulse. The timer and every time of the test run on the CPU time of the thread, like the
+ * dedicated core of the target: when the host schedules the test out, the simulated panel
+ * stops with it instead of sending pulses nobody sees. Frames are then rendered for a pseudo-random number of refresh periods, most
+ * within their budget and some 1.2 to 3 times over it, at 1, 2 and 3 periods per frame.
+ * For every frame the pulse FRAME_Begin returns on and the slots it reports skipped must
+ * match a model of the pacing, FRAME_TearCount (through FRAME_GetTearCount) must follow
+ * the pulses, and FRAME_Begin must return right after the pulse.
+ *
+ * EXTI, AFIO and NVIC are replaced by the functions of this file, which record how the
+ * pacer routes the TE pin.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     frame_test
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "GPIO_interface.h"
+#include "NVIC_interface.h"
+#include "EXTI_interface.h"
+#include "AFIO_interface.h"
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "FRAME_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Simulated refresh period (a multiple of the 4 ms scheduler tick that drives CPU-time
+ * timers on common hosts), frames paced at each period and pulse times kept.
+ */
+#define FRTEST_TE_MICROSECONDS      4000
+#define FRTEST_FRAMES               100
+#define FRTEST_PULSES               1024
+
+/**
+ * @brief Largest delay from a pulse to the return of FRAME_Begin, in seconds.
+ */
+#define FRTEST_MAX_LATENCY          0.0005
+
+/**
+ * @brief Routing of the TE pin recorded by the replaced MCAL functions.
+ */
+static void (*FRTEST_Callback)(void) = NULL;
+static u8 FRTEST_Line = 0xFF;
+static u8 FRTEST_Port = 0xFF;
+static u8 FRTEST_Edge = 0xFF;
+static u8 FRTEST_Enabled = 0xFF;
+static IRQn_Type FRTEST_Irq = 0xFF;
+
+/**
+ * @brief Time of each pulse, indexed by the pulse count modulo FRTEST_PULSES.
+ */
+static volatile double FRTEST_PulseTime[FRTEST_PULSES];
+
+/**
+ * @brief The simulated TE source.
+ */
+static timer_t FRTEST_Timer;
+
+/**
+ * @brief State of the pseudo-random render times.
+ */
+static u32 FRTEST_Random = 12345;
+
+/**
+ * @brief The TE pulse: the EXTI interrupt of the TE line.
+ */
+static void FRTEST_OnAlarm(int Copy_Signal);
+
+/**
+ * @brief CPU time of the thread, in seconds.
+ */
+static double FRTEST_Seconds(void);
+
+/**
+ * @brief Starts or stops the simulated TE pulses.
+ */
+static void FRTEST_SetPulses(u8 Copy_Enable);
+
+/**
+ * @brief Next pseudo-random number, 0 to 65535.
+ */
+static u32 FRTEST_Next(void);
+
+/**
+ * @brief Checks the routing of the TE pin and the invalid arguments of FRAME_Init.
+ */
+static void FRTEST_Init(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_Spi);
+
+/**
+ * @brief Paces FRTEST_FRAMES frames at Copy_Period refresh periods per frame and checks them.
+ */
+static void FRTEST_Run(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_Spi, u8 Copy_Period);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static void FRTEST_OnAlarm(int Copy_Signal)
+{
+    double Local_Time = FRTEST_Seconds();
+
+    (void)Copy_Signal;
+    if (FRTEST_Callback != NULL)
+    {
+        FRTEST_Callback();
+        FRTEST_PulseTime[FRAME_GetTearCount() % FRTEST_PULSES] = Local_Time;
+    }
+}
+
+static double FRTEST_Seconds(void)
+{
+    struct timespec Local_Time;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &Local_Time);
+    return (double)Local_Time.tv_sec + (double)Local_Time.tv_nsec * 1e-9;
+}
+
+static void FRTEST_SetPulses(u8 Copy_Enable)
+{
+    struct itimerspec Local_Timer;
+
+    memset(&Local_Timer, 0, sizeof(Local_Timer));
+    if (Copy_Enable)
+    {
+        Local_Timer.it_interval.tv_nsec = FRTEST_TE_MICROSECONDS * 1000L;
+        Local_Timer.it_value.tv_nsec = FRTEST_TE_MICROSECONDS * 1000L;
+    }
+    timer_settime(FRTEST_Timer, 0, &Local_Timer, NULL);
+}
+
+static u32 FRTEST_Next(void)
+{
+    FRTEST_Random = FRTEST_Random * 1103515245u + 12345u;
+    return (FRTEST_Random >> 16) & 0xFFFF;
+}
+
+static void FRTEST_Init(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_Spi)
+{
+    static const u8 Local_Pins[3] = {0, 7, 12};
+    static const IRQn_Type Local_Irqs[3] = {NVIC_EXTI0_IRQn, NVIC_EXTI9_5_IRQn, NVIC_EXTI15_10_IRQn};
+    TFT_EMU_Stats_t Local_Stats;
+    u8 Local_Index;
+    u8 Local_Status;
+
+    TEST_Check(FRAME_Init(NULL, Copy_Spi, GPIO_PORTB, 0, 1) == 1, "FRAME_Init refuses a NULL display");
+    TEST_Check(FRAME_Init(Copy_TftDisplay, Copy_Spi, GPIO_PORTB, 16, 1) == 1, "FRAME_Init refuses pin 16");
+    TEST_Check(FRAME_Init(Copy_TftDisplay, Copy_Spi, GPIO_PORTB, 0, 0) == 1, "FRAME_Init refuses a period of 0");
+
+    for (Local_Index = 0; Local_Index < 3; Local_Index++)
+    {
+        TFT_EMU_ResetStats();
+        Local_Status = FRAME_Init(Copy_TftDisplay, Copy_Spi, GPIO_PORTB, Local_Pins[Local_Index], 1);
+        TFT_EMU_GetStats(&Local_Stats);
+        TEST_Check((Local_Status == 0) && (Local_Stats.Errors == 0) && (Local_Stats.Commands != 0),
+                   "FRAME_Init on PB%u: status %u, %u commands, %u protocol errors", Local_Pins[Local_Index], Local_Status,
+                   Local_Stats.Commands, Local_Stats.Errors);
+        TEST_Check((FRTEST_Line == Local_Pins[Local_Index]) && (FRTEST_Port == GPIO_PORTB) && (FRTEST_Edge == EXTI_RISING) &&
+                   (FRTEST_Enabled == Local_Pins[Local_Index]) && (FRTEST_Irq == Local_Irqs[Local_Index]) &&
+                   (FRTEST_Callback == FRAME_OnTearingEffect),
+                   "PB%u routed to EXTI line %u, rising edge, IRQ %u", Local_Pins[Local_Index], FRTEST_Line, FRTEST_Irq);
+    }
+}
+
+static void FRTEST_Run(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_Spi, u8 Copy_Period)
+{
+    double Local_Latency = 0;
+    double Local_Delay;
+    double Local_Return;
+    u32 Local_Expected;
+    u32 Local_ExpectedSkips = 0;
+    u32 Local_Start;
+    u32 Local_Count;
+    u32 Local_Periods;
+    u32 Local_WrongStarts = 0;
+    u32 Local_WrongSkips = 0;
+    u32 Local_Skipped = 0;
+    u32 Local_Late = 0;
+    u32 Local_Frame;
+    u8 Local_Reported;
+
+    FRAME_Init(Copy_TftDisplay, Copy_Spi, GPIO_PORTB, 0, Copy_Period);
+    FRTEST_SetPulses(1);
+
+    /**< The first frame starts on the next pulse */
+    Local_Expected = FRAME_GetTearCount() + 1;
+    for (Local_Frame = 0; Local_Frame < FRTEST_FRAMES; Local_Frame++)
+    {
+        Local_Reported = FRAME_Begin();
+        Local_Return = FRTEST_Seconds();
+        Local_Start = FRAME_GetTearCount();
+
+        /**< A pulse taken after the return is not the one FRAME_Begin returned on */
+        if ((Local_Start == (Local_Expected + 1)) && (FRTEST_PulseTime[Local_Start % FRTEST_PULSES] >= Local_Return))
+        {
+            Local_Start = Local_Expected;
+        }
+        Local_Delay = Local_Return - FRTEST_PulseTime[Local_Start % FRTEST_PULSES];
+        Local_Latency = (Local_Delay > Local_Latency) ? Local_Delay : Local_Latency;
+        Local_WrongStarts += (Local_Start != Local_Expected) ? 1 : 0;
+        Local_WrongSkips += (Local_Reported != Local_ExpectedSkips) ? 1 : 0;
+        Local_Skipped += Local_Reported;
+
+        /**< Render: 80% within the budget, 20% 1.2 to 3 times over it; it ends half a refresh
+             period after a pulse, away from the edges */
+        Local_Periods = ((FRTEST_Next() % 10) < 8) ? (FRTEST_Next() % Copy_Period) : (Copy_Period + FRTEST_Next() % (2 * Copy_Period));
+        while ((s32)(FRAME_GetTearCount() - (Local_Start + Local_Periods)) < 0)
+        {
+        }
+        while (FRTEST_Seconds() < (FRTEST_PulseTime[(Local_Start + Local_Periods) % FRTEST_PULSES] + FRTEST_TE_MICROSECONDS * 0.5e-6))
+        {
+        }
+
+        /**< Model: the slots whose pulse came during the render are skipped; the pulses are
+             counted rather than assumed, so a late host timer does not fail the check */
+        Local_Count = FRAME_GetTearCount();
+        Local_ExpectedSkips = ((Local_Count - Local_Start) >= Copy_Period) ? ((Local_Count - Local_Start) / Copy_Period) : 0;
+        Local_Expected = Local_Start + Copy_Period * (Local_ExpectedSkips + 1);
+        Local_Late += (Local_ExpectedSkips != 0) ? 1 : 0;
+    }
+    FRTEST_SetPulses(0);
+
+    TEST_Check(Local_WrongStarts == 0, "period %u: %u frames, %u late, %u started on another pulse", Copy_Period, FRTEST_FRAMES,
+               Local_Late, Local_WrongStarts);
+    TEST_Check((Local_WrongSkips == 0) && (FRAME_GetSkippedCount() == Local_Skipped),
+               "period %u: %u slots skipped, FRAME_GetSkippedCount %u, %u wrong reports", Copy_Period, Local_Skipped,
+               FRAME_GetSkippedCount(), Local_WrongSkips);
+    TEST_Check(Local_Latency < FRTEST_MAX_LATENCY, "period %u: FRAME_Begin returns at most %.1f us after the pulse", Copy_Period,
+               Local_Latency * 1e6);
+}
+
+/****************************************< MCAL REPLACEMENT ****************************************/
+void AFIO_SetEXTIPinConfiguration(u8 Copy_Line, u8 Copy_PortMap)
+{
+    FRTEST_Line = Copy_Line;
+    FRTEST_Port = Copy_PortMap;
+}
+
+u8 EXTI_SetSignalLatch(u8 Copy_Line, u8 Copy_Mode)
+{
+    (void)Copy_Line;
+    FRTEST_Edge = Copy_Mode;
+    return 0;
+}
+
+u8 EXTI_EnableEXTI(u8 Copy_Line)
+{
+    FRTEST_Enabled = Copy_Line;
+    return 0;
+}
+
+u8 EXTI_SetCallBack(void (*Copy_Callback)(void))
+{
+    FRTEST_Callback = Copy_Callback;
+    return 0;
+}
+
+Std_ReturnType NVIC_EnableIRQ(IRQn_Type Copy_IRQn)
+{
+    FRTEST_Irq = Copy_IRQn;
+    return E_OK;
+}
+
+int main(int argc, char **argv)
+{
+    const TFT_Config_t *Local_Config = &TEST_Panels[0].Config;
+    struct sigaction Local_Action;
+    struct sigevent Local_Event;
+    SPI_t Local_Spi;
+    u8 Local_Period;
+
+    TEST_Init(argc, argv);
+
+    memset(&Local_Action, 0, sizeof(Local_Action));
+    Local_Action.sa_handler = FRTEST_OnAlarm;
+    sigemptyset(&Local_Action.sa_mask);
+    sigaction(SIGALRM, &Local_Action, NULL);
+    memset(&Local_Event, 0, sizeof(Local_Event));
+    Local_Event.sigev_notify = SIGEV_SIGNAL;
+    Local_Event.sigev_signo = SIGALRM;
+    timer_create(CLOCK_THREAD_CPUTIME_ID, &Local_Event, &FRTEST_Timer);
+
+    Local_Spi = TEST_StartPanel(&TEST_Panels[0]);
+    FRTEST_Init(Local_Config, Local_Spi);
+    for (Local_Period = 1; Local_Period <= 3; Local_Period++)
+    {
+        FRTEST_Run(Local_Config, Local_Spi, Local_Period);
+    }
+
+    return TEST_Finish();
+}
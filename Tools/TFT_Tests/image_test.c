@@ -0,0 +1,287 @@
+/**
+ * @file image_test.c
+ * @brief Host tests of TFT_DrawImage on every controller.
+ *
+ * RLE images, with RGB565 pixel values and with palette indices, are drawn inside the
+ * screen, across each of its edges, across all of them at once and off it. Their packets
+ * are random: runs and literals of 1 to 128 pixels that cross row ends and the clipped
+ * edges, runs long enough to be sent as one repeated color and literals that fill the
+ * decode buffer. Indexed images of 1, 2, 4 and 8 bits per pixel have odd widths, so their
+ * rows start inside a byte, and are drawn across the left edge among other places.
+ *
+ * The glass is compared pixel for pixel with the image expanded by a reference decoder, and
+ * the counts with what must reach the panel: every visible pixel once in one window,
+ * nothing for an image off the screen.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     image_test
+ */
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Sizes of the images: a small one, and a large one that covers every screen edge
+ * of the ST7735S at once.
+ */
+#define IMTEST_SMALL_WIDTH          37
+#define IMTEST_SMALL_HEIGHT         23
+#define IMTEST_LARGE_WIDTH          151
+#define IMTEST_LARGE_HEIGHT         141
+
+/**
+ * @brief Largest image, in pixels, and the largest RLE stream: a header per pixel value
+ * at worst, two bytes per value.
+ */
+#define IMTEST_MAX_PIXELS           (IMTEST_LARGE_WIDTH * IMTEST_LARGE_HEIGHT)
+#define IMTEST_MAX_BYTES            (IMTEST_MAX_PIXELS * 3)
+
+/**
+ * @brief Longest packet of the RLE format.
+ */
+#define IMTEST_MAX_PACKET           128
+
+/**
+ * @brief The encoded image, its palette and its pixels expanded by the reference decoder.
+ */
+static u8 IMTEST_Data[IMTEST_MAX_BYTES];
+static u16 IMTEST_Palette[256];
+static u16 IMTEST_Pixels[IMTEST_MAX_PIXELS];
+static TFT_Image_t IMTEST_Image;
+
+/**
+ * @brief The expected screen.
+ */
+static u32 IMTEST_Reference[TEST_MAX_SIDE * TEST_MAX_SIDE];
+
+/**
+ * @brief State of the pseudo-random generator.
+ */
+static u32 IMTEST_Seed = 1;
+
+/**
+ * @brief Returns a pseudo-random number below a limit.
+ */
+static u32 IMTEST_Random(u32 Copy_Limit);
+
+/**
+ * @brief Fills a random RLE image and expands it into IMTEST_Pixels.
+ *
+ * Each packet is a run or a literal of a random length, long and short ones mixed, and
+ * each pixel value a random RGB565 color or, with a palette, a random index.
+ */
+static void IMTEST_MakeRle(u16 Copy_Width, u16 Copy_Height, u8 Copy_UsePalette);
+
+/**
+ * @brief Fills a random indexed image, its rows unpadded, and expands it into IMTEST_Pixels.
+ */
+static void IMTEST_MakeIndexed(u16 Copy_Width, u16 Copy_Height, u8 Copy_IndexBits);
+
+/**
+ * @brief Draws the image at a position on a fresh panel and checks it against IMTEST_Pixels.
+ */
+static void IMTEST_Run(const TEST_Panel_t *Copy_Panel, const char *Copy_Name, s16 Copy_X, s16 Copy_Y);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static u32 IMTEST_Random(u32 Copy_Limit)
+{
+    IMTEST_Seed = IMTEST_Seed * 1103515245UL + 12345UL;
+    return (IMTEST_Seed >> 8) % Copy_Limit;
+}
+
+static void IMTEST_MakeRle(u16 Copy_Width, u16 Copy_Height, u8 Copy_UsePalette)
+{
+    u32 Local_Total = (u32)Copy_Width * Copy_Height;
+    u32 Local_Pixel = 0;
+    u32 Local_Byte = 0;
+    u32 Local_Length;
+    u32 Local_Index;
+    u16 Local_Color = 0;
+    u8 Local_IsRun;
+
+    for (Local_Index = 0; Local_Index < 256; Local_Index++)
+    {
+        IMTEST_Palette[Local_Index] = (u16)IMTEST_Random(0x10000);
+    }
+
+    while (Local_Pixel < Local_Total)
+    {
+        /**< Mostly short packets, one in four as long as the format allows */
+        Local_IsRun = (u8)IMTEST_Random(2);
+        Local_Length = (IMTEST_Random(4) == 0) ? (IMTEST_MAX_PACKET - IMTEST_Random(8)) : (1 + IMTEST_Random(20));
+        if (Local_Length > Local_Total - Local_Pixel)
+        {
+            Local_Length = Local_Total - Local_Pixel;
+        }
+        IMTEST_Data[Local_Byte++] = (u8)((Local_IsRun ? 0x80 : 0x00) | (Local_Length - 1));
+
+        for (Local_Index = 0; Local_Index < Local_Length; Local_Index++)
+        {
+            /**< A run has one pixel value, a literal one per pixel */
+            if ((Local_Index == 0) || !Local_IsRun)
+            {
+                if (Copy_UsePalette)
+                {
+                    IMTEST_Data[Local_Byte] = (u8)IMTEST_Random(256);
+                    Local_Color = IMTEST_Palette[IMTEST_Data[Local_Byte++]];
+                }
+                else
+                {
+                    Local_Color = (u16)IMTEST_Random(0x10000);
+                    IMTEST_Data[Local_Byte++] = (u8)(Local_Color >> 8);
+                    IMTEST_Data[Local_Byte++] = (u8)Local_Color;
+                }
+            }
+            IMTEST_Pixels[Local_Pixel++] = Local_Color;
+        }
+    }
+
+    IMTEST_Image.TFT_Data = IMTEST_Data;
+    IMTEST_Image.TFT_Palette = Copy_UsePalette ? IMTEST_Palette : NULL;
+    IMTEST_Image.TFT_Width = Copy_Width;
+    IMTEST_Image.TFT_Height = Copy_Height;
+    IMTEST_Image.TFT_Format = TFT_IMAGE_RLE;
+    IMTEST_Image.TFT_IndexBits = 0;
+}
+
+static void IMTEST_MakeIndexed(u16 Copy_Width, u16 Copy_Height, u8 Copy_IndexBits)
+{
+    u32 Local_Pixel;
+    u32 Local_Bit;
+    u8 Local_Value;
+
+    for (Local_Pixel = 0; Local_Pixel < 256; Local_Pixel++)
+    {
+        IMTEST_Palette[Local_Pixel] = (u16)IMTEST_Random(0x10000);
+    }
+    for (Local_Pixel = 0; Local_Pixel < ((u32)Copy_Width * Copy_Height * Copy_IndexBits + 7) / 8; Local_Pixel++)
+    {
+        IMTEST_Data[Local_Pixel] = 0;
+    }
+
+    /**< Pixel N in bits N * bits .. N * bits + bits - 1, most significant bits first */
+    for (Local_Pixel = 0; Local_Pixel < (u32)Copy_Width * Copy_Height; Local_Pixel++)
+    {
+        Local_Value = (u8)IMTEST_Random(1U << Copy_IndexBits);
+        for (Local_Bit = 0; Local_Bit < Copy_IndexBits; Local_Bit++)
+        {
+            if (Local_Value & (1U << (Copy_IndexBits - 1 - Local_Bit)))
+            {
+                IMTEST_Data[(Local_Pixel * Copy_IndexBits + Local_Bit) / 8] |= (u8)(0x80 >> ((Local_Pixel * Copy_IndexBits + Local_Bit) % 8));
+            }
+        }
+        IMTEST_Pixels[Local_Pixel] = IMTEST_Palette[Local_Value];
+    }
+
+    IMTEST_Image.TFT_Data = IMTEST_Data;
+    IMTEST_Image.TFT_Palette = IMTEST_Palette;
+    IMTEST_Image.TFT_Width = Copy_Width;
+    IMTEST_Image.TFT_Height = Copy_Height;
+    IMTEST_Image.TFT_Format = TFT_IMAGE_INDEXED;
+    IMTEST_Image.TFT_IndexBits = Copy_IndexBits;
+}
+
+static void IMTEST_Run(const TEST_Panel_t *Copy_Panel, const char *Copy_Name, s16 Copy_X, s16 Copy_Y)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    s32 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    s32 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    u32 Local_Pixels = 0;
+    TFT_EMU_Stats_t Local_Stats;
+    SPI_t Local_Spi;
+    s32 Local_X;
+    s32 Local_Y;
+
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TEST_CaptureScreen(IMTEST_Reference, (u16)Local_Width, (u16)Local_Height);
+
+    for (Local_Y = 0; Local_Y < IMTEST_Image.TFT_Height; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < IMTEST_Image.TFT_Width; Local_X++)
+        {
+            if (((Copy_X + Local_X) >= 0) && ((Copy_X + Local_X) < Local_Width) && ((Copy_Y + Local_Y) >= 0) && ((Copy_Y + Local_Y) < Local_Height))
+            {
+                IMTEST_Reference[(Copy_Y + Local_Y) * Local_Width + (Copy_X + Local_X)] =
+                    TEST_Rgb565ToRgb888(IMTEST_Pixels[Local_Y * IMTEST_Image.TFT_Width + Local_X]);
+                Local_Pixels++;
+            }
+        }
+    }
+
+    TFT_EMU_ResetStats();
+    TFT_DrawImage(Local_Config, Local_Spi, Copy_X, Copy_Y, &IMTEST_Image);
+    TFT_EMU_GetStats(&Local_Stats);
+
+    TEST_Check((Local_Stats.Errors == 0) && (Local_Stats.Pixels == Local_Pixels) && (Local_Stats.Windows == ((Local_Pixels > 0) ? 1U : 0U)) &&
+               (TEST_CountMismatches(IMTEST_Reference, (u16)Local_Width, (u16)Local_Height) == 0),
+               "%s: %s %ux%u at %d,%d, %u protocol errors, %u pixels (%u expected), %u windows, %u wrong pixels",
+               Copy_Panel->Name, Copy_Name, IMTEST_Image.TFT_Width, IMTEST_Image.TFT_Height, Copy_X, Copy_Y, Local_Stats.Errors,
+               Local_Stats.Pixels, Local_Pixels, Local_Stats.Windows, TEST_CountMismatches(IMTEST_Reference, (u16)Local_Width, (u16)Local_Height));
+}
+
+int main(int argc, char **argv)
+{
+    static const char *const Local_IndexedNames[] = { "", "1-bit indexed", "2-bit indexed", "", "4-bit indexed", "", "", "", "8-bit indexed" };
+    const TEST_Panel_t *Local_Panel;
+    s16 Local_Width;
+    s16 Local_Height;
+    u8 Local_Index;
+    u8 Local_UsePalette;
+    u8 Local_Bits;
+
+    TEST_Init(argc, argv);
+
+    for (Local_Index = 0; Local_Index < TEST_PanelCount; Local_Index++)
+    {
+        Local_Panel = &TEST_Panels[Local_Index];
+        Local_Width = (s16)Local_Panel->Config.TFT_Controller->TFT_Width;
+        Local_Height = (s16)Local_Panel->Config.TFT_Controller->TFT_Height;
+
+        for (Local_UsePalette = 0; Local_UsePalette <= 1; Local_UsePalette++)
+        {
+            /**< Inside, across each edge and corner, and off the screen */
+            IMTEST_MakeRle(IMTEST_SMALL_WIDTH, IMTEST_SMALL_HEIGHT, Local_UsePalette);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", 10, 12);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", -13, 20);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", 15, -9);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", Local_Width - 20, 30);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", 25, Local_Height - 10);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", -30, -11);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", Local_Width - 7, Local_Height - 5);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", -IMTEST_SMALL_WIDTH, 0);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", 0, Local_Height);
+
+            /**< Across every edge at once on the smaller screens */
+            IMTEST_MakeRle(IMTEST_LARGE_WIDTH, IMTEST_LARGE_HEIGHT, Local_UsePalette);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", -9, -5);
+            IMTEST_Run(Local_Panel, Local_UsePalette ? "indexed RLE" : "RLE", 3, 1);
+        }
+
+        for (Local_Bits = 1; Local_Bits <= 8; Local_Bits *= 2)
+        {
+            /**< Odd widths: rows start at every bit offset of a byte */
+            IMTEST_MakeIndexed(IMTEST_SMALL_WIDTH, IMTEST_SMALL_HEIGHT, Local_Bits);
+            IMTEST_Run(Local_Panel, Local_IndexedNames[Local_Bits], 10, 12);
+            IMTEST_Run(Local_Panel, Local_IndexedNames[Local_Bits], -1, 3);
+            IMTEST_Run(Local_Panel, Local_IndexedNames[Local_Bits], -3, 30);
+            IMTEST_Run(Local_Panel, Local_IndexedNames[Local_Bits], -14, -5);
+            IMTEST_Run(Local_Panel, Local_IndexedNames[Local_Bits], Local_Width - 20, Local_Height - 9);
+
+            IMTEST_MakeIndexed(IMTEST_LARGE_WIDTH, IMTEST_LARGE_HEIGHT, Local_Bits);
+            IMTEST_Run(Local_Panel, Local_IndexedNames[Local_Bits], -7, -5);
+        }
+    }
+
+    return TEST_Finish();
+}
@@ -0,0 +1,185 @@
+/**
+ * @file init_test.c
+ * @brief Host tests of TFT_Init on every controller.
+ *
+ * The emulator records what each controller receives from TFT_Init: the reset pulse, every
+ * chip select, command, parameter and delay. The log is compared entry by entry with the
+ * expected sequence, written out below from the controller init code as it was before the
+ * sequences became tables, so a table entry that loses a byte, a delay or its own chip
+ * select cycle is caught. The ILI9481 is also run on the parallel bus.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     init_test
+ */
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+#include "TFT_ST7735S_interface.h"
+#include "TFT_HX8357B_interface.h"
+#include "TFT_ILI9481_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Entries of the expected sequences.
+ */
+#define INTEST_CMD(command)         TFT_EMU_LOG_SELECT, (TFT_EMU_LOG_COMMAND | (command))
+#define INTEST_DATA(byte)           (TFT_EMU_LOG_DATA | (byte))
+#define INTEST_DELAY(milliseconds)  (TFT_EMU_LOG_DELAY | (milliseconds))
+#define INTEST_RESET                TFT_EMU_LOG_RESET
+
+/**
+ * @brief Interface pixel format parameters of the configurations: 16 bits per pixel, in the
+ * encoding of the ST7735S (control interface only) and of the HX8357B and ILI9481 (RGB and
+ * control interfaces).
+ */
+#define INTEST_COLMOD_16BIT         0x05
+#define INTEST_COLMOD_16BIT_DBI     0x55
+
+/**
+ * @brief Capacity of the recorded log.
+ */
+#define INTEST_LOG_SIZE             512
+
+/**
+ * @brief Expected sequence of the ST7735S.
+ */
+static const u32 INTEST_ST7735S[] =
+{
+    INTEST_DELAY(5), INTEST_RESET, INTEST_DELAY(15), INTEST_DELAY(15),
+    INTEST_CMD(0x01), INTEST_DELAY(150),
+    INTEST_CMD(0x11), INTEST_DELAY(500),
+    INTEST_CMD(0xB1), INTEST_DATA(0x01), INTEST_DATA(0x2C), INTEST_DATA(0x2D),
+    INTEST_CMD(0xB2), INTEST_DATA(0x01), INTEST_DATA(0x2C), INTEST_DATA(0x2D),
+    INTEST_CMD(0xB3), INTEST_DATA(0x01), INTEST_DATA(0x2C), INTEST_DATA(0x2D), INTEST_DATA(0x01), INTEST_DATA(0x2C), INTEST_DATA(0x2D),
+    INTEST_CMD(0xB4), INTEST_DATA(0x07),
+    INTEST_CMD(0xC0), INTEST_DATA(0xA2), INTEST_DATA(0x02), INTEST_DATA(0x84),
+    INTEST_CMD(0xC1), INTEST_DATA(0xC5),
+    INTEST_CMD(0xC2), INTEST_DATA(0x0A), INTEST_DATA(0x00),
+    INTEST_CMD(0xC3), INTEST_DATA(0x8A), INTEST_DATA(0x2A),
+    INTEST_CMD(0xC4), INTEST_DATA(0x8A), INTEST_DATA(0xEE),
+    INTEST_CMD(0xC5), INTEST_DATA(0x0E),
+    INTEST_CMD(0x20),
+    INTEST_CMD(0x36), INTEST_DATA(0xC0),
+    INTEST_CMD(0x3A), INTEST_DATA(INTEST_COLMOD_16BIT),
+    INTEST_CMD(0x2A), INTEST_DATA(0x00), INTEST_DATA(0x00), INTEST_DATA(0x00), INTEST_DATA(0x7F),
+    INTEST_CMD(0x2B), INTEST_DATA(0x00), INTEST_DATA(0x00), INTEST_DATA(0x00), INTEST_DATA(0x7F),
+    INTEST_CMD(0xE0), INTEST_DATA(0x02), INTEST_DATA(0x1C), INTEST_DATA(0x07), INTEST_DATA(0x12), INTEST_DATA(0x37), INTEST_DATA(0x32),
+    INTEST_DATA(0x29), INTEST_DATA(0x2D), INTEST_DATA(0x29), INTEST_DATA(0x25), INTEST_DATA(0x2B), INTEST_DATA(0x39), INTEST_DATA(0x00),
+    INTEST_DATA(0x01), INTEST_DATA(0x03), INTEST_DATA(0x10),
+    INTEST_CMD(0xE1), INTEST_DATA(0x03), INTEST_DATA(0x1D), INTEST_DATA(0x07), INTEST_DATA(0x06), INTEST_DATA(0x2E), INTEST_DATA(0x2C),
+    INTEST_DATA(0x29), INTEST_DATA(0x2D), INTEST_DATA(0x2E), INTEST_DATA(0x2E), INTEST_DATA(0x37), INTEST_DATA(0x3F), INTEST_DATA(0x00),
+    INTEST_DATA(0x00), INTEST_DATA(0x02), INTEST_DATA(0x10),
+    INTEST_CMD(0x13), INTEST_DELAY(10),
+    INTEST_CMD(0x29), INTEST_DELAY(100),
+};
+
+/**
+ * @brief Expected sequence of the HX8357B.
+ */
+static const u32 INTEST_HX8357B[] =
+{
+    INTEST_DELAY(50), INTEST_RESET, INTEST_DELAY(10), INTEST_DELAY(10),
+    INTEST_CMD(0x11), INTEST_DELAY(20),
+    INTEST_CMD(0xD0), INTEST_DATA(0x07), INTEST_DATA(0x42), INTEST_DATA(0x18),
+    INTEST_CMD(0xD1), INTEST_DATA(0x00), INTEST_DATA(0x07), INTEST_DATA(0x10),
+    INTEST_CMD(0xD2), INTEST_DATA(0x01), INTEST_DATA(0x02),
+    INTEST_CMD(0xC0), INTEST_DATA(0x10), INTEST_DATA(0x3B), INTEST_DATA(0x00), INTEST_DATA(0x02), INTEST_DATA(0x11),
+    INTEST_CMD(0xC5), INTEST_DATA(0x08),
+    INTEST_CMD(0xC8), INTEST_DATA(0x00), INTEST_DATA(0x32), INTEST_DATA(0x36), INTEST_DATA(0x45), INTEST_DATA(0x06), INTEST_DATA(0x16),
+    INTEST_DATA(0x37), INTEST_DATA(0x75), INTEST_DATA(0x77), INTEST_DATA(0x54), INTEST_DATA(0x0C), INTEST_DATA(0x00),
+    INTEST_CMD(0x36), INTEST_DATA(0x0A),
+    INTEST_CMD(0x3A), INTEST_DATA(INTEST_COLMOD_16BIT_DBI),
+    INTEST_CMD(0x2A), INTEST_DATA(0x00), INTEST_DATA(0x00), INTEST_DATA(0x01), INTEST_DATA(0x3F),
+    INTEST_CMD(0x2B), INTEST_DATA(0x00), INTEST_DATA(0x00), INTEST_DATA(0x01), INTEST_DATA(0xDF), INTEST_DELAY(120),
+    INTEST_CMD(0x29), INTEST_DELAY(25),
+};
+
+/**
+ * @brief Expected sequence of the ILI9481.
+ */
+static const u32 INTEST_ILI9481[] =
+{
+    INTEST_DELAY(5), INTEST_RESET, INTEST_DELAY(15), INTEST_DELAY(15),
+    INTEST_CMD(0x11), INTEST_DELAY(20),
+    INTEST_CMD(0xD0), INTEST_DATA(0x07), INTEST_DATA(0x42), INTEST_DATA(0x18),
+    INTEST_CMD(0xD1), INTEST_DATA(0x00), INTEST_DATA(0x07), INTEST_DATA(0x10),
+    INTEST_CMD(0xD2), INTEST_DATA(0x01), INTEST_DATA(0x02),
+    INTEST_CMD(0xC0), INTEST_DATA(0x10), INTEST_DATA(0x3B), INTEST_DATA(0x00), INTEST_DATA(0x02), INTEST_DATA(0x11),
+    INTEST_CMD(0xC5), INTEST_DATA(0x03),
+    INTEST_CMD(0xC8), INTEST_DATA(0x00), INTEST_DATA(0x32), INTEST_DATA(0x36), INTEST_DATA(0x45), INTEST_DATA(0x06), INTEST_DATA(0x16),
+    INTEST_DATA(0x37), INTEST_DATA(0x75), INTEST_DATA(0x77), INTEST_DATA(0x54), INTEST_DATA(0x0C), INTEST_DATA(0x00),
+    INTEST_CMD(0x36), INTEST_DATA(0x0A),
+    INTEST_CMD(0x3A), INTEST_DATA(INTEST_COLMOD_16BIT_DBI),
+    INTEST_CMD(0x2A), INTEST_DATA(0x00), INTEST_DATA(0x00), INTEST_DATA(0x01), INTEST_DATA(0x3F),
+    INTEST_CMD(0x2B), INTEST_DATA(0x00), INTEST_DATA(0x00), INTEST_DATA(0x01), INTEST_DATA(0xE0), INTEST_DELAY(120),
+    INTEST_CMD(0x29),
+};
+
+/**
+ * @brief The ILI9481 on the 16-bit parallel bus, D0-D15 on port B and WR on A4.
+ */
+static const TEST_Panel_t INTEST_ParallelPanel =
+{
+    "ILI9481-parallel", { {0, 2}, {0, 3}, {0, 7}, {0, 1}, &TFT_ILI9481_Controller, TFT_BUS_PARALLEL_8080, 1, {0, 4} }, TFT_EMU_MOUNT_NORMAL
+};
+
+/**
+ * @brief The recorded log.
+ */
+static u32 INTEST_Log[INTEST_LOG_SIZE];
+
+/**
+ * @brief Runs TFT_Init on a panel and checks what the controller received.
+ */
+static void INTEST_Run(const TEST_Panel_t *Copy_Panel, const u32 *Copy_Expected, u32 Copy_ExpectedCount);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static void INTEST_Run(const TEST_Panel_t *Copy_Panel, const u32 *Copy_Expected, u32 Copy_ExpectedCount)
+{
+    const TFT_Controller_t *Local_Controller = Copy_Panel->Config.TFT_Controller;
+    TFT_EMU_Stats_t Local_Stats;
+    u32 Local_Count;
+    u32 Local_Index;
+
+    TFT_EMU_Attach(&Copy_Panel->Config, Local_Controller->TFT_Width, Local_Controller->TFT_Height, Copy_Panel->Mounting);
+    TFT_EMU_StartLog(INTEST_Log, INTEST_LOG_SIZE);
+    TFT_Init(&Copy_Panel->Config, SPI_SelectSpiPeripheral(SPI1));
+    Local_Count = TFT_EMU_StopLog();
+    TFT_EMU_GetStats(&Local_Stats);
+
+    /**< First entry that differs, or the end of the shorter sequence */
+    for (Local_Index = 0; (Local_Index < Local_Count) && (Local_Index < Copy_ExpectedCount); Local_Index++)
+    {
+        if (INTEST_Log[Local_Index] != Copy_Expected[Local_Index])
+        {
+            break;
+        }
+    }
+
+    TEST_Check((Local_Count == Copy_ExpectedCount) && (Local_Index == Copy_ExpectedCount),
+               "%s: %u entries received (%u expected), the first %u as expected",
+               Copy_Panel->Name, Local_Count, Copy_ExpectedCount, Local_Index);
+    TEST_Check(Local_Stats.Errors == 0, "%s: %u protocol errors", Copy_Panel->Name, Local_Stats.Errors);
+}
+
+int main(int argc, char **argv)
+{
+    TEST_Init(argc, argv);
+
+    INTEST_Run(&TEST_Panels[0], INTEST_ST7735S, sizeof(INTEST_ST7735S) / sizeof(INTEST_ST7735S[0]));
+    INTEST_Run(&TEST_Panels[1], INTEST_HX8357B, sizeof(INTEST_HX8357B) / sizeof(INTEST_HX8357B[0]));
+    INTEST_Run(&TEST_Panels[2], INTEST_ILI9481, sizeof(INTEST_ILI9481) / sizeof(INTEST_ILI9481[0]));
+    INTEST_Run(&INTEST_ParallelPanel, INTEST_ILI9481, sizeof(INTEST_ILI9481) / sizeof(INTEST_ILI9481[0]));
+
+    return TEST_Finish();
+}
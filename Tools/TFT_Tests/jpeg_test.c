@@ -0,0 +1,685 @@
+/**
+ * @file jpeg_test.c
+ * @brief Host tests of the output and the clipping of the JPEG decoder on every controller.
+ *
+ * Small 4:4:4 and 4:2:0 pictures, one of them with restart markers, are drawn at every scale
+ * and compared with the output of libjpeg: exactly, except for 4:2:0 at reduced scales whose
+ * chroma libjpeg computes at a higher resolution (see JPGTEST_MAX_SCALED_ERROR).
+ *
+ * A 200x120 4:2:0 photo (12.5 x 7.5 MCUs) is drawn at every scale with its bottom-right part
+ * off the screen of each panel. The reference is the same photo drawn whole on a panel large
+ * enough: the visible part must match it pixel for pixel, the rest of the screen must be
+ * untouched, and no pixel may be written outside the screen. The number of address windows
+ * is checked too: one per visible MCU, or at 1/8 one per strip of MCUs.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     jpeg_test
+ */
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "JPEG_config.h"
+#include "JPEG_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Side of the MCUs of the photo at full scale, and width of the strips at 1/8
+ * (JPEG_t.Pixels over the MCU height).
+ */
+#define JPGTEST_MCU_SIDE            16
+#define JPGTEST_STRIP_WIDTH         128
+
+/**
+ * @brief Largest difference from libjpeg of a color channel (0-255) for the 4:2:0 picture
+ * at 1/2, 1/4 and 1/8 (33, 33 and 42 measured). At reduced scales libjpeg decodes the
+ * subsampled chroma with a larger IDCT, so that it needs no upsampling (jdmaster.c), where
+ * the decoder computes it at the scale of the luma and replicates it: its output is the luma
+ * of libjpeg at 1/N with the chroma of libjpeg at 1/2N. Full size and 4:4:4 at every scale
+ * match libjpeg exactly.
+ */
+#define JPGTEST_MAX_SCALED_ERROR    42
+
+/**
+ * @brief The photo: flat 8x8 luma blocks and flat chroma per MCU, all different, so a block
+ * drawn at the wrong place shows (libjpeg q75, optimized Huffman tables).
+ */
+static const u8 JPGTEST_Photo[] =
+{
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08,
+    0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0A, 0x0C, 0x14, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x19, 0x12,
+    0x13, 0x0F, 0x14, 0x1D, 0x1A, 0x1F, 0x1E, 0x1D, 0x1A, 0x1C, 0x1C, 0x20, 0x24, 0x2E, 0x27, 0x20,
+    0x22, 0x2C, 0x23, 0x1C, 0x1C, 0x28, 0x37, 0x29, 0x2C, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1F, 0x27,
+    0x39, 0x3D, 0x38, 0x32, 0x3C, 0x2E, 0x33, 0x34, 0x32, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x09, 0x09,
+    0x09, 0x0C, 0x0B, 0x0C, 0x18, 0x0D, 0x0D, 0x18, 0x32, 0x21, 0x1C, 0x21, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xFF, 0xC0,
+    0x00, 0x11, 0x08, 0x00, 0x78, 0x00, 0xC8, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xFF, 0xC4, 0x00, 0x19, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x08, 0x00, 0x05, 0x07, 0xFF, 0xC4, 0x00, 0x14,
+    0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xC4, 0x00, 0x17, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x07, 0xFF, 0xC4, 0x00, 0x14, 0x11,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xF9,
+    0x39, 0x2A, 0x12, 0x56, 0x5D, 0x97, 0x5C, 0x4A, 0x84, 0x95, 0x68, 0xC5, 0xCC, 0xE0, 0xD4, 0xCC,
+    0xE0, 0xB4, 0x5A, 0xE2, 0x54, 0x24, 0xAB, 0x26, 0x2E, 0x25, 0x42, 0x4A, 0xC4, 0x96, 0xCB, 0x24,
+    0xA8, 0x49, 0x56, 0x8C, 0x5C, 0x4A, 0x84, 0x95, 0x68, 0xB5, 0xCC, 0xE0, 0x84, 0x95, 0x88, 0x73,
+    0xB5, 0xC4, 0xA8, 0x49, 0x56, 0x8B, 0x5C, 0x4A, 0x85, 0x9C, 0x16, 0x8C, 0x5C, 0x4A, 0x84, 0x95,
+    0x89, 0x31, 0x71, 0x2A, 0x12, 0x55, 0xA2, 0xD7, 0x39, 0x98, 0x9C, 0xB2, 0x61, 0x19, 0x2A, 0x12,
+    0x56, 0x11, 0x01, 0x71, 0x2A, 0x16, 0x70, 0x5A, 0x2D, 0x71, 0x2A, 0x12, 0x55, 0x93, 0x17, 0x12,
+    0xA1, 0x25, 0x62, 0x4B, 0x5C, 0xCE, 0x08, 0x49, 0x56, 0x8C, 0x5C, 0x4A, 0x84, 0x95, 0x69, 0xCE,
+    0x97, 0x12, 0xA1, 0x67, 0x06, 0x20, 0xC5, 0xC4, 0xA8, 0x49, 0x56, 0x8B, 0x5C, 0x4A, 0x84, 0x95,
+    0x68, 0xC5, 0xCC, 0xE0, 0x84, 0x95, 0x89, 0x31, 0x71, 0x2A, 0x12, 0x55, 0xA2, 0xD7, 0x12, 0xA1,
+    0x67, 0x05, 0x93, 0x17, 0x39, 0xEB, 0xB9, 0x69, 0xCE, 0x88, 0xC9, 0x50, 0x92, 0xB0, 0x8D, 0x8A,
+    0xE6, 0x70, 0x42, 0x4A, 0xB2, 0x62, 0xE2, 0x54, 0x24, 0xAB, 0x45, 0xAE, 0x25, 0x42, 0xCE, 0x0C,
+    0x4B, 0x9D, 0xAE, 0x25, 0x42, 0x4A, 0xB4, 0x5A, 0xE2, 0x54, 0x24, 0xAB, 0x26, 0x2E, 0x67, 0x04,
+    0x24, 0xAC, 0x49, 0x6B, 0x89, 0x50, 0x92, 0xAD, 0x18, 0xB9, 0x9C, 0x1A, 0x99, 0x9C, 0x16, 0x8C,
+    0x5C, 0x4A, 0x84, 0x95, 0x89, 0x2D, 0x71, 0x2A, 0x12, 0x55, 0x97, 0x3B, 0x65, 0x92, 0x54, 0x24,
+    0xAB, 0x45, 0xAE, 0x73, 0xD7, 0x73, 0x12, 0x61, 0x19, 0x2A, 0x16, 0x70, 0x54, 0x40, 0x5C, 0x4A,
+    0x84, 0x95, 0x68, 0xB5, 0xC4, 0xA8, 0x49, 0x58, 0x93, 0x19, 0x64, 0x95, 0x09, 0x2A, 0xD1, 0x6B,
+    0x89, 0x50, 0x92, 0xAC, 0x98, 0xB9, 0x9C, 0x1A, 0x99, 0x9C, 0x16, 0x8B, 0x5C, 0x4A, 0x84, 0x95,
+    0x89, 0x31, 0x71, 0x2A, 0x12, 0x55, 0xA7, 0x3B, 0x65, 0x92, 0x54, 0x24, 0xAB, 0x45, 0xAE, 0x25,
+    0x42, 0x4A, 0xC4, 0x18, 0xB9, 0x9C, 0x10, 0x92, 0xAD, 0x16, 0xB8, 0x95, 0x09, 0x2A, 0xD1, 0x8B,
+    0x9C, 0xF5, 0xDC, 0xC4, 0x96, 0xCD, 0xC4, 0xA8, 0x49, 0x55, 0x10, 0x17, 0x12, 0xA1, 0x25, 0x5A,
+    0x31, 0x73, 0x38, 0x35, 0x33, 0x38, 0x31, 0x25, 0xAE, 0x25, 0x42, 0x4A, 0xB2, 0x62, 0xE2, 0x54,
+    0x2C, 0xE0, 0xB4, 0x5A, 0xE2, 0x54, 0x24, 0xAC, 0x4B, 0x9D, 0xAE, 0x25, 0x42, 0x4A, 0xB4, 0x62,
+    0xE6, 0x70, 0x42, 0x4A, 0xB4, 0x5A, 0xE2, 0x54, 0x24, 0xAC, 0x41, 0x8B, 0x89, 0x50, 0xB3, 0x82,
+    0xD1, 0x6B, 0x89, 0x50, 0x92, 0xAD, 0x18, 0xB8, 0x95, 0x09, 0x2B, 0x12, 0x5A, 0xE7, 0x33, 0x13,
+    0x96, 0x5C, 0xEC, 0x8C, 0x95, 0x09, 0x2A, 0xAB, 0x62, 0xB8, 0x95, 0x0B, 0x38, 0x2D, 0x16, 0xB8,
+    0x95, 0x09, 0x2B, 0x10, 0xE7, 0x6B, 0x89, 0x50, 0x92, 0xAD, 0x16, 0xB9, 0x9C, 0x10, 0x92, 0xAD,
+    0x18, 0xB8, 0x95, 0x09, 0x2B, 0x12, 0x62, 0xE2, 0x54, 0x2C, 0xE0, 0xB4, 0x5A, 0xE2, 0x54, 0x24,
+    0xAB, 0x26, 0x2E, 0x25, 0x42, 0x4A, 0xC4, 0x96, 0xB9, 0x9C, 0x10, 0x92, 0xAD, 0x39, 0xDA, 0xE2,
+    0x54, 0x24, 0xAB, 0x45, 0xAE, 0x67, 0x06, 0xA6, 0x67, 0x06, 0x20, 0xC5, 0xCE, 0x7A, 0xEE, 0x5A,
+    0x2C, 0x8C, 0x95, 0x09, 0x2A, 0xAA, 0x02, 0xE6, 0x70, 0x42, 0x4A, 0xC4, 0x18, 0xB8, 0x95, 0x09,
+    0x2A, 0xD1, 0x6B, 0x89, 0x50, 0xB3, 0x82, 0xD1, 0x8B, 0x89, 0x50, 0x92, 0xB1, 0x26, 0x2E, 0x25,
+    0x42, 0x4A, 0xB4, 0x5B, 0x2C, 0x92, 0xA1, 0x25, 0x59, 0x31, 0x71, 0x2A, 0x12, 0x55, 0xA7, 0x3A,
+    0x5C, 0xCE, 0x0D, 0x4C, 0xCE, 0x0C, 0x49, 0x8B, 0x89, 0x50, 0x92, 0xAD, 0x16, 0xB8, 0x95, 0x09,
+    0x2A, 0xC9, 0x8C, 0xB2, 0x4A, 0x84, 0x95, 0x89, 0x2D, 0x73, 0x9E, 0xBB, 0x96, 0x8C, 0x23, 0x25,
+    0x73, 0x95, 0x10, 0x19, 0xC0, 0x95, 0xCE, 0x62, 0x4B, 0x25, 0x25, 0x73, 0x96, 0x8C, 0x67, 0x02,
+    0x57, 0x39, 0x68, 0xC2, 0x52, 0x57, 0x39, 0x89, 0x2C, 0x95, 0x9C, 0x1C, 0xE5, 0x97, 0x3B, 0x25,
+    0x25, 0x73, 0x96, 0x8B, 0x25, 0x25, 0x73, 0x98, 0x93, 0x19, 0xC0, 0x95, 0xCE, 0x5A, 0x2C, 0x94,
+    0x95, 0xCE, 0x59, 0x30, 0x95, 0x9C, 0x1C, 0xE6, 0x24, 0xB2, 0x52, 0x57, 0x39, 0x69, 0xCE, 0xC9,
+    0x5C, 0xE7, 0x2D, 0x18, 0xFF, 0xD9
+};
+
+/**
+ * @brief 37x23 pictures (color gradients, a disc, a box, a white line and some noise) coded
+ * by libjpeg-turbo 2.1.5 at q75 with optimized Huffman tables: 4:4:4 with a red disc and a
+ * blue box, then 4:2:0 with a darker disc and box, so that its chroma stays smooth, without
+ * and with a restart marker every 2 MCUs (inside and at the end of MCU rows).
+ */
+static const u8 JPGTEST_Small444[] =
+{    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08,
+    0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0A, 0x0C, 0x14, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x19, 0x12,
+    0x13, 0x0F, 0x14, 0x1D, 0x1A, 0x1F, 0x1E, 0x1D, 0x1A, 0x1C, 0x1C, 0x20, 0x24, 0x2E, 0x27, 0x20,
+    0x22, 0x2C, 0x23, 0x1C, 0x1C, 0x28, 0x37, 0x29, 0x2C, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1F, 0x27,
+    0x39, 0x3D, 0x38, 0x32, 0x3C, 0x2E, 0x33, 0x34, 0x32, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x09, 0x09,
+    0x09, 0x0C, 0x0B, 0x0C, 0x18, 0x0D, 0x0D, 0x18, 0x32, 0x21, 0x1C, 0x21, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xFF, 0xC0,
+    0x00, 0x11, 0x08, 0x00, 0x17, 0x00, 0x25, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xFF, 0xC4, 0x00, 0x18, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x02, 0x06, 0xFF, 0xC4, 0x00, 0x2F, 0x10,
+    0x00, 0x00, 0x04, 0x03, 0x05, 0x07, 0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x04, 0x11, 0x00, 0x03, 0x05, 0x06, 0x12, 0x13, 0x21, 0x31, 0x14, 0x22, 0x32, 0x43,
+    0x51, 0x61, 0xD2, 0x81, 0x95, 0x16, 0x41, 0x42, 0x75, 0x91, 0x94, 0xD1, 0xFF, 0xC4, 0x00, 0x18,
+    0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x03, 0x04, 0x06, 0x07, 0xFF, 0xC4, 0x00, 0x2F, 0x11, 0x00, 0x01, 0x03, 0x03, 0x01,
+    0x05, 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x11, 0x03,
+    0x04, 0x21, 0x12, 0x05, 0x31, 0x41, 0x51, 0x91, 0x13, 0x61, 0x71, 0xD1, 0xF0, 0xF1, 0x14, 0x15,
+    0x22, 0x33, 0x72, 0x92, 0xA1, 0xB1, 0xC1, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11,
+    0x03, 0x11, 0x00, 0x3F, 0x00, 0x92, 0x4B, 0x2C, 0xB0, 0x39, 0xB4, 0xEF, 0x72, 0x4F, 0xE7, 0x1A,
+    0xAA, 0x97, 0xAD, 0x3C, 0xFA, 0x1F, 0x25, 0x42, 0x93, 0x88, 0xE5, 0xD4, 0x26, 0x09, 0x66, 0x15,
+    0x87, 0x36, 0x9F, 0xEE, 0x29, 0xFC, 0xE2, 0x85, 0x4B, 0xB0, 0x7D, 0x8A, 0x46, 0x95, 0x58, 0x46,
+    0xF8, 0x75, 0x44, 0xBE, 0x29, 0xD4, 0xF7, 0xFB, 0x8A, 0x7F, 0x38, 0x36, 0xBD, 0xE0, 0x18, 0xF5,
+    0xFC, 0xA6, 0x6D, 0x1A, 0xFA, 0xB9, 0x68, 0x31, 0xCE, 0x1C, 0x47, 0x86, 0x01, 0x46, 0x93, 0x41,
+    0x9E, 0x61, 0x00, 0xC5, 0x40, 0x06, 0xE8, 0x15, 0x04, 0xE2, 0xFF, 0x00, 0x83, 0xC5, 0x17, 0x5C,
+    0x6A, 0xF7, 0x09, 0x27, 0x13, 0x47, 0x30, 0x48, 0xFC, 0x5C, 0x3A, 0xC8, 0x4D, 0x96, 0xCE, 0x29,
+    0x6E, 0x34, 0x3F, 0xBB, 0x27, 0xCE, 0x2A, 0xBA, 0xA1, 0x9D, 0xE3, 0xA8, 0xF3, 0x53, 0x32, 0xF5,
+    0x80, 0x71, 0xFD, 0x5D, 0xE4, 0xA0, 0x29, 0x9C, 0x92, 0x9F, 0x73, 0x6A, 0x99, 0x87, 0x7D, 0xEE,
+    0xEE, 0x88, 0xBB, 0x6B, 0xA0, 0x77, 0x8D, 0x6D, 0x3A, 0x55, 0xEE, 0xA7, 0xB1, 0x13, 0x1D, 0xE3,
+    0xFD, 0x5C, 0xAA, 0xDD, 0xCE, 0x76, 0xE4, 0xC5, 0x3E, 0x7A, 0x4A, 0x85, 0xFD, 0x96, 0x6E, 0x26,
+    0x1B, 0x5E, 0xDD, 0x10, 0x67, 0x76, 0xD4, 0x3B, 0x41, 0xF7, 0xF4, 0x2E, 0x2D, 0x63, 0xB7, 0x6C,
+    0x4E, 0xEC, 0x83, 0xFD, 0x14, 0x95, 0x37, 0x96, 0xEF, 0x4B, 0xAE, 0x96, 0x69, 0x4A, 0xCE, 0x53,
+    0x03, 0x68, 0x21, 0x93, 0x38, 0x34, 0x67, 0x6A, 0xBB, 0x53, 0xC9, 0x5D, 0x37, 0x61, 0xD4, 0x63,
+    0xEC, 0x59, 0xA3, 0x84, 0xCE, 0x67, 0x32, 0x7D, 0xE3, 0x91, 0x1E, 0x2B, 0x28, 0xC8, 0x79, 0x8B,
+    0x24, 0x90, 0x81, 0xBC, 0x27, 0x06, 0xC9, 0xFE, 0x71, 0x0B, 0x88, 0x6B, 0x49, 0x29, 0x0B, 0x97,
+    0x35, 0xB4, 0x5C, 0x5D, 0xBA, 0x0A, 0xEC, 0x0A, 0x8F, 0x2D, 0x20, 0xB7, 0xDC, 0x65, 0x66, 0x69,
+    0xD5, 0xC2, 0x83, 0x58, 0xB3, 0x23, 0x59, 0x09, 0x0C, 0xA7, 0x07, 0x0A, 0xF7, 0xD1, 0x79, 0xDD,
+    0xBB, 0x87, 0x48, 0xDF, 0x6C, 0xFD, 0xB7, 0xF0, 0x1A, 0xFE, 0x8D, 0x5A, 0xA3, 0x8C, 0x6E, 0x9E,
+    0xE3, 0xCD, 0x72, 0x8B, 0x3B, 0xBE, 0xCE, 0x71, 0x32, 0x98, 0xB3, 0xF6, 0x60, 0x68, 0xDB, 0x40,
+    0x8A, 0x9C, 0x7C, 0x6B, 0xBC, 0xBB, 0xAC, 0xCF, 0xDC, 0x7A, 0xC5, 0x0D, 0xB7, 0xB7, 0x7E, 0x61,
+    0xA2, 0x19, 0xA7, 0x4C, 0xF1, 0x99, 0x98, 0xEE, 0x1C, 0x92, 0x22, 0xE7, 0x59, 0x18, 0x85, 0x6E,
+    0x6D, 0x29, 0x3A, 0xB2, 0x94, 0xB3, 0xE5, 0x81, 0xC0, 0xA3, 0x96, 0x62, 0x0D, 0xEA, 0x11, 0x97,
+    0xA9, 0x72, 0x46, 0xE4, 0xC5, 0x86, 0xD1, 0xAF, 0x6A, 0x49, 0xA2, 0xE8, 0x9F, 0x5C, 0x51, 0x90,
+    0xD1, 0x13, 0x22, 0x71, 0x93, 0x2D, 0x8E, 0x20, 0x00, 0x26, 0x30, 0xB8, 0x8F, 0xF3, 0xD2, 0x28,
+    0x57, 0xBB, 0x73, 0xB0, 0x52, 0xD5, 0x76, 0xA5, 0xC5, 0xD7, 0xDD, 0x76, 0x39, 0x70, 0xF5, 0xE3,
+    0x2A, 0x91, 0x52, 0x03, 0x41, 0xAF, 0xAF, 0x95, 0x33, 0x2A, 0xE1, 0x7F, 0xFF, 0xD9
+};
+
+static const u8 JPGTEST_Small420[] =
+{    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08,
+    0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0A, 0x0C, 0x14, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x19, 0x12,
+    0x13, 0x0F, 0x14, 0x1D, 0x1A, 0x1F, 0x1E, 0x1D, 0x1A, 0x1C, 0x1C, 0x20, 0x24, 0x2E, 0x27, 0x20,
+    0x22, 0x2C, 0x23, 0x1C, 0x1C, 0x28, 0x37, 0x29, 0x2C, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1F, 0x27,
+    0x39, 0x3D, 0x38, 0x32, 0x3C, 0x2E, 0x33, 0x34, 0x32, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x09, 0x09,
+    0x09, 0x0C, 0x0B, 0x0C, 0x18, 0x0D, 0x0D, 0x18, 0x32, 0x21, 0x1C, 0x21, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xFF, 0xC0,
+    0x00, 0x11, 0x08, 0x00, 0x17, 0x00, 0x25, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xFF, 0xC4, 0x00, 0x18, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xC4, 0x00, 0x2E, 0x10,
+    0x00, 0x00, 0x05, 0x02, 0x02, 0x06, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x11, 0x03, 0x05, 0x12, 0x13, 0x06, 0x21, 0x22, 0x32, 0x42, 0x61, 0x15,
+    0x23, 0x31, 0x41, 0x43, 0x51, 0x71, 0x81, 0x95, 0xD1, 0xD2, 0x94, 0xFF, 0xC4, 0x00, 0x17, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x06, 0x04, 0x07, 0xFF, 0xC4, 0x00, 0x20, 0x11, 0x00, 0x02, 0x01, 0x04, 0x01, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x01, 0x03, 0x11, 0x41,
+    0x51, 0x05, 0x31, 0x61, 0x91, 0xE1, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03,
+    0x11, 0x00, 0x3F, 0x00, 0xC9, 0x46, 0x8B, 0x3C, 0x2F, 0x16, 0xDD, 0xF2, 0x4D, 0xFF, 0x00, 0x62,
+    0xC2, 0x34, 0x61, 0xD9, 0x78, 0xB6, 0xFF, 0x00, 0x91, 0x6F, 0xFB, 0x10, 0xD6, 0x53, 0x76, 0x78,
+    0x33, 0xD7, 0x83, 0x1C, 0xC6, 0xC9, 0x9C, 0xC7, 0xA0, 0xB4, 0xC9, 0x4D, 0xDE, 0x62, 0xC8, 0x5E,
+    0x3C, 0x31, 0x3B, 0x26, 0x51, 0x3E, 0xA1, 0x76, 0x5F, 0x2D, 0xD6, 0x1C, 0xAB, 0x74, 0xD4, 0x8A,
+    0xBD, 0x9E, 0xA3, 0x48, 0x2A, 0x95, 0xED, 0xD8, 0xCF, 0x87, 0xA4, 0xDB, 0x11, 0xC7, 0x9E, 0xD5,
+    0x42, 0xD5, 0xA8, 0x4A, 0xC6, 0xD9, 0x51, 0xC9, 0x92, 0x0E, 0xAD, 0xB9, 0x15, 0x4C, 0xB7, 0x4A,
+    0xE8, 0xD9, 0x52, 0x7D, 0xF1, 0x86, 0xA1, 0xF6, 0x0E, 0x6E, 0xF4, 0xC5, 0x69, 0xBC, 0x56, 0x35,
+    0x96, 0xF4, 0x1A, 0x4F, 0x0C, 0x11, 0x94, 0x17, 0xD4, 0x7B, 0x05, 0xB1, 0x8A, 0xD7, 0x71, 0x6C,
+    0x54, 0xD3, 0xB7, 0x98, 0x93, 0x2D, 0x99, 0x22, 0xD7, 0x33, 0x1E, 0x40, 0x06, 0x5F, 0xF3, 0x29,
+    0x55, 0x6A, 0xBA, 0xAC, 0xED, 0xD3, 0xA3, 0x8E, 0x63, 0x7D, 0x8F, 0xF6, 0xD1, 0xFD, 0x80, 0xBE,
+    0x96, 0x7A, 0xBB, 0x00, 0x0E, 0x5D, 0x42, 0x99, 0x8D, 0x8B, 0x27, 0x8E, 0xF4, 0xF5, 0xF6, 0x64,
+    0xBF, 0xB1, 0x74, 0x8E, 0x57, 0x5B, 0x97, 0x82, 0x78, 0x66, 0x66, 0x39, 0xF2, 0x16, 0x6D, 0x36,
+    0x32, 0xB7, 0xE6, 0x75, 0xB9, 0x99, 0x91, 0xC3, 0x11, 0x13, 0xCF, 0x98, 0x00, 0xDA, 0xCD, 0xD3,
+    0xE6, 0x71, 0xF5, 0x2E, 0x14, 0xD1, 0xAF, 0x67, 0x6C, 0xF5, 0x09, 0x4B, 0x8A, 0x45, 0x50, 0x92,
+    0x72, 0x5A, 0xCC, 0x8C, 0xBD, 0xC8, 0x4D, 0x6F, 0xB1, 0x34, 0x63, 0x27, 0x42, 0x94, 0x2C, 0xC8,
+    0x89, 0x4A, 0x51, 0xC9, 0x9F, 0xD7, 0xB0, 0x00, 0x9E, 0x66, 0xE9, 0xF3, 0x29, 0xD4, 0xB8, 0x53,
+    0x4D, 0x2D, 0x0A, 0x00, 0x00, 0x0C, 0x57, 0x4B, 0x31, 0xE1, 0x32, 0xC4, 0xFF, 0xD9
+};
+
+static const u8 JPGTEST_Small420Restart[] =
+{    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08,
+    0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0A, 0x0C, 0x14, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x19, 0x12,
+    0x13, 0x0F, 0x14, 0x1D, 0x1A, 0x1F, 0x1E, 0x1D, 0x1A, 0x1C, 0x1C, 0x20, 0x24, 0x2E, 0x27, 0x20,
+    0x22, 0x2C, 0x23, 0x1C, 0x1C, 0x28, 0x37, 0x29, 0x2C, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1F, 0x27,
+    0x39, 0x3D, 0x38, 0x32, 0x3C, 0x2E, 0x33, 0x34, 0x32, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x09, 0x09,
+    0x09, 0x0C, 0x0B, 0x0C, 0x18, 0x0D, 0x0D, 0x18, 0x32, 0x21, 0x1C, 0x21, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xFF, 0xC0,
+    0x00, 0x11, 0x08, 0x00, 0x17, 0x00, 0x25, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xFF, 0xC4, 0x00, 0x18, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0xFF, 0xC4, 0x00, 0x2E, 0x10,
+    0x00, 0x00, 0x05, 0x02, 0x02, 0x06, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x11, 0x03, 0x05, 0x12, 0x13, 0x06, 0x21, 0x22, 0x32, 0x42, 0x61, 0x15,
+    0x23, 0x31, 0x41, 0x43, 0x51, 0x71, 0x81, 0x95, 0xD1, 0xD2, 0x94, 0xFF, 0xC4, 0x00, 0x17, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x06, 0x04, 0x07, 0xFF, 0xC4, 0x00, 0x20, 0x11, 0x00, 0x02, 0x01, 0x04, 0x01, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x01, 0x03, 0x11, 0x41,
+    0x51, 0x05, 0x31, 0x61, 0x91, 0xE1, 0xFF, 0xDD, 0x00, 0x04, 0x00, 0x02, 0xFF, 0xDA, 0x00, 0x0C,
+    0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xC9, 0x46, 0x8B, 0x3C, 0x2F, 0x16,
+    0xDD, 0xF2, 0x4D, 0xFF, 0x00, 0x62, 0xC2, 0x34, 0x61, 0xD9, 0x78, 0xB6, 0xFF, 0x00, 0x91, 0x6F,
+    0xFB, 0x10, 0xD6, 0x53, 0x76, 0x78, 0x33, 0xD7, 0x83, 0x1C, 0xC6, 0xC9, 0x9C, 0xC7, 0xA0, 0xB4,
+    0xC9, 0x4D, 0xDE, 0x62, 0xC8, 0x5E, 0x3C, 0x31, 0x3B, 0x26, 0x51, 0x3E, 0xA1, 0x76, 0x5F, 0x2D,
+    0xD6, 0x1C, 0xAB, 0x74, 0xD4, 0x8A, 0xBD, 0x9E, 0xA3, 0x48, 0x2A, 0x95, 0xED, 0xD8, 0xCF, 0x87,
+    0xA4, 0xDB, 0x11, 0xC7, 0x9E, 0xD5, 0x42, 0xD5, 0xA8, 0x4A, 0xC6, 0xD9, 0x51, 0xC9, 0x92, 0x0E,
+    0xAD, 0xB9, 0x15, 0x4C, 0xB7, 0x4A, 0xE8, 0xD9, 0x52, 0x7D, 0xF1, 0x86, 0xA1, 0xF6, 0x0E, 0x6E,
+    0xF4, 0xC5, 0x69, 0xBC, 0x56, 0x35, 0x96, 0xF4, 0x1A, 0x4F, 0x0C, 0x11, 0x94, 0x17, 0xD4, 0x7B,
+    0x05, 0xB1, 0x8A, 0xD7, 0x71, 0x6C, 0x54, 0xD3, 0xB7, 0x98, 0x93, 0x2D, 0x99, 0x22, 0xD7, 0x33,
+    0x1E, 0x40, 0x06, 0x5F, 0xF3, 0x29, 0x55, 0x6A, 0xBA, 0xAC, 0xFF, 0xD0, 0xB2, 0x9D, 0x1C, 0x73,
+    0x1B, 0xEC, 0x7F, 0xB6, 0x8F, 0xEC, 0x05, 0xF4, 0xB3, 0xD5, 0xD8, 0x02, 0x7C, 0xBA, 0x85, 0x33,
+    0x2B, 0xC5, 0x93, 0xC7, 0x7A, 0x7A, 0xFB, 0x32, 0x5F, 0xD8, 0xBA, 0x47, 0x2B, 0xAD, 0xCB, 0xC1,
+    0x3C, 0x33, 0x33, 0x1C, 0xF9, 0x0B, 0x36, 0x9B, 0x19, 0x5B, 0xF3, 0x3A, 0xDC, 0xCC, 0xC8, 0xE1,
+    0x88, 0x89, 0xE7, 0xCC, 0x00, 0x6D, 0x66, 0xE9, 0xF3, 0x38, 0xFA, 0x97, 0x0A, 0x7F, 0xFF, 0xD1,
+    0xDC, 0xAF, 0x67, 0x6C, 0xF5, 0x09, 0x4B, 0x8A, 0x45, 0x50, 0x92, 0x72, 0x5A, 0xCC, 0x8C, 0xBD,
+    0xC8, 0x4D, 0x6F, 0xB1, 0x34, 0x63, 0x27, 0x42, 0x94, 0x2C, 0xC8, 0x89, 0x4A, 0x51, 0xC9, 0x9F,
+    0xD7, 0xB0, 0x00, 0x8B, 0x66, 0xE9, 0xF3, 0x32, 0xA9, 0x70, 0xA6, 0x9A, 0x5A, 0x14, 0x00, 0x00,
+    0x18, 0xAE, 0x96, 0x63, 0xC2, 0x65, 0x89, 0xFF, 0xD9
+};
+
+/**
+ * @brief The pictures decoded by libjpeg-turbo at every scale (djpeg -dct int -nosmooth
+ * -scale 1/N) and truncated to RGB565, one scale after the other. The 4:2:0 file with
+ * restarts decodes to the 4:2:0 reference.
+ */
+static const u16 JPGTEST_Expected444[] =
+{
+    /**< 1, 37x23 */
+    0x21F9, 0x21F9, 0x29F9, 0x2A18, 0x31F7, 0x3A17, 0x41F6, 0x41F6, 0x49F5, 0x51F5, 0x51F5, 0x59F4,
+    0x61F3, 0x69F3, 0x71F3, 0x71F2, 0x79F3, 0x9193, 0x9193, 0x81D2, 0x81F1, 0x99B0, 0xA1CF, 0x8A2E,
+    0xA1AF, 0x99CF, 0x91EE, 0xA1CE, 0xB9AE, 0xC9CE, 0xBA0D, 0xB22D, 0xC1CC, 0xC1EC, 0xC9CB, 0xD1CB,
+    0xD9CB, 0x31F8, 0x31F8, 0x39F8, 0x39F7, 0x41F7, 0x49F6, 0x51F6, 0x51F6, 0x5216, 0x5216, 0x5A15,
+    0x6215, 0x6A14, 0x7214, 0x7213, 0x7A13, 0x7270, 0x6A90, 0x6A91, 0x7272, 0x7A52, 0x8A32, 0x9212,
+    0xA1F2, 0x9A70, 0xAA50, 0xBA0F, 0xBA0E, 0xB20D, 0xB22D, 0xC1EC, 0xD1CD, 0xC20C, 0xCA0C, 0xD20B,
+    0xD20B, 0xDA0B, 0x2A57, 0x2A56, 0x3256, 0x3256, 0x3A55, 0x4255, 0x4A54, 0x4A54, 0x5216, 0x5216,
+    0x5216, 0x5A15, 0x6215, 0x6A14, 0x7214, 0x7214, 0x89B4, 0x7214, 0x7A33, 0x91F2, 0x9A10, 0x8A6E,
+    0x8A8D, 0xA22C, 0x99EC, 0xA9EC, 0xBA0C, 0xB22C, 0xA24B, 0xAA4B, 0xC24B, 0xDA4C, 0xCA6D, 0xD24D,
+    0xD24C, 0xDA4C, 0xE24C, 0x3279, 0x3A79, 0x3A78, 0x4278, 0x4277, 0x4A77, 0x5277, 0x5277, 0x52B2,
+    0x5AB2, 0x5AB2, 0x62B1, 0x6AB1, 0x72B1, 0x72B0, 0x72B0, 0x7A91, 0x7AB1, 0x8A91, 0xA251, 0xA251,
+    0x92B0, 0x8AD0, 0x92AF, 0xA270, 0x9AD0, 0x9331, 0x9AF0, 0xB26F, 0xC20F, 0xCA0F, 0xCA2F, 0xBA89,
+    0xC289, 0xC289, 0xCA89, 0xCA88, 0x1AD6, 0x22D6, 0x22D6, 0x2AD5, 0x2AD5, 0x32D4, 0x32D4, 0x3AD4,
+    0x52B4, 0x5AB4, 0x5AB4, 0x62B3, 0x62B3, 0x6AB3, 0x6AB2, 0x6AB2, 0x7AD0, 0x82B0, 0x82CF, 0x7B0F,
+    0x830E, 0x92AE, 0x9A8E, 0x92AD, 0xD16A, 0xC1EA, 0xB26B, 0xB2CB, 0xBACC, 0xC2EC, 0xB30C, 0xA32C,
+    0xCAAC, 0xD2AC, 0xD2AB, 0xDAAB, 0xDAAB, 0x32F7, 0x32F7, 0x32F6, 0x3AF6, 0x3AF6, 0x42F6, 0x42F5,
+    0x4AF5, 0x52D4, 0x5AD4, 0x5AF3, 0x62D3, 0x62D3, 0x62D3, 0x6AD2, 0x6AD2, 0x7AD3, 0x8A92, 0x82D0,
+    0x732E, 0x8ACB, 0xC9CA, 0xF128, 0xF128, 0xD906, 0xE106, 0xE147, 0xD1E8, 0xBAA9, 0xAB29, 0xAB2A,
+    0xB309, 0xD2AA, 0xDAAA, 0xDAA9, 0xE2A9, 0xE2A9, 0xF7BF, 0xF7BF, 0xFFBF, 0xFFBF, 0xFFBF, 0xFFBE,
+    0xFFBE, 0xFFBE, 0xEFFF, 0xEFFF, 0xEFFF, 0xF7FF, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF,
+    0xFFFE, 0xEFFD, 0xEFFD, 0xF7FD, 0xFFBD, 0xFFBD, 0xEFFF, 0xFFFF, 0xFF9F, 0xFF9F, 0xFF9F, 0xF7BF,
+    0xFFBF, 0xFF9F, 0xEFDF, 0xEFFF, 0xEFFF, 0xF7FF, 0xF7FF, 0x2B75, 0x2B75, 0x3375, 0x3375, 0x3375,
+    0x3B74, 0x3B74, 0x3B74, 0x5B52, 0x5B52, 0x5B52, 0x6351, 0x6351, 0x6B51, 0x6B31, 0x6B31, 0x6B90,
+    0x736F, 0xA28D, 0xE16A, 0xF8E8, 0xE127, 0xD946, 0xE126, 0xE905, 0xE146, 0xD966, 0xD966, 0xD966,
+    0xD9E8, 0xCAC9, 0xBB8B, 0xCB68, 0xD368, 0xD368, 0xDB67, 0xDB67, 0x2B97, 0x2336, 0x3397, 0x3355,
+    0x43B4, 0x4372, 0x53D3, 0x4B73, 0x4B92, 0x5BB4, 0x5B95, 0x5B93, 0x63B0, 0x638E, 0x636E, 0x73B1,
+    0x832F, 0x7BAD, 0xE127, 0xE125, 0xF926, 0xE926, 0xE167, 0xE146, 0xE146, 0xD945, 0xF145, 0xE925,
+    0xD946, 0xE126, 0xD985, 0xBBC9, 0xC3A9, 0xCB89, 0xCBA9, 0xD3A8, 0xDB88, 0x3413, 0x2BF3, 0x3C15,
+    0x33B4, 0x43F5, 0x3B74, 0x4BB5, 0x4B76, 0x4BB1, 0x53D1, 0x53D1, 0x5BD1, 0x63F0, 0x6BEF, 0x740F,
+    0x7C10, 0x7410, 0x5CAE, 0xC9E8, 0xE166, 0xF906, 0xC185, 0xE146, 0xF0E6, 0xE126, 0xD945, 0xF145,
+    0xE925, 0xE187, 0xF147, 0xE1A7, 0xCBCA, 0xC3C9, 0xCBC9, 0xD3C9, 0xD3C8, 0xDBC8, 0x23B5, 0x23D5,
+    0x2BF4, 0x2BD2, 0x4432, 0x3C0F, 0x442F, 0x4C4F, 0x5432, 0x4BF0, 0x5410, 0x5BF0, 0x5BB1, 0x6392,
+    0x6BB2, 0x6B90, 0x7BAF, 0x936D, 0xF8A7, 0xE926, 0xD9A6, 0xE0E5, 0xE146, 0xE946, 0xE946, 0xD945,
+    0xE945, 0xE926, 0xD967, 0xE907, 0xE126, 0xCB08, 0xC409, 0xCC09, 0xD3E8, 0xDC08, 0xDBE7, 0x2C57,
+    0x3497, 0x3456, 0x3435, 0x4476, 0x4435, 0x4414, 0x4C33, 0x4C15, 0x4BF1, 0x5C71, 0x6450, 0x6451,
+    0x6C30, 0x7CAF, 0x748C, 0x6C0E, 0xE9CB, 0xE0C5, 0xF865, 0xD1C6, 0xD146, 0xF886, 0xC9C6, 0xF146,
+    0xD925, 0xE945, 0xE126, 0xD947, 0xE8E7, 0xE0E5, 0xCAC7, 0xC428, 0xCC48, 0xD428, 0xD427, 0xDC27,
+    0x2453, 0x2472, 0x2450, 0x3471, 0x3C72, 0x4473, 0x4C71, 0x4C90, 0x5490, 0x544E, 0x64CF, 0x5C4E,
+    0x6471, 0x5BF0, 0x6C51, 0x6C2F, 0x74AF, 0x744C, 0xE906, 0xD945, 0xD9C7, 0xE126, 0xD166, 0xF0E5,
+    0xE906, 0xD925, 0xE925, 0xE126, 0xD967, 0xF127, 0xE966, 0xD368, 0xC468, 0xCC68, 0xD467, 0xD467,
+    0xDC66, 0x2CB6, 0x2CB3, 0x34D2, 0x44F3, 0x3C33, 0x4C54, 0x5473, 0x5470, 0x5C8E, 0x5C8F, 0x64AF,
+    0x542D, 0x754F, 0x6CCC, 0x74ED, 0x6CCD, 0x846E, 0x64CC, 0xF8E6, 0xB1E5, 0xF906, 0xD966, 0xF126,
+    0xD925, 0xE926, 0xD925, 0xE926, 0xE106, 0xD947, 0xE926, 0xE1C5, 0xCC08, 0xC4A7, 0xCCA7, 0xD4A7,
+    0xD4A6, 0xDCA6, 0x2CF5, 0x2CB3, 0x3494, 0x3C18, 0x01B7, 0x093C, 0x111D, 0x08DB, 0x10BF, 0x10DF,
+    0x191F, 0x1157, 0x6456, 0x648E, 0x6CCD, 0x6CEE, 0x940D, 0x74EC, 0xF947, 0xB1E5, 0xE906, 0xF8A6,
+    0xE967, 0xD185, 0xE167, 0xD946, 0xF126, 0xE906, 0xD146, 0xD945, 0xD224, 0xBCC8, 0xCCE7, 0xCCE7,
+    0xD4E6, 0xDCE6, 0xDCE6, 0x3552, 0x2D10, 0x4532, 0x4CB7, 0x0174, 0x00F9, 0x193C, 0x10DA, 0x1118,
+    0x18FC, 0x10DB, 0x1134, 0x74F5, 0x6D2D, 0x6D0C, 0x6CF0, 0x6D4E, 0x7DAE, 0x6CA9, 0xE966, 0xE105,
+    0xD926, 0xF126, 0xD925, 0xE146, 0xD946, 0xF146, 0xF106, 0xD966, 0xE1C6, 0xDAE6, 0xC5C9, 0xCD07,
+    0xCD07, 0xD506, 0xDD06, 0xDD06, 0x3D33, 0x2D52, 0x2D71, 0x3D8E, 0x00DF, 0x18FC, 0x10FB, 0x093A,
+    0x113D, 0x111B, 0x1118, 0x08FC, 0x656C, 0x6530, 0x6D2E, 0x752C, 0x7D0B, 0x7D6C, 0x856D, 0xA46B,
+    0xBAA8, 0xD925, 0xE8C5, 0xF126, 0xE8E6, 0xF127, 0xE905, 0xE904, 0xF205, 0xE3A7, 0xBD27, 0xA627,
+    0xCD46, 0xCD46, 0xD546, 0xD545, 0xDD45, 0x3552, 0x2D92, 0x2DB2, 0x3D6F, 0x08DE, 0x189B, 0x18BB,
+    0x10DA, 0x18FB, 0x18DB, 0x18BB, 0x10DD, 0x6D8C, 0x6DAE, 0x75AD, 0x756E, 0x6DAC, 0x6DEC, 0x760D,
+    0x954C, 0xB3C9, 0xC246, 0xC9A4, 0xC984, 0xD1C6, 0xD985, 0xD143, 0xBA84, 0xBCC9, 0xC62B, 0xC5A8,
+    0xCCC5, 0xCD66, 0xCD66, 0xD565, 0xD565, 0xDD64, 0x2571, 0x25B1, 0x2DB2, 0x3D50, 0x093D, 0x18DA,
+    0x20DA, 0x211B, 0x2119, 0x18BB, 0x18BC, 0x193C, 0x656B, 0x65CB, 0x6DCC, 0x6D6E, 0x8D4C, 0x858C,
+    0x7DCC, 0x8DCC, 0x9D8B, 0xAD4B, 0xAD4A, 0xA58B, 0xDA24, 0xC408, 0xA5AA, 0x95C9, 0xAD88, 0xC527,
+    0xC586, 0xBE27, 0xCDA6, 0xCDA6, 0xD5A5, 0xDDA5, 0xDDA4, 0x3631, 0x2E31, 0x2DD2, 0x3551, 0x01DB,
+    0x095B, 0x08FC, 0x00FC, 0x00DC, 0x08DC, 0x111B, 0x19BA, 0x5D4D, 0x65EC, 0x6E2B, 0x7E0B, 0x860D,
+    0x760B, 0x6E0B, 0x760A, 0x8DEA, 0x95EA, 0x9E0A, 0x9E4A, 0x95C8, 0xBDEA, 0xCDEA, 0xBDE8, 0xA668,
+    0x9666, 0xADE5, 0xCDA5, 0xCDE6, 0xCDE5, 0xD5E5, 0xDDE4, 0xDDE4, 0x25D2, 0x25F1, 0x362F, 0x46AD,
+    0x3D91, 0x4DEE, 0x562D, 0x564C, 0x5E4E, 0x5E4D, 0x5DEC, 0x558E, 0x6EAB, 0x6E4D, 0x6DEC, 0x75CB,
+    0x7E0B, 0x762B, 0x7E4B, 0x866A, 0x8E49, 0x8DE8, 0x8DC7, 0x8DE7, 0x9E88, 0x9E88, 0x9606, 0xA5C5,
+    0xCE07, 0xD647, 0xBE25, 0xA624, 0xCE25, 0xCE25, 0xD625, 0xDE24, 0xDE24, 0x3671, 0x2E50, 0x3670,
+    0x3E8F, 0x3630, 0x3E70, 0x3E6F, 0x3E4D, 0x3E50, 0x4E6E, 0x566C, 0x564C, 0x66AD, 0x664E, 0x764B,
+    0x8669, 0x8E0A, 0x8E0A, 0x8E4A, 0x966A, 0x9689, 0x8E88, 0x96A9, 0x9EE9, 0x9606, 0xA667, 0xAE87,
+    0xAE66, 0xBE45, 0xBE25, 0xC625, 0xD666, 0xCE65, 0xCE65, 0xD664, 0xDE64, 0xDE63, 0x2690, 0x2E70,
+    0x3670, 0x3E90, 0x3EAF, 0x46AF, 0x4EAF, 0x4E8E, 0x4E8D, 0x568D, 0x5E8C, 0x5EAB, 0x5E8D, 0x668B,
+    0x6E4A, 0x7E4A, 0x772B, 0x76CA, 0x7E69, 0x8648, 0x8E28, 0x9607, 0xA627, 0xB628, 0xA688, 0xAE88,
+    0xAE66, 0xAE85, 0xB6E6, 0xBEC6, 0xBE65, 0xCE45, 0xCE84, 0xCE84, 0xD684, 0xDE83, 0xDE83,
+    /**< 1/2, 19x12 */
+    0x29F9, 0x31F8, 0x41F7, 0x49F6, 0x5215, 0x59F5, 0x6A14, 0x7213, 0x7A32, 0x7A12, 0x89F1, 0x99F0,
+    0xA20F, 0xA9EE, 0xB9ED, 0xC20D, 0xC1EC, 0xD1EB, 0xD9EB, 0x3258, 0x3A57, 0x4256, 0x4A56, 0x5274,
+    0x5A74, 0x6A73, 0x7272, 0x7A52, 0x8A52, 0x9A50, 0x928E, 0xA24E, 0xAA8E, 0xB24D, 0xCA2D, 0xC26B,
+    0xD26A, 0xDA6A, 0x2AF6, 0x32F6, 0x3AF5, 0x42D5, 0x52D4, 0x5AD3, 0x62D3, 0x6AB2, 0x82B1, 0x7AEF,
+    0x9A8C, 0xC1EB, 0xD148, 0xCA09, 0xBAEB, 0xAB2B, 0xD2AB, 0xDAAA, 0xE2AA, 0x959A, 0x9D9A, 0x9D99,
+    0xA599, 0xA5B8, 0xADB8, 0xB5B8, 0xB597, 0xBDD7, 0xDD15, 0xF492, 0xEC91, 0xF4B2, 0xF492, 0xECB3,
+    0xE575, 0xDDB5, 0xE5B4, 0xEDB4, 0x2BB5, 0x33B6, 0x43B4, 0x4B94, 0x53B2, 0x5BB2, 0x63CF, 0x73CF,
+    0x73EF, 0xD966, 0xE946, 0xE926, 0xD945, 0xE925, 0xE146, 0xD2A7, 0xCBA9, 0xD3A8, 0xDBA8, 0x2C16,
+    0x3414, 0x4433, 0x4431, 0x4C12, 0x5C30, 0x63F1, 0x740F, 0x9B2D, 0xF8C6, 0xD966, 0xE946, 0xE145,
+    0xE925, 0xE127, 0xD9E6, 0xCC29, 0xD408, 0xDC07, 0x2493, 0x34B1, 0x4473, 0x5471, 0x548F, 0x5C6E,
+    0x6C8F, 0x6C8E, 0x748D, 0xD945, 0xE146, 0xE126, 0xE125, 0xE926, 0xE147, 0xDAA7, 0xCC87, 0xD487,
+    0xDC86, 0x2CF2, 0x3CB6, 0x0158, 0x10FC, 0x10DD, 0x1119, 0x6CB1, 0x6CEE, 0x7D0D, 0xC246, 0xE906,
+    0xE146, 0xE146, 0xF126, 0xD966, 0xCBE7, 0xCD07, 0xD506, 0xDCE6, 0x2D52, 0x3590, 0x10DD, 0x10FB,
+    0x111C, 0x10FB, 0x6D6D, 0x754D, 0x758C, 0x8D4C, 0xC267, 0xD945, 0xE166, 0xD964, 0xD428, 0xBD67,
+    0xCD66, 0xD565, 0xDD65, 0x2DD1, 0x3591, 0x115B, 0x10FB, 0x10DB, 0x193B, 0x65AC, 0x6DCC, 0x85AC,
+    0x7DEB, 0x9DAA, 0xA5CA, 0xBC87, 0xADC9, 0xADE7, 0xBDC6, 0xCDC6, 0xD5C5, 0xDDC4, 0x2E11, 0x3E6F,
+    0x3E10, 0x4E4D, 0x564E, 0x5E0C, 0x666D, 0x760B, 0x860B, 0x8E4A, 0x8E49, 0x9648, 0x9E67, 0xA626,
+    0xC626, 0xBE45, 0xCE45, 0xD644, 0xDE44, 0x2690, 0x3E90, 0x46AE, 0x568F, 0x568D, 0x668D, 0x66AC,
+    0x768B, 0x76AA, 0x8669, 0x8E88, 0x9E68, 0xAEA8, 0xAE86, 0xBEC5, 0xBE85, 0xCE84, 0xD683, 0xDE83,
+    /**< 1/4, 10x6 */
+    0x3238, 0x4A36, 0x5234, 0x7233, 0x8232, 0x9230, 0xA22E, 0xBA0D, 0xCA2B, 0xDA2A, 0x6438, 0x6C37,
+    0x7C36, 0x8C35, 0xA413, 0xD34F, 0xE32E, 0xCC0F, 0xDC2F, 0xE42F, 0x2BD5, 0x43F3, 0x53F2, 0x6BF0,
+    0xBA4A, 0xE146, 0xE145, 0xD9C7, 0xCBE8, 0xDBC7, 0x34B3, 0x2AD6, 0x32B5, 0x6CAF, 0xA349, 0xE126,
+    0xE126, 0xDA46, 0xD4C7, 0xDCC6, 0x3591, 0x10FC, 0x10FB, 0x6D8D, 0x7D8C, 0xB3C8, 0xCB47, 0xBD47,
+    0xD585, 0xDD84, 0x3670, 0x464F, 0x5E6D, 0x6E6B, 0x866A, 0x9668, 0xA667, 0xBE65, 0xD664, 0xDE63,
+    /**< 1/8, 5x3 */
+    0x5337, 0x7334, 0xA2F1, 0xC2EE, 0xDB2D, 0x33D4, 0x5BD1, 0xCA08, 0xE1A6, 0xD447, 0x2CD3, 0x54D0,
+    0x9589, 0xBD66, 0xD604
+};
+
+static const u16 JPGTEST_Expected420[] =
+{
+    /**< 1, 37x23 */
+    0x21F9, 0x29F9, 0x29F8, 0x2A19, 0x31F8, 0x3A18, 0x41F7, 0x4217, 0x49F5, 0x51F5, 0x59F4, 0x59F4,
+    0x61F3, 0x61F4, 0x69F3, 0x6A13, 0x79F2, 0x8233, 0x79D1, 0x81F2, 0x798F, 0x9232, 0x91D0, 0x91D0,
+    0xA1CF, 0xA1CF, 0xA9AE, 0xB1CE, 0xB9EE, 0xB9CE, 0xB9CD, 0xCA0F, 0xB9EB, 0xC1EB, 0xC20B, 0xC20B,
+    0xCA0A, 0x2A19, 0x2A19, 0x3219, 0x3219, 0x3A18, 0x3A38, 0x4217, 0x4217, 0x5216, 0x5216, 0x6215,
+    0x6215, 0x6A14, 0x6A34, 0x7234, 0x7234, 0x79D2, 0x79D2, 0x79B1, 0x8A33, 0x89F1, 0x9232, 0x91D0,
+    0x9A11, 0xB231, 0xA1CF, 0xA9CE, 0xB1EF, 0xB1AD, 0xB9EE, 0xC1EE, 0xB98D, 0xC20B, 0xC22C, 0xC22B,
+    0xCA2B, 0xCA2B, 0x2A37, 0x2A37, 0x3256, 0x3257, 0x3A56, 0x3A56, 0x4255, 0x4255, 0x5234, 0x5254,
+    0x5A33, 0x5A33, 0x6232, 0x6252, 0x6A52, 0x6A52, 0x7A71, 0x7A71, 0x7A50, 0x8292, 0x8250, 0x8A70,
+    0x8A2E, 0x924F, 0xA28F, 0x9A4E, 0xAA6E, 0xB28E, 0xAA2C, 0xBA8D, 0xC2CE, 0xB22C, 0xDA2C, 0xDA4C,
+    0xDA4C, 0xDA4C, 0xE24B, 0x3278, 0x3278, 0x3A97, 0x3A98, 0x4297, 0x4297, 0x4A96, 0x4A96, 0x5A95,
+    0x5A95, 0x6274, 0x6294, 0x6A73, 0x7293, 0x7293, 0x7293, 0x7A71, 0x82B2, 0x8292, 0x8271, 0x8250,
+    0x8A91, 0x9A90, 0x924F, 0x89AC, 0xA26F, 0xBACF, 0xB28F, 0xB26D, 0xBA8E, 0xC2AE, 0xC28D, 0xD20B,
+    0xD20B, 0xDA0B, 0xDA2B, 0xDA2B, 0x32B4, 0x32B4, 0x32B4, 0x3AB4, 0x3AB3, 0x3AB4, 0x4A93, 0x4A93,
+    0x52D2, 0x52D2, 0x62B1, 0x62D1, 0x6AD1, 0x6AD1, 0x6AD1, 0x6AD1, 0x6A6E, 0x6A8E, 0x7ACF, 0x8310,
+    0x8B10, 0x82EF, 0x92EE, 0x92EE, 0x6967, 0x92CD, 0x9AAB, 0x926A, 0xB30C, 0xB30C, 0xA28A, 0xAAEB,
+    0xD2AB, 0xD2AC, 0xD2AB, 0xD2CB, 0xDAAB, 0x3AF5, 0x3AF5, 0x3AF5, 0x42F5, 0x42F4, 0x42F5, 0x52D4,
+    0x52D4, 0x5AF3, 0x5AF3, 0x62D2, 0x62D2, 0x6AD1, 0x6AF1, 0x6AD1, 0x6AD1, 0x8B92, 0x7AD0, 0x82F0,
+    0x8310, 0x7AAE, 0x4928, 0x48C5, 0x5107, 0x4002, 0x6106, 0x60E4, 0x7146, 0xAACB, 0xBB4D, 0xB30B,
+    0xBB6D, 0xD2AC, 0xD2AC, 0xD2AB, 0xD2CB, 0xDACB, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xDFFF, 0xDFFF,
+    0xE7FF, 0xE7FF, 0xEFDF, 0xEFDF, 0xF7DF, 0xF7DF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFF7F, 0xFF3F,
+    0xFF9F, 0xFF7F, 0xFFBF, 0xFF1D, 0xFF5E, 0xFF9E, 0xFF9D, 0xFF9D, 0xFF5B, 0xFF1A, 0xFF1A, 0xFF3A,
+    0xFF5A, 0xFF5A, 0xFF99, 0xFF99, 0xFF99, 0xFFB9, 0xFFB9, 0x3B54, 0x3B54, 0x4353, 0x4353, 0x4353,
+    0x4B53, 0x4B32, 0x4B32, 0x5B52, 0x5B52, 0x6351, 0x6351, 0x6350, 0x6B50, 0x6B50, 0x6B50, 0x834F,
+    0x8390, 0x7B2F, 0x4147, 0x4105, 0x4126, 0x5186, 0x40C3, 0x5965, 0x40A2, 0x6164, 0x69C5, 0x58E1,
+    0x71A4, 0xAB4A, 0xB38B, 0xA3EB, 0xA40B, 0xA40B, 0xA40B, 0xAC0A, 0x3373, 0x3393, 0x3372, 0x3372,
+    0x43D3, 0x4BD3, 0x4B92, 0x4BB2, 0x53B1, 0x53B1, 0x63D1, 0x63D1, 0x5B8F, 0x6390, 0x6BD0, 0x6BB0,
+    0x7B4E, 0x83B0, 0x30E4, 0x49C8, 0x30E4, 0x49A6, 0x4964, 0x4944, 0x5143, 0x4902, 0x69C4, 0x6163,
+    0x6162, 0x6162, 0x6161, 0xAB8A, 0xD369, 0xD369, 0xD389, 0xD389, 0xDB89, 0x3BB3, 0x3BD4, 0x3BB3,
+    0x3B93, 0x43B3, 0x43B3, 0x4391, 0x4B92, 0x53B1, 0x5391, 0x5BB0, 0x63D1, 0x63B0, 0x6BF1, 0x73F1,
+    0x6BF1, 0x9411, 0x838F, 0x49A8, 0x49A7, 0x4125, 0x51A7, 0x4964, 0x59A6, 0x6A06, 0x5143, 0x6183,
+    0x5942, 0x6982, 0x69A3, 0x71E3, 0xC44D, 0xD389, 0xD38A, 0xD3A9, 0xDBA9, 0xDBA9, 0x2BD3, 0x33F3,
+    0x3413, 0x3C33, 0x3C13, 0x4433, 0x4C32, 0x5453, 0x5C52, 0x5432, 0x5C30, 0x5C31, 0x6430, 0x6430,
+    0x642F, 0x640F, 0x83EF, 0x62EB, 0x4A07, 0x3984, 0x4184, 0x49E5, 0x4963, 0x5A05, 0x6204, 0x59A3,
+    0x61C2, 0x61A1, 0x69C2, 0x71E2, 0x69C1, 0xA368, 0xCC08, 0xCC08, 0xCC07, 0xD408, 0xD407, 0x3434,
+    0x3414, 0x3C34, 0x3C34, 0x3BF2, 0x3BF2, 0x43F1, 0x43F1, 0x4BF0, 0x4BF1, 0x53EF, 0x5C10, 0x6430,
+    0x6C50, 0x6C30, 0x6C50, 0x7BAE, 0x62CA, 0x41C5, 0x41A5, 0x49E5, 0x5206, 0x49A3, 0x51E4, 0x5182,
+    0x61E4, 0x7244, 0x61C2, 0x7202, 0x7223, 0x69C1, 0x8AA4, 0xCC28, 0xCC28, 0xD428, 0xD428, 0xD428,
+    0x2C94, 0x2453, 0x3493, 0x34D4, 0x3472, 0x3CB3, 0x4CD2, 0x4492, 0x5490, 0x5CD1, 0x5CB0, 0x5C8F,
+    0x6CAF, 0x648F, 0x646E, 0x6CAF, 0x848D, 0x742C, 0x3203, 0x4AA6, 0x4A64, 0x4A64, 0x5243, 0x4A22,
+    0x5A21, 0x6262, 0x6A61, 0x6221, 0x7240, 0x7240, 0x7A81, 0xABE7, 0xD447, 0xD467, 0xD467, 0xD467,
+    0xDC66, 0x2C94, 0x2453, 0x34B3, 0x3CD4, 0x3451, 0x3472, 0x4CD2, 0x4491, 0x4C70, 0x5CD1, 0x5C6F,
+    0x546F, 0x6CD0, 0x6CAF, 0x646E, 0x74CF, 0x84AE, 0x84AE, 0x3A24, 0x4285, 0x4223, 0x4244, 0x5AA4,
+    0x5263, 0x6283, 0x5A42, 0x6200, 0x6A82, 0x7A81, 0x61E0, 0x7A81, 0xC4AA, 0xD467, 0xD487, 0xDC87,
+    0xDC87, 0xDC87, 0x2D14, 0x24D3, 0x3513, 0x2CB2, 0x034C, 0x02EA, 0x0B2A, 0x02C9, 0x0AC7, 0x1B29,
+    0x22E7, 0x2B49, 0x5C8D, 0x6CEE, 0x6CCD, 0x752F, 0x74CC, 0x74CC, 0x4B46, 0x3AA3, 0x3A82, 0x3A82,
+    0x52E3, 0x52C2, 0x5A80, 0x5AC1, 0x6260, 0x6AC0, 0x72C0, 0x6260, 0x8301, 0xBCC7, 0xCCC7, 0xCCE7,
+    0xD4E7, 0xD4E7, 0xDCE6, 0x2CF3, 0x2CD3, 0x3D54, 0x2CF3, 0x032B, 0x02CA, 0x132A, 0x0B2A, 0x1308,
+    0x1B49, 0x1AC7, 0x2B48, 0x64CE, 0x754F, 0x6CCD, 0x750E, 0x7D0D, 0x7CEC, 0x7CCC, 0x4305, 0x4B04,
+    0x42C3, 0x52C2, 0x52C2, 0x5280, 0x7364, 0x72E1, 0x6260, 0x72C0, 0x8342, 0xAC46, 0xCD29, 0xD4E7,
+    0xD4E7, 0xD507, 0xD507, 0xDD07, 0x2D72, 0x2D72, 0x2D31, 0x3593, 0x0369, 0x03AB, 0x0B69, 0x0B69,
+    0x1368, 0x1368, 0x2388, 0x1B47, 0x6D8F, 0x652E, 0x6D6E, 0x6D6E, 0x7D6C, 0x7D6C, 0x854C, 0x74EA,
+    0x5BE6, 0x3B02, 0x42E1, 0x5363, 0x5300, 0x5B41, 0x62E0, 0x62E0, 0x83C2, 0xA4A6, 0xB527, 0xBD88,
+    0xCD65, 0xCD65, 0xCD65, 0xD565, 0xD564, 0x2D52, 0x2D72, 0x2D51, 0x3592, 0x0369, 0x03AA, 0x0B69,
+    0x0B89, 0x1B88, 0x1388, 0x2387, 0x1B47, 0x6D6F, 0x654E, 0x6D6E, 0x6D4E, 0x7D4C, 0x7D6C, 0x8DAD,
+    0x858D, 0x74C9, 0x53C5, 0x4B22, 0x4B22, 0x6362, 0x6341, 0x62E0, 0x7382, 0xAD07, 0xCE0B, 0xC5A9,
+    0xB507, 0xCD65, 0xCD65, 0xD565, 0xD565, 0xD585, 0x35D1, 0x35F2, 0x35D1, 0x35F1, 0x03C8, 0x03E9,
+    0x03A7, 0x0BC8, 0x13E7, 0x13C6, 0x23C6, 0x23C6, 0x6DCD, 0x6DED, 0x760E, 0x75ED, 0x758A, 0x758A,
+    0x85AB, 0x8E0C, 0x95EB, 0x8DAA, 0x9589, 0x95A9, 0x6BE1, 0x8D05, 0xAD87, 0xADA7, 0xB586, 0xB586,
+    0xBDA7, 0xCE28, 0xCDA5, 0xCDA5, 0xD5A5, 0xD5A5, 0xD5A5, 0x2D90, 0x2DB1, 0x2D90, 0x2D90, 0x0409,
+    0x0C2A, 0x0BE8, 0x1408, 0x1C08, 0x1C07, 0x2C07, 0x2C27, 0x658C, 0x658C, 0x6DCD, 0x6DAC, 0x860C,
+    0x7DCB, 0x7DAA, 0x85CB, 0x8DCA, 0x95EB, 0xA60B, 0xAE4C, 0x9D88, 0xB62A, 0xBE4A, 0xBE09, 0xBDE8,
+    0xBDC7, 0xBDA7, 0xC5E8, 0xD5C6, 0xD5C6, 0xD5C5, 0xD5E5, 0xDDE5, 0x3650, 0x3670, 0x3E70, 0x3E91,
+    0x35EE, 0x3E2F, 0x460D, 0x462E, 0x560D, 0x560D, 0x5E2C, 0x5E0B, 0x768D, 0x6E4C, 0x766C, 0x766C,
+    0x7E2A, 0x7E2A, 0x8649, 0x864A, 0x8E29, 0x8608, 0x8DE7, 0x8DE7, 0xAE48, 0xAE48, 0xA5E5, 0xA5E5,
+    0xBE66, 0xC687, 0xBE25, 0xB604, 0xCE25, 0xCE25, 0xD625, 0xD625, 0xDE24, 0x2E0F, 0x2E2F, 0x2E0F,
+    0x364F, 0x3E4F, 0x466F, 0x4E4E, 0x4E6E, 0x564D, 0x564D, 0x666D, 0x664C, 0x662B, 0x660B, 0x6E2B,
+    0x6E2B, 0x7E29, 0x864A, 0x8E8A, 0x96AB, 0x968A, 0x968A, 0x9E69, 0x9E69, 0x9DC6, 0xAE48, 0xB667,
+    0xB647, 0xBE46, 0xB625, 0xBE25, 0xCEA7, 0xD625, 0xD645, 0xD645, 0xDE45, 0xDE45, 0x2E8F, 0x36B0,
+    0x36AF, 0x368F, 0x46AF, 0x3EAF, 0x468E, 0x4EAE, 0x566C, 0x566C, 0x668C, 0x66AC, 0x666B, 0x6E8B,
+    0x76AC, 0x76AC, 0x86AA, 0x86AA, 0x8689, 0x8669, 0x8668, 0x8668, 0x9667, 0x9667, 0xA687, 0xA6A7,
+    0xAE65, 0xAE66, 0xC6C6, 0xC6C6, 0xBE85, 0xBE85, 0xCE64, 0xD664, 0xD664, 0xD684, 0xDE84,
+    /**< 1/2, 19x12 */
+    0x29F9, 0x2A19, 0x3A18, 0x4217, 0x5216, 0x59F4, 0x6A14, 0x6A14, 0x79F2, 0x81F2, 0x89F1, 0x99F0,
+    0xA1EF, 0xA9CE, 0xB9EE, 0xC1CE, 0xC20B, 0xC20B, 0xCA2B, 0x3257, 0x3277, 0x4276, 0x4A76, 0x5274,
+    0x6253, 0x6A73, 0x6A72, 0x8272, 0x8271, 0x8A70, 0x924F, 0x9A4E, 0xB28F, 0xB26D, 0xBA8D, 0xDA2C,
+    0xDA2C, 0xE24B, 0x32D5, 0x3AD4, 0x42D4, 0x4AB3, 0x5AD2, 0x62D2, 0x6AD1, 0x6AD1, 0x7AD0, 0x82F0,
+    0x726D, 0x71EA, 0x6947, 0x81E8, 0xB30C, 0xB2EB, 0xD2AC, 0xD2AB, 0xDACB, 0x8DBD, 0x8D9D, 0x959C,
+    0x9D9B, 0xA59B, 0xAD9A, 0xB599, 0xB599, 0xC578, 0xB4D5, 0xA452, 0xB451, 0xBC71, 0xC470, 0xC42E,
+    0xED52, 0xDDD2, 0xE5D2, 0xE5D2, 0x3BB3, 0x3B92, 0x43B3, 0x4B92, 0x53B1, 0x63D1, 0x63B0, 0x6BD0,
+    0x83AF, 0x4187, 0x4165, 0x5165, 0x5964, 0x6183, 0x6962, 0x92C7, 0xD389, 0xD389, 0xDB89, 0x3413,
+    0x3C33, 0x3C12, 0x4C12, 0x5411, 0x5C10, 0x6430, 0x6C30, 0x734C, 0x41C5, 0x49E5, 0x51C4, 0x59C3,
+    0x69E2, 0x71E2, 0x8263, 0xCC08, 0xD428, 0xD428, 0x2C73, 0x34B4, 0x3472, 0x4CB2, 0x54B1, 0x5C8F,
+    0x6CAF, 0x6C8E, 0x848D, 0x3A44, 0x4244, 0x5263, 0x5A42, 0x6241, 0x6A40, 0x9B65, 0xD467, 0xDC87,
+    0xDC87, 0x2CF3, 0x34F3, 0x030B, 0x0B0A, 0x1B08, 0x2308, 0x6CEE, 0x74EE, 0x7CEC, 0x5366, 0x42A3,
+    0x52C2, 0x62C1, 0x62A0, 0x72C0, 0xAC46, 0xCCE7, 0xD4E7, 0xDD06, 0x2D72, 0x3572, 0x038A, 0x0B69,
+    0x1388, 0x2367, 0x656E, 0x6D6E, 0x7D4C, 0x856C, 0x5BC5, 0x4B22, 0x5B41, 0x6300, 0xA4E6, 0xBD68,
+    0xCD65, 0xD565, 0xD565, 0x35D1, 0x35B1, 0x03E9, 0x0BE8, 0x1BE7, 0x23E6, 0x65AD, 0x75CD, 0x7DCB,
+    0x85CB, 0x8DCB, 0x9DEA, 0x9526, 0xB5E8, 0xB5A7, 0xC5E7, 0xCDC5, 0xD5C5, 0xDDC5, 0x3630, 0x3650,
+    0x3E2F, 0x4E4E, 0x562D, 0x662C, 0x6E4C, 0x764C, 0x7E2A, 0x8E6A, 0x8E49, 0x9628, 0xA627, 0xAE26,
+    0xBE46, 0xBE45, 0xD625, 0xD625, 0xDE45, 0x3690, 0x368F, 0x3EAF, 0x4E8E, 0x566C, 0x66AC, 0x666B,
+    0x76AB, 0x868A, 0x8689, 0x8E89, 0x9E88, 0xA6A7, 0xAE66, 0xBEA6, 0xBE85, 0xD664, 0xD684, 0xDE84,
+    /**< 1/4, 10x6 */
+    0x3238, 0x4237, 0x5A34, 0x6A33, 0x8232, 0x9230, 0xAA2F, 0xBA2D, 0xCA2B, 0xDA2B, 0x6439, 0x6C37,
+    0x8436, 0x8C35, 0x9C13, 0x932F, 0x9AEC, 0xC3EE, 0xDC4F, 0xE44E, 0x33D3, 0x43D2, 0x5BF1, 0x6C10,
+    0x5A8A, 0x49A5, 0x61A3, 0x7A23, 0xD3C9, 0xDBC8, 0x2CD3, 0x23CE, 0x3BCC, 0x6CCE, 0x63C9, 0x4A83,
+    0x6281, 0x8B23, 0xD4A7, 0xDCA6, 0x3591, 0x03A9, 0x1BA7, 0x6D8D, 0x7D8C, 0x74A7, 0x8464, 0xB567,
+    0xCD85, 0xDDA4, 0x3670, 0x466E, 0x5E6C, 0x6E6B, 0x866A, 0x9668, 0xAE47, 0xBE66, 0xD645, 0xDE64,
+    /**< 1/8, 5x3 */
+    0x5338, 0x7335, 0x92F1, 0xB2CD, 0xDB2D, 0x3412, 0x5C2F, 0x52A7, 0x7263, 0xD447, 0x2D8E, 0x558B,
+    0x85C9, 0xADA6, 0xD5E5
+};
+
+/**
+ * @brief Decoder, the photo drawn whole and the expected screen.
+ */
+static JPEG_t JPGTEST_Jpeg;
+static u32 JPGTEST_Whole[TEST_MAX_SIDE * TEST_MAX_SIDE];
+static u32 JPGTEST_Reference[TEST_MAX_SIDE * TEST_MAX_SIDE];
+
+/**
+ * @brief Draws the whole photo at a scale on the first panel it fits, checks its windows
+ * and captures it.
+ *
+ * @return The width of the captured screen, 0 when no panel is large enough.
+ */
+static u16 JPGTEST_DrawWhole(u8 Copy_Scale);
+
+/**
+ * @brief Draws the photo at a scale across the bottom-right corner of a panel and checks it.
+ */
+static void JPGTEST_Run(const TEST_Panel_t *Copy_Panel, u8 Copy_Scale, u16 Copy_WholeWidth);
+
+/**
+ * @brief Draws a small picture at every scale on a panel and checks it against the libjpeg
+ * output.
+ *
+ * @param[in] Copy_Panel       The panel.
+ * @param[in] Copy_Name        The picture, for the log.
+ * @param[in] Copy_Data        The JPEG file.
+ * @param[in] Copy_Size        Its size in bytes.
+ * @param[in] Copy_Expected    The libjpeg output, one scale after the other.
+ * @param[in] Copy_ScaledError Largest channel error allowed at 1/2 to 1/8, 0 for an exact match.
+ */
+static void JPGTEST_RunReference(const TEST_Panel_t *Copy_Panel, const char *Copy_Name, const u8 *Copy_Data, u32 Copy_Size, const u16 *Copy_Expected, u8 Copy_ScaledError);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static u16 JPGTEST_DrawWhole(u8 Copy_Scale)
+{
+    const TFT_Config_t *Local_Config;
+    u16 Local_Width = (JPGTEST_Jpeg.Width + (1 << Copy_Scale) - 1) >> Copy_Scale;
+    u16 Local_Height = (JPGTEST_Jpeg.Height + (1 << Copy_Scale) - 1) >> Copy_Scale;
+    u16 Local_Mcu = JPGTEST_MCU_SIDE >> Copy_Scale;
+    u16 Local_StripWidth = (Copy_Scale == JPEG_SCALE_1_8) ? JPGTEST_STRIP_WIDTH : Local_Mcu;
+    u32 Local_Windows = (u32)((Local_Width + Local_StripWidth - 1) / Local_StripWidth) * ((Local_Height + Local_Mcu - 1) / Local_Mcu);
+    TFT_EMU_Stats_t Local_Stats;
+    SPI_t Local_Spi;
+    u8 Local_Panel;
+
+    for (Local_Panel = 0; Local_Panel < TEST_PanelCount; Local_Panel++)
+    {
+        Local_Config = &TEST_Panels[Local_Panel].Config;
+        if ((Local_Config->TFT_Controller->TFT_Width >= JPGTEST_Jpeg.Width) && (Local_Config->TFT_Controller->TFT_Height >= JPGTEST_Jpeg.Height))
+        {
+            Local_Spi = TEST_StartPanel(&TEST_Panels[Local_Panel]);
+            TFT_EMU_ResetStats();
+            JPEG_Draw(&JPGTEST_Jpeg, Local_Config, Local_Spi, 0, 0, Copy_Scale);
+            TFT_EMU_GetStats(&Local_Stats);
+            TEST_Check((Local_Stats.Windows == Local_Windows) && (Local_Stats.Pixels == (u32)Local_Width * Local_Height),
+                       "%s: 1/%u whole, %u windows (%u expected), %u pixels", TEST_Panels[Local_Panel].Name, 1u << Copy_Scale,
+                       Local_Stats.Windows, Local_Windows, Local_Stats.Pixels);
+            TEST_CaptureScreen(JPGTEST_Whole, Local_Config->TFT_Controller->TFT_Width, Local_Config->TFT_Controller->TFT_Height);
+            return Local_Config->TFT_Controller->TFT_Width;
+        }
+    }
+
+    return 0;
+}
+
+static void JPGTEST_Run(const TEST_Panel_t *Copy_Panel, u8 Copy_Scale, u16 Copy_WholeWidth)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    u16 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    u16 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    u16 Local_PhotoWidth = (JPGTEST_Jpeg.Width + (1 << Copy_Scale) - 1) >> Copy_Scale;
+    u16 Local_PhotoHeight = (JPGTEST_Jpeg.Height + (1 << Copy_Scale) - 1) >> Copy_Scale;
+    u16 Local_Mcu = JPGTEST_MCU_SIDE >> Copy_Scale;
+    u16 Local_XPosition = Local_Width - Local_PhotoWidth * 7 / 20;
+    u16 Local_YPosition = Local_Height - Local_PhotoHeight * 2 / 3;
+    u16 Local_VisibleWidth = Local_Width - Local_XPosition;
+    u16 Local_VisibleHeight = Local_Height - Local_YPosition;
+    u16 Local_StripWidth = (Copy_Scale == JPEG_SCALE_1_8) ? JPGTEST_STRIP_WIDTH : Local_Mcu;
+    u32 Local_Windows;
+    TFT_EMU_Stats_t Local_Stats;
+    SPI_t Local_Spi;
+    u16 Local_X;
+    u16 Local_Y;
+    u8 Local_Status;
+
+    /**< Expected screen: the untouched screen, the top-left of the whole photo in the corner */
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TEST_CaptureScreen(JPGTEST_Reference, Local_Width, Local_Height);
+    for (Local_Y = 0; Local_Y < Local_VisibleHeight; Local_Y++)
+    {
+        for (Local_X = 0; Local_X < Local_VisibleWidth; Local_X++)
+        {
+            JPGTEST_Reference[(u32)(Local_YPosition + Local_Y) * Local_Width + Local_XPosition + Local_X] = JPGTEST_Whole[(u32)Local_Y * Copy_WholeWidth + Local_X];
+        }
+    }
+    Local_Windows = (u32)((Local_VisibleWidth + Local_StripWidth - 1) / Local_StripWidth) * ((Local_VisibleHeight + Local_Mcu - 1) / Local_Mcu);
+
+    TFT_EMU_ResetStats();
+    Local_Status = JPEG_Draw(&JPGTEST_Jpeg, Local_Config, Local_Spi, Local_XPosition, Local_YPosition, Copy_Scale);
+    TFT_EMU_GetStats(&Local_Stats);
+
+    TEST_Check((Local_Status == 0) && (Local_Stats.Errors == 0), "%s: 1/%u at %u,%u, status %u, %u protocol errors",
+               Copy_Panel->Name, 1u << Copy_Scale, Local_XPosition, Local_YPosition, Local_Status, Local_Stats.Errors);
+    TEST_Check(Local_Stats.Pixels == (u32)Local_VisibleWidth * Local_VisibleHeight, "%s: 1/%u, %u pixels written for %ux%u visible of %ux%u",
+               Copy_Panel->Name, 1u << Copy_Scale, Local_Stats.Pixels, Local_VisibleWidth, Local_VisibleHeight, Local_PhotoWidth, Local_PhotoHeight);
+    TEST_Check(Local_Stats.Windows == Local_Windows, "%s: 1/%u, %u windows, %u expected",
+               Copy_Panel->Name, 1u << Copy_Scale, Local_Stats.Windows, Local_Windows);
+    TEST_Check(TEST_CountMismatches(JPGTEST_Reference, Local_Width, Local_Height) == 0, "%s: 1/%u, %u wrong pixels",
+               Copy_Panel->Name, 1u << Copy_Scale, TEST_CountMismatches(JPGTEST_Reference, Local_Width, Local_Height));
+
+    /**< Entirely off the screen: nothing is sent */
+    TFT_EMU_ResetStats();
+    Local_Status = JPEG_Draw(&JPGTEST_Jpeg, Local_Config, Local_Spi, Local_Width, 0, Copy_Scale);
+    Local_Status |= JPEG_Draw(&JPGTEST_Jpeg, Local_Config, Local_Spi, 0, Local_Height, Copy_Scale);
+    TFT_EMU_GetStats(&Local_Stats);
+    TEST_Check((Local_Status == 0) && (Local_Stats.Bytes == 0), "%s: 1/%u off the screen, status %u, %u bytes sent",
+               Copy_Panel->Name, 1u << Copy_Scale, Local_Status, Local_Stats.Bytes);
+}
+
+static void JPGTEST_RunReference(const TEST_Panel_t *Copy_Panel, const char *Copy_Name, const u8 *Copy_Data, u32 Copy_Size, const u16 *Copy_Expected, u8 Copy_ScaledError)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    u32 Local_Offset = 0;
+    u32 Local_Mismatches;
+    u32 Local_Expected;
+    u32 Local_Actual;
+    u16 Local_Width;
+    u16 Local_Height;
+    u16 Local_X;
+    u16 Local_Y;
+    u8 Local_Allowed;
+    u8 Local_Error;
+    u8 Local_Channel;
+    u8 Local_Status;
+    u8 Local_Scale;
+    s16 Local_Difference;
+    SPI_t Local_Spi;
+
+    Local_Status = JPEG_Prepare(&JPGTEST_Jpeg, Copy_Data, Copy_Size);
+    TEST_Check(Local_Status == 0, "%s: %s, JPEG_Prepare status %u", Copy_Panel->Name, Copy_Name, Local_Status);
+
+    for (Local_Scale = JPEG_SCALE_1; (Local_Status == 0) && (Local_Scale <= JPEG_SCALE_1_8); Local_Scale++)
+    {
+        Local_Width = (JPGTEST_Jpeg.Width + (1 << Local_Scale) - 1) >> Local_Scale;
+        Local_Height = (JPGTEST_Jpeg.Height + (1 << Local_Scale) - 1) >> Local_Scale;
+        Local_Allowed = (Local_Scale == JPEG_SCALE_1) ? 0 : Copy_ScaledError;
+        Local_Mismatches = 0;
+        Local_Error = 0;
+
+        Local_Spi = TEST_StartPanel(Copy_Panel);
+        JPEG_Draw(&JPGTEST_Jpeg, Local_Config, Local_Spi, 0, 0, Local_Scale);
+        for (Local_Y = 0; Local_Y < Local_Height; Local_Y++)
+        {
+            for (Local_X = 0; Local_X < Local_Width; Local_X++)
+            {
+                Local_Expected = TEST_Rgb565ToRgb888(Copy_Expected[Local_Offset + (u32)Local_Y * Local_Width + Local_X]);
+                Local_Actual = TFT_EMU_GetPixel(Local_X, Local_Y);
+                if (Local_Actual != Local_Expected)
+                {
+                    Local_Mismatches++;
+                }
+                for (Local_Channel = 0; Local_Channel < 24; Local_Channel += 8)
+                {
+                    Local_Difference = (s16)((Local_Actual >> Local_Channel) & 0xFF) - (s16)((Local_Expected >> Local_Channel) & 0xFF);
+                    if (Local_Difference < 0)
+                    {
+                        Local_Difference = -Local_Difference;
+                    }
+                    if (Local_Difference > Local_Error)
+                    {
+                        Local_Error = (u8)Local_Difference;
+                    }
+                }
+            }
+        }
+        Local_Offset += (u32)Local_Width * Local_Height;
+
+        TEST_Check((Local_Allowed == 0) ? (Local_Mismatches == 0) : (Local_Error <= Local_Allowed),
+                   "%s: %s at 1/%u, %u of %u pixels differ from libjpeg, largest channel error %u (%u allowed)", Copy_Panel->Name, Copy_Name,
+                   1u << Local_Scale, Local_Mismatches, (u32)Local_Width * Local_Height, Local_Error, Local_Allowed);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    u16 Local_WholeWidth;
+    u8 Local_Status;
+    u8 Local_Scale;
+    u8 Local_Panel;
+
+    TEST_Init(argc, argv);
+
+    /**< Small pictures against libjpeg, at every scale */
+    for (Local_Panel = 0; Local_Panel < TEST_PanelCount; Local_Panel++)
+    {
+        JPGTEST_RunReference(&TEST_Panels[Local_Panel], "4:4:4", JPGTEST_Small444, sizeof(JPGTEST_Small444), JPGTEST_Expected444, 0);
+        JPGTEST_RunReference(&TEST_Panels[Local_Panel], "4:2:0", JPGTEST_Small420, sizeof(JPGTEST_Small420), JPGTEST_Expected420, JPGTEST_MAX_SCALED_ERROR);
+        JPGTEST_RunReference(&TEST_Panels[Local_Panel], "4:2:0 with restarts", JPGTEST_Small420Restart, sizeof(JPGTEST_Small420Restart),
+                             JPGTEST_Expected420, JPGTEST_MAX_SCALED_ERROR);
+    }
+
+    Local_Status = JPEG_Prepare(&JPGTEST_Jpeg, JPGTEST_Photo, sizeof(JPGTEST_Photo));
+    TEST_Check(Local_Status == 0, "JPEG_Prepare: status %u, %ux%u", Local_Status, JPGTEST_Jpeg.Width, JPGTEST_Jpeg.Height);
+    for (Local_Scale = JPEG_SCALE_1; Local_Scale <= JPEG_SCALE_1_8; Local_Scale++)
+    {
+        Local_WholeWidth = JPGTEST_DrawWhole(Local_Scale);
+        for (Local_Panel = 0; Local_Panel < TEST_PanelCount; Local_Panel++)
+        {
+            JPGTEST_Run(&TEST_Panels[Local_Panel], Local_Scale, Local_WholeWidth);
+        }
+    }
+
+    return TEST_Finish();
+}
@@ -0,0 +1,167 @@
+/**
+ * @file line_test.c
+ * @brief Host tests of TFT_DrawLine on every controller.
+ *
+ * Lines in every octant, steep and shallow, exact diagonals, single pixels and lines running
+ * past the right and bottom edges are drawn on a fresh panel and compared pixel for pixel with
+ * a reference Bresenham: at each step along the major axis, the pixel of the minor axis nearest
+ * the ideal line, ties going away from the upper end point. The counts are checked too: every
+ * visible pixel written once, and one window per row (mostly horizontal lines) or per column
+ * (mostly vertical lines) holding a visible pixel.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     line_test
+ */
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Color of the lines.
+ */
+#define LNTEST_COLOR                0x07E0
+
+/**
+ * @brief End points of the star drawn from the middle of the screen, as offsets: every
+ * octant, both diagonals, the axes and slopes whose runs end on ties.
+ */
+static const s16 LNTEST_Star[][2] =
+{
+    { 37, 0 }, { 37, 5 }, { 37, 12 }, { 30, 30 }, { 12, 37 }, { 5, 37 }, { 0, 37 },
+    { -5, 37 }, { -12, 37 }, { -30, 30 }, { -37, 12 }, { -37, 5 }, { -37, 0 },
+    { -37, -5 }, { -37, -12 }, { -30, -30 }, { -12, -37 }, { -5, -37 }, { 0, -37 },
+    { 5, -37 }, { 12, -37 }, { 30, -30 }, { 37, -12 }, { 37, -5 },
+    { 8, 4 }, { 4, 8 }, { -8, 4 }, { 9, -3 }, { 3, 9 }, { 1, 0 }, { 0, 1 }, { 1, 1 }, { 0, 0 }
+};
+
+/**
+ * @brief The expected screen.
+ */
+static u32 LNTEST_Reference[TEST_MAX_SIDE * TEST_MAX_SIDE];
+
+/**
+ * @brief Draws a line on a fresh panel and checks it against the reference Bresenham.
+ */
+static void LNTEST_Run(const TEST_Panel_t *Copy_Panel, u16 Copy_X1, u16 Copy_Y1, u16 Copy_X2, u16 Copy_Y2);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static void LNTEST_Run(const TEST_Panel_t *Copy_Panel, u16 Copy_X1, u16 Copy_Y1, u16 Copy_X2, u16 Copy_Y2)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    u16 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    u16 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    s32 Local_TopX = (Copy_Y1 <= Copy_Y2) ? Copy_X1 : Copy_X2;
+    s32 Local_TopY = (Copy_Y1 <= Copy_Y2) ? Copy_Y1 : Copy_Y2;
+    s32 Local_XDelta = (Copy_Y1 <= Copy_Y2) ? ((s32)Copy_X2 - Copy_X1) : ((s32)Copy_X1 - Copy_X2);
+    s32 Local_YDelta = (Copy_Y1 <= Copy_Y2) ? ((s32)Copy_Y2 - Copy_Y1) : ((s32)Copy_Y1 - Copy_Y2);
+    s32 Local_XAdvance = (Local_XDelta < 0) ? -1 : 1;
+    s32 Local_Major = (Local_XDelta * Local_XAdvance >= Local_YDelta) ? (Local_XDelta * Local_XAdvance) : Local_YDelta;
+    s32 Local_Minor = (Local_XDelta * Local_XAdvance >= Local_YDelta) ? Local_YDelta : (Local_XDelta * Local_XAdvance);
+    u8 Local_IsXMajor = (Local_XDelta * Local_XAdvance >= Local_YDelta);
+    u8 Local_IsAxis = (Local_XDelta == 0) || (Local_YDelta == 0);
+    s32 Local_LastRun = -1;
+    u32 Local_Pixels = 0;
+    u32 Local_Windows = 0;
+    TFT_EMU_Stats_t Local_Stats;
+    SPI_t Local_Spi;
+    s32 Local_Step;
+    s32 Local_Offset;
+    s32 Local_X;
+    s32 Local_Y;
+
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TEST_CaptureScreen(LNTEST_Reference, Local_Width, Local_Height);
+
+    for (Local_Step = 0; Local_Step <= Local_Major; Local_Step++)
+    {
+        /**< Nearest minor coordinate, ties rounded up: away from the upper end point */
+        Local_Offset = (Local_Major == 0) ? 0 : ((2 * Local_Step * Local_Minor + Local_Major) / (2 * Local_Major));
+        Local_X = Local_TopX + Local_XAdvance * (Local_IsXMajor ? Local_Step : Local_Offset);
+        Local_Y = Local_TopY + (Local_IsXMajor ? Local_Offset : Local_Step);
+        if ((Local_X >= Local_Width) || (Local_Y >= Local_Height))
+        {
+            continue;
+        }
+        LNTEST_Reference[Local_Y * Local_Width + Local_X] = TEST_Rgb565ToRgb888(LNTEST_COLOR);
+        Local_Pixels++;
+
+        /**< One run per row or column, a single one for an axis-aligned line */
+        if (Local_IsAxis)
+        {
+            Local_Windows = 1;
+        }
+        else if ((Local_IsXMajor ? Local_Y : Local_X) != Local_LastRun)
+        {
+            Local_LastRun = Local_IsXMajor ? Local_Y : Local_X;
+            Local_Windows++;
+        }
+    }
+
+    TFT_EMU_ResetStats();
+    TFT_DrawLine(Local_Config, Local_Spi, Copy_X1, Copy_Y1, Copy_X2, Copy_Y2, LNTEST_COLOR);
+    TFT_EMU_GetStats(&Local_Stats);
+
+    TEST_Check((Local_Stats.Errors == 0) && (Local_Stats.Pixels == Local_Pixels) && (Local_Stats.Windows == Local_Windows) &&
+               (TEST_CountMismatches(LNTEST_Reference, Local_Width, Local_Height) == 0),
+               "%s: line %u,%u to %u,%u, %u protocol errors, %u pixels (%u expected), %u windows (%u expected), %u wrong pixels",
+               Copy_Panel->Name, Copy_X1, Copy_Y1, Copy_X2, Copy_Y2, Local_Stats.Errors, Local_Stats.Pixels, Local_Pixels,
+               Local_Stats.Windows, Local_Windows, TEST_CountMismatches(LNTEST_Reference, Local_Width, Local_Height));
+}
+
+int main(int argc, char **argv)
+{
+    const TFT_Controller_t *Local_Controller;
+    u16 Local_Width;
+    u16 Local_Height;
+    u16 Local_CenterX;
+    u16 Local_CenterY;
+    u8 Local_Panel;
+    u8 Local_Index;
+
+    TEST_Init(argc, argv);
+
+    for (Local_Panel = 0; Local_Panel < TEST_PanelCount; Local_Panel++)
+    {
+        Local_Controller = TEST_Panels[Local_Panel].Config.TFT_Controller;
+        Local_Width = Local_Controller->TFT_Width;
+        Local_Height = Local_Controller->TFT_Height;
+        Local_CenterX = Local_Width / 2;
+        Local_CenterY = Local_Height / 2;
+
+        /**< Every octant, steep and shallow, from the middle of the screen */
+        for (Local_Index = 0; Local_Index < sizeof(LNTEST_Star) / sizeof(LNTEST_Star[0]); Local_Index++)
+        {
+            LNTEST_Run(&TEST_Panels[Local_Panel], Local_CenterX, Local_CenterY,
+                       (u16)(Local_CenterX + LNTEST_Star[Local_Index][0]), (u16)(Local_CenterY + LNTEST_Star[Local_Index][1]));
+        }
+
+        /**< Corner to corner, and long shallow and steep lines */
+        LNTEST_Run(&TEST_Panels[Local_Panel], 0, 0, Local_Width - 1, Local_Height - 1);
+        LNTEST_Run(&TEST_Panels[Local_Panel], Local_Width - 1, 0, 0, Local_Height - 1);
+        LNTEST_Run(&TEST_Panels[Local_Panel], 3, 7, Local_Width - 4, 10);
+        LNTEST_Run(&TEST_Panels[Local_Panel], 5, Local_Height - 3, 8, 2);
+
+        /**< Past the right edge, the bottom edge, the corner, and off the screen */
+        LNTEST_Run(&TEST_Panels[Local_Panel], Local_Width - 20, 10, Local_Width + 35, 30);
+        LNTEST_Run(&TEST_Panels[Local_Panel], Local_Width + 35, 40, Local_Width - 20, 10);
+        LNTEST_Run(&TEST_Panels[Local_Panel], 10, Local_Height - 15, 25, Local_Height + 40);
+        LNTEST_Run(&TEST_Panels[Local_Panel], Local_Width - 10, Local_Height - 12, Local_Width + 30, Local_Height + 20);
+        LNTEST_Run(&TEST_Panels[Local_Panel], Local_Width - 5, 20, Local_Width + 60, 20);
+        LNTEST_Run(&TEST_Panels[Local_Panel], 20, Local_Height - 5, 20, Local_Height + 60);
+        LNTEST_Run(&TEST_Panels[Local_Panel], Local_Width, 0, Local_Width + 40, 30);
+        LNTEST_Run(&TEST_Panels[Local_Panel], 0, Local_Height + 3, 30, Local_Height + 40);
+    }
+
+    return TEST_Finish();
+}
@@ -0,0 +1,415 @@
+/**
+ * @file pixel_test.c
+ * @brief Host tests of the PIXEL kernels against scalar references, and their throughput.
+ *
+ * - PIXEL_Blend: random color pairs with every alpha, against the per-channel formula
+ *   (Foreground * a + Background * (32 - a)) / 32 with a = (Alpha + 4) / 8, rounded down.
+ * - Every span kernel at every destination and source alignment and every length up to
+ *   PIXTEST_MAX_LENGTH, inside guard pixels: the span must match the reference pixel for
+ *   pixel and nothing outside it may change.
+ * - PIXEL_GradientSpan: exact end colors, every channel within 1 of the exact rounded
+ *   interpolation, no write past the span.
+ *
+ * With --bench the kernels are timed against the scalar per-channel loops, in Mpixel/s.
+ * The host numbers only compare the kernels with each other: the target has no cache and a
+ * single-cycle multiplier, so run the same loops on the board for absolute figures.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     pixel_test [--bench]
+ */
+#include <stdio.h>
+#include <string.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "PIXEL_interface.h"
+/**< TOOLS */
+#include "TEST_interface.h"
+
+/**
+ * @brief Longest span of the alignment tests, and the guard pixels around it.
+ */
+#define PIXTEST_MAX_LENGTH          70
+#define PIXTEST_GUARD               4
+#define PIXTEST_BUFFER              (PIXTEST_MAX_LENGTH + 2 * PIXTEST_GUARD)
+
+/**
+ * @brief Random pairs of the PIXEL_Blend test, and gradients tested.
+ */
+#define PIXTEST_BLEND_PAIRS         20000
+#define PIXTEST_GRADIENTS           20000
+#define PIXTEST_GRADIENT_MAX        600
+
+/**
+ * @brief Pixels per pass and passes of the throughput measurements.
+ */
+#define PIXTEST_BENCH_PIXELS        (480 * 16)
+#define PIXTEST_BENCH_PASSES        2000
+
+/**
+ * @brief Buffers of the tests, word aligned so the offsets give every alignment.
+ */
+static _Alignas(4) u16 PIXTEST_Destination[PIXTEST_BUFFER];
+static _Alignas(4) u16 PIXTEST_Expected[PIXTEST_BUFFER];
+static _Alignas(4) u16 PIXTEST_Source[PIXTEST_BUFFER];
+static _Alignas(4) u8 PIXTEST_Alphas[PIXTEST_BUFFER];
+static _Alignas(4) u8 PIXTEST_Rgb[3 * PIXTEST_BUFFER];
+static _Alignas(4) u16 PIXTEST_Gradient[PIXTEST_GRADIENT_MAX + 2];
+static _Alignas(4) u16 PIXTEST_BenchDestination[PIXTEST_BENCH_PIXELS];
+static _Alignas(4) u16 PIXTEST_BenchSource[PIXTEST_BENCH_PIXELS];
+static _Alignas(4) u8 PIXTEST_BenchRgb[3 * PIXTEST_BENCH_PIXELS];
+
+/**
+ * @brief State of the random generator, fixed so every run tests the same values.
+ */
+static u32 PIXTEST_Seed = 0x12345678;
+
+/**
+ * @brief Kernels of the span tests.
+ */
+typedef enum {
+    PIXTEST_BLEND_SPAN,
+    PIXTEST_BLEND_SPAN_ALPHA,
+    PIXTEST_BLEND_COLOR,
+    PIXTEST_CONVERT,
+    PIXTEST_KERNELS
+} PIXTEST_Kernel_t;
+
+static const char *const PIXTEST_KernelNames[PIXTEST_KERNELS] = {
+    "PIXEL_BlendSpan", "PIXEL_BlendSpanAlpha", "PIXEL_BlendColor", "PIXEL_ConvertRgb888"
+};
+
+/**
+ * @brief Next value of a xorshift generator.
+ */
+static u32 PIXTEST_Random(void);
+
+/**
+ * @brief Channel 0 (red), 1 (green) or 2 (blue) of an RGB565 color.
+ */
+static s32 PIXTEST_Channel(u16 Copy_Color, u8 Copy_Channel);
+
+/**
+ * @brief Scalar reference of a blend: the per-channel formula, one channel at a time.
+ */
+static u16 PIXTEST_BlendReference(u16 Copy_Background, u16 Copy_Foreground, u8 Copy_Alpha);
+
+/**
+ * @brief Scalar reference of an RGB888 conversion.
+ */
+static u16 PIXTEST_ConvertReference(const u8 *Copy_Source);
+
+/**
+ * @brief Runs one span kernel on a span of the destination buffer and checks the buffer
+ * against the reference.
+ *
+ * @return 1 when the whole buffer matches.
+ */
+static u8 PIXTEST_RunSpan(PIXTEST_Kernel_t Copy_Kernel, u8 Copy_DestinationOffset, u8 Copy_SourceOffset, u8 Copy_Length);
+
+/**
+ * @brief Measures a span kernel and its scalar reference loop.
+ */
+static void PIXTEST_Benchmark(void);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static u32 PIXTEST_Random(void)
+{
+    PIXTEST_Seed ^= PIXTEST_Seed << 13;
+    PIXTEST_Seed ^= PIXTEST_Seed >> 17;
+    PIXTEST_Seed ^= PIXTEST_Seed << 5;
+
+    return PIXTEST_Seed;
+}
+
+static s32 PIXTEST_Channel(u16 Copy_Color, u8 Copy_Channel)
+{
+    if (Copy_Channel == 0)
+    {
+        return Copy_Color >> 11;
+    }
+    if (Copy_Channel == 1)
+    {
+        return (Copy_Color >> 5) & 0x3F;
+    }
+
+    return Copy_Color & 0x1F;
+}
+
+static u16 PIXTEST_BlendReference(u16 Copy_Background, u16 Copy_Foreground, u8 Copy_Alpha)
+{
+    s32 Local_Alpha = (Copy_Alpha + 4) >> 3;
+    s32 Local_Red = (PIXTEST_Channel(Copy_Foreground, 0) * Local_Alpha + PIXTEST_Channel(Copy_Background, 0) * (32 - Local_Alpha)) >> 5;
+    s32 Local_Green = (PIXTEST_Channel(Copy_Foreground, 1) * Local_Alpha + PIXTEST_Channel(Copy_Background, 1) * (32 - Local_Alpha)) >> 5;
+    s32 Local_Blue = (PIXTEST_Channel(Copy_Foreground, 2) * Local_Alpha + PIXTEST_Channel(Copy_Background, 2) * (32 - Local_Alpha)) >> 5;
+
+    return (u16)((Local_Red << 11) | (Local_Green << 5) | Local_Blue);
+}
+
+static u16 PIXTEST_ConvertReference(const u8 *Copy_Source)
+{
+    return (u16)(((Copy_Source[0] >> 3) << 11) | ((Copy_Source[1] >> 2) << 5) | (Copy_Source[2] >> 3));
+}
+
+static u8 PIXTEST_RunSpan(PIXTEST_Kernel_t Copy_Kernel, u8 Copy_DestinationOffset, u8 Copy_SourceOffset, u8 Copy_Length)
+{
+    u16 *Local_Span = &PIXTEST_Destination[PIXTEST_GUARD + Copy_DestinationOffset];
+    const u16 *Local_Source = &PIXTEST_Source[PIXTEST_GUARD + Copy_SourceOffset];
+    const u8 *Local_Alphas = &PIXTEST_Alphas[Copy_SourceOffset];
+    const u8 *Local_Rgb = &PIXTEST_Rgb[Copy_SourceOffset];
+    u8 Local_Alpha = (u8)PIXTEST_Random();
+    u16 Local_Color = (u16)PIXTEST_Random();
+    u16 *Local_Expected = &PIXTEST_Expected[PIXTEST_GUARD + Copy_DestinationOffset];
+    u16 Local_Index;
+
+    for (Local_Index = 0; Local_Index < PIXTEST_BUFFER; Local_Index++)
+    {
+        PIXTEST_Destination[Local_Index] = (u16)PIXTEST_Random();
+        PIXTEST_Source[Local_Index] = (u16)PIXTEST_Random();
+        /**< Masks are mostly transparent or opaque */
+        PIXTEST_Alphas[Local_Index] = (u8)((Local_Index % 3 == 0) ? 0 : (Local_Index % 3 == 1) ? 255 : PIXTEST_Random());
+    }
+    for (Local_Index = 0; Local_Index < sizeof(PIXTEST_Rgb); Local_Index++)
+    {
+        PIXTEST_Rgb[Local_Index] = (u8)PIXTEST_Random();
+    }
+    memcpy(PIXTEST_Expected, PIXTEST_Destination, sizeof(PIXTEST_Expected));
+
+    for (Local_Index = 0; Local_Index < Copy_Length; Local_Index++)
+    {
+        switch (Copy_Kernel)
+        {
+        case PIXTEST_BLEND_SPAN:
+            Local_Expected[Local_Index] = PIXTEST_BlendReference(Local_Expected[Local_Index], Local_Source[Local_Index], Local_Alpha);
+            break;
+        case PIXTEST_BLEND_SPAN_ALPHA:
+            Local_Expected[Local_Index] = PIXTEST_BlendReference(Local_Expected[Local_Index], Local_Source[Local_Index], Local_Alphas[Local_Index]);
+            break;
+        case PIXTEST_BLEND_COLOR:
+            Local_Expected[Local_Index] = PIXTEST_BlendReference(Local_Expected[Local_Index], Local_Color, Local_Alpha);
+            break;
+        default:
+            Local_Expected[Local_Index] = PIXTEST_ConvertReference(&Local_Rgb[3 * Local_Index]);
+            break;
+        }
+    }
+
+    switch (Copy_Kernel)
+    {
+    case PIXTEST_BLEND_SPAN:
+        PIXEL_BlendSpan(Local_Span, Local_Source, Copy_Length, Local_Alpha);
+        break;
+    case PIXTEST_BLEND_SPAN_ALPHA:
+        PIXEL_BlendSpanAlpha(Local_Span, Local_Source, Local_Alphas, Copy_Length);
+        break;
+    case PIXTEST_BLEND_COLOR:
+        PIXEL_BlendColor(Local_Span, Local_Color, Copy_Length, Local_Alpha);
+        break;
+    default:
+        PIXEL_ConvertRgb888(Local_Span, Local_Rgb, Copy_Length);
+        break;
+    }
+
+    return memcmp(PIXTEST_Destination, PIXTEST_Expected, sizeof(PIXTEST_Expected)) == 0;
+}
+
+static void PIXTEST_Benchmark(void)
+{
+    u32 Local_Pass;
+    u32 Local_Index;
+    u16 Local_Background;
+    u16 Local_Foreground;
+    double Local_Start;
+    double Local_Megapixels = (double)PIXTEST_BENCH_PIXELS * PIXTEST_BENCH_PASSES / 1e6;
+    double Local_Scalar;
+    double Local_Kernel;
+
+    for (Local_Index = 0; Local_Index < PIXTEST_BENCH_PIXELS; Local_Index++)
+    {
+        PIXTEST_BenchDestination[Local_Index] = (u16)PIXTEST_Random();
+        PIXTEST_BenchSource[Local_Index] = (u16)PIXTEST_Random();
+    }
+    for (Local_Index = 0; Local_Index < sizeof(PIXTEST_BenchRgb); Local_Index++)
+    {
+        PIXTEST_BenchRgb[Local_Index] = (u8)PIXTEST_Random();
+    }
+
+    Local_Start = TEST_Seconds();
+    for (Local_Pass = 0; Local_Pass < PIXTEST_BENCH_PASSES; Local_Pass++)
+    {
+        for (Local_Index = 0; Local_Index < PIXTEST_BENCH_PIXELS; Local_Index++)
+        {
+            Local_Background = PIXTEST_BenchDestination[Local_Index];
+            Local_Foreground = PIXTEST_BenchSource[Local_Index];
+            PIXTEST_BenchDestination[Local_Index] = PIXTEST_BlendReference(Local_Background, Local_Foreground, (u8)(100 + (Local_Pass & 7)));
+        }
+    }
+    Local_Scalar = TEST_Seconds() - Local_Start;
+    Local_Start = TEST_Seconds();
+    for (Local_Pass = 0; Local_Pass < PIXTEST_BENCH_PASSES; Local_Pass++)
+    {
+        PIXEL_BlendSpan(PIXTEST_BenchDestination, PIXTEST_BenchSource, PIXTEST_BENCH_PIXELS, (u8)(100 + (Local_Pass & 7)));
+    }
+    Local_Kernel = TEST_Seconds() - Local_Start;
+    printf("bench %-22s %8.1f Mpixel/s (scalar %8.1f)\n", "PIXEL_BlendSpan", Local_Megapixels / Local_Kernel, Local_Megapixels / Local_Scalar);
+
+    Local_Start = TEST_Seconds();
+    for (Local_Pass = 0; Local_Pass < PIXTEST_BENCH_PASSES; Local_Pass++)
+    {
+        for (Local_Index = 0; Local_Index < PIXTEST_BENCH_PIXELS; Local_Index++)
+        {
+            PIXTEST_BenchDestination[Local_Index] = PIXTEST_BlendReference(PIXTEST_BenchDestination[Local_Index], PIXTEST_BenchSource[Local_Pass & 7], (u8)(100 + (Local_Pass & 7)));
+        }
+    }
+    Local_Scalar = TEST_Seconds() - Local_Start;
+    Local_Start = TEST_Seconds();
+    for (Local_Pass = 0; Local_Pass < PIXTEST_BENCH_PASSES; Local_Pass++)
+    {
+        PIXEL_BlendColor(PIXTEST_BenchDestination, PIXTEST_BenchSource[Local_Pass & 7], PIXTEST_BENCH_PIXELS, (u8)(100 + (Local_Pass & 7)));
+    }
+    Local_Kernel = TEST_Seconds() - Local_Start;
+    printf("bench %-22s %8.1f Mpixel/s (scalar %8.1f)\n", "PIXEL_BlendColor", Local_Megapixels / Local_Kernel, Local_Megapixels / Local_Scalar);
+
+    Local_Start = TEST_Seconds();
+    for (Local_Pass = 0; Local_Pass < PIXTEST_BENCH_PASSES; Local_Pass++)
+    {
+        for (Local_Index = 0; Local_Index < PIXTEST_BENCH_PIXELS; Local_Index++)
+        {
+            PIXTEST_BenchDestination[Local_Index] = PIXTEST_ConvertReference(&PIXTEST_BenchRgb[3 * Local_Index]);
+        }
+    }
+    Local_Scalar = TEST_Seconds() - Local_Start;
+    Local_Start = TEST_Seconds();
+    for (Local_Pass = 0; Local_Pass < PIXTEST_BENCH_PASSES; Local_Pass++)
+    {
+        PIXEL_ConvertRgb888(PIXTEST_BenchDestination, PIXTEST_BenchRgb, PIXTEST_BENCH_PIXELS);
+    }
+    Local_Kernel = TEST_Seconds() - Local_Start;
+    printf("bench %-22s %8.1f Mpixel/s (scalar %8.1f)\n", "PIXEL_ConvertRgb888", Local_Megapixels / Local_Kernel, Local_Megapixels / Local_Scalar);
+
+    Local_Start = TEST_Seconds();
+    for (Local_Pass = 0; Local_Pass < PIXTEST_BENCH_PASSES; Local_Pass++)
+    {
+        PIXEL_GradientSpan(PIXTEST_BenchDestination, PIXTEST_BENCH_PIXELS, PIXTEST_BenchSource[Local_Pass & 7], PIXTEST_BenchSource[(Local_Pass + 1) & 7]);
+    }
+    Local_Kernel = TEST_Seconds() - Local_Start;
+    printf("bench %-22s %8.1f Mpixel/s\n", "PIXEL_GradientSpan", Local_Megapixels / Local_Kernel);
+}
+
+int main(int argc, char **argv)
+{
+    u32 Local_Pair;
+    u32 Local_Mismatches;
+    u32 Local_Errors;
+    u32 Local_Overruns;
+    u16 Local_Alpha;
+    u16 Local_Background;
+    u16 Local_Foreground;
+    u8 Local_Kernel;
+    u8 Local_DestinationOffset;
+    u8 Local_SourceOffset;
+    u8 Local_Length;
+    u16 Local_Count;
+    u16 Local_Index;
+    u16 Local_Start;
+    u16 Local_End;
+    u8 Local_Channel;
+    s32 Local_Exact;
+    s32 Local_Error;
+    s32 Local_MaxError;
+
+    TEST_Init(argc, argv);
+
+    /**< Single blends: every alpha of random color pairs */
+    Local_Mismatches = 0;
+    for (Local_Pair = 0; Local_Pair < PIXTEST_BLEND_PAIRS; Local_Pair++)
+    {
+        Local_Background = (u16)PIXTEST_Random();
+        Local_Foreground = (u16)PIXTEST_Random();
+        for (Local_Alpha = 0; Local_Alpha < 256; Local_Alpha++)
+        {
+            if (PIXEL_Blend(Local_Background, Local_Foreground, (u8)Local_Alpha) != PIXTEST_BlendReference(Local_Background, Local_Foreground, (u8)Local_Alpha))
+            {
+                Local_Mismatches++;
+            }
+        }
+    }
+    TEST_Check(Local_Mismatches == 0, "PIXEL_Blend: %u mismatches in %u blends", Local_Mismatches, PIXTEST_BLEND_PAIRS * 256);
+
+    /**< Spans at every alignment: destination by 0..1 pixels, source by 0..3 pixels or bytes */
+    for (Local_Kernel = 0; Local_Kernel < PIXTEST_KERNELS; Local_Kernel++)
+    {
+        Local_Mismatches = 0;
+        for (Local_DestinationOffset = 0; Local_DestinationOffset < 2; Local_DestinationOffset++)
+        {
+            for (Local_SourceOffset = 0; Local_SourceOffset < 4; Local_SourceOffset++)
+            {
+                for (Local_Length = 0; Local_Length < PIXTEST_MAX_LENGTH; Local_Length++)
+                {
+                    if (!PIXTEST_RunSpan((PIXTEST_Kernel_t)Local_Kernel, Local_DestinationOffset, Local_SourceOffset, Local_Length))
+                    {
+                        Local_Mismatches++;
+                    }
+                }
+            }
+        }
+        TEST_Check(Local_Mismatches == 0, "%s: %u wrong spans of %u (every alignment, lengths 0..%u)", PIXTEST_KernelNames[Local_Kernel],
+                   Local_Mismatches, 2 * 4 * PIXTEST_MAX_LENGTH, PIXTEST_MAX_LENGTH - 1);
+    }
+
+    /**< Gradients: end colors, rounding, no overrun */
+    Local_Errors = 0;
+    Local_Overruns = 0;
+    Local_MaxError = 0;
+    for (Local_Pair = 0; Local_Pair < PIXTEST_GRADIENTS; Local_Pair++)
+    {
+        Local_Count = (u16)(1 + PIXTEST_Random() % PIXTEST_GRADIENT_MAX);
+        Local_DestinationOffset = (u8)(PIXTEST_Random() & 1);
+        Local_Start = (u16)PIXTEST_Random();
+        Local_End = (u16)PIXTEST_Random();
+        PIXTEST_Gradient[Local_DestinationOffset + Local_Count] = 0xDEAD;
+
+        PIXEL_GradientSpan(&PIXTEST_Gradient[Local_DestinationOffset], Local_Count, Local_Start, Local_End);
+
+        if (PIXTEST_Gradient[Local_DestinationOffset + Local_Count] != 0xDEAD)
+        {
+            Local_Overruns++;
+        }
+        if ((PIXTEST_Gradient[Local_DestinationOffset] != Local_Start) ||
+            (PIXTEST_Gradient[Local_DestinationOffset + Local_Count - 1] != ((Local_Count > 1) ? Local_End : Local_Start)))
+        {
+            Local_Errors++;
+        }
+        for (Local_Index = 0; (Local_Count > 1) && (Local_Index < Local_Count); Local_Index++)
+        {
+            for (Local_Channel = 0; Local_Channel < 3; Local_Channel++)
+            {
+                /**< Exact interpolation rounded to the nearest, half away from the start */
+                Local_Exact = PIXTEST_Channel(Local_End, Local_Channel) - PIXTEST_Channel(Local_Start, Local_Channel);
+                Local_Exact = Local_Exact * Local_Index * 2 + ((Local_Exact < 0) ? -(Local_Count - 1) : (Local_Count - 1));
+                Local_Exact = PIXTEST_Channel(Local_Start, Local_Channel) + Local_Exact / (2 * (Local_Count - 1));
+                Local_Error = PIXTEST_Channel(PIXTEST_Gradient[Local_DestinationOffset + Local_Index], Local_Channel) - Local_Exact;
+                Local_Error = (Local_Error < 0) ? -Local_Error : Local_Error;
+                Local_MaxError = (Local_Error > Local_MaxError) ? Local_Error : Local_MaxError;
+            }
+        }
+    }
+    TEST_Check(Local_Errors == 0, "PIXEL_GradientSpan: %u wrong end colors in %u gradients", Local_Errors, PIXTEST_GRADIENTS);
+    TEST_Check(Local_Overruns == 0, "PIXEL_GradientSpan: %u writes past the span", Local_Overruns);
+    TEST_Check(Local_MaxError <= 1, "PIXEL_GradientSpan: largest error %d LSB against exact rounding", Local_MaxError);
+
+    if (TEST_IsBenchmark())
+    {
+        PIXTEST_Benchmark();
+    }
+
+    return TEST_Finish();
+}
@@ -0,0 +1,241 @@
+/**
+ * @file render_test.c
+ * @brief Host tests of the band renderer on every controller.
+ *
+ * A display list of overlapping rectangles, images and a custom rasterizer, some of them
+ * partly off the screen, is rendered with band buffers of one row, of an odd number of rows
+ * with a remainder, and of the whole screen. The glass is compared pixel for pixel with the
+ * commands painted in list order over the background, and the counts with one window per
+ * band and every pixel sent once. A region is rendered too, leaving the rest untouched.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     render_test
+ */
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "RENDER_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Commands of the display list, size of the images and the background.
+ */
+#define RDTEST_COMMANDS             8
+#define RDTEST_IMAGE_SIDE           24
+#define RDTEST_BACKGROUND           0x0841
+
+/**
+ * @brief Display list, image pixels, band buffer and expected screen.
+ */
+static RENDER_Cmd_t RDTEST_Cmds[RDTEST_COMMANDS];
+static RENDER_List_t RDTEST_List;
+static u16 RDTEST_Image[RDTEST_IMAGE_SIDE * RDTEST_IMAGE_SIDE];
+static const u16 RDTEST_CheckerColor = 0xFFE0;
+static u16 RDTEST_Buffer[TEST_MAX_SIDE * TEST_MAX_SIDE];
+static u32 RDTEST_Reference[TEST_MAX_SIDE * TEST_MAX_SIDE];
+
+/**
+ * @brief Tells whether the checker of the custom command covers a screen pixel.
+ */
+static u8 RDTEST_IsChecker(s32 Copy_X, s32 Copy_Y);
+
+/**
+ * @brief Custom rasterizer: a checkerboard of 4x4 squares in the color of the context.
+ */
+static void RDTEST_DrawChecker(const RENDER_Cmd_t *Copy_Cmd, u16 *Copy_Band, u16 Copy_BandX, u16 Copy_BandY, u16 Copy_BandWidth, u16 Copy_BandHeight);
+
+/**
+ * @brief Records the display list of a screen.
+ */
+static void RDTEST_MakeList(u16 Copy_Width, u16 Copy_Height);
+
+/**
+ * @brief Paints the commands in list order over the background, in a region of the reference.
+ */
+static void RDTEST_PaintList(u16 Copy_ScreenWidth, s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom);
+
+/**
+ * @brief Renders the list on a panel with a band buffer of Copy_BufferPixels and checks it.
+ */
+static void RDTEST_Run(const TEST_Panel_t *Copy_Panel, u32 Copy_BufferPixels);
+
+/**
+ * @brief Renders a region of the list on a panel and checks the rest is untouched.
+ */
+static void RDTEST_RunRegion(const TEST_Panel_t *Copy_Panel);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static u8 RDTEST_IsChecker(s32 Copy_X, s32 Copy_Y)
+{
+    return (((Copy_X ^ Copy_Y) & 0x04) != 0) ? 1 : 0;
+}
+
+static void RDTEST_DrawChecker(const RENDER_Cmd_t *Copy_Cmd, u16 *Copy_Band, u16 Copy_BandX, u16 Copy_BandY, u16 Copy_BandWidth, u16 Copy_BandHeight)
+{
+    s32 Local_X;
+    s32 Local_Y;
+
+    for (Local_Y = Copy_BandY; Local_Y < Copy_BandY + Copy_BandHeight; Local_Y++)
+    {
+        for (Local_X = Copy_BandX; Local_X < Copy_BandX + Copy_BandWidth; Local_X++)
+        {
+            if ((Local_X >= Copy_Cmd->X) && (Local_X < Copy_Cmd->X + Copy_Cmd->Width) && (Local_Y >= Copy_Cmd->Y) &&
+                (Local_Y < Copy_Cmd->Y + Copy_Cmd->Height) && RDTEST_IsChecker(Local_X, Local_Y))
+            {
+                Copy_Band[(Local_Y - Copy_BandY) * Copy_BandWidth + (Local_X - Copy_BandX)] = *(const u16 *)Copy_Cmd->Data;
+            }
+        }
+    }
+}
+
+static void RDTEST_MakeList(u16 Copy_Width, u16 Copy_Height)
+{
+    RENDER_Init(&RDTEST_List, RDTEST_Cmds, RDTEST_COMMANDS);
+    RENDER_FillRect(&RDTEST_List, 0, 0, Copy_Width, Copy_Height / 8, 0x001F);
+    RENDER_FillRect(&RDTEST_List, -12, Copy_Height / 4, Copy_Width / 2, Copy_Height / 3, 0xF800);
+    RENDER_Custom(&RDTEST_List, Copy_Width / 4, Copy_Height / 5, Copy_Width / 2, Copy_Height / 2, RDTEST_DrawChecker, &RDTEST_CheckerColor);
+    RENDER_Image(&RDTEST_List, Copy_Width / 3, Copy_Height / 3, RDTEST_IMAGE_SIDE, RDTEST_IMAGE_SIDE, RDTEST_Image);
+    RENDER_Image(&RDTEST_List, -7, -9, RDTEST_IMAGE_SIDE, RDTEST_IMAGE_SIDE, RDTEST_Image);
+    RENDER_Image(&RDTEST_List, Copy_Width - 10, Copy_Height - 15, RDTEST_IMAGE_SIDE, RDTEST_IMAGE_SIDE, RDTEST_Image);
+    RENDER_FillRect(&RDTEST_List, Copy_Width / 2, Copy_Height / 2, Copy_Width, Copy_Height, 0x07E0);
+    RENDER_FillRect(&RDTEST_List, 3, Copy_Height + 4, 10, 10, 0xFFFF);
+}
+
+static void RDTEST_PaintList(u16 Copy_ScreenWidth, s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom)
+{
+    const RENDER_Cmd_t *Local_Cmd;
+    u16 Local_Color;
+    s32 Local_X;
+    s32 Local_Y;
+    u8 Local_Index;
+
+    for (Local_Y = Copy_Top; Local_Y < Copy_Bottom; Local_Y++)
+    {
+        for (Local_X = Copy_Left; Local_X < Copy_Right; Local_X++)
+        {
+            Local_Color = RDTEST_BACKGROUND;
+            for (Local_Index = 0; Local_Index < RDTEST_List.Count; Local_Index++)
+            {
+                Local_Cmd = &RDTEST_List.Cmds[Local_Index];
+                if ((Local_X < Local_Cmd->X) || (Local_X >= Local_Cmd->X + Local_Cmd->Width) || (Local_Y < Local_Cmd->Y) || (Local_Y >= Local_Cmd->Y + Local_Cmd->Height))
+                {
+                    continue;
+                }
+                switch (Local_Cmd->Type)
+                {
+                    case RENDER_FILL_RECT:
+                        Local_Color = Local_Cmd->Color;
+                        break;
+                    case RENDER_IMAGE:
+                        Local_Color = ((const u16 *)Local_Cmd->Data)[(Local_Y - Local_Cmd->Y) * Local_Cmd->Width + (Local_X - Local_Cmd->X)];
+                        break;
+                    default:
+                        Local_Color = RDTEST_IsChecker(Local_X, Local_Y) ? *(const u16 *)Local_Cmd->Data : Local_Color;
+                        break;
+                }
+            }
+            RDTEST_Reference[Local_Y * Copy_ScreenWidth + Local_X] = TEST_Rgb565ToRgb888(Local_Color);
+        }
+    }
+}
+
+static void RDTEST_Run(const TEST_Panel_t *Copy_Panel, u32 Copy_BufferPixels)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    u16 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    u16 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    u32 Local_Rows = ((Copy_BufferPixels / Local_Width) > Local_Height) ? Local_Height : (Copy_BufferPixels / Local_Width);
+    u32 Local_Bands = (Local_Height + Local_Rows - 1) / Local_Rows;
+    TFT_EMU_Stats_t Local_Stats;
+    SPI_t Local_Spi;
+    u8 Local_Status;
+
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    RDTEST_MakeList(Local_Width, Local_Height);
+    RDTEST_PaintList(Local_Width, 0, 0, Local_Width, Local_Height);
+
+    TFT_EMU_ResetStats();
+    Local_Status = RENDER_Draw(&RDTEST_List, Local_Config, Local_Spi, RDTEST_Buffer, Copy_BufferPixels, RDTEST_BACKGROUND);
+    TFT_EMU_GetStats(&Local_Stats);
+
+    TEST_Check((Local_Status == 0) && (Local_Stats.Errors == 0) && (Local_Stats.Windows == Local_Bands) && (Local_Stats.Pixels == (u32)Local_Width * Local_Height),
+               "%s: bands of %u rows, status %u, %u protocol errors, %u windows (%u expected), %u pixels",
+               Copy_Panel->Name, Local_Rows, Local_Status, Local_Stats.Errors, Local_Stats.Windows, Local_Bands, Local_Stats.Pixels);
+    TEST_Check(TEST_CountMismatches(RDTEST_Reference, Local_Width, Local_Height) == 0, "%s: bands of %u rows, %u wrong pixels",
+               Copy_Panel->Name, Local_Rows, TEST_CountMismatches(RDTEST_Reference, Local_Width, Local_Height));
+}
+
+static void RDTEST_RunRegion(const TEST_Panel_t *Copy_Panel)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    u16 Local_Width = Local_Config->TFT_Controller->TFT_Width;
+    u16 Local_Height = Local_Config->TFT_Controller->TFT_Height;
+    u16 Local_RegionX = Local_Width / 5;
+    u16 Local_RegionY = Local_Height / 6;
+    u16 Local_RegionWidth = Local_Width / 2;
+    u16 Local_RegionHeight = Local_Height / 2;
+    TFT_EMU_Stats_t Local_Stats;
+    SPI_t Local_Spi;
+    u8 Local_Status;
+
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TEST_CaptureScreen(RDTEST_Reference, Local_Width, Local_Height);
+    RDTEST_MakeList(Local_Width, Local_Height);
+    RDTEST_PaintList(Local_Width, Local_RegionX, Local_RegionY, Local_RegionX + Local_RegionWidth, Local_RegionY + Local_RegionHeight);
+
+    /**< Five rows per band and a remainder */
+    TFT_EMU_ResetStats();
+    Local_Status = RENDER_DrawRegion(&RDTEST_List, Local_Config, Local_Spi, RDTEST_Buffer, (u32)Local_RegionWidth * 5 + 3, RDTEST_BACKGROUND,
+                                     Local_RegionX, Local_RegionY, Local_RegionWidth, Local_RegionHeight);
+    TFT_EMU_GetStats(&Local_Stats);
+
+    TEST_Check((Local_Status == 0) && (Local_Stats.Errors == 0) && (Local_Stats.Windows == (u32)(Local_RegionHeight + 4) / 5) &&
+               (Local_Stats.Pixels == (u32)Local_RegionWidth * Local_RegionHeight) && (TEST_CountMismatches(RDTEST_Reference, Local_Width, Local_Height) == 0),
+               "%s: region %ux%u at %u,%u, status %u, %u protocol errors, %u windows, %u pixels, %u wrong pixels", Copy_Panel->Name,
+               Local_RegionWidth, Local_RegionHeight, Local_RegionX, Local_RegionY, Local_Status, Local_Stats.Errors, Local_Stats.Windows,
+               Local_Stats.Pixels, TEST_CountMismatches(RDTEST_Reference, Local_Width, Local_Height));
+
+    /**< A buffer shorter than a row is refused and nothing is sent */
+    TFT_EMU_ResetStats();
+    Local_Status = RENDER_DrawRegion(&RDTEST_List, Local_Config, Local_Spi, RDTEST_Buffer, Local_RegionWidth - 1, RDTEST_BACKGROUND,
+                                     Local_RegionX, Local_RegionY, Local_RegionWidth, Local_RegionHeight);
+    TFT_EMU_GetStats(&Local_Stats);
+    TEST_Check((Local_Status == 1) && (Local_Stats.Bytes == 0), "%s: buffer shorter than a row, status %u, %u bytes sent",
+               Copy_Panel->Name, Local_Status, Local_Stats.Bytes);
+}
+
+int main(int argc, char **argv)
+{
+    const TFT_Controller_t *Local_Controller;
+    u32 Local_Pixel;
+    u8 Local_Panel;
+
+    TEST_Init(argc, argv);
+
+    for (Local_Pixel = 0; Local_Pixel < RDTEST_IMAGE_SIDE * RDTEST_IMAGE_SIDE; Local_Pixel++)
+    {
+        RDTEST_Image[Local_Pixel] = (u16)(((Local_Pixel % RDTEST_IMAGE_SIDE) << 11) | ((Local_Pixel / RDTEST_IMAGE_SIDE) << 5) | 0x10);
+    }
+
+    for (Local_Panel = 0; Local_Panel < TEST_PanelCount; Local_Panel++)
+    {
+        Local_Controller = TEST_Panels[Local_Panel].Config.TFT_Controller;
+        RDTEST_Run(&TEST_Panels[Local_Panel], Local_Controller->TFT_Width);
+        RDTEST_Run(&TEST_Panels[Local_Panel], (u32)Local_Controller->TFT_Width * 7 + 5);
+        RDTEST_Run(&TEST_Panels[Local_Panel], (u32)Local_Controller->TFT_Width * Local_Controller->TFT_Height);
+        RDTEST_RunRegion(&TEST_Panels[Local_Panel]);
+    }
+
+    return TEST_Finish();
+}
@@ -0,0 +1,427 @@
+/**
+ * @file shape_test.c
+ * @brief Host tests of the shapes on every controller.
+ *
+ * Every shape is drawn on a fresh panel, inside the screen and across its edges, and the
+ * glass is compared pixel for pixel with a reference model that tests each pixel against the
+ * geometry: the rounded corners (a pixel is in when its distance to the corner centre is at
+ * most the radius + 1/2), the cut of the outlines and rings, the two ends of the arcs and the
+ * edges of the convex polygons. Every pixel must be written once, and none outside the screen.
+ * The polygon outlines are compared with the same lines drawn by TFT_DrawLine.
+ *
+ * @date 17 Oct 2026
+ * @version V01
+ * @author Mahmoud Abdelraouf Mahmoud
+ *
+ * Usage:
+ *     shape_test
+ */
+#include <math.h>
+#include <stdio.h>
+/**< LIB */
+#include "STD_TYPES.h"
+/**< MCAL */
+#include "SPI_interface.h"
+/**< HAL */
+#include "TFT_interface.h"
+/**< SERVICES */
+#include "SHAPE_interface.h"
+/**< TOOLS */
+#include "TFT_EMU_interface.h"
+#include "TEST_interface.h"
+
+/**
+ * @brief Scale of the sines of the arc ends, as in SHAPE_SineTable.
+ */
+#define SHTEST_SINE_ONE             16384
+#define SHTEST_PI                   3.14159265358979323846
+
+/**
+ * @brief Expected screen, its size and the number of pixels the model painted.
+ */
+static u32 SHTEST_Reference[TEST_MAX_SIDE * TEST_MAX_SIDE];
+static s32 SHTEST_Width;
+static s32 SHTEST_Height;
+static u32 SHTEST_Painted;
+
+/**
+ * @brief Starts a panel for one shape and captures its untouched screen as the reference.
+ */
+static SPI_t SHTEST_Begin(const TEST_Panel_t *Copy_Panel);
+
+/**
+ * @brief Checks the glass and the counts of the shape drawn since SHTEST_Begin.
+ */
+static void SHTEST_End(const TEST_Panel_t *Copy_Panel, const char *Copy_Shape);
+
+/**
+ * @brief Sets a pixel of the reference, when it is on the screen.
+ */
+static void SHTEST_Paint(s32 Copy_X, s32 Copy_Y, u16 Copy_Color);
+
+/**
+ * @brief Tells whether a pixel is in the box Left..Right, Top..Bottom with corners of a radius.
+ */
+static u8 SHTEST_IsInRounded(s32 Copy_X, s32 Copy_Y, s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom, s32 Copy_Radius);
+
+/**
+ * @brief Sine of an angle in degrees, scaled by SHTEST_SINE_ONE and rounded.
+ */
+static s32 SHTEST_Sine(u16 Copy_Angle);
+
+/**
+ * @brief Paints a rounded box, an outline of it when Copy_Thickness is not 0, and keeps the
+ * angles from Copy_Start to Copy_End clockwise when Copy_IsArc is set.
+ */
+static void SHTEST_PaintRounded(s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom, s32 Copy_Radius, s32 Copy_Thickness,
+                                u8 Copy_IsArc, u16 Copy_Start, u16 Copy_End, u16 Copy_Color);
+
+/**
+ * @brief Paints a convex polygon: the pixels on or inside all its edges.
+ */
+static void SHTEST_PaintPolygon(const SHAPE_Point_t *Copy_Points, u8 Copy_Count, u16 Copy_Color);
+
+/**
+ * @brief Draws every shape on a panel and checks it.
+ */
+static void SHTEST_Run(const TEST_Panel_t *Copy_Panel);
+
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+static SPI_t SHTEST_Begin(const TEST_Panel_t *Copy_Panel)
+{
+    SPI_t Local_Spi = TEST_StartPanel(Copy_Panel);
+
+    SHTEST_Width = Copy_Panel->Config.TFT_Controller->TFT_Width;
+    SHTEST_Height = Copy_Panel->Config.TFT_Controller->TFT_Height;
+    SHTEST_Painted = 0;
+    TEST_CaptureScreen(SHTEST_Reference, (u16)SHTEST_Width, (u16)SHTEST_Height);
+    TFT_EMU_ResetStats();
+
+    return Local_Spi;
+}
+
+static void SHTEST_End(const TEST_Panel_t *Copy_Panel, const char *Copy_Shape)
+{
+    TFT_EMU_Stats_t Local_Stats;
+    u32 Local_Mismatches = TEST_CountMismatches(SHTEST_Reference, (u16)SHTEST_Width, (u16)SHTEST_Height);
+
+    TFT_EMU_GetStats(&Local_Stats);
+    TEST_Check((Local_Stats.Errors == 0) && (Local_Stats.Pixels == SHTEST_Painted) && (Local_Mismatches == 0),
+               "%s: %s, %u protocol errors, %u pixels written for %u, %u wrong pixels", Copy_Panel->Name, Copy_Shape,
+               Local_Stats.Errors, Local_Stats.Pixels, SHTEST_Painted, Local_Mismatches);
+}
+
+static void SHTEST_Paint(s32 Copy_X, s32 Copy_Y, u16 Copy_Color)
+{
+    if ((Copy_X >= 0) && (Copy_X < SHTEST_Width) && (Copy_Y >= 0) && (Copy_Y < SHTEST_Height))
+    {
+        SHTEST_Reference[Copy_Y * SHTEST_Width + Copy_X] = TEST_Rgb565ToRgb888(Copy_Color);
+        SHTEST_Painted++;
+    }
+}
+
+static u8 SHTEST_IsInRounded(s32 Copy_X, s32 Copy_Y, s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom, s32 Copy_Radius)
+{
+    s32 Local_DX;
+    s32 Local_DY;
+
+    if ((Copy_X < Copy_Left) || (Copy_X > Copy_Right) || (Copy_Y < Copy_Top) || (Copy_Y > Copy_Bottom))
+    {
+        return 0;
+    }
+
+    /**< Distance to the nearest point of the box shrunk by the radius */
+    Local_DX = Copy_X - ((Copy_X < Copy_Left + Copy_Radius) ? (Copy_Left + Copy_Radius) : (Copy_X > Copy_Right - Copy_Radius) ? (Copy_Right - Copy_Radius) : Copy_X);
+    Local_DY = Copy_Y - ((Copy_Y < Copy_Top + Copy_Radius) ? (Copy_Top + Copy_Radius) : (Copy_Y > Copy_Bottom - Copy_Radius) ? (Copy_Bottom - Copy_Radius) : Copy_Y);
+
+    return ((Local_DX * Local_DX + Local_DY * Local_DY) <= (Copy_Radius * Copy_Radius + Copy_Radius)) ? 1 : 0;
+}
+
+static s32 SHTEST_Sine(u16 Copy_Angle)
+{
+    return (s32)lround(sin(Copy_Angle * SHTEST_PI / 180.0) * SHTEST_SINE_ONE);
+}
+
+static void SHTEST_PaintRounded(s32 Copy_Left, s32 Copy_Top, s32 Copy_Right, s32 Copy_Bottom, s32 Copy_Radius, s32 Copy_Thickness,
+                                u8 Copy_IsArc, u16 Copy_Start, u16 Copy_End, u16 Copy_Color)
+{
+    s32 Local_XCenter = (Copy_Left + Copy_Right) / 2;
+    s32 Local_YCenter = (Copy_Top + Copy_Bottom) / 2;
+    s32 Local_StartX = SHTEST_Sine(Copy_Start + 90);
+    s32 Local_StartY = SHTEST_Sine(Copy_Start);
+    s32 Local_EndX = SHTEST_Sine(Copy_End + 90);
+    s32 Local_EndY = SHTEST_Sine(Copy_End);
+    u16 Local_Sweep = (u16)((Copy_End % 360 + 360 - Copy_Start % 360) % 360);
+    u8 Local_IsIn;
+    s32 Local_DX;
+    s32 Local_DY;
+    s32 Local_X;
+    s32 Local_Y;
+
+    for (Local_Y = Copy_Top; Local_Y <= Copy_Bottom; Local_Y++)
+    {
+        for (Local_X = Copy_Left; Local_X <= Copy_Right; Local_X++)
+        {
+            Local_IsIn = SHTEST_IsInRounded(Local_X, Local_Y, Copy_Left, Copy_Top, Copy_Right, Copy_Bottom, Copy_Radius);
+
+            /**< Outlines and rings: less the box inset by the thickness, with the radius less the thickness */
+            if (Local_IsIn && (Copy_Thickness > 0) && SHTEST_IsInRounded(Local_X, Local_Y, Copy_Left + Copy_Thickness, Copy_Top + Copy_Thickness,
+                                                                          Copy_Right - Copy_Thickness, Copy_Bottom - Copy_Thickness,
+                                                                          (Copy_Radius > Copy_Thickness) ? (Copy_Radius - Copy_Thickness) : 0))
+            {
+                Local_IsIn = 0;
+            }
+
+            /**< Arcs: clockwise from the start and counterclockwise from the end, either side for a wide arc */
+            if (Local_IsIn && Copy_IsArc && (Local_Sweep != 0))
+            {
+                Local_DX = Local_X - Local_XCenter;
+                Local_DY = Local_Y - Local_YCenter;
+                if (Local_Sweep <= 180)
+                {
+                    Local_IsIn = (((Local_StartX * Local_DY - Local_StartY * Local_DX) >= 0) && ((Local_EndY * Local_DX - Local_EndX * Local_DY) >= 0)) ? 1 : 0;
+                }
+                else
+                {
+                    Local_IsIn = (((Local_EndX * Local_DY - Local_EndY * Local_DX) > 0) && ((Local_StartY * Local_DX - Local_StartX * Local_DY) > 0)) ? 0 : 1;
+                }
+            }
+
+            if (Local_IsIn)
+            {
+                SHTEST_Paint(Local_X, Local_Y, Copy_Color);
+            }
+        }
+    }
+}
+
+static void SHTEST_PaintPolygon(const SHAPE_Point_t *Copy_Points, u8 Copy_Count, u16 Copy_Color)
+{
+    s32 Local_Left = Copy_Points[0].X;
+    s32 Local_Top = Copy_Points[0].Y;
+    s32 Local_Right = Copy_Points[0].X;
+    s32 Local_Bottom = Copy_Points[0].Y;
+    s32 Local_Cross;
+    u8 Local_Outside;
+    u8 Local_Inside;
+    u8 Local_Index;
+    const SHAPE_Point_t *Local_From;
+    const SHAPE_Point_t *Local_To;
+    s32 Local_X;
+    s32 Local_Y;
+
+    for (Local_Index = 1; Local_Index < Copy_Count; Local_Index++)
+    {
+        Local_Left = (Copy_Points[Local_Index].X < Local_Left) ? Copy_Points[Local_Index].X : Local_Left;
+        Local_Right = (Copy_Points[Local_Index].X > Local_Right) ? Copy_Points[Local_Index].X : Local_Right;
+        Local_Top = (Copy_Points[Local_Index].Y < Local_Top) ? Copy_Points[Local_Index].Y : Local_Top;
+        Local_Bottom = (Copy_Points[Local_Index].Y > Local_Bottom) ? Copy_Points[Local_Index].Y : Local_Bottom;
+    }
+
+    for (Local_Y = Local_Top; Local_Y <= Local_Bottom; Local_Y++)
+    {
+        for (Local_X = Local_Left; Local_X <= Local_Right; Local_X++)
+        {
+            /**< In when no edge has the pixel on its left, or none on its right: either winding */
+            Local_Outside = 0;
+            Local_Inside = 0;
+            for (Local_Index = 0; Local_Index < Copy_Count; Local_Index++)
+            {
+                Local_From = &Copy_Points[Local_Index];
+                Local_To = &Copy_Points[((Local_Index + 1) == Copy_Count) ? 0 : (Local_Index + 1)];
+                Local_Cross = ((s32)Local_To->X - Local_From->X) * (Local_Y - Local_From->Y) - ((s32)Local_To->Y - Local_From->Y) * (Local_X - Local_From->X);
+                Local_Outside |= (Local_Cross < 0) ? 1 : 0;
+                Local_Inside |= (Local_Cross > 0) ? 1 : 0;
+            }
+            if (!(Local_Outside && Local_Inside))
+            {
+                SHTEST_Paint(Local_X, Local_Y, Copy_Color);
+            }
+        }
+    }
+}
+
+static void SHTEST_Run(const TEST_Panel_t *Copy_Panel)
+{
+    const TFT_Config_t *Local_Config = &Copy_Panel->Config;
+    s16 Local_Width = (s16)Local_Config->TFT_Controller->TFT_Width;
+    s16 Local_Height = (s16)Local_Config->TFT_Controller->TFT_Height;
+    s16 Local_Side = (Local_Width < Local_Height) ? Local_Width : Local_Height;
+    s16 Local_X = Local_Width / 2;
+    s16 Local_Y = Local_Height / 2;
+    s16 Local_Radius = Local_Side / 3;
+    SHAPE_Point_t Local_Points[6];
+    SHAPE_Point_t Local_Reversed[6];
+    TFT_EMU_Stats_t Local_Stats;
+    SPI_t Local_Spi;
+    u8 Local_Index;
+
+    /**< Circles */
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillCircle(Local_Config, Local_Spi, Local_X, Local_Y, Local_Radius, 0xF800);
+    SHTEST_PaintRounded(Local_X - Local_Radius, Local_Y - Local_Radius, Local_X + Local_Radius, Local_Y + Local_Radius, Local_Radius, 0, 0, 0, 0, 0xF800);
+    SHTEST_End(Copy_Panel, "fill circle");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillCircle(Local_Config, Local_Spi, 5, 7, 0, 0x07E0);
+    SHTEST_Paint(5, 7, 0x07E0);
+    SHTEST_End(Copy_Panel, "fill circle of radius 0");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillCircle(Local_Config, Local_Spi, -10, Local_Height - 8, Local_Side / 4, 0x001F);
+    SHTEST_PaintRounded(-10 - Local_Side / 4, Local_Height - 8 - Local_Side / 4, -10 + Local_Side / 4, Local_Height - 8 + Local_Side / 4, Local_Side / 4, 0, 0, 0, 0, 0x001F);
+    SHTEST_End(Copy_Panel, "fill circle across the bottom-left corner");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_DrawCircle(Local_Config, Local_Spi, Local_X, Local_Y, Local_Radius, 0xFFFF);
+    SHTEST_PaintRounded(Local_X - Local_Radius, Local_Y - Local_Radius, Local_X + Local_Radius, Local_Y + Local_Radius, Local_Radius, 1, 0, 0, 0, 0xFFFF);
+    SHTEST_End(Copy_Panel, "circle");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_DrawCircle(Local_Config, Local_Spi, Local_Width + 5, 10, 30, 0xFFE0);
+    SHTEST_PaintRounded(Local_Width + 5 - 30, 10 - 30, Local_Width + 5 + 30, 10 + 30, 30, 1, 0, 0, 0, 0xFFE0);
+    SHTEST_End(Copy_Panel, "circle across the top-right corner");
+
+    /**< Arcs: narrow, half turn, wide, full ring and pie */
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_DrawArc(Local_Config, Local_Spi, Local_X, Local_Y, Local_Radius, 6, 30, 120, 0x07FF);
+    SHTEST_PaintRounded(Local_X - Local_Radius, Local_Y - Local_Radius, Local_X + Local_Radius, Local_Y + Local_Radius, Local_Radius, 6, 1, 30, 120, 0x07FF);
+    SHTEST_End(Copy_Panel, "arc of 90 degrees");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_DrawArc(Local_Config, Local_Spi, Local_X, Local_Y, Local_Radius, 9, 180, 0, 0xF81F);
+    SHTEST_PaintRounded(Local_X - Local_Radius, Local_Y - Local_Radius, Local_X + Local_Radius, Local_Y + Local_Radius, Local_Radius, 9, 1, 180, 0, 0xF81F);
+    SHTEST_End(Copy_Panel, "arc of a half turn");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_DrawArc(Local_Config, Local_Spi, Local_X, Local_Y, Local_Radius, 5, 135, 45, 0x07E0);
+    SHTEST_PaintRounded(Local_X - Local_Radius, Local_Y - Local_Radius, Local_X + Local_Radius, Local_Y + Local_Radius, Local_Radius, 5, 1, 135, 45, 0x07E0);
+    SHTEST_End(Copy_Panel, "arc of 270 degrees");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_DrawArc(Local_Config, Local_Spi, Local_X, Local_Y, Local_Radius, 4, 405, 45, 0xFD20);
+    SHTEST_PaintRounded(Local_X - Local_Radius, Local_Y - Local_Radius, Local_X + Local_Radius, Local_Y + Local_Radius, Local_Radius, 4, 1, 405, 45, 0xFD20);
+    SHTEST_End(Copy_Panel, "full ring");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_DrawArc(Local_Config, Local_Spi, 12, 12, 20, 40, 300, 30, 0xFFFF);
+    SHTEST_PaintRounded(12 - 20, 12 - 20, 12 + 20, 12 + 20, 20, 40, 1, 300, 30, 0xFFFF);
+    SHTEST_End(Copy_Panel, "pie across the top-left corner");
+
+    /**< Rounded rectangles, the radius reduced to half the shorter side */
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillRoundRect(Local_Config, Local_Spi, Local_Width / 8, Local_Height / 8, Local_Width * 3 / 4, Local_Height / 2, 12, 0x001F);
+    SHTEST_PaintRounded(Local_Width / 8, Local_Height / 8, Local_Width / 8 + Local_Width * 3 / 4 - 1, Local_Height / 8 + Local_Height / 2 - 1, 12, 0, 0, 0, 0, 0x001F);
+    SHTEST_End(Copy_Panel, "filled rounded rectangle");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillRoundRect(Local_Config, Local_Spi, 10, 10, 40, 20, 100, 0x07E0);
+    SHTEST_PaintRounded(10, 10, 49, 29, 9, 0, 0, 0, 0, 0x07E0);
+    SHTEST_End(Copy_Panel, "filled rounded rectangle of a large radius");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_DrawRoundRect(Local_Config, Local_Spi, Local_Width / 4, Local_Height / 3, Local_Width / 2, Local_Height / 3, 8, 0xFFFF);
+    SHTEST_PaintRounded(Local_Width / 4, Local_Height / 3, Local_Width / 4 + Local_Width / 2 - 1, Local_Height / 3 + Local_Height / 3 - 1, 8, 1, 0, 0, 0, 0xFFFF);
+    SHTEST_End(Copy_Panel, "rounded rectangle");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_DrawRoundRect(Local_Config, Local_Spi, -6, Local_Height - 26, 40, 30, 10, 0xF800);
+    SHTEST_PaintRounded(-6, Local_Height - 26, 33, Local_Height + 3, 10, 1, 0, 0, 0, 0xF800);
+    SHTEST_End(Copy_Panel, "rounded rectangle across the bottom-left corner");
+
+    /**< Convex polygons in both windings, inside and across the screen */
+    Local_Points[0].X = Local_Width / 2;
+    Local_Points[0].Y = 4;
+    Local_Points[1].X = Local_Width - 5;
+    Local_Points[1].Y = Local_Height / 2;
+    Local_Points[2].X = 3;
+    Local_Points[2].Y = Local_Height - 7;
+    for (Local_Index = 0; Local_Index < 3; Local_Index++)
+    {
+        Local_Reversed[Local_Index] = Local_Points[2 - Local_Index];
+    }
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillTriangle(Local_Config, Local_Spi, Local_Points[0].X, Local_Points[0].Y, Local_Points[1].X, Local_Points[1].Y, Local_Points[2].X, Local_Points[2].Y, 0xFD20);
+    SHTEST_PaintPolygon(Local_Points, 3, 0xFD20);
+    SHTEST_End(Copy_Panel, "filled triangle");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillPolygon(Local_Config, Local_Spi, Local_Reversed, 3, 0xFD20);
+    SHTEST_PaintPolygon(Local_Reversed, 3, 0xFD20);
+    SHTEST_End(Copy_Panel, "filled triangle, counterclockwise");
+
+    /**< Outline: the same lines as TFT_DrawLine, the vertices written by both of their lines */
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TFT_EMU_ResetStats();
+    for (Local_Index = 0; Local_Index < 3; Local_Index++)
+    {
+        TFT_DrawLine(Local_Config, Local_Spi, (u16)Local_Points[Local_Index].X, (u16)Local_Points[Local_Index].Y,
+                     (u16)Local_Points[(Local_Index + 1) % 3].X, (u16)Local_Points[(Local_Index + 1) % 3].Y, 0xFFFF);
+    }
+    TFT_EMU_GetStats(&Local_Stats);
+    TEST_CaptureScreen(SHTEST_Reference, (u16)Local_Width, (u16)Local_Height);
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TFT_EMU_ResetStats();
+    SHAPE_DrawTriangle(Local_Config, Local_Spi, Local_Points[0].X, Local_Points[0].Y, Local_Points[1].X, Local_Points[1].Y, Local_Points[2].X, Local_Points[2].Y, 0xFFFF);
+    SHTEST_Painted = Local_Stats.Pixels;
+    SHTEST_End(Copy_Panel, "triangle");
+
+    Local_Points[0].X = -20;
+    Local_Points[0].Y = -10;
+    Local_Points[1].X = Local_Width + 30;
+    Local_Points[1].Y = Local_Height / 3;
+    Local_Points[2].X = Local_Width / 3;
+    Local_Points[2].Y = Local_Height + 15;
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillTriangle(Local_Config, Local_Spi, Local_Points[0].X, Local_Points[0].Y, Local_Points[1].X, Local_Points[1].Y, Local_Points[2].X, Local_Points[2].Y, 0x07FF);
+    SHTEST_PaintPolygon(Local_Points, 3, 0x07FF);
+    SHTEST_End(Copy_Panel, "filled triangle across three edges");
+
+    Local_Points[0].X = Local_Width / 4;
+    Local_Points[0].Y = Local_Height * 3 / 4;
+    Local_Points[1].X = Local_Width / 2;
+    Local_Points[1].Y = Local_Height * 5 / 8;
+    Local_Points[2].X = Local_Width * 3 / 4;
+    Local_Points[2].Y = Local_Height * 3 / 4;
+    Local_Points[3].X = Local_Width * 3 / 4;
+    Local_Points[3].Y = Local_Height * 7 / 8;
+    Local_Points[4].X = Local_Width / 2;
+    Local_Points[4].Y = Local_Height + Local_Height / 8;
+    Local_Points[5].X = Local_Width / 4;
+    Local_Points[5].Y = Local_Height * 7 / 8;
+    for (Local_Index = 0; Local_Index < 6; Local_Index++)
+    {
+        Local_Reversed[Local_Index] = Local_Points[5 - Local_Index];
+    }
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillPolygon(Local_Config, Local_Spi, Local_Points, 6, 0xF81F);
+    SHTEST_PaintPolygon(Local_Points, 6, 0xF81F);
+    SHTEST_End(Copy_Panel, "filled hexagon across the bottom edge");
+
+    Local_Spi = SHTEST_Begin(Copy_Panel);
+    SHAPE_FillPolygon(Local_Config, Local_Spi, Local_Reversed, 6, 0xF81F);
+    SHTEST_PaintPolygon(Local_Reversed, 6, 0xF81F);
+    SHTEST_End(Copy_Panel, "filled hexagon across the bottom edge, counterclockwise");
+
+    /**< Clipped outline: only what is on the screen reaches the panel */
+    Local_Spi = TEST_StartPanel(Copy_Panel);
+    TFT_EMU_ResetStats();
+    SHAPE_DrawPolygon(Local_Config, Local_Spi, Local_Points, 6, 0xFFFF);
+    TFT_EMU_GetStats(&Local_Stats);
+    TEST_Check((Local_Stats.Errors == 0) && (Local_Stats.Pixels > 0), "%s: hexagon across the bottom edge, %u protocol errors, %u pixels",
+               Copy_Panel->Name, Local_Stats.Errors, Local_Stats.Pixels);
+}
+
+int main(int argc, char **argv)
+{
+    u8 Local_Panel;
+
+    TEST_Init(argc, argv);
+
+    for (Local_Panel = 0; Local_Panel < TEST_PanelCount; Local_Panel++)
+    {
+        SHTEST_Run(&TEST_Panels[Local_Panel]);
+    }
+
+    return TEST_Finish();
+}
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""
+@file tfttests.py
+@brief Builds and runs the host tests of the display drivers and services.
+
+Every test program is built with the host TFT emulator in place of the MCAL, the test support
+(TEST_program.c), the TFT core, every controller and the services it tests, with warnings as
+errors. Each program prints one line per check; the run fails (exit status 1) when a program
+does not build, a check fails or a program exits with an error.
+
+With --bench the programs that have throughput measurements also run them and print the
+results; they are informative and never fail the run.
+
+@date 17 Oct 2026
+@version V01
+@author Mahmoud Abdelraouf Mahmoud
+
+Usage:
+    tfttests.py [--test pixel] [--bench] [--cc gcc]
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.normpath(os.path.join(HERE, "..", ".."))
+COTS = os.path.join(ROOT, "COTS")
+EMULATOR = os.path.join(ROOT, "Tools", "TFT_Emulator")
+HAL = os.path.join(COTS, "03-HAL")
+SERVICES = os.path.join(COTS, "04-SERVICES")
+
+# Sources of every test program.
+COMMON = [
+    os.path.join(HERE, "TEST_program.c"),
+    os.path.join(EMULATOR, "TFT_EMU_program.c"),
+    os.path.join(HAL, "TFT_Display", "TFT_Core", "TFT_program.c"),
+    os.path.join(HAL, "TFT_Display", "TFT_ST7735S", "TFT_ST7735S_program.c"),
+    os.path.join(HAL, "TFT_Display", "TFT_HX8357B", "TFT_HX8357B_program.c"),
+    os.path.join(HAL, "TFT_Display", "TFT_ILI9481", "TFT_ILI9481_program.c"),
+]
+
+# Test programs and the sources they test.
+TESTS = {
+    "blit": [],
+    "chart": [os.path.join(SERVICES, "CHART", "CHART_program.c")],
+    "console": [os.path.join(SERVICES, "CONSOLE", "CONSOLE_program.c")],
+    "frame": [os.path.join(SERVICES, "FRAME", "FRAME_program.c")],
+    "image": [],
+    "init": [],
+    "jpeg": [os.path.join(SERVICES, "JPEG", "JPEG_program.c")],
+    "line": [],
+    "pixel": [os.path.join(SERVICES, "PIXEL", "PIXEL_program.c")],
+    "render": [os.path.join(SERVICES, "RENDER", "RENDER_program.c")],
+    "shape": [os.path.join(SERVICES, "SHAPE", "SHAPE_program.c")],
+}
+
+FLAGS = ["-std=c11", "-O2", "-Wall", "-Wextra", "-Werror"]
+LIBS = ["-lm"]
+
+
+def build(cc, directory, name):
+    """Compile one test program into directory; return the executable, or None on failure."""
+    includes = ["-I" + HERE]
+    for base in (COTS, EMULATOR):
+        for path, _, _ in os.walk(base):
+            includes.append("-I" + path)
+    binary = os.path.join(directory, name + "_test")
+    sources = [os.path.join(HERE, name + "_test.c")] + COMMON + TESTS[name]
+    command = [cc] + FLAGS + includes + ["-o", binary] + sources + LIBS
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    if result.returncode != 0:
+        print("%s: build failed\n%s" % (name, result.stdout))
+        return None
+    return binary
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the host tests of the display drivers.")
+    parser.add_argument("--test", action="append", choices=sorted(TESTS),
+                        help="test program to run (default: all), may be repeated")
+    parser.add_argument("--bench", action="store_true", help="also run the throughput measurements")
+    parser.add_argument("--cc", default="gcc", help="host C compiler")
+    args = parser.parse_args()
+
+    failed = []
+    with tempfile.TemporaryDirectory() as directory:
+        for name in args.test or sorted(TESTS):
+            print("== %s" % name)
+            sys.stdout.flush()
+            binary = build(args.cc, directory, name)
+            if binary is None:
+                failed.append(name)
+                continue
+            command = [binary] + (["--bench"] if args.bench else [])
+            if subprocess.run(command).returncode != 0:
+                failed.append(name)
+
+    for name in failed:
+        print("FAILED: " + name)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
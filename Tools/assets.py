@@ -0,0 +1,314 @@
+#!/usr/bin/env python3
+"""
+@file assets.py
+@brief Converts PNG/BMP assets to const TFT_Image_t images and writes a flash manifest.
+
+Every asset is converted to each encoding of TFT_ImageFormat_t and the smallest one is
+kept, unless a format is forced:
+
+- RGB565  2 bytes per pixel, lossless.
+- RLE     run/literal packets over palette indices or RGB565 values, lossless.
+- INDEXED 1/2/4/8-bit palette indices, lossless when the asset has at most 256 colors.
+- RGB444  12 bits per pixel, lossy; only considered with --lossy or --format rgb444.
+
+With --lossy, assets with more than 256 colors may also be reduced to a --colors palette
+(median cut). --dither applies Floyd-Steinberg error diffusion to these lossy reductions;
+the RGB565 conversion is not dithered, which would break the runs of flat UI colors.
+
+The manifest (manifest.csv in the output directory) lists the encoding and the flash size
+of each asset so builds can budget flash per asset.
+
+@date 17 Oct 2026
+@version V01
+@author Mahmoud Abdelraouf Mahmoud
+
+Usage:
+    assets.py [-o out_dir] [--format auto|rgb565|rgb444|indexed|rle] [--lossy] [--dither]
+              [--colors N] [--background RRGGBB] [--prefix Img_] asset.png asset.bmp ...
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+from imgencode import encode_image, load_bmp, write_image
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+
+def load_png(path, background):
+    """Return (width, height, pixels) of a non-interlaced PNG, pixels as (r, g, b) rows from
+    the top, alpha composited over background."""
+    with open(path, "rb") as png:
+        data = png.read()
+    if data[:8] != PNG_SIGNATURE:
+        sys.exit("%s: not a PNG file" % path)
+
+    pos = 8
+    idat = b""
+    palette = []
+    transparency = b""
+    while pos < len(data):
+        length, kind = struct.unpack_from(">I4s", data, pos)
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            transparency = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    if interlace:
+        sys.exit("%s: interlaced PNG files are not supported" % path)
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits = channels * depth
+    stride = (width * bits + 7) // 8
+    step = max(1, bits // 8)
+    raw = zlib.decompress(idat)
+
+    # Undo the per-row filters
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        row = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            left = row[i - step] if i >= step else 0
+            up = previous[i]
+            corner = previous[i - step] if i >= step else 0
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + up) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                p = left + up - corner
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - corner)
+                row[i] = (row[i] + (left if pa <= pb and pa <= pc else up if pb <= pc else corner)) & 0xFF
+        rows.append(row)
+        previous = row
+
+    def samples(row):
+        if depth == 8:
+            return list(row)
+        if depth == 16:
+            return list(row[0::2])
+        per = 8 // depth
+        return [(row[i // per] >> (8 - depth * (i % per + 1))) & ((1 << depth) - 1)
+                for i in range(width * channels)]
+
+    def blend(rgb, alpha):
+        return tuple((c * alpha + b * (255 - alpha)) // 255 for c, b in zip(rgb, background))
+
+    pixels = []
+    for row in rows:
+        s = samples(row)
+        for x in range(width):
+            if color == 3:
+                index = s[x]
+                alpha = transparency[index] if index < len(transparency) else 255
+                pixels.append(blend(palette[index], alpha))
+            elif color in (0, 4):
+                gray = s[x * channels] * 255 // ((1 << min(depth, 8)) - 1)
+                alpha = s[x * channels + 1] if color == 4 else 255
+                pixels.append(blend((gray, gray, gray), alpha))
+            else:
+                rgb = tuple(s[x * channels:x * channels + 3])
+                alpha = s[x * channels + 3] if color == 6 else 255
+                pixels.append(blend(rgb, alpha))
+    return width, height, pixels
+
+
+def reduce_colors(pixels, width, height, nearest, dither):
+    """Map every pixel through nearest(r, g, b) -> ((r, g, b), value), optionally with
+    Floyd-Steinberg error diffusion. Returns the list of values."""
+    if not dither:
+        return [nearest(*p)[1] for p in pixels]
+
+    values = []
+    work = [list(map(float, p)) for p in pixels]
+    for y in range(height):
+        for x in range(width):
+            pixel = work[y * width + x]
+            clamped = [min(255, max(0, int(round(c)))) for c in pixel]
+            approx, value = nearest(*clamped)
+            values.append(value)
+            error = [c - a for c, a in zip(pixel, approx)]
+            for dx, dy, weight in ((1, 0, 7), (-1, 1, 3), (0, 1, 5), (1, 1, 1)):
+                nx, ny = x + dx, y + dy
+                if 0 <= nx < width and ny < height:
+                    target = work[ny * width + nx]
+                    for c in range(3):
+                        target[c] += error[c] * weight / 16
+    return values
+
+
+def widen(value, bits):
+    """Expand a channel of the given width to 8 bits the way the decoders do."""
+    return (value << (8 - bits)) | (value >> (2 * bits - 8))
+
+
+def nearest565(r, g, b):
+    r5, g6, b5 = r >> 3, g >> 2, b >> 3
+    return (widen(r5, 5), widen(g6, 6), widen(b5, 5)), (r5 << 11) | (g6 << 5) | b5
+
+
+def nearest444(r, g, b):
+    r4, g4, b4 = (min(15, (c + 8) // 17) for c in (r, g, b))
+    return (r4 * 17, g4 * 17, b4 * 17), (r4 << 8) | (g4 << 4) | b4
+
+
+def to_rgb(color565):
+    return (widen(color565 >> 11, 5), widen((color565 >> 5) & 0x3F, 6), widen(color565 & 0x1F, 5))
+
+
+def median_cut(colors, count):
+    """Return up to count RGB565 colors representing the given RGB565 colors."""
+    def split_info(box):
+        """(widest channel range, channel) of a box, -1 when it cannot be split."""
+        if len(box) < 2:
+            return -1, 0
+        ranges = [max(p[c] for p in box) - min(p[c] for p in box) for c in range(3)]
+        return max(ranges), ranges.index(max(ranges))
+
+    first = [to_rgb(c) for c in set(colors)]
+    boxes = [(split_info(first), first)]
+    while len(boxes) < count:
+        boxes.sort(key=lambda entry: entry[0][0])
+        (spread, channel), box = boxes[-1]
+        if spread <= 0:
+            break
+        boxes.pop()
+        box.sort(key=lambda p: p[channel])
+        for half in (box[:len(box) // 2], box[len(box) // 2:]):
+            boxes.append((split_info(half), half))
+    return sorted(set(nearest565(*(sum(p[c] for p in box) // len(box) for c in range(3)))[1]
+                      for _, box in boxes))
+
+
+def pack_bits(values, bits):
+    """Pack values without padding, most significant bits first."""
+    out = bytearray()
+    acc = nbits = 0
+    for value in values:
+        acc = (acc << bits) | value
+        nbits += bits
+        while nbits >= 8:
+            nbits -= 8
+            out.append((acc >> nbits) & 0xFF)
+        acc &= (1 << nbits) - 1
+    if nbits:
+        out.append((acc << (8 - nbits)) & 0xFF)
+    return bytes(out)
+
+
+def indexed(colors, palette):
+    """Return the INDEXED candidate for RGB565 colors and a palette containing them."""
+    bits = next(b for b in (1, 2, 4, 8) if len(palette) <= (1 << b))
+    index = {color: i for i, color in enumerate(palette)}
+    return ("INDEXED", pack_bits([index[c] for c in colors], bits), palette, bits)
+
+
+def candidates(pixels, width, height, args):
+    """Return the encodings to choose from as (format, data, palette, index_bits)."""
+    colors = reduce_colors(pixels, width, height, nearest565, False)
+    distinct = sorted(set(colors))
+    wanted = args.format.upper()
+    result = []
+
+    if wanted in ("AUTO", "RGB565"):
+        result.append(("RGB565", b"".join(c.to_bytes(2, "big") for c in colors), None, 0))
+    if wanted in ("AUTO", "RLE"):
+        data, palette = encode_image(colors, "auto")
+        result.append(("RLE", data, palette, 0))
+    if wanted in ("AUTO", "INDEXED") and len(distinct) <= args.colors:
+        result.append(indexed(colors, distinct))
+    elif wanted == "INDEXED" or (wanted == "AUTO" and args.lossy):
+        palette = median_cut(colors, args.colors)
+        entries = [(to_rgb(p), p) for p in palette]
+        cache = {}
+
+        def nearest(r, g, b):
+            key = nearest565(r, g, b)[1]
+            if key not in cache:
+                kr, kg, kb = to_rgb(key)
+                cache[key] = min(entries, key=lambda e: (e[0][0] - kr) ** 2 + (e[0][1] - kg) ** 2 + (e[0][2] - kb) ** 2)
+            return cache[key]
+
+        result.append(indexed(reduce_colors(pixels, width, height, nearest, args.dither), palette))
+    if wanted == "RGB444" or (wanted == "AUTO" and args.lossy):
+        values = reduce_colors(pixels, width, height, nearest444, args.dither)
+        result.append(("RGB444", pack_bits(values, 12), None, 0))
+    return result
+
+
+def size_of(candidate):
+    _, data, palette, _ = candidate
+    return len(data) + (2 * len(palette) if palette else 0)
+
+
+def c_name(prefix, path):
+    stem = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+    return prefix + stem[:1].upper() + stem[1:]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert PNG/BMP assets to TFT_Image_t images.")
+    parser.add_argument("assets", nargs="+", help="PNG or BMP files")
+    parser.add_argument("-o", "--out", default=".", help="output directory")
+    parser.add_argument("--format", choices=("auto", "rgb565", "rgb444", "indexed", "rle"),
+                        default="auto", help="force an encoding (default: the smallest)")
+    parser.add_argument("--lossy", action="store_true",
+                        help="let auto pick RGB444 or a reduced palette")
+    parser.add_argument("--dither", action="store_true", help="Floyd-Steinberg dithering")
+    parser.add_argument("--colors", type=int, default=256, help="palette size limit (2..256)")
+    parser.add_argument("--background", default="000000",
+                        help="RRGGBB color transparent pixels are composited over")
+    parser.add_argument("--prefix", default="Img_", help="prefix of the C names")
+    args = parser.parse_args()
+    if not 2 <= args.colors <= 256:
+        sys.exit("--colors must be between 2 and 256")
+    background = tuple(int(args.background[i:i + 2], 16) for i in (0, 2, 4))
+    os.makedirs(args.out, exist_ok=True)
+
+    rows = []
+    for path in args.assets:
+        with open(path, "rb") as asset:
+            magic = asset.read(8)
+        if magic == PNG_SIGNATURE:
+            width, height, pixels = load_png(path, background)
+        else:
+            width, height, pixels = load_bmp(path)
+        if not 0 < width <= 0xFFFF or not 0 < height <= 0xFFFF:
+            sys.exit("%s: unsupported size %dx%d" % (path, width, height))
+
+        best = min(candidates(pixels, width, height, args), key=size_of)
+        fmt, data, palette, bits = best
+        name = c_name(args.prefix, path)
+        write_image(args.out, name, os.path.basename(path), width, height, data, palette, fmt, bits)
+        rows.append((name, os.path.basename(path), fmt, width, height, len(data),
+                     2 * len(palette) if palette else 0))
+
+    with open(os.path.join(args.out, "manifest.csv"), "w") as manifest:
+        manifest.write("name,source,format,width,height,data_bytes,palette_bytes,total_bytes\n")
+        for row in rows:
+            manifest.write("%s,%s,%s,%d,%d,%d,%d,%d\n" % (row + (row[5] + row[6],)))
+
+    print("%-24s %-8s %9s %9s %7s" % ("asset", "format", "size", "flash", "ratio"))
+    for name, _, fmt, width, height, data, pal in rows:
+        print("%-24s %-8s %9s %9d %6.1f:1"
+              % (name, fmt, "%dx%d" % (width, height), data + pal, 2.0 * width * height / (data + pal)))
+    print("%-24s %-8s %9s %9d" % ("total", "", "", sum(r[5] + r[6] for r in rows)))
+
+
+if __name__ == "__main__":
+    main()
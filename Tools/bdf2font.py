@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+"""
+@file bdf2font.py
+@brief Converts a BDF bitmap font to the compact TFT_Font_t format of the TFT core.
+
+Each glyph is cropped to the bounding box of its inked pixels and packed row after row,
+without padding, 1 or 2 bits per pixel, most significant bits first. The output is a C
+source file and its header, ready to be built with the application.
+
+2-bpp anti-aliased fonts are produced from a BDF drawn at twice the wanted size: every
+2x2 block of the source is reduced to one pixel whose level (0..3) is the rounded
+coverage of the block.
+
+@date 17 Oct 2026
+@version V01
+@author Mahmoud Abdelraouf Mahmoud
+
+Usage:
+    bdf2font.py font.bdf Font_Terminus12 [--bpp 1|2] [--first 32] [--last 126] [-o out_dir]
+"""
+
+import argparse
+import os
+import sys
+
+
+def parse_bdf(path):
+    """Return (ascent, descent, {code: glyph}) where a glyph is a dict with the BDF metrics
+    and its rows as lists of 0/1."""
+    ascent = descent = None
+    glyphs = {}
+    glyph = None
+    rows = None
+
+    with open(path, "r", encoding="latin-1") as bdf:
+        for line in bdf:
+            words = line.split()
+            if not words:
+                continue
+            key = words[0]
+
+            if rows is not None:
+                if key == "ENDCHAR":
+                    glyph["rows"] = rows
+                    if glyph.get("code", -1) >= 0:
+                        glyphs[glyph["code"]] = glyph
+                    glyph = rows = None
+                else:
+                    bits = bin(int(key, 16))[2:].zfill(len(key) * 4)
+                    rows.append([int(b) for b in bits[:glyph["w"]]])
+            elif key == "FONT_ASCENT":
+                ascent = int(words[1])
+            elif key == "FONT_DESCENT":
+                descent = int(words[1])
+            elif key == "STARTCHAR":
+                glyph = {}
+            elif key == "ENCODING" and glyph is not None:
+                glyph["code"] = int(words[1])
+            elif key == "DWIDTH" and glyph is not None:
+                glyph["advance"] = int(words[1])
+            elif key == "BBX" and glyph is not None:
+                glyph["w"], glyph["h"], glyph["xoff"], glyph["yoff"] = (int(v) for v in words[1:5])
+            elif key == "BITMAP" and glyph is not None:
+                rows = []
+
+    if ascent is None or descent is None:
+        sys.exit("%s: FONT_ASCENT/FONT_DESCENT missing" % path)
+    return ascent, descent, glyphs
+
+
+def place(glyph, ascent):
+    """Return {(x, y): 1} of the inked pixels, x from the pen, y from the top of the line."""
+    top = ascent - (glyph["yoff"] + glyph["h"])
+    return {(glyph["xoff"] + x, top + y): 1
+            for y, row in enumerate(glyph["rows"]) for x, bit in enumerate(row) if bit}
+
+
+def downsample(pixels):
+    """Reduce 2x2 blocks to one pixel with a 0..3 coverage level."""
+    counts = {}
+    for (x, y) in pixels:
+        key = (x // 2, y // 2)
+        counts[key] = counts.get(key, 0) + 1
+    levels = {key: (count * 3 + 2) // 4 for key, count in counts.items()}
+    return {key: level for key, level in levels.items() if level}
+
+
+def crop(pixels):
+    """Return (xoff, yoff, width, height, rows) of the tight bounding box."""
+    if not pixels:
+        return 0, 0, 0, 0, []
+    xs = [x for x, _ in pixels]
+    ys = [y for _, y in pixels]
+    x0, y0 = min(xs), min(ys)
+    width, height = max(xs) - x0 + 1, max(ys) - y0 + 1
+    rows = [[pixels.get((x0 + x, y0 + y), 0) for x in range(width)] for y in range(height)]
+    return x0, y0, width, height, rows
+
+
+def pack(rows, bpp):
+    """Pack the rows without padding, most significant bits first."""
+    out = bytearray()
+    acc = nbits = 0
+    for row in rows:
+        for value in row:
+            acc = (acc << bpp) | value
+            nbits += bpp
+            if nbits == 8:
+                out.append(acc)
+                acc = nbits = 0
+    if nbits:
+        out.append(acc << (8 - nbits))
+    return bytes(out)
+
+
+def check_range(name, value, low, high, code):
+    if not low <= value <= high:
+        sys.exit("glyph %d: %s %d does not fit the font format" % (code, name, value))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a BDF font to a TFT_Font_t.")
+    parser.add_argument("bdf", help="input BDF font")
+    parser.add_argument("name", help="C name of the font, e.g. Font_Terminus12")
+    parser.add_argument("--bpp", type=int, choices=(1, 2), default=1,
+                        help="bits per pixel; 2 expects a BDF drawn at twice the size")
+    parser.add_argument("--first", type=int, default=32, help="first character code")
+    parser.add_argument("--last", type=int, default=126, help="last character code")
+    parser.add_argument("-o", "--out", default=".", help="output directory")
+    args = parser.parse_args()
+
+    ascent, descent, glyphs = parse_bdf(args.bdf)
+    scale = 2 if args.bpp == 2 else 1
+    line_height = (ascent + descent + scale - 1) // scale
+
+    bitmap = bytearray()
+    entries = []
+    for code in range(args.first, args.last + 1):
+        glyph = glyphs.get(code)
+        if glyph is None:
+            entries.append((0, 0, 0, 0, 0, 0, code))
+            continue
+
+        pixels = place(glyph, ascent)
+        if args.bpp == 2:
+            pixels = downsample(pixels)
+        xoff, yoff, width, height, rows = crop(pixels)
+        advance = (glyph["advance"] + scale - 1) // scale
+
+        check_range("width", width, 0, 255, code)
+        check_range("height", height, 0, 255, code)
+        check_range("advance", advance, 0, 255, code)
+        check_range("x offset", xoff, -128, 127, code)
+        check_range("y offset", yoff, -128, 127, code)
+        check_range("bitmap offset", len(bitmap), 0, 0xFFFF, code)
+
+        entries.append((len(bitmap), width, height, advance, xoff, yoff, code))
+        bitmap += pack(rows, args.bpp)
+
+    guard = "__%s_H__" % args.name.upper()
+    with open(os.path.join(args.out, args.name + ".h"), "w") as header:
+        header.write("/**\n * @file %s.h\n * @brief %s, generated by bdf2font.py from %s.\n */\n\n"
+                     % (args.name, args.name, os.path.basename(args.bdf)))
+        header.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+        header.write("extern const TFT_Font_t %s;\n\n#endif /**< %s */\n" % (args.name, guard))
+
+    with open(os.path.join(args.out, args.name + ".c"), "w") as source:
+        source.write("/**\n * @file %s.c\n * @brief %s, generated by bdf2font.py from %s.\n"
+                     " *\n * %d-bpp, characters %d..%d, line height %d px, %d bytes of bitmap.\n */\n\n"
+                     % (args.name, args.name, os.path.basename(args.bdf), args.bpp,
+                        args.first, args.last, line_height, len(bitmap)))
+        source.write('#include "STD_TYPES.h"\n#include "SPI_interface.h"\n'
+                     '#include "TFT_interface.h"\n#include "%s.h"\n\n' % args.name)
+
+        source.write("static const u8 %s_Bitmap[] =\n{\n" % args.name)
+        for start in range(0, max(len(bitmap), 1), 16):
+            chunk = bitmap[start:start + 16] or b"\x00"
+            source.write("    " + ", ".join("0x%02X" % b for b in chunk) + ",\n")
+        source.write("};\n\n")
+
+        source.write("static const TFT_Glyph_t %s_Glyphs[] =\n{\n" % args.name)
+        for offset, width, height, advance, xoff, yoff, code in entries:
+            label = "'%s'" % chr(code) if 32 < code < 127 and chr(code) not in "\\'" else "0x%02X" % code
+            source.write("    { %5d, %3d, %3d, %3d, %4d, %4d },   /**< %s */\n"
+                         % (offset, width, height, advance, xoff, yoff, label))
+        source.write("};\n\n")
+
+        source.write("const TFT_Font_t %s =\n{\n" % args.name)
+        source.write("    .TFT_Bitmap       = %s_Bitmap,\n" % args.name)
+        source.write("    .TFT_Glyphs       = %s_Glyphs,\n" % args.name)
+        source.write("    .TFT_FirstChar    = %d,\n" % args.first)
+        source.write("    .TFT_LastChar     = %d,\n" % args.last)
+        source.write("    .TFT_LineHeight   = %d,\n" % line_height)
+        source.write("    .TFT_BitsPerPixel = %d\n};\n" % args.bpp)
+
+
+if __name__ == "__main__":
+    main()
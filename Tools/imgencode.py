@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+@file imgencode.py
+@brief Encodes a BMP image to the compressed TFT_Image_t format of the TFT core.
+
+The pixels are converted to RGB565 and encoded row by row as run and literal packets
+(see TFT_Image_t in TFT_interface.h). When the image has at most 256 distinct colors the
+pixel values are palette indices, otherwise they are RGB565 colors.
+
+The functions of this file are also used by the asset pipeline.
+
+@date 17 Oct 2026
+@version V01
+@author Mahmoud Abdelraouf Mahmoud
+
+Usage:
+    imgencode.py image.bmp Img_Logo [--palette auto|on|off] [-o out_dir]
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+MAX_PACKET = 128
+
+
+def load_bmp(path):
+    """Return (width, height, pixels) of an uncompressed 24/32-bit BMP, pixels as (r, g, b)
+    rows from the top."""
+    with open(path, "rb") as bmp:
+        data = bmp.read()
+    if data[:2] != b"BM":
+        sys.exit("%s: not a BMP file" % path)
+    offset = struct.unpack_from("<I", data, 10)[0]
+    width, height, _, bits, compression = struct.unpack_from("<iiHHI", data, 18)
+    if bits not in (24, 32) or compression not in (0, 3):
+        sys.exit("%s: only uncompressed 24/32-bit BMP files are supported" % path)
+
+    top_down = height < 0
+    height = abs(height)
+    step = bits // 8
+    stride = (width * step + 3) & ~3
+    rows = []
+    for y in range(height):
+        base = offset + (y if top_down else height - 1 - y) * stride
+        rows.append([(data[base + x * step + 2], data[base + x * step + 1], data[base + x * step])
+                     for x in range(width)])
+    return width, height, [p for row in rows for p in row]
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def encode_rle(values, value_size):
+    """Encode a list of pixel values (ints) as run/literal packets.
+
+    value_size is the number of bytes of a value: 1 for palette indices, 2 for RGB565."""
+    out = bytearray()
+    literal = []
+    min_run = 3 if value_size == 1 else 2
+
+    def put(value):
+        out.extend(value.to_bytes(value_size, "big"))
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_PACKET]
+            del literal[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            for value in chunk:
+                put(value)
+
+    i = 0
+    while i < len(values):
+        run = 1
+        while i + run < len(values) and run < MAX_PACKET and values[i + run] == values[i]:
+            run += 1
+        if run >= min_run:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            put(values[i])
+            i += run
+        else:
+            literal.append(values[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def encode_image(colors, palette_mode="auto"):
+    """Return (data, palette) for a list of RGB565 colors; palette is None for direct colors."""
+    distinct = sorted(set(colors))
+    use_palette = palette_mode == "on" or (palette_mode == "auto" and len(distinct) <= 256)
+    if use_palette and len(distinct) > 256:
+        sys.exit("image has %d colors, a palette holds at most 256" % len(distinct))
+    if not use_palette:
+        return encode_rle(colors, 2), None
+    index = {color: i for i, color in enumerate(distinct)}
+    return encode_rle([index[c] for c in colors], 1), distinct
+
+
+def write_c_array(out, ctype, name, values, fmt, per_line):
+    out.write("static const %s %s[] =\n{\n" % (ctype, name))
+    for start in range(0, len(values), per_line):
+        out.write("    " + ", ".join(fmt % v for v in values[start:start + per_line]) + ",\n")
+    out.write("};\n\n")
+
+
+def write_image(out_dir, name, source, width, height, data, palette, fmt="RLE", index_bits=0):
+    """Write <name>.c and <name>.h defining a const TFT_Image_t.
+
+    fmt is the TFT_ImageFormat_t without its prefix: RLE, RGB565, RGB444 or INDEXED."""
+    guard = "__%s_H__" % name.upper()
+    with open(os.path.join(out_dir, name + ".h"), "w") as header:
+        header.write("/**\n * @file %s.h\n * @brief %s, generated from %s.\n */\n\n" % (name, name, source))
+        header.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+        header.write("extern const TFT_Image_t %s;\n\n#endif /**< %s */\n" % (name, guard))
+
+    with open(os.path.join(out_dir, name + ".c"), "w") as c:
+        c.write("/**\n * @file %s.c\n * @brief %s, generated from %s.\n *\n"
+                " * %dx%d, %s, %s, %d bytes.\n */\n\n"
+                % (name, name, source, width, height, fmt,
+                   "%d-color palette" % len(palette) if palette else "no palette",
+                   len(data) + (2 * len(palette) if palette else 0)))
+        c.write('#include "STD_TYPES.h"\n#include "SPI_interface.h"\n'
+                '#include "TFT_interface.h"\n#include "%s.h"\n\n' % name)
+        write_c_array(c, "u8", name + "_Data", data, "0x%02X", 16)
+        if palette:
+            write_c_array(c, "u16", name + "_Palette", palette, "0x%04X", 8)
+        c.write("const TFT_Image_t %s =\n{\n" % name)
+        c.write("    .TFT_Data      = %s_Data,\n" % name)
+        c.write("    .TFT_Palette   = %s,\n" % (name + "_Palette" if palette else "NULL"))
+        c.write("    .TFT_Width     = %d,\n" % width)
+        c.write("    .TFT_Height    = %d,\n" % height)
+        c.write("    .TFT_Format    = TFT_IMAGE_%s,\n" % fmt)
+        c.write("    .TFT_IndexBits = %d\n};\n" % index_bits)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Encode a BMP image to a TFT_Image_t.")
+    parser.add_argument("image", help="input 24/32-bit BMP")
+    parser.add_argument("name", help="C name of the image, e.g. Img_Logo")
+    parser.add_argument("--palette", choices=("auto", "on", "off"), default="auto",
+                        help="palette indices instead of RGB565 values (default: when <= 256 colors)")
+    parser.add_argument("-o", "--out", default=".", help="output directory")
+    args = parser.parse_args()
+
+    width, height, pixels = load_bmp(args.image)
+    if not 0 < width <= 0xFFFF or not 0 < height <= 0xFFFF:
+        sys.exit("%s: unsupported size %dx%d" % (args.image, width, height))
+    colors = [rgb565(*p) for p in pixels]
+    data, palette = encode_image(colors, args.palette)
+    write_image(args.out, args.name, os.path.basename(args.image), width, height, data, palette)
+
+    raw = 2 * width * height
+    size = len(data) + (2 * len(palette) if palette else 0)
+    print("%s: %dx%d, raw %d bytes, encoded %d bytes, ratio %.2f:1"
+          % (args.name, width, height, raw, size, raw / size))
+
+
+if __name__ == "__main__":
+    main()